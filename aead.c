@@ -0,0 +1,375 @@
+#include <memory.h>
+#include "aead.h"
+
+typedef unsigned long long PolyWide;
+
+#define AEAD_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define AEAD_GET_LE32(p) \
+    (((unsigned int) (p)[0]      ) | ((unsigned int) (p)[1] <<  8) | \
+     ((unsigned int) (p)[2] << 16) | ((unsigned int) (p)[3] << 24))
+
+#define AEAD_PUT_LE32(p, v) \
+    do { \
+        (p)[0] = (unsigned char) ((v)      ); \
+        (p)[1] = (unsigned char) ((v) >>  8); \
+        (p)[2] = (unsigned char) ((v) >> 16); \
+        (p)[3] = (unsigned char) ((v) >> 24); \
+    } while (0)
+
+#define CHACHA20_QUARTER(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = AEAD_ROTL(d, 16); \
+        c += d; b ^= c; b = AEAD_ROTL(b, 12); \
+        a += b; d ^= a; d = AEAD_ROTL(d,  8); \
+        c += d; b ^= c; b = AEAD_ROTL(b,  7); \
+    } while (0)
+
+#define POLY1305_MASK 0x3ffffffU
+
+/*
+ * Poly1305 state, with the numbers in five limbs of 26 bits, so that all
+ * the products fit in 64 bits (this is the well known "donna" approach).
+ */
+typedef struct Poly1305 {
+    unsigned int r[5];
+    unsigned int h[5];
+    unsigned int pad[4];
+    unsigned char block[16];
+    unsigned int used;
+} Poly1305;
+
+static void chacha20_block(const unsigned int input[16], unsigned char output[CHACHA20_BLOCK_LEN])
+{
+    unsigned int x[16];
+    int j = 0;
+
+    memcpy(x, input, sizeof(x));
+    for (j = 0; j < 10; ++j) {
+        /* column rounds */
+        CHACHA20_QUARTER(x[0], x[4], x[ 8], x[12]);
+        CHACHA20_QUARTER(x[1], x[5], x[ 9], x[13]);
+        CHACHA20_QUARTER(x[2], x[6], x[10], x[14]);
+        CHACHA20_QUARTER(x[3], x[7], x[11], x[15]);
+        /* diagonal rounds */
+        CHACHA20_QUARTER(x[0], x[5], x[10], x[15]);
+        CHACHA20_QUARTER(x[1], x[6], x[11], x[12]);
+        CHACHA20_QUARTER(x[2], x[7], x[ 8], x[13]);
+        CHACHA20_QUARTER(x[3], x[4], x[ 9], x[14]);
+    }
+    for (j = 0; j < 16; ++j) {
+        unsigned int v = x[j] + input[j];
+        AEAD_PUT_LE32(output + 4 * j, v);
+    }
+}
+
+static void chacha20_setup(unsigned int state[16],
+                           const unsigned char key[AEAD_KEY_LEN],
+                           unsigned int counter,
+                           const unsigned char nonce[AEAD_NONCE_LEN])
+{
+    int j = 0;
+
+    /* "expand 32-byte k" */
+    state[0] = 0x61707865U;
+    state[1] = 0x3320646eU;
+    state[2] = 0x79622d32U;
+    state[3] = 0x6b206574U;
+    for (j = 0; j < 8; ++j) {
+        state[4 + j] = AEAD_GET_LE32(key + 4 * j);
+    }
+    state[12] = counter;
+    for (j = 0; j < 3; ++j) {
+        state[13 + j] = AEAD_GET_LE32(nonce + 4 * j);
+    }
+}
+
+void chacha20_xor(const unsigned char key[AEAD_KEY_LEN],
+                  unsigned int counter,
+                  const unsigned char nonce[AEAD_NONCE_LEN],
+                  const unsigned char* src, unsigned int len,
+                  unsigned char* tgt)
+{
+    unsigned int state[16];
+    unsigned char stream[CHACHA20_BLOCK_LEN];
+    unsigned int pos = 0;
+
+    chacha20_setup(state, key, counter, nonce);
+    while (pos < len) {
+        unsigned int left = len - pos;
+        unsigned int todo = left < CHACHA20_BLOCK_LEN ? left : CHACHA20_BLOCK_LEN;
+        unsigned int j = 0;
+
+        chacha20_block(state, stream);
+        ++state[12];
+        for (j = 0; j < todo; ++j) {
+            tgt[pos + j] = src[pos + j] ^ stream[j];
+        }
+        pos += todo;
+    }
+}
+
+static void poly1305_init(Poly1305* poly, const unsigned char key[32])
+{
+    int j = 0;
+
+    /* r is "clamped", clearing some of its bits */
+    poly->r[0] = (AEAD_GET_LE32(key +  0)     ) & 0x3ffffffU;
+    poly->r[1] = (AEAD_GET_LE32(key +  3) >> 2) & 0x3ffff03U;
+    poly->r[2] = (AEAD_GET_LE32(key +  6) >> 4) & 0x3ffc0ffU;
+    poly->r[3] = (AEAD_GET_LE32(key +  9) >> 6) & 0x3f03fffU;
+    poly->r[4] = (AEAD_GET_LE32(key + 12) >> 8) & 0x00fffffU;
+
+    for (j = 0; j < 5; ++j) {
+        poly->h[j] = 0;
+    }
+    for (j = 0; j < 4; ++j) {
+        poly->pad[j] = AEAD_GET_LE32(key + 16 + 4 * j);
+    }
+    poly->used = 0;
+}
+
+/*
+ * Add each 16 byte block (plus a high bit, except for a final partial
+ * block, which already has it) to h, and multiply h by r, modulo 2^130 - 5.
+ */
+static void poly1305_blocks(Poly1305* poly, const unsigned char* msg,
+                            unsigned int len, unsigned int hibit)
+{
+    unsigned int r0 = poly->r[0];
+    unsigned int r1 = poly->r[1];
+    unsigned int r2 = poly->r[2];
+    unsigned int r3 = poly->r[3];
+    unsigned int r4 = poly->r[4];
+    unsigned int s1 = r1 * 5;
+    unsigned int s2 = r2 * 5;
+    unsigned int s3 = r3 * 5;
+    unsigned int s4 = r4 * 5;
+    unsigned int h0 = poly->h[0];
+    unsigned int h1 = poly->h[1];
+    unsigned int h2 = poly->h[2];
+    unsigned int h3 = poly->h[3];
+    unsigned int h4 = poly->h[4];
+
+    while (len >= 16) {
+        PolyWide d0, d1, d2, d3, d4;
+        unsigned int c = 0;
+
+        h0 += (AEAD_GET_LE32(msg +  0)     ) & POLY1305_MASK;
+        h1 += (AEAD_GET_LE32(msg +  3) >> 2) & POLY1305_MASK;
+        h2 += (AEAD_GET_LE32(msg +  6) >> 4) & POLY1305_MASK;
+        h3 += (AEAD_GET_LE32(msg +  9) >> 6) & POLY1305_MASK;
+        h4 += (AEAD_GET_LE32(msg + 12) >> 8) | hibit;
+
+        d0 = (PolyWide) h0 * r0 + (PolyWide) h1 * s4 + (PolyWide) h2 * s3 + (PolyWide) h3 * s2 + (PolyWide) h4 * s1;
+        d1 = (PolyWide) h0 * r1 + (PolyWide) h1 * r0 + (PolyWide) h2 * s4 + (PolyWide) h3 * s3 + (PolyWide) h4 * s2;
+        d2 = (PolyWide) h0 * r2 + (PolyWide) h1 * r1 + (PolyWide) h2 * r0 + (PolyWide) h3 * s4 + (PolyWide) h4 * s3;
+        d3 = (PolyWide) h0 * r3 + (PolyWide) h1 * r2 + (PolyWide) h2 * r1 + (PolyWide) h3 * r0 + (PolyWide) h4 * s4;
+        d4 = (PolyWide) h0 * r4 + (PolyWide) h1 * r3 + (PolyWide) h2 * r2 + (PolyWide) h3 * r1 + (PolyWide) h4 * r0;
+
+        /* partial reduction */
+                     c = (unsigned int) (d0 >> 26); h0 = (unsigned int) d0 & POLY1305_MASK;
+        d1 += c;     c = (unsigned int) (d1 >> 26); h1 = (unsigned int) d1 & POLY1305_MASK;
+        d2 += c;     c = (unsigned int) (d2 >> 26); h2 = (unsigned int) d2 & POLY1305_MASK;
+        d3 += c;     c = (unsigned int) (d3 >> 26); h3 = (unsigned int) d3 & POLY1305_MASK;
+        d4 += c;     c = (unsigned int) (d4 >> 26); h4 = (unsigned int) d4 & POLY1305_MASK;
+        h0 += c * 5; c = h0 >> 26;                  h0 &= POLY1305_MASK;
+        h1 += c;
+
+        msg += 16;
+        len -= 16;
+    }
+
+    poly->h[0] = h0;
+    poly->h[1] = h1;
+    poly->h[2] = h2;
+    poly->h[3] = h3;
+    poly->h[4] = h4;
+}
+
+static void poly1305_update(Poly1305* poly, const unsigned char* msg, unsigned int len)
+{
+    if (!len) {
+        return;
+    }
+
+    /* complete a partial block first */
+    if (poly->used) {
+        unsigned int left = 16 - poly->used;
+        if (len < left) {
+            memcpy(poly->block + poly->used, msg, len);
+            poly->used += len;
+            return;
+        }
+        memcpy(poly->block + poly->used, msg, left);
+        poly1305_blocks(poly, poly->block, 16, 1U << 24);
+        poly->used = 0;
+        msg += left;
+        len -= left;
+    }
+
+    /* whole blocks are processed straight from the message */
+    if (len >= 16) {
+        unsigned int whole = len & ~15U;
+        poly1305_blocks(poly, msg, whole, 1U << 24);
+        msg += whole;
+        len -= whole;
+    }
+
+    memcpy(poly->block, msg, len);
+    poly->used = len;
+}
+
+/*
+ * Add zeros to complete a 16 byte block, as the AEAD construction does
+ * after the additional data and after the ciphertext.
+ */
+static void poly1305_pad16(Poly1305* poly)
+{
+    static const unsigned char zeros[16] = { 0 };
+    if (poly->used) {
+        poly1305_update(poly, zeros, 16 - poly->used);
+    }
+}
+
+static void poly1305_final(Poly1305* poly, unsigned char tag[AEAD_TAG_LEN])
+{
+    unsigned int h0, h1, h2, h3, h4;
+    unsigned int g0, g1, g2, g3, g4;
+    unsigned int c = 0;
+    unsigned int mask = 0;
+    PolyWide f = 0;
+
+    /* a final partial block gets a 1 after its last byte */
+    if (poly->used) {
+        poly->block[poly->used++] = 1;
+        memset(poly->block + poly->used, 0, 16 - poly->used);
+        poly1305_blocks(poly, poly->block, 16, 0);
+    }
+
+    /* fully carry h */
+    h0 = poly->h[0];
+    h1 = poly->h[1];
+    h2 = poly->h[2];
+    h3 = poly->h[3];
+    h4 = poly->h[4];
+                 c = h1 >> 26; h1 &= POLY1305_MASK;
+    h2 += c;     c = h2 >> 26; h2 &= POLY1305_MASK;
+    h3 += c;     c = h3 >> 26; h3 &= POLY1305_MASK;
+    h4 += c;     c = h4 >> 26; h4 &= POLY1305_MASK;
+    h0 += c * 5; c = h0 >> 26; h0 &= POLY1305_MASK;
+    h1 += c;
+
+    /* compute g = h + -p = h - (2^130 - 5) */
+    g0 = h0 + 5; c = g0 >> 26; g0 &= POLY1305_MASK;
+    g1 = h1 + c; c = g1 >> 26; g1 &= POLY1305_MASK;
+    g2 = h2 + c; c = g2 >> 26; g2 &= POLY1305_MASK;
+    g3 = h3 + c; c = g3 >> 26; g3 &= POLY1305_MASK;
+    g4 = h4 + c - (1U << 26);
+
+    /* select h if h < p, or g otherwise, without branching */
+    mask = (g4 >> 31) - 1;
+    g0 &= mask;
+    g1 &= mask;
+    g2 &= mask;
+    g3 &= mask;
+    g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    /* h = h % 2^128, then add pad */
+    h0 = (h0      ) | (h1 << 26);
+    h1 = (h1 >>  6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 <<  8);
+
+    f = (PolyWide) h0 + poly->pad[0]            ; h0 = (unsigned int) f;
+    f = (PolyWide) h1 + poly->pad[1] + (f >> 32); h1 = (unsigned int) f;
+    f = (PolyWide) h2 + poly->pad[2] + (f >> 32); h2 = (unsigned int) f;
+    f = (PolyWide) h3 + poly->pad[3] + (f >> 32); h3 = (unsigned int) f;
+
+    AEAD_PUT_LE32(tag +  0, h0);
+    AEAD_PUT_LE32(tag +  4, h1);
+    AEAD_PUT_LE32(tag +  8, h2);
+    AEAD_PUT_LE32(tag + 12, h3);
+}
+
+void poly1305_mac(const unsigned char key[32],
+                  const unsigned char* msg, unsigned int len,
+                  unsigned char tag[AEAD_TAG_LEN])
+{
+    Poly1305 poly;
+    poly1305_init(&poly, key);
+    poly1305_update(&poly, msg, len);
+    poly1305_final(&poly, tag);
+}
+
+/*
+ * Compute the AEAD tag for some additional data and ciphertext.
+ */
+static void aead_tag(const unsigned char key[AEAD_KEY_LEN],
+                     const unsigned char nonce[AEAD_NONCE_LEN],
+                     const unsigned char* aad, unsigned int alen,
+                     const unsigned char* ct, unsigned int len,
+                     unsigned char tag[AEAD_TAG_LEN])
+{
+    static const unsigned char zeros[32] = { 0 };
+    unsigned char otk[32];
+    unsigned char lengths[16];
+    Poly1305 poly;
+
+    /* the one-time Poly1305 key is the start of block 0 */
+    chacha20_xor(key, 0, nonce, zeros, 32, otk);
+
+    /* lengths are 64-bit little endian numbers */
+    memset(lengths, 0, sizeof(lengths));
+    AEAD_PUT_LE32(lengths + 0, alen);
+    AEAD_PUT_LE32(lengths + 8, len);
+
+    poly1305_init(&poly, otk);
+    poly1305_update(&poly, aad, alen);
+    poly1305_pad16(&poly);
+    poly1305_update(&poly, ct, len);
+    poly1305_pad16(&poly);
+    poly1305_update(&poly, lengths, 16);
+    poly1305_final(&poly, tag);
+}
+
+void aead_seal(const unsigned char key[AEAD_KEY_LEN],
+               const unsigned char nonce[AEAD_NONCE_LEN],
+               const unsigned char* aad, unsigned int alen,
+               const unsigned char* src, unsigned int len,
+               unsigned char* tgt,
+               unsigned char tag[AEAD_TAG_LEN])
+{
+    /* the data is encrypted starting with block 1 */
+    chacha20_xor(key, 1, nonce, src, len, tgt);
+    aead_tag(key, nonce, aad, alen, tgt, len, tag);
+}
+
+int aead_open(const unsigned char key[AEAD_KEY_LEN],
+              const unsigned char nonce[AEAD_NONCE_LEN],
+              const unsigned char* aad, unsigned int alen,
+              const unsigned char* src, unsigned int len,
+              const unsigned char tag[AEAD_TAG_LEN],
+              unsigned char* tgt)
+{
+    unsigned char computed[AEAD_TAG_LEN];
+    unsigned char diff = 0;
+    int j = 0;
+
+    aead_tag(key, nonce, aad, alen, src, len, computed);
+    for (j = 0; j < AEAD_TAG_LEN; ++j) {
+        diff |= computed[j] ^ tag[j];
+    }
+    if (diff) {
+        return 0;
+    }
+
+    chacha20_xor(key, 1, nonce, src, len, tgt);
+    return 1;
+}
@@ -0,0 +1,59 @@
+#ifndef AEAD_H_
+#define AEAD_H_
+
+/*
+ * ChaCha20 and Poly1305, and the AEAD (authenticated encryption with
+ * associated data) built with them, exactly as described in RFC 8439.  This
+ * is a plain implementation, with no dependencies; we assume an unsigned int
+ * has (at least) 32 bits, and use unsigned long long for the products in
+ * Poly1305, as every compiler Perl is built with supports it.
+ */
+
+#define AEAD_KEY_LEN   32
+#define AEAD_NONCE_LEN 12
+#define AEAD_TAG_LEN   16
+
+#define CHACHA20_BLOCK_LEN 64
+
+/*
+ * XOR len bytes from src with the ChaCha20 key stream for a key, nonce and
+ * initial block counter, writing them to tgt (which can be the same as src).
+ */
+void chacha20_xor(const unsigned char key[AEAD_KEY_LEN],
+                  unsigned int counter,
+                  const unsigned char nonce[AEAD_NONCE_LEN],
+                  const unsigned char* src, unsigned int len,
+                  unsigned char* tgt);
+
+/*
+ * Compute the Poly1305 tag for a message with a one-time key.
+ */
+void poly1305_mac(const unsigned char key[32],
+                  const unsigned char* msg, unsigned int len,
+                  unsigned char tag[AEAD_TAG_LEN]);
+
+/*
+ * Encrypt len bytes from src into tgt (which can be the same as src), and
+ * compute the tag for the ciphertext and the additional data.
+ */
+void aead_seal(const unsigned char key[AEAD_KEY_LEN],
+               const unsigned char nonce[AEAD_NONCE_LEN],
+               const unsigned char* aad, unsigned int alen,
+               const unsigned char* src, unsigned int len,
+               unsigned char* tgt,
+               unsigned char tag[AEAD_TAG_LEN]);
+
+/*
+ * Check the tag for len bytes of ciphertext in src and the additional data;
+ * if it is valid, decrypt them into tgt (which can be the same as src) and
+ * return non-zero, otherwise return zero without touching tgt.  The tags
+ * are compared in constant time.
+ */
+int aead_open(const unsigned char key[AEAD_KEY_LEN],
+              const unsigned char nonce[AEAD_NONCE_LEN],
+              const unsigned char* aad, unsigned int alen,
+              const unsigned char* src, unsigned int len,
+              const unsigned char tag[AEAD_TAG_LEN],
+              unsigned char* tgt);
+
+#endif
@@ -0,0 +1,4162 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of baker.xs. Do not edit this file, edit baker.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "baker.xs"
+#define PERL_NO_GET_CONTEXT     /* we want efficiency */
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+#include <string.h>
+#include "buffer.h"
+#include "scratch.h"
+#include "uri.h"
+#include "scan.h"
+#include "cookie.h"
+#include "pairs.h"
+#include "names.h"
+#include "parser.h"
+#include "date.h"
+#include "sign.h"
+#include "seal.h"
+#include "pack.h"
+#include "compress.h"
+#include "psl.h"
+#include "jar.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#define snprintf    _snprintf
+#define vsnprintf   _vsnprintf
+#define strcasecmp  _stricmp
+#define strncasecmp _strnicmp
+#else
+#include <strings.h>
+#endif
+
+
+/*
+ * Possible field names in a cookie.
+ */
+#define COOKIE_NAME_VALUE      "value"
+#define COOKIE_NAME_DOMAIN     "Domain"
+#define COOKIE_NAME_PATH       "Path"
+#define COOKIE_NAME_MAX_AGE    "Max-Age"
+#define COOKIE_NAME_EXPIRES    "Expires"
+#define COOKIE_NAME_SECURE     "Secure"
+#define COOKIE_NAME_HTTP_ONLY  "HttpOnly"
+#define COOKIE_NAME_SAME_SITE  "SameSite"
+
+/*
+ * Not fields: flags that ask for the value to be packed (see pack.h) or
+ * compressed (see compress.h).
+ */
+#define COOKIE_NAME_PACKED     "packed"
+#define COOKIE_NAME_COMPRESS   "compress"
+
+/*
+ * Per-interpreter data.
+ */
+#define MY_CXT_KEY "HTTP::XSCookies::_guts" XS_VERSION
+
+typedef struct {
+    DateCache date_cache;   /* last formatted Expires date */
+    Scratch scratch;        /* scratch buffers, reused by all calls */
+    SignKey sign_key;       /* last key used to sign cookies */
+    SealNonces seal_nonces; /* nonces to seal cookies */
+} my_cxt_t;
+
+START_MY_CXT
+
+/*
+ * Scratch buffers come from a per-interpreter pool (see scratch.h), so
+ * that once the pool has warmed up we allocate no memory for them.  Each
+ * function gives back the buffers it takes; XSUBs that can run Perl code
+ * (magic, overloading) while holding buffers use SCRATCH_ENTER / LEAVE,
+ * so that the buffers are also given back if that code dies.
+ */
+static Scratch* get_scratch(pTHX)
+{
+    dMY_CXT;
+    return &MY_CXT.scratch;
+}
+
+static void scratch_unwind(pTHX_ void* mark)
+{
+    scratch_release(get_scratch(aTHX), (unsigned int) PTR2UV(mark));
+}
+
+static void scratch_destroy(pTHX_ void* unused)
+{
+    PERL_UNUSED_VAR(unused);
+    scratch_fini(get_scratch(aTHX));
+}
+
+#define SCRATCH_ENTER(scratch) \
+    do { \
+        ENTER; \
+        SAVEDESTRUCTOR_X(scratch_unwind, INT2PTR(void*, (UV) scratch_mark(scratch))); \
+    } while (0)
+
+#define SCRATCH_LEAVE() \
+    LEAVE
+
+/*
+ * A lazily crushed cookie: when created, we only build an index of the
+ * pairs in the cookie, and each value is decoded the first time it is
+ * fetched.  This is the object behind the (tied) hash returned by
+ * crush_cookie_lazy().
+ */
+typedef struct LazyCookie {
+    SV* str;            /* private (COW if possible) copy of the cookie */
+    AV* values;         /* values already decoded, by position in index */
+    unsigned int iter;  /* current position for FIRSTKEY / NEXTKEY */
+    PairIndex index;
+} LazyCookie;
+
+typedef LazyCookie* HTTP__XSCookies__Lazy;
+typedef NameSet* HTTP__XSCookies__NameSet;
+
+/*
+ * A cookie being crushed incrementally, as its chunks arrive; this is the
+ * object behind HTTP::XSCookies::Parser.  The pairs parsed so far are kept
+ * in a hash, with the same rules as crush_cookie().
+ */
+typedef struct CookieStream {
+    CookieParser parser;
+    HV* crushed;
+    int allow_no_value;
+} CookieStream;
+
+typedef CookieStream* HTTP__XSCookies__Parser;
+
+/*
+ * A template to bake many cookies with the same attributes: the attributes
+ * are rendered once, when the template is created, and baking a cookie just
+ * needs to encode its name and value and append the rendered attributes.
+ * An Expires attribute relative to the current time is rendered every time.
+ */
+typedef struct CookieTemplate {
+    Buffer tail;        /* all attributes, already rendered */
+    SV* expires;        /* relative Expires attribute, if any */
+} CookieTemplate;
+
+typedef CookieTemplate* HTTP__XSCookies__Template;
+
+typedef Jar* HTTP__XSCookies__Jar;
+
+/*
+ * How to protect a value when baking a cookie: sign it with a key for
+ * HMAC-SHA256 (see sign.h) or seal it with a key for ChaCha20-Poly1305
+ * (see seal.h).
+ */
+typedef struct CookieGuard {
+    const HmacSha256* sign;
+    const unsigned char* seal;
+} CookieGuard;
+
+static void get_encoded_value(pTHX_ SV* value, Buffer* encoded, int encode)
+{
+    SV* ref = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+
+    Buffer unencoded;
+    buffer_reset(encoded);
+
+    /* common case: just a string */
+    if (!SvROK(value)) {
+        vstr = SvPV_const(value, vlen);
+        buffer_wrap(&unencoded, vstr, vlen);
+        if (encode) {
+            url_encode(&unencoded, encoded);
+        } else {
+            buffer_append_buf(encoded, &unencoded);
+        }
+        return;
+    }
+
+    /* less common case: a reference => multiple values */
+    ref = SvRV(value);
+    if (SvTYPE(ref) == SVt_PVAV) {
+        AV* values = (AV*) ref;
+        int count = 0;
+        Scratch* scratch = get_scratch(aTHX);
+        unsigned int mark = scratch_mark(scratch);
+        Buffer* joined = scratch_get(scratch);
+        while (1) {
+            SV* elem = av_shift(values);
+            if (!elem || elem == &PL_sv_undef) {
+                break;
+            }
+            if (!SvOK(elem) || !SvPOK(elem)) {
+                continue;
+            }
+            vstr = SvPV_const(elem, vlen);
+            if (count) {
+                buffer_append_str(joined, "&", 1);
+            }
+            buffer_append_str(joined, vstr, vlen);
+            ++count;
+        }
+        if (encode) {
+            url_encode(joined, encoded);
+        } else {
+            buffer_append_buf(encoded, joined);
+        }
+        scratch_release(scratch, mark);
+    }
+
+    /* don't know (yet) how to deal with other ref types */
+}
+
+/*
+ * Pack a scalar; croak if it is a reference, since we only pack flat
+ * arrays and hashes.
+ */
+static void pack_scalar(pTHX_ SV* value, Buffer* packed)
+{
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    int negative = 0;
+    unsigned long long num = 0;
+
+    if (!SvOK(value)) {
+        pack_put_undef(packed);
+        return;
+    }
+    if (SvROK(value)) {
+        croak("Packed cookie values can only have strings and numbers");
+    }
+
+    vstr = SvPV_const(value, vlen);
+    if (pack_scan_int(vstr, vlen, &negative, &num)) {
+        pack_put_int(packed, negative, num);
+    } else {
+        pack_put_string(packed, vstr, vlen, SvUTF8(value) ? 1 : 0);
+    }
+}
+
+/*
+ * Pack a value, which can be a string, an arrayref or a hashref, and put
+ * it in a buffer in base64url.
+ */
+static void get_packed_value(pTHX_ SV* value, Buffer* encoded)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* packed = scratch_get(scratch);
+    SV* ref = SvROK(value) ? SvRV(value) : 0;
+
+    if (ref && SvTYPE(ref) == SVt_PVAV) {
+        AV* values = (AV*) ref;
+        SSize_t top = av_len(values);
+        SSize_t j = 0;
+        pack_put_list(packed, PACK_TYPE_ARRAY, (unsigned int) (top + 1));
+        for (j = 0; j <= top; ++j) {
+            SV** elem = av_fetch(values, j, 0);
+            pack_scalar(aTHX_ elem ? *elem : &PL_sv_undef, packed);
+        }
+    } else if (ref && SvTYPE(ref) == SVt_PVHV) {
+        /* pack the pairs first, since we only know how many there are
+         * (for example, for a tied hash) after going over them */
+        HV* values = (HV*) ref;
+        Buffer* pairs = scratch_get(scratch);
+        unsigned int count = 0;
+        HE* entry = 0;
+        hv_iterinit(values);
+        while ((entry = hv_iternext(values))) {
+            STRLEN klen = 0;
+            const char* kstr = HePV(entry, klen);
+            pack_put_string(pairs, kstr, klen, HeUTF8(entry) ? 1 : 0);
+            pack_scalar(aTHX_ hv_iterval(values, entry), pairs);
+            ++count;
+        }
+        pack_put_list(packed, PACK_TYPE_HASH, count);
+        buffer_append_buf(packed, pairs);
+    } else {
+        pack_scalar(aTHX_ value, packed);
+    }
+
+    buffer_reset(encoded);
+    base64_encode(packed->data, packed->wpos, encoded);
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Create an SV for an item in a packed value; return 0 if the item is not
+ * a valid scalar.
+ */
+static SV* new_packed_sv(pTHX_ const PackItem* item)
+{
+    SV* sv = 0;
+
+    switch (item->type) {
+    case PACK_TYPE_UNDEF:
+        return newSV(0);
+
+    case PACK_TYPE_BYTES:
+        return newSVpvn(item->str, item->len);
+
+    case PACK_TYPE_UTF8:
+        /* is_utf8_string() would use strlen() for an empty string */
+        if (item->len && !is_utf8_string((const U8*) item->str, item->len)) {
+            return 0;
+        }
+        sv = newSVpvn(item->str, item->len);
+        SvUTF8_on(sv);
+        return sv;
+
+    case PACK_TYPE_INT:
+        if (item->negative) {
+            return item->num - 1 <= (unsigned long long) IV_MAX
+                 ? newSViv(-1 - (IV) (item->num - 1))
+                 : newSVnv(-(NV) item->num);
+        }
+        if (item->num <= (unsigned long long) IV_MAX) {
+            return newSViv((IV) item->num);
+        }
+        return item->num <= (unsigned long long) UV_MAX
+             ? newSVuv((UV) item->num)
+             : newSVnv((NV) item->num);
+    }
+
+    return 0;
+}
+
+/*
+ * Unpack a whole packed value into a new SV (a string, an arrayref or a
+ * hashref); return 0 if it is not valid.
+ */
+static SV* unpack_value(pTHX_ Buffer* packed)
+{
+    PackItem item;
+    SV* result = 0;
+    unsigned long long j = 0;
+
+    if (!pack_get_item(packed, &item)) {
+        return 0;
+    }
+
+    if (item.type == PACK_TYPE_ARRAY) {
+        AV* array = 0;
+        /* each element takes at least one byte; checking this first means
+         * a bogus count cannot make us allocate a huge array */
+        if (item.num > buffer_used(packed)) {
+            return 0;
+        }
+        array = newAV();
+        result = newRV_noinc((SV*) array);
+        if (item.num) {
+            av_extend(array, (SSize_t) item.num - 1);
+        }
+        for (j = 0; j < item.num; ++j) {
+            PackItem elem;
+            SV* sv = 0;
+            if (!pack_get_item(packed, &elem) || !(sv = new_packed_sv(aTHX_ &elem))) {
+                SvREFCNT_dec(result);
+                return 0;
+            }
+            av_push(array, sv);
+        }
+    } else if (item.type == PACK_TYPE_HASH) {
+        HV* hash = 0;
+        if (item.num > buffer_used(packed) / 2) {
+            return 0;
+        }
+        hash = newHV();
+        result = newRV_noinc((SV*) hash);
+        for (j = 0; j < item.num; ++j) {
+            PackItem key;
+            PackItem elem;
+            SV* sv = 0;
+            if (!pack_get_item(packed, &key) ||
+                (key.type != PACK_TYPE_BYTES && key.type != PACK_TYPE_UTF8) ||
+                (key.type == PACK_TYPE_UTF8 && key.len &&
+                 !is_utf8_string((const U8*) key.str, key.len)) ||
+                !pack_get_item(packed, &elem) ||
+                !(sv = new_packed_sv(aTHX_ &elem))) {
+                SvREFCNT_dec(result);
+                return 0;
+            }
+            /* a negative length tells hv_store the key is in UTF-8 */
+            hv_store(hash, key.str, key.type == PACK_TYPE_UTF8 ? -(I32) key.len : (I32) key.len, sv, 0);
+        }
+    } else {
+        result = new_packed_sv(aTHX_ &item);
+    }
+
+    /* there can be nothing after the value */
+    if (result && buffer_used(packed)) {
+        SvREFCNT_dec(result);
+        result = 0;
+    }
+    return result;
+}
+
+/*
+ * Add to a cookie the attribute with a given name and value.
+ * Names for unknown attributes are silently ignored.
+ */
+static void put_attribute(pTHX_ Buffer* cookie, const char* kstr,
+                          SV* value, Buffer* encoded)
+{
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    dMY_CXT;
+
+    /* value could be a string or an array, so need to encode it */
+    get_encoded_value(aTHX_ value, encoded, 0);
+    vstr = encoded->data;
+    vlen = encoded->wpos;
+    if (vstr == 0) {
+        return;
+    }
+
+    /* TODO: should we skip if vstr is invalid / empty? */
+
+    if        (strcasecmp(kstr, COOKIE_NAME_DOMAIN) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_DOMAIN   , sizeof(COOKIE_NAME_DOMAIN)      - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_PATH      ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_PATH     , sizeof(COOKIE_NAME_PATH)        - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_MAX_AGE   ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_MAX_AGE  , sizeof(COOKIE_NAME_MAX_AGE)     - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_EXPIRES   ) == 0) {
+        cookie_put_date (cookie, COOKIE_NAME_EXPIRES    , sizeof(COOKIE_NAME_EXPIRES)     - 1, vstr, vlen, &MY_CXT.date_cache);
+    } else if (strcasecmp(kstr, COOKIE_NAME_SECURE    ) == 0) {
+        cookie_put_boolean(cookie, COOKIE_NAME_SECURE   , sizeof(COOKIE_NAME_SECURE)      - 1, SvTRUE(value));
+    } else if (strcasecmp(kstr, COOKIE_NAME_HTTP_ONLY ) == 0) {
+        cookie_put_boolean(cookie, COOKIE_NAME_HTTP_ONLY, sizeof(COOKIE_NAME_HTTP_ONLY)   - 1, SvTRUE(value));
+    } else if (strcasecmp(kstr, COOKIE_NAME_SAME_SITE ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_SAME_SITE  , sizeof(COOKIE_NAME_SAME_SITE) - 1, vstr, vlen, 0, 0);
+    }
+}
+
+/*
+ * Sign or seal the value in a buffer for a cookie with the given name, as
+ * a guard says.
+ */
+static void guard_value(pTHX_ const CookieGuard* guard,
+                        const char* name, unsigned int nlen, Buffer* value)
+{
+    Scratch* scratch = 0;
+    unsigned int mark = 0;
+    Buffer* sealed = 0;
+    int ok = 0;
+    dMY_CXT;
+
+    if (guard->sign) {
+        sign_append(value, name, nlen, guard->sign);
+        return;
+    }
+
+    scratch = get_scratch(aTHX);
+    mark = scratch_mark(scratch);
+    sealed = scratch_get(scratch);
+    ok = seal_append(value, name, nlen, guard->seal, &MY_CXT.seal_nonces, sealed);
+    if (ok) {
+        buffer_reset(value);
+        buffer_append_buf(value, sealed);
+    }
+    scratch_release(scratch, mark);
+    if (!ok) {
+        croak("Could not get random bytes to seal a cookie");
+    }
+}
+
+/*
+ * Compress the value in a buffer, if that makes it shorter than it would
+ * be otherwise (URL-encoded, if encode is non-zero); return whether it
+ * was compressed.
+ */
+static int compress_value(pTHX_ Buffer* value, int encode)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* compressed = scratch_get(scratch);
+    unsigned int limit = encode
+                       ? url_encoded_len(value->data + value->rpos, buffer_used(value))
+                       : buffer_used(value);
+    int ok = compress_append(value, limit, compressed);
+
+    if (ok) {
+        buffer_reset(value);
+        buffer_append_buf(value, compressed);
+    }
+    scratch_release(scratch, mark);
+    return ok;
+}
+
+/*
+ * Given a name and a value, which can be a string or a hashref,
+ * build a cookie with that data.  Buffer encoded is used as scratch
+ * space; this allows reusing it when baking many cookies.  If a guard
+ * is given, the value is signed or sealed as it says.
+ */
+static void build_cookie(pTHX_ SV* pname, SV* pvalue, const CookieGuard* guard,
+                         Buffer* cookie, Buffer* encoded)
+{
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    SV* ref = 0;
+    HV* values = 0;
+    SV** nval = 0;
+    SV** flag = 0;
+    int packed = 0;
+    int compress = 0;
+    int encode = 0;
+
+    /* name not a valid string? bail out */
+    if (!SvOK(pname) || !SvPOK(pname)) {
+        return;
+    }
+
+    /* value not a valid scalar? bail out */
+    if (!SvOK(pvalue)) {
+        return;
+    }
+
+    nstr = SvPV_const(pname, nlen);
+
+    if (SvPOK(pvalue)) {
+        /* value is a simple string */
+        vstr = SvPV_const(pvalue, vlen);
+        if (guard) {
+            buffer_reset(encoded);
+            buffer_append_str(encoded, vstr, vlen);
+            guard_value(aTHX_ guard, nstr, nlen, encoded);
+            vstr = encoded->data;
+            vlen = encoded->wpos;
+        }
+        cookie_put_string(cookie, nstr, nlen, vstr, vlen, 1, 1);
+        return;
+    }
+
+    /* value not a valid ref? bail out */
+    if (!SvROK(pvalue)) {
+        return;
+    }
+
+    /* value not a valid hashref? bail out */
+    ref = SvRV(pvalue);
+    if (SvTYPE(ref) != SVt_PVHV) {
+        return;
+    }
+    values = (HV*) ref;
+
+    /* value for name not there? bail out */
+    nval = hv_fetch(values, COOKIE_NAME_VALUE, sizeof(COOKIE_NAME_VALUE) -1, 0);
+    if (!nval) {
+        return;
+    }
+
+    flag = hv_fetch(values, COOKIE_NAME_PACKED, sizeof(COOKIE_NAME_PACKED) - 1, 0);
+    packed = flag && SvTRUE(*flag);
+    flag = hv_fetch(values, COOKIE_NAME_COMPRESS, sizeof(COOKIE_NAME_COMPRESS) - 1, 0);
+    compress = flag && SvTRUE(*flag);
+
+    /* the length of a sealed value would tell something about its contents,
+     * so don't let secrets be compressed along with other data */
+    if (compress && guard && guard->seal) {
+        croak("Cannot compress a value that will be sealed");
+    }
+
+    /* first store cookie name and value, URL-encoding both; a value to be
+     * compressed, signed or sealed is encoded after that, and a packed or
+     * compressed value is in base64url, which needs no encoding */
+    if (packed) {
+        get_packed_value(aTHX_ *nval, encoded);
+    } else {
+        encode = guard || compress;
+        get_encoded_value(aTHX_ *nval, encoded, !encode);
+    }
+    if (compress && compress_value(aTHX_ encoded, encode)) {
+        encode = 0;
+    }
+    if (guard) {
+        guard_value(aTHX_ guard, nstr, nlen, encoded);
+    }
+    cookie_put_string(cookie, nstr, nlen, encoded->data, encoded->wpos, 1, encode);
+
+    /* now iterate over all other values */
+    hv_iterinit(values);
+    while (nval) {
+        SV* value = 0;
+        I32 klen = 0;
+        char* kstr = 0;
+        HE* entry = hv_iternext(values);
+        if (!entry) {
+            /* no more hash keys */
+            break;
+        }
+
+        kstr = hv_iterkey(entry, &klen);
+        if (!kstr || klen <= 0) {
+            /* invalid key */
+            continue;
+        }
+
+        if (strcmp(kstr, COOKIE_NAME_VALUE) == 0 ||
+            strcmp(kstr, COOKIE_NAME_PACKED) == 0 ||
+            strcmp(kstr, COOKIE_NAME_COMPRESS) == 0) {
+            /* name was already processed */
+            continue;
+        }
+
+        value = hv_iterval(values, entry);
+        if (!SvOK(value)) {
+            continue;
+        }
+
+        put_attribute(aTHX_ cookie, kstr, value, encoded);
+    }
+}
+
+/*
+ * Get the key used to sign cookies, ready to use; croak if there is no
+ * valid key, since a cookie signed with an empty key is not signed at all.
+ */
+static const HmacSha256* get_signing_key(pTHX_ SV* key, const char* func)
+{
+    const char* kstr = 0;
+    STRLEN klen = 0;
+    dMY_CXT;
+
+    if (SvOK(key)) {
+        kstr = SvPV_const(key, klen);
+    }
+    if (!klen) {
+        croak("Key for %s must be a non-empty string", func);
+    }
+    return sign_key_get(&MY_CXT.sign_key, kstr, klen);
+}
+
+/*
+ * Copy the key used to seal cookies; croak if it does not have the right
+ * length.
+ */
+static void get_sealing_key(pTHX_ SV* key, unsigned char copy[AEAD_KEY_LEN], const char* func)
+{
+    const char* kstr = 0;
+    STRLEN klen = 0;
+
+    if (SvOK(key)) {
+        kstr = SvPV_const(key, klen);
+    }
+    if (klen != AEAD_KEY_LEN) {
+        croak("Key for %s must be a string of %d bytes", func, AEAD_KEY_LEN);
+    }
+    memcpy(copy, kstr, AEAD_KEY_LEN);
+}
+
+/*
+ * Get the bytes in an argument for the functions we only use to test the
+ * AEAD primitives; croak if it is not defined or, if we want a given length,
+ * it does not have it.
+ */
+static const unsigned char* get_test_bytes(pTHX_ SV* sv, STRLEN* len, STRLEN want)
+{
+    const char* str = 0;
+    if (!SvOK(sv)) {
+        croak("Undefined argument");
+    }
+    str = SvPV_const(sv, *len);
+    if (want && *len != want) {
+        croak("Argument must be a string of %d bytes", (int) want);
+    }
+    return (const unsigned char*) str;
+}
+
+/*
+ * Render all the attributes in a hash into a template; a relative Expires
+ * attribute is just remembered, to be rendered when baking each cookie.
+ */
+static void build_template(pTHX_ HV* values, CookieTemplate* tmpl)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* encoded = scratch_get(scratch);
+
+    hv_iterinit(values);
+    while (1) {
+        SV* value = 0;
+        I32 klen = 0;
+        char* kstr = 0;
+        HE* entry = hv_iternext(values);
+        if (!entry) {
+            break;
+        }
+
+        kstr = hv_iterkey(entry, &klen);
+        if (!kstr || klen <= 0) {
+            continue;
+        }
+
+        if (strcmp(kstr, COOKIE_NAME_VALUE) == 0) {
+            /* values are given for each cookie */
+            continue;
+        }
+
+        value = hv_iterval(values, entry);
+        if (!SvOK(value)) {
+            continue;
+        }
+
+        if (strcasecmp(kstr, COOKIE_NAME_EXPIRES) == 0 && !SvROK(value)) {
+            STRLEN vlen = 0;
+            const char* vstr = SvPV_const(value, vlen);
+            if (date_is_relative(vstr, vlen)) {
+                tmpl->expires = newSVpvn(vstr, vlen);
+                continue;
+            }
+        }
+
+        put_attribute(aTHX_ &tmpl->tail, kstr, value, encoded);
+    }
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Bake a cookie with a given name and value, using a template.
+ */
+static void bake_template(pTHX_ const CookieTemplate* tmpl,
+                          SV* pname, SV* pvalue, Buffer* cookie)
+{
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    dMY_CXT;
+
+    /* name or value not a valid string? bail out, just like build_cookie() */
+    if (!SvOK(pname) || !SvPOK(pname) || !SvOK(pvalue) || !SvPOK(pvalue)) {
+        return;
+    }
+
+    nstr = SvPV_const(pname, nlen);
+    vstr = SvPV_const(pvalue, vlen);
+    buffer_ensure_unused(cookie, 3 * (nlen + vlen) + 3 + tmpl->tail.wpos);
+    cookie_put_string(cookie, nstr, nlen, vstr, vlen, 1, 1);
+    if (tmpl->tail.wpos) {
+        buffer_append_str(cookie, "; ", 2);
+        buffer_append_str(cookie, tmpl->tail.data, tmpl->tail.wpos);
+    }
+    if (tmpl->expires) {
+        vstr = SvPV_const(tmpl->expires, vlen);
+        cookie_put_date(cookie, COOKIE_NAME_EXPIRES, sizeof(COOKIE_NAME_EXPIRES) - 1, vstr, vlen, &MY_CXT.date_cache);
+    }
+}
+
+static int search_char(char c, const Buffer* buf, int start)
+{
+    const char* found = 0;
+    if ((unsigned int) start >= buf->wpos) {
+        return -1;
+    }
+    found = (const char*) memchr(buf->data + start, c, buf->wpos - start);
+    return found ? (int) (found - buf->data) : -1;
+}
+
+/*
+ * Create an SV for a (URL-decoded) value.  If the value contains any
+ * '&' characters, it is interpreted as multiple values, and we return
+ * an arrayref with each of them; otherwise, we return a simple string.
+ */
+static SV* new_value_sv(pTHX_ const Buffer* value)
+{
+    int pos = 0;
+    AV* array = 0;
+    int key = 0;
+    unsigned int ini = 0;
+    unsigned int end = 0;
+
+    pos = search_char('&', value, value->rpos);
+    if (pos < 0) {
+        /* no & chars? simple string */
+        return newSVpvn(value->data, value->wpos);
+    }
+
+    /* & chars => create arrayref */
+    array = newAV();
+    end = (unsigned int) pos;
+    while (1) {
+        SV* str = 0;
+        if (ini >= value->wpos) {
+            break;
+        }
+        str = sv_2mortal(newSVpvn(value->data + ini, end - ini));
+        if (av_store(array, key, str)) {
+            SvREFCNT_inc(str);
+        }
+        ++key;
+        ini = ++end;
+        pos = search_char('&', value, end);
+        end = pos < 0 ? value->wpos : (unsigned int) pos;
+    }
+    return newRV_noinc((SV*) array);
+}
+
+/*
+ * Copy an SV created by new_value_sv; an arrayref gets its own array, so
+ * that changing one of the copies does not change the other.
+ */
+static SV* copy_value_sv(pTHX_ SV* value)
+{
+    AV* array = 0;
+
+    if (!SvROK(value)) {
+        return newSVsv(value);
+    }
+    array = (AV*) SvRV(value);
+    return newRV_noinc((SV*) av_make(av_len(array) + 1, AvARRAY(array)));
+}
+
+/*
+ * Given a string, parse it as a cookie into its component values
+ * and return a hashref with them.
+ *
+ * Some standard field names have no value associated:
+ *
+ *   Secure
+ *   HttpOnly
+ *
+ * Parameter allow_no_value controls what we do:
+ *
+ * =0: ignore these names, as if they had not been specified
+ * >0: always treat these names as having a value of undef
+ *
+ * If filter is not null, only the (distinct) names in that set are
+ * returned; values for all other names are never copied or decoded, and
+ * we stop parsing as soon as all names in the set have been found.
+ *
+ * If decompress is non-zero, compressed values (see compress.h) are
+ * returned decompressed.
+ *
+ * Buffers name and value are used as scratch space; this allows reusing
+ * them when crushing many cookies.
+ */
+static HV* parse_cookie_buffers(pTHX_ SV* pstr, int allow_no_value, const NameSet* filter,
+                                int decompress, Buffer* name, Buffer* value)
+{
+    /* we will always return a hashref, maybe empty */
+    HV* hv = newHV();
+
+    do {
+        const char* cstr = 0;
+        STRLEN clen = 0;
+        Buffer cookie;
+
+        /* string not valid? bail out */
+        if (!SvOK(pstr) || !SvPOK(pstr)) {
+            break;
+        }
+
+        /* empty string? bail out */
+        cstr = SvPV_const(pstr, clen);
+        if (!cstr || !clen) {
+            break;
+        }
+
+        /* wrap a Buffer around this string, so that we can
+         * more easily work with it */
+        buffer_wrap(&cookie, cstr, clen);
+
+        while (1) {
+            int equals = 0;
+            CookieSpan span;
+            Buffer found;
+
+            /* reset buffers for name / value, avoiding memory reallocation */
+            buffer_reset(name);
+            buffer_reset(value);
+
+            /* get the pair name=value, return whether we saw an equals sign;
+             * when filtering, just get the position of the value */
+            equals = cookie_get_pair_span(&cookie, name, filter ? 0 : value, &span);
+
+            /* got an empty name => ran out of data */
+            if (name->wpos == 0) {
+                break;
+            }
+
+            /* not a name we want? skip it */
+            if (filter && nameset_find(filter, name->data, name->wpos) < 0) {
+                continue;
+            }
+
+            /* only first value seen for a name is kept */
+            if (hv_exists(hv, name->data, name->wpos)) {
+                continue;
+            }
+
+            if (!equals) {
+                /* didn't see an equal sign => name with no value */
+                if (allow_no_value) {
+                    /* store a name => undef pair*/
+                    SV* nil = newSV(0);
+                    hv_store(hv, name->data, name->wpos, nil, 0);
+                }
+            } else {
+                /* a value that needed no decoding was not copied and is
+                 * still in the cookie; otherwise, it is in our buffer,
+                 * unless we skipped it while filtering */
+                if (span.verbatim && span.escaped) {
+                    cookie_get_span_value(&cookie, &span, value);
+                }
+                if (span.verbatim && !span.escaped) {
+                    /* a compressed value is never URL-encoded, and we
+                     * leave it alone if it does not decompress */
+                    if (decompress && span.vlen && cstr[span.vpos] == COMPRESS_MARKER &&
+                        compress_open(cstr + span.vpos, span.vlen, value)) {
+                        buffer_wrap(&found, value->data, value->wpos);
+                    } else {
+                        buffer_wrap(&found, cstr + span.vpos, span.vlen);
+                    }
+                } else {
+                    buffer_wrap(&found, value->data, value->wpos);
+                }
+                hv_store(hv, name->data, name->wpos, new_value_sv(aTHX_ &found), 0);
+            }
+
+            /* found all the names we want? we are done */
+            if (filter && HvUSEDKEYS(hv) >= filter->count) {
+                break;
+            }
+        }
+    } while (0);
+
+    return hv;
+}
+
+static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value, const NameSet* filter,
+                        int decompress)
+{
+    HV* hv = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* name = scratch_get(scratch);
+    Buffer* value = scratch_get(scratch);
+
+    hv = parse_cookie_buffers(aTHX_ pstr, allow_no_value, filter, decompress, name, value);
+
+    scratch_release(scratch, mark);
+    return hv;
+}
+
+/*
+ * Given a string, parse it as a cookie looking for a given name, and
+ * return the value for the first occurrence of that name with a value;
+ * return undef if there is no such value.
+ *
+ * We stop parsing as soon as we find the name, and we only decode the
+ * value we return, so this is faster than crushing the whole cookie.
+ */
+static SV* find_cookie(pTHX_ SV* pstr, SV* pname)
+{
+    SV* found = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+
+    do {
+        const char* cstr = 0;
+        STRLEN clen = 0;
+        const char* nstr = 0;
+        STRLEN nlen = 0;
+        Buffer cookie;
+        Buffer* name = 0;
+
+        /* string or name not valid? bail out */
+        if (!SvOK(pstr) || !SvPOK(pstr) || !SvOK(pname)) {
+            break;
+        }
+
+        /* empty string? bail out */
+        cstr = SvPV_const(pstr, clen);
+        if (!cstr || !clen) {
+            break;
+        }
+        nstr = SvPV_const(pname, nlen);
+
+        buffer_wrap(&cookie, cstr, clen);
+        name = scratch_get(scratch);
+
+        while (1) {
+            int equals = 0;
+            CookieSpan span;
+            Buffer* value = 0;
+
+            /* get the name and where the value is, without copying it */
+            buffer_reset(name);
+            equals = cookie_get_pair_span(&cookie, name, 0, &span);
+
+            /* got an empty name => ran out of data */
+            if (name->wpos == 0) {
+                break;
+            }
+
+            /* not the name we want, or no value? keep looking */
+            if (!equals ||
+                name->wpos != nlen ||
+                memcmp(name->data, nstr, nlen) != 0) {
+                continue;
+            }
+
+            value = scratch_get(scratch);
+            cookie_get_span_value(&cookie, &span, value);
+            found = new_value_sv(aTHX_ value);
+            break;
+        }
+
+    } while (0);
+
+    scratch_release(scratch, mark);
+    return found ? found : newSV(0);
+}
+
+/*
+ * Given a string, parse it as a cookie looking for all the names in a set,
+ * and store in values[j] the value for the first occurrence (with a value)
+ * of the j-th name in the set; values for names not found are left null.
+ *
+ * We stop parsing as soon as all names have been found, and we only decode
+ * the values we return.
+ */
+static void pick_cookie(pTHX_ SV* pstr, const NameSet* set, SV** values)
+{
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    unsigned int missing = set->count;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    Buffer cookie;
+    Buffer* name = 0;
+
+    /* string not valid? bail out */
+    if (!SvOK(pstr) || !SvPOK(pstr)) {
+        return;
+    }
+
+    /* empty string? bail out */
+    cstr = SvPV_const(pstr, clen);
+    if (!cstr || !clen) {
+        return;
+    }
+
+    buffer_wrap(&cookie, cstr, clen);
+    mark = scratch_mark(scratch);
+    name = scratch_get(scratch);
+
+    while (missing > 0) {
+        int equals = 0;
+        int pos = 0;
+        SV* value = 0;
+        CookieSpan span;
+
+        /* get the name and where the value is, without copying it */
+        buffer_reset(name);
+        equals = cookie_get_pair_span(&cookie, name, 0, &span);
+
+        /* got an empty name => ran out of data */
+        if (name->wpos == 0) {
+            break;
+        }
+
+        /* no value? keep looking */
+        if (!equals) {
+            continue;
+        }
+
+        /* the same name could have been requested more than once */
+        for (pos = nameset_find(set, name->data, name->wpos);
+             pos >= 0;
+             pos = nameset_next(set, pos)) {
+            if (values[pos]) {
+                /* only first value seen for a name is kept */
+                continue;
+            }
+            if (!value) {
+                unsigned int vmark = scratch_mark(scratch);
+                Buffer* decoded = scratch_get(scratch);
+                cookie_get_span_value(&cookie, &span, decoded);
+                value = new_value_sv(aTHX_ decoded);
+                scratch_release(scratch, vmark);
+                values[pos] = value;
+            } else {
+                values[pos] = copy_value_sv(aTHX_ value);
+            }
+            --missing;
+        }
+    }
+
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Return non-zero if the name in a buffer is a given attribute name,
+ * ignoring case.
+ */
+#define IS_ATTRIBUTE(buf, attr) \
+    ((buf)->wpos == sizeof(attr) - 1 && \
+     strncasecmp((buf)->data, attr, sizeof(attr) - 1) == 0)
+
+/*
+ * Parse the delta-seconds for a Max-Age attribute: an optional minus
+ * sign followed by digits.  Return zero if the value is not valid.
+ */
+static int get_max_age(const Buffer* value, IV* age)
+{
+    unsigned int j = 0;
+    int negative = 0;
+    IV number = 0;
+
+    if (j < value->wpos && value->data[j] == '-') {
+        negative = 1;
+        ++j;
+    }
+    if (j >= value->wpos) {
+        return 0;
+    }
+    for (; j < value->wpos; ++j) {
+        char c = value->data[j];
+        IV digit = c - '0';
+        if (c < '0' || c > '9') {
+            return 0;
+        }
+        /* saturate very large values, they mean "forever" anyway */
+        if (number > (IV_MAX - digit) / 10) {
+            number = IV_MAX;
+        } else {
+            number = 10 * number + digit;
+        }
+    }
+    *age = negative ? -number : number;
+    return 1;
+}
+
+/*
+ * Get the next attribute from a Set-Cookie header, as RFC 6265 section
+ * 5.2 says: everything up to the next ';', split on the first '=', with
+ * the whitespace around name and value removed.  Attributes are taken
+ * literally, without any URL-decoding, so name and value are just wrapped
+ * around the bytes in the cookie.  Return -1 if there are no attributes
+ * left, otherwise whether there was an '='.
+ */
+static int get_raw_attribute(Buffer* cookie, Buffer* name, Buffer* value)
+{
+    const char* data = cookie->data;
+    unsigned int beg = cookie->rpos;
+    unsigned int end = beg;
+    unsigned int eq = 0;
+    unsigned int vbeg = 0;
+    unsigned int nend = 0;
+    int equals = 0;
+
+    if (beg >= cookie->wpos) {
+        return -1;
+    }
+    while (end < cookie->wpos && data[end] != ';') {
+        ++end;
+    }
+    cookie->rpos = end < cookie->wpos ? end + 1 : end;
+
+    for (eq = beg; eq < end && data[eq] != '='; ++eq) {
+    }
+    equals = eq < end;
+    vbeg = equals ? eq + 1 : end;
+
+    while (beg < eq && (data[beg] == ' ' || data[beg] == '\t')) {
+        ++beg;
+    }
+    for (nend = eq; nend > beg && (data[nend - 1] == ' ' || data[nend - 1] == '\t'); --nend) {
+    }
+    while (vbeg < end && (data[vbeg] == ' ' || data[vbeg] == '\t')) {
+        ++vbeg;
+    }
+    while (end > vbeg && (data[end - 1] == ' ' || data[end - 1] == '\t')) {
+        --end;
+    }
+
+    buffer_wrap(name, data + beg, nend - beg);
+    buffer_wrap(value, data + vbeg, end - vbeg);
+    return equals;
+}
+
+/*
+ * Given the value of a Set-Cookie header, parse it and return a hashref
+ * with the cookie name and value, plus all known attributes, with their
+ * canonical names:
+ *
+ *   name, value  => strings, value can be an arrayref as in parse_cookie()
+ *   Domain, Path, SameSite => strings
+ *   Expires  => epoch, if the date could be parsed
+ *   Max-Age  => integer, if it was valid
+ *   Secure, HttpOnly => 1 if present
+ *
+ * Only the value is URL-decoded; attributes are taken literally.  Unknown
+ * attributes and invalid dates / ages are ignored, and when an attribute
+ * is repeated the last one wins, as in RFC 6265.  If the header
+ * does not start with a name=value pair, return null.
+ */
+static HV* parse_set_cookie(pTHX_ SV* pstr)
+{
+    HV* hv = 0;
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    Buffer cookie;
+    Buffer* name = 0;
+    Buffer* value = 0;
+    Buffer attr_name;
+    Buffer attr_value;
+
+    /* string not valid? bail out */
+    if (!SvOK(pstr) || !SvPOK(pstr)) {
+        return 0;
+    }
+
+    /* empty string? bail out */
+    cstr = SvPV_const(pstr, clen);
+    if (!cstr || !clen) {
+        return 0;
+    }
+
+    buffer_wrap(&cookie, cstr, clen);
+    mark = scratch_mark(scratch);
+    name = scratch_get(scratch);
+    value = scratch_get(scratch);
+
+    /* first we must have the cookie name=value */
+    if (cookie_get_pair(&cookie, name, value) && name->wpos > 0) {
+        hv = newHV();
+        hv_stores(hv, "name", newSVpvn(name->data, name->wpos));
+        hv_stores(hv, COOKIE_NAME_VALUE, new_value_sv(aTHX_ value));
+    }
+    scratch_release(scratch, mark);
+    name = &attr_name;
+    value = &attr_value;
+
+    /* then the attributes, which are taken literally */
+    while (hv) {
+        int equals = get_raw_attribute(&cookie, name, value);
+
+        /* ran out of data */
+        if (equals < 0) {
+            break;
+        }
+
+        /* empty attributes are ignored */
+        if (name->wpos == 0) {
+            continue;
+        }
+
+        if        (IS_ATTRIBUTE(name, COOKIE_NAME_SECURE)) {
+            hv_stores(hv, COOKIE_NAME_SECURE, newSViv(1));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_HTTP_ONLY)) {
+            hv_stores(hv, COOKIE_NAME_HTTP_ONLY, newSViv(1));
+        } else if (!equals) {
+            /* all other attributes need a value */
+            continue;
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_DOMAIN)) {
+            hv_stores(hv, COOKIE_NAME_DOMAIN, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_PATH)) {
+            hv_stores(hv, COOKIE_NAME_PATH, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_SAME_SITE)) {
+            hv_stores(hv, COOKIE_NAME_SAME_SITE, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_EXPIRES)) {
+            double epoch = 0;
+            if (date_parse_http(value->data, value->wpos, &epoch)) {
+                hv_stores(hv, COOKIE_NAME_EXPIRES, newSViv((IV) epoch));
+            }
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_MAX_AGE)) {
+            IV age = 0;
+            if (get_max_age(value, &age)) {
+                hv_stores(hv, COOKIE_NAME_MAX_AGE, newSViv(age));
+            }
+        }
+    }
+
+    return hv;
+}
+
+/*
+ * Add the pair just completed by the parser of a cookie stream to the
+ * crushed hash, following the same rules as parse_cookie(); if the pair
+ * was added, also push its name and value onto the Perl stack.
+ */
+static SV** stream_add_pair(pTHX_ CookieStream* stream, SV** sp)
+{
+    const Buffer* name = &stream->parser.name;
+    SV* value = 0;
+
+    /* got an empty name => nothing to add */
+    if (name->wpos == 0) {
+        return sp;
+    }
+
+    /* only first value seen for a name is kept */
+    if (hv_exists(stream->crushed, name->data, name->wpos)) {
+        return sp;
+    }
+
+    if (!stream->parser.equals) {
+        /* didn't see an equal sign => name with no value */
+        if (!stream->allow_no_value) {
+            return sp;
+        }
+        value = newSV(0);
+    } else {
+        value = new_value_sv(aTHX_ &stream->parser.value);
+    }
+    hv_store(stream->crushed, name->data, name->wpos, value, 0);
+
+    EXTEND(SP, 2);
+    mPUSHp(name->data, name->wpos);
+    PUSHs(sv_2mortal(copy_value_sv(aTHX_ value)));
+    return sp;
+}
+
+/*
+ * Return the name set inside an HTTP::XSCookies::NameSet object, or null
+ * if the SV is not such an object.
+ */
+static NameSet* get_nameset(pTHX_ SV* sv)
+{
+    SV* obj = 0;
+    const char* klass = 0;
+
+    if (!SvROK(sv)) {
+        return 0;
+    }
+
+    /* check the class name first, it is faster than sv_derived_from */
+    obj = SvRV(sv);
+    klass = SvOBJECT(obj) ? HvNAME(SvSTASH(obj)) : 0;
+    if (!klass ||
+        (strcmp(klass, "HTTP::XSCookies::NameSet") != 0 &&
+         !sv_derived_from(sv, "HTTP::XSCookies::NameSet"))) {
+        return 0;
+    }
+    return INT2PTR(NameSet*, SvIV(SvRV(sv)));
+}
+
+/*
+ * Get the parts of a request URL that a cookie jar needs.
+ */
+static void get_jar_request(pTHX_ SV* url, JarRequest* req)
+{
+    const char* ustr = 0;
+    STRLEN ulen = 0;
+
+    if (SvOK(url)) {
+        ustr = SvPV_const(url, ulen);
+    }
+    if (!ustr || !jar_parse_url(ustr, ulen, req)) {
+        croak("Invalid URL for a cookie jar: %s", ustr ? ustr : "undef");
+    }
+}
+
+/*
+ * The current time for a cookie jar: the given epoch, or the actual time.
+ */
+static double get_jar_now(pTHX_ SV* now)
+{
+    if (now && SvOK(now)) {
+        return SvNV(now);
+    }
+    return (double) time(0);
+}
+
+/*
+ * Which SameSite cookies can be sent with a request, from a string.
+ */
+static int get_jar_site(pTHX_ SV* site)
+{
+    const char* sstr = 0;
+    STRLEN slen = 0;
+
+    if (!site || !SvOK(site)) {
+        return JAR_SITE_SAME;
+    }
+    sstr = SvPV_const(site, slen);
+    if (slen == 9 && memcmp(sstr, "same-site", 9) == 0) {
+        return JAR_SITE_SAME;
+    }
+    if (slen == 10 && memcmp(sstr, "navigation", 10) == 0) {
+        return JAR_SITE_NAVIGATION;
+    }
+    if (slen == 10 && memcmp(sstr, "cross-site", 10) == 0) {
+        return JAR_SITE_CROSS;
+    }
+    croak("Invalid site for a cookie jar request: %s", sstr);
+    return JAR_SITE_SAME;
+}
+
+/*
+ * Return a hashref describing a cookie stored in a jar.
+ */
+static SV* new_jar_cookie_sv(pTHX_ const Jar* jar, const JarCookie* cookie)
+{
+    static const char* same_site[] = { 0, "None", "Lax", "Strict" };
+    const JarDomain* domain = &jar->domains[cookie->domain];
+    HV* hv = newHV();
+
+    hv_stores(hv, "name", newSVpvn(cookie->data, cookie->nlen));
+    hv_stores(hv, COOKIE_NAME_VALUE, newSVpvn(cookie->data + cookie->nlen, cookie->vlen));
+    hv_stores(hv, COOKIE_NAME_DOMAIN, newSVpvn(domain->name, domain->len));
+    hv_stores(hv, COOKIE_NAME_PATH, newSVpvn(cookie->data + cookie->nlen + cookie->vlen, cookie->plen));
+    if (cookie->flags & JAR_PERSISTENT) {
+        hv_stores(hv, COOKIE_NAME_EXPIRES, newSViv((IV) cookie->expires));
+    }
+    if (cookie->flags & JAR_SECURE) {
+        hv_stores(hv, COOKIE_NAME_SECURE, newSViv(1));
+    }
+    if (cookie->flags & JAR_HTTP_ONLY) {
+        hv_stores(hv, COOKIE_NAME_HTTP_ONLY, newSViv(1));
+    }
+    if (cookie->flags & JAR_HOST_ONLY) {
+        hv_stores(hv, "host_only", newSViv(1));
+    }
+    if (same_site[cookie->same_site]) {
+        hv_stores(hv, COOKIE_NAME_SAME_SITE, newSVpv(same_site[cookie->same_site], 0));
+    }
+    return newRV_noinc((SV*) hv);
+}
+
+/*
+ * Return the value for the pair at a given position in a lazy cookie,
+ * decoding it (only) the first time it is requested.
+ */
+static SV* lazy_fetch(pTHX_ LazyCookie* lazy, unsigned int pos)
+{
+    SV** cached = av_fetch(lazy->values, pos, 0);
+    SV* sv = 0;
+
+    if (cached) {
+        return *cached;
+    }
+
+    if (!(lazy->index.pairs[pos].flags & PAIR_EQUALS)) {
+        /* name with no value */
+        sv = newSV(0);
+    } else {
+        Scratch* scratch = get_scratch(aTHX);
+        unsigned int mark = scratch_mark(scratch);
+        Buffer* value = scratch_get(scratch);
+        pairs_get_value(&lazy->index, pos, value);
+        sv = new_value_sv(aTHX_ value);
+        scratch_release(scratch, mark);
+    }
+
+    av_store(lazy->values, pos, sv);
+    return sv;
+}
+
+/*
+ * Return the next name in a lazy cookie, skipping repeated names,
+ * or undef if there are no more names.
+ */
+static SV* lazy_next_key(pTHX_ LazyCookie* lazy)
+{
+    while (lazy->iter < lazy->index.count) {
+        unsigned int pos = lazy->iter++;
+        const Pair* pair = &lazy->index.pairs[pos];
+        if (!pairs_is_repeated(&lazy->index, pos)) {
+            return newSVpvn(lazy->index.names.data + pair->npos, pair->nlen);
+        }
+    }
+    return newSV(0);
+}
+
+/*
+ * URL-encode (or decode) a string and append the result to a target SV,
+ * writing straight into the target's buffer; return the target.
+ */
+static SV* uri_append(pTHX_ SV* tgt, SV* src, int encode)
+{
+    const char* sstr = 0;
+    STRLEN slen = 0;
+    STRLEN tlen = 0;
+    char* tstr = 0;
+
+    if (!SvOK(tgt)) {
+        sv_setpvs(tgt, "");
+    }
+    if (!SvOK(src)) {
+        return tgt;
+    }
+    if (src == tgt) {
+        /* growing the target would move the source */
+        src = sv_mortalcopy(src);
+    }
+    sstr = SvPV_const(src, slen);
+
+    if (!encode && SvUTF8(tgt)) {
+        /* decoded bytes must be upgraded to characters, let perl do it */
+        sv_catsv(tgt, sv_2mortal(uri_append(aTHX_ newSVpvs(""), src, 0)));
+        SvSETMAGIC(tgt);
+        return tgt;
+    }
+
+    SvPV_force(tgt, tlen);
+    tstr = SvGROW(tgt, tlen + (encode ? 3 : 1) * slen + 1);
+    tlen += encode ? url_encode_str(sstr, slen, tstr + tlen)
+                   : url_decode_str(sstr, slen, tstr + tlen);
+    tstr[tlen] = '\0';
+    SvCUR_set(tgt, tlen);
+    SvSETMAGIC(tgt);
+    return tgt;
+}
+
+
+#line 1520 "baker.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 1664 "baker.c"
+
+XS_EUPXS(XS_HTTP__XSCookies_CLONE); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_CLONE)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+#line 1527 "baker.xs"
+    {
+        MY_CXT_CLONE;
+        date_cache_init(&MY_CXT.date_cache);
+        /* the buffers we copied belong to the parent interpreter */
+        scratch_init(&MY_CXT.scratch);
+        call_atexit(scratch_destroy, 0);
+        sign_key_init(&MY_CXT.sign_key);
+        /* never share nonces with the parent interpreter */
+        seal_nonces_init(&MY_CXT.seal_nonces);
+    }
+    PERL_UNUSED_VAR(items);
+#line 1685 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_bake_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_bake_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "name, value");
+    {
+#line 1544 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+#line 1702 "baker.c"
+	SV *	RETVAL;
+	SV*	name = ST(0)
+;
+	SV*	value = ST(1)
+;
+#line 1548 "baker.xs"
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, 0, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+#line 1715 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_bake_cookies); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_bake_cookies)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cookies");
+    {
+#line 1559 "baker.xs"
+    AV* baked = 0;
+    SV* ref = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+#line 1736 "baker.c"
+	SV *	RETVAL;
+	SV*	cookies = ST(0)
+;
+#line 1565 "baker.xs"
+    ref = SvROK(cookies) ? SvRV(cookies) : 0;
+    if (!ref || (SvTYPE(ref) != SVt_PVAV && SvTYPE(ref) != SVt_PVHV)) {
+        croak("Cookies for bake_cookies must be an arrayref or a hashref");
+    }
+    baked = newAV();
+
+    /* the same buffers are used for all the cookies */
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    if (SvTYPE(ref) == SVt_PVAV) {
+        /* name / value pairs */
+        AV* pairs = (AV*) ref;
+        SSize_t top = av_len(pairs);
+        SSize_t j = 0;
+        for (j = 0; j + 1 <= top; j += 2) {
+            SV** name = av_fetch(pairs, j, 0);
+            SV** value = av_fetch(pairs, j + 1, 0);
+            buffer_reset(cookie);
+            if (name && value) {
+                build_cookie(aTHX_ *name, *value, 0, cookie, encoded);
+            }
+            av_push(baked, newSVpvn(cookie->data, cookie->wpos));
+        }
+    } else {
+        /* name => value */
+        HV* specs = (HV*) ref;
+        HE* entry = 0;
+        hv_iterinit(specs);
+        while ((entry = hv_iternext(specs))) {
+            buffer_reset(cookie);
+            build_cookie(aTHX_ hv_iterkeysv(entry), hv_iterval(specs, entry), 0, cookie, encoded);
+            av_push(baked, newSVpvn(cookie->data, cookie->wpos));
+        }
+    }
+    SCRATCH_LEAVE();
+
+    RETVAL = newRV_noinc((SV*) baked);
+#line 1779 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_bake_signed_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_bake_signed_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "name, value, key");
+    {
+#line 1608 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+    HmacSha256 signing;
+    CookieGuard guard;
+#line 1800 "baker.c"
+	SV *	RETVAL;
+	SV*	name = ST(0)
+;
+	SV*	value = ST(1)
+;
+	SV*	key = ST(2)
+;
+#line 1614 "baker.xs"
+    /* copy the key: baking / verifying might run code that signs
+     * with another key */
+    signing = *get_signing_key(aTHX_ key, "bake_signed_cookie");
+    guard.sign = &signing;
+    guard.seal = 0;
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, &guard, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+#line 1820 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_verify_signed_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_verify_signed_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "name, value, key");
+    {
+#line 1630 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    HmacSha256 signing;
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    Buffer* joined = 0;
+    Buffer payload;
+    int vlen = -1;
+#line 1843 "baker.c"
+	SV *	RETVAL;
+	SV*	name = ST(0)
+;
+	SV*	value = ST(1)
+;
+	SV*	key = ST(2)
+;
+#line 1638 "baker.xs"
+    /* copy the key: baking / verifying might run code that signs
+     * with another key */
+    signing = *get_signing_key(aTHX_ key, "verify_signed_cookie");
+    SCRATCH_ENTER(scratch);
+    joined = scratch_get(scratch);
+    if (SvROK(value) && SvTYPE(SvRV(value)) == SVt_PVAV) {
+        /* crush gave us several values: put them back together, as
+         * they were when signed, without touching the array */
+        AV* values = (AV*) SvRV(value);
+        SSize_t top = av_len(values);
+        SSize_t j = 0;
+        for (j = 0; j <= top; ++j) {
+            SV** elem = av_fetch(values, j, 0);
+            const char* estr = 0;
+            STRLEN elen = 0;
+            if (!elem || !SvOK(*elem)) {
+                continue;
+            }
+            estr = SvPV_const(*elem, elen);
+            if (joined->wpos) {
+                buffer_append_str(joined, "&", 1);
+            }
+            buffer_append_str(joined, estr, elen);
+        }
+    } else if (SvOK(value) && !SvROK(value)) {
+        const char* vstr = 0;
+        STRLEN len = 0;
+        vstr = SvPV_const(value, len);
+        buffer_append_str(joined, vstr, len);
+    }
+    if (joined->wpos && SvOK(name)) {
+        nstr = SvPV_const(name, nlen);
+        vlen = sign_verify(nstr, nlen, joined->data, joined->wpos, &signing);
+    }
+    if (vlen < 0) {
+        RETVAL = newSV(0);
+    } else {
+        /* return the value as crush would have returned it */
+        buffer_wrap(&payload, joined->data, vlen);
+        RETVAL = new_value_sv(aTHX_ &payload);
+    }
+    SCRATCH_LEAVE();
+#line 1894 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_bake_sealed_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_bake_sealed_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "name, value, key");
+    {
+#line 1685 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+    unsigned char sealing[AEAD_KEY_LEN];
+    CookieGuard guard;
+#line 1915 "baker.c"
+	SV *	RETVAL;
+	SV*	name = ST(0)
+;
+	SV*	value = ST(1)
+;
+	SV*	key = ST(2)
+;
+#line 1691 "baker.xs"
+    get_sealing_key(aTHX_ key, sealing, "bake_sealed_cookie");
+    guard.sign = 0;
+    guard.seal = sealing;
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, &guard, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+#line 1933 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_open_sealed_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_open_sealed_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "name, value, key");
+    {
+#line 1705 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned char sealing[AEAD_KEY_LEN];
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* opened = 0;
+#line 1956 "baker.c"
+	SV *	RETVAL;
+	SV*	name = ST(0)
+;
+	SV*	value = ST(1)
+;
+	SV*	key = ST(2)
+;
+#line 1713 "baker.xs"
+    get_sealing_key(aTHX_ key, sealing, "open_sealed_cookie");
+    RETVAL = 0;
+    if (SvOK(name) && SvOK(value) && !SvROK(value)) {
+        nstr = SvPV_const(name, nlen);
+        vstr = SvPV_const(value, vlen);
+        SCRATCH_ENTER(scratch);
+        opened = scratch_get(scratch);
+        if (seal_open(nstr, nlen, vstr, vlen, sealing, opened)) {
+            /* return the value as crush would have returned it */
+            RETVAL = new_value_sv(aTHX_ opened);
+        }
+        SCRATCH_LEAVE();
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+#line 1981 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_unpack_cookie_value); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_unpack_cookie_value)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "value");
+    {
+#line 1734 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* packed = 0;
+    int plen = 0;
+#line 2003 "baker.c"
+	SV *	RETVAL;
+	SV*	value = ST(0)
+;
+#line 1741 "baker.xs"
+    RETVAL = 0;
+    if (SvOK(value) && !SvROK(value)) {
+        vstr = SvPV_const(value, vlen);
+        mark = scratch_mark(scratch);
+        packed = scratch_get(scratch);
+        buffer_ensure_unused(packed, BASE64_DECODED_LEN(vlen));
+        plen = base64_decode_str(vstr, vlen, packed->data);
+        if (plen >= 0) {
+            packed->wpos = plen;
+            RETVAL = unpack_value(aTHX_ packed);
+        }
+        scratch_release(scratch, mark);
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+#line 2024 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_decompress_cookie_value); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_decompress_cookie_value)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "value");
+    {
+#line 1762 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* opened = 0;
+#line 2045 "baker.c"
+	SV *	RETVAL;
+	SV*	value = ST(0)
+;
+#line 1768 "baker.xs"
+    RETVAL = 0;
+    if (SvOK(value) && !SvROK(value)) {
+        vstr = SvPV_const(value, vlen);
+        mark = scratch_mark(scratch);
+        opened = scratch_get(scratch);
+        if (compress_open(vstr, vlen, opened)) {
+            /* return the value as crush would have returned it */
+            RETVAL = new_value_sv(aTHX_ opened);
+        }
+        scratch_release(scratch, mark);
+    }
+    if (!RETVAL) {
+        /* not compressed: return the value as it was */
+        RETVAL = newSVsv(value);
+    }
+#line 2065 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "str, ...");
+    {
+#line 1788 "baker.xs"
+    IV allow_no_value = 0;
+    NameSet* filter = 0;
+    int decompress = 0;
+#line 2084 "baker.c"
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1792 "baker.xs"
+    if (items > 1) {
+        allow_no_value = SvIV(ST(1));
+    }
+    if (items > 2 && SvOK(ST(2))) {
+        filter = get_nameset(aTHX_ ST(2));
+        if (!filter) {
+            croak("Filter for crush_cookie must be an HTTP::XSCookies::NameSet");
+        }
+    }
+    if (items > 3) {
+        decompress = SvTRUE(ST(3));
+    }
+    RETVAL = newRV_noinc((SV *) parse_cookie(aTHX_ str, allow_no_value, filter, decompress));
+#line 2102 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_set_cookie); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_set_cookie)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+#line 1810 "baker.xs"
+    HV* hv = 0;
+#line 2119 "baker.c"
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1812 "baker.xs"
+    hv = parse_set_cookie(aTHX_ str);
+    RETVAL = hv ? newRV_noinc((SV *) hv) : newSV(0);
+#line 2126 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_parse_http_date); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_parse_http_date)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+#line 1819 "baker.xs"
+    const char* dstr = 0;
+    STRLEN dlen = 0;
+    double epoch = 0;
+#line 2145 "baker.c"
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1823 "baker.xs"
+    if (SvOK(str)) {
+        dstr = SvPV_const(str, dlen);
+    }
+    if (dstr && date_parse_http(dstr, dlen, &epoch)) {
+        RETVAL = newSViv((IV) epoch);
+    } else {
+        RETVAL = newSV(0);
+    }
+#line 2158 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_public_suffix); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_public_suffix)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "host");
+    {
+#line 1836 "baker.xs"
+    char lower[JAR_HOST_MAX + 1];
+    const char* hstr = 0;
+    STRLEN hlen = 0;
+    STRLEN j = 0;
+    int pos = -1;
+#line 2179 "baker.c"
+	SV *	RETVAL;
+	SV*	host = ST(0)
+;
+#line 1842 "baker.xs"
+    if (SvOK(host)) {
+        hstr = SvPV_const(host, hlen);
+    }
+    if (hstr && hlen <= JAR_HOST_MAX) {
+        for (j = 0; j < hlen; ++j) {
+            char c = hstr[j];
+            lower[j] = c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+        }
+        pos = psl_suffix(lower, hlen);
+    }
+    if (pos < 0) {
+        RETVAL = newSV(0);
+    } else {
+        RETVAL = newSVpvn(lower + pos, hlen - pos);
+        if (SvUTF8(host)) {
+            SvUTF8_on(RETVAL);
+        }
+    }
+#line 2202 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+#line 1865 "baker.xs"
+    const char* sstr = 0;
+    STRLEN slen = 0;
+#line 2220 "baker.c"
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1868 "baker.xs"
+    if (!SvOK(str)) {
+        RETVAL = newSV(0);
+    } else {
+        sstr = SvPV_const(str, slen);
+        if (scan_unreserved(sstr, slen) == slen) {
+            /* nothing to encode, don't reserve room for it */
+            RETVAL = newSVpvn(sstr, slen);
+        } else {
+            RETVAL = uri_append(aTHX_ newSVpvs(""), str, 1);
+        }
+    }
+#line 2236 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1884 "baker.xs"
+    /* decoding never makes a string longer, so this allocates once */
+    RETVAL = SvOK(str) ? uri_append(aTHX_ newSVpvs(""), str, 0) : newSV(0);
+#line 2257 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode_append); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode_append)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "tgt, str");
+    {
+	SV*	tgt = ST(0)
+;
+	SV*	str = ST(1)
+;
+#line 1891 "baker.xs"
+    uri_append(aTHX_ tgt, str, 1);
+#line 2278 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode_append); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode_append)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "tgt, str");
+    {
+	SV*	tgt = ST(0)
+;
+	SV*	str = ST(1)
+;
+#line 1896 "baker.xs"
+    uri_append(aTHX_ tgt, str, 0);
+#line 2297 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode_inplace); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_encode_inplace)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+#line 1901 "baker.xs"
+    char* sstr = 0;
+    STRLEN slen = 0;
+    unsigned int tlen = 0;
+#line 2314 "baker.c"
+	SV*	str = ST(0)
+;
+#line 1905 "baker.xs"
+    if (SvOK(str)) {
+        sstr = SvPV_force(str, slen);
+        if (scan_unreserved(sstr, slen) < slen) {
+            /* move the string to the end of a buffer three times as
+             * long and encode it from there into the start */
+            sstr = SvGROW(str, 3 * slen + 1);
+            memmove(sstr + 2 * slen, sstr, slen);
+            tlen = url_encode_str(sstr + 2 * slen, slen, sstr);
+            sstr[tlen] = '\0';
+            SvCUR_set(str, tlen);
+            SvSETMAGIC(str);
+        }
+    }
+#line 2331 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode_inplace); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_uri_decode_inplace)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "str");
+    {
+#line 1922 "baker.xs"
+    char* sstr = 0;
+    STRLEN slen = 0;
+    unsigned int tlen = 0;
+#line 2348 "baker.c"
+	SV*	str = ST(0)
+;
+#line 1926 "baker.xs"
+    if (SvOK(str)) {
+        sstr = SvPV_force(str, slen);
+        tlen = url_decode_str(sstr, slen, sstr);
+        sstr[tlen] = '\0';
+        SvCUR_set(str, tlen);
+        /* decoded bytes are just bytes */
+        SvUTF8_off(str);
+        SvSETMAGIC(str);
+    }
+#line 2361 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookies); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookies)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "headers, ...");
+    {
+#line 1939 "baker.xs"
+    IV allow_no_value = 0;
+    NameSet* filter = 0;
+    int decompress = 0;
+    AV* strs = 0;
+    AV* crushed = 0;
+    SSize_t top = 0;
+    SSize_t j = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* name = 0;
+    Buffer* value = 0;
+#line 2385 "baker.c"
+	SV *	RETVAL;
+	SV*	headers = ST(0)
+;
+#line 1950 "baker.xs"
+    if (!SvROK(headers) || SvTYPE(SvRV(headers)) != SVt_PVAV) {
+        croak("Headers for crush_cookies must be an arrayref");
+    }
+    if (items > 1) {
+        allow_no_value = SvIV(ST(1));
+    }
+    if (items > 2 && SvOK(ST(2))) {
+        filter = get_nameset(aTHX_ ST(2));
+        if (!filter) {
+            croak("Filter for crush_cookies must be an HTTP::XSCookies::NameSet");
+        }
+    }
+    if (items > 3) {
+        decompress = SvTRUE(ST(3));
+    }
+    strs = (AV*) SvRV(headers);
+    top = av_len(strs);
+    crushed = newAV();
+    av_extend(crushed, top);
+
+    /* the same buffers are used for all the cookies */
+    SCRATCH_ENTER(scratch);
+    name = scratch_get(scratch);
+    value = scratch_get(scratch);
+    for (j = 0; j <= top; ++j) {
+        SV** str = av_fetch(strs, j, 0);
+        HV* hv = parse_cookie_buffers(aTHX_ str ? *str : &PL_sv_undef, allow_no_value, filter,
+                                      decompress, name, value);
+        av_store(crushed, j, newRV_noinc((SV*) hv));
+    }
+    SCRATCH_LEAVE();
+
+    RETVAL = newRV_noinc((SV*) crushed);
+#line 2423 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_lazy); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_lazy)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "str, ...");
+    {
+#line 1988 "baker.xs"
+    IV allow_no_value = 0;
+    LazyCookie* lazy = 0;
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    SV* obj = 0;
+    HV* hv = 0;
+#line 2445 "baker.c"
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+#line 1995 "baker.xs"
+    if (items > 1) {
+        allow_no_value = SvIV(ST(1));
+    }
+    Newxz(lazy, 1, LazyCookie);
+    lazy->values = newAV();
+    if (SvOK(str) && SvPOK(str)) {
+        lazy->str = newSVsv(str);
+        cstr = SvPV_const(lazy->str, clen);
+    }
+    pairs_init(&lazy->index, cstr, clen, allow_no_value);
+
+    /* tie a new hash to the lazy cookie */
+    obj = sv_setref_pv(newSV(0), "HTTP::XSCookies::Lazy", lazy);
+    hv = newHV();
+    sv_magic((SV*) hv, obj, PERL_MAGIC_tied, 0, 0);
+    SvREFCNT_dec(obj);
+    RETVAL = newRV_noinc((SV*) hv);
+#line 2467 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__scratch_stats); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__scratch_stats)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 2017 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+#line 2486 "baker.c"
+#line 2019 "baker.xs"
+    EXTEND(SP, 3);
+    mPUSHu(scratch->allocs);
+    mPUSHu(scratch->used);
+    mPUSHu(scratch->count);
+#line 2492 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__gmem_allocs); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__gmem_allocs)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	SV *	RETVAL;
+#line 2027 "baker.xs"
+    /* memory is only counted when built with GMEM_CHECK */
+#if defined(GMEM_CHECK) && GMEM_CHECK >= 1
+    RETVAL = newSViv(gmem_allocs);
+#else
+    RETVAL = newSV(0);
+#endif
+#line 2514 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__chacha20); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__chacha20)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "key, counter, nonce, data");
+    {
+#line 2038 "baker.xs"
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* dstr = 0;
+#line 2536 "baker.c"
+	SV *	RETVAL;
+	SV*	key = ST(0)
+;
+	UV	counter = (UV)SvUV(ST(1))
+;
+	SV*	nonce = ST(2)
+;
+	SV*	data = ST(3)
+;
+#line 2045 "baker.xs"
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    RETVAL = newSV(dlen + 1);
+    SvPOK_on(RETVAL);
+    chacha20_xor(kstr, (unsigned int) counter, nstr, dstr, dlen,
+                 (unsigned char*) SvPVX(RETVAL));
+    SvCUR_set(RETVAL, dlen);
+#line 2555 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__poly1305); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__poly1305)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "key, msg");
+    {
+#line 2058 "baker.xs"
+    STRLEN klen = 0;
+    STRLEN mlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* mstr = 0;
+    unsigned char tag[AEAD_TAG_LEN];
+#line 2576 "baker.c"
+	SV *	RETVAL;
+	SV*	key = ST(0)
+;
+	SV*	msg = ST(1)
+;
+#line 2064 "baker.xs"
+    kstr = get_test_bytes(aTHX_ key, &klen, 32);
+    mstr = get_test_bytes(aTHX_ msg, &mlen, 0);
+    poly1305_mac(kstr, mstr, mlen, tag);
+    RETVAL = newSVpvn((const char*) tag, AEAD_TAG_LEN);
+#line 2587 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__aead_seal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__aead_seal)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "key, nonce, aad, data");
+    {
+#line 2073 "baker.xs"
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN alen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* astr = 0;
+    const unsigned char* dstr = 0;
+    unsigned char* out = 0;
+#line 2612 "baker.c"
+	SV *	RETVAL;
+	SV*	key = ST(0)
+;
+	SV*	nonce = ST(1)
+;
+	SV*	aad = ST(2)
+;
+	SV*	data = ST(3)
+;
+#line 2083 "baker.xs"
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    astr = get_test_bytes(aTHX_ aad, &alen, 0);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    /* ciphertext followed by tag */
+    RETVAL = newSV(dlen + AEAD_TAG_LEN + 1);
+    SvPOK_on(RETVAL);
+    out = (unsigned char*) SvPVX(RETVAL);
+    aead_seal(kstr, nstr, astr, alen, dstr, dlen, out, out + dlen);
+    SvCUR_set(RETVAL, dlen + AEAD_TAG_LEN);
+#line 2633 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__aead_open); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__aead_open)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "key, nonce, aad, data");
+    {
+#line 2098 "baker.xs"
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN alen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* astr = 0;
+    const unsigned char* dstr = 0;
+#line 2657 "baker.c"
+	SV *	RETVAL;
+	SV*	key = ST(0)
+;
+	SV*	nonce = ST(1)
+;
+	SV*	aad = ST(2)
+;
+	SV*	data = ST(3)
+;
+#line 2107 "baker.xs"
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    astr = get_test_bytes(aTHX_ aad, &alen, 0);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    RETVAL = 0;
+    if (dlen >= AEAD_TAG_LEN) {
+        /* ciphertext followed by tag */
+        dlen -= AEAD_TAG_LEN;
+        RETVAL = newSV(dlen + 1);
+        SvPOK_on(RETVAL);
+        if (aead_open(kstr, nstr, astr, alen, dstr, dlen, dstr + dlen,
+                      (unsigned char*) SvPVX(RETVAL))) {
+            SvCUR_set(RETVAL, dlen);
+        } else {
+            SvREFCNT_dec(RETVAL);
+            RETVAL = 0;
+        }
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+#line 2689 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_get); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_get)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "str, name");
+    {
+	SV *	RETVAL;
+	SV*	str = ST(0)
+;
+	SV*	name = ST(1)
+;
+#line 2133 "baker.xs"
+    RETVAL = find_cookie(aTHX_ str, name);
+#line 2711 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_pick); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies_crush_cookie_pick)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "str, ...");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 2139 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    NameSet names;
+    NameSet* set = 0;
+    Buffer* buf = 0;
+    SV** values = 0;
+    int j = 0;
+#line 2735 "baker.c"
+	SV*	str = ST(0)
+;
+#line 2146 "baker.xs"
+    /* the names (when given as a list) and the values are kept in scratch
+     * buffers, which are given back even if getting a name dies */
+    SCRATCH_ENTER(scratch);
+
+    /* names can be given as a (compiled) set, or as a list */
+    if (items == 2) {
+        set = get_nameset(aTHX_ ST(1));
+    }
+    if (!set) {
+        set = &names;
+        if (items - 1 > NAMESET_FIXED) {
+            buf = scratch_get(scratch);
+            buffer_ensure_total(buf, (items - 1) * sizeof(NameEntry));
+            nameset_init_entries(set, (NameEntry*) buf->data, items - 1);
+        } else {
+            nameset_init(set);
+        }
+        for (j = 1; j < items; ++j) {
+            const char* nstr = "";
+            STRLEN nlen = 0;
+            if (SvOK(ST(j))) {
+                nstr = SvPV_const(ST(j), nlen);
+            }
+            nameset_add(set, nstr, nlen);
+        }
+    }
+    buf = scratch_get(scratch);
+    buffer_ensure_total(buf, set->count * sizeof(SV*));
+    values = (SV**) buf->data;
+    Zero(values, set->count, SV*);
+
+    pick_cookie(aTHX_ str, set, values);
+
+    /* return the values in the same order as the names */
+    EXTEND(SP, (int) set->count);
+    for (j = 0; j < (int) set->count; ++j) {
+        PUSHs(values[j] ? sv_2mortal(values[j]) : &PL_sv_undef);
+    }
+    SCRATCH_LEAVE();
+#line 2778 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_new)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "klass, allow_no_value= 0");
+    {
+#line 2195 "baker.xs"
+    CookieStream* stream = 0;
+#line 2794 "baker.c"
+	SV *	RETVAL;
+	char*	klass = (char *)SvPV_nolen(ST(0))
+;
+	IV	allow_no_value;
+
+	if (items < 2)
+	    allow_no_value = 0;
+	else {
+	    allow_no_value = (IV)SvIV(ST(1))
+;
+	}
+#line 2197 "baker.xs"
+    Newxz(stream, 1, CookieStream);
+    parser_init(&stream->parser);
+    stream->crushed = newHV();
+    stream->allow_no_value = allow_no_value;
+    RETVAL = sv_setref_pv(newSV(0), klass, stream);
+#line 2812 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_feed); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_feed)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, chunk");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 2207 "baker.xs"
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    unsigned int pos = 0;
+#line 2833 "baker.c"
+	HTTP__XSCookies__Parser	self;
+	SV*	chunk = ST(1)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Parser")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Parser,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Parser::feed",
+			"self", "HTTP::XSCookies::Parser",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2211 "baker.xs"
+    /* chunks are often substr() results, which need get magic */
+    SvGETMAGIC(chunk);
+    if (SvOK(chunk)) {
+        cstr = SvPV_nomg_const(chunk, clen);
+    }
+    while (1) {
+        unsigned int used = 0;
+        int got = parser_feed(&self->parser, cstr + pos, clen - pos, &used);
+        pos += used;
+        if (!got) {
+            break;
+        }
+        SP = stream_add_pair(aTHX_ self, SP);
+    }
+#line 2866 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_finish); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_finish)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	HTTP__XSCookies__Parser	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Parser")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Parser,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Parser::finish",
+			"self", "HTTP::XSCookies::Parser",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2229 "baker.xs"
+    if (parser_finish(&self->parser)) {
+        SP = stream_add_pair(aTHX_ self, SP);
+    }
+#line 2901 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_crushed); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_crushed)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	SV *	RETVAL;
+	HTTP__XSCookies__Parser	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Parser")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Parser,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Parser::crushed",
+			"self", "HTTP::XSCookies::Parser",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2236 "baker.xs"
+    RETVAL = newRV_inc((SV*) self->crushed);
+#line 2933 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_reset); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_reset)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Parser	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Parser")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Parser,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Parser::reset",
+			"self", "HTTP::XSCookies::Parser",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2242 "baker.xs"
+    parser_reset(&self->parser);
+    SvREFCNT_dec(self->crushed);
+    self->crushed = newHV();
+#line 2967 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2249 "baker.xs"
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+#line 2986 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Parser_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Parser_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Parser	self;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Parser,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"HTTP::XSCookies::Parser::DESTROY",
+			"self")
+;
+#line 2257 "baker.xs"
+    parser_fini(&self->parser);
+    SvREFCNT_dec(self->crushed);
+    Safefree(self);
+#line 3016 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Template_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Template_new)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "klass, attributes= 0");
+    {
+#line 2270 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    CookieTemplate* tmpl = 0;
+#line 3032 "baker.c"
+	SV *	RETVAL;
+	char*	klass = (char *)SvPV_nolen(ST(0))
+;
+	SV*	attributes;
+
+	if (items < 2)
+	    attributes = 0;
+	else {
+	    attributes = ST(1)
+;
+	}
+#line 2273 "baker.xs"
+    if (attributes && SvOK(attributes) &&
+        (!SvROK(attributes) || SvTYPE(SvRV(attributes)) != SVt_PVHV)) {
+        croak("Attributes for %s must be a hashref", klass);
+    }
+    Newxz(tmpl, 1, CookieTemplate);
+    buffer_init(&tmpl->tail, 0);
+    if (attributes && SvOK(attributes)) {
+        SCRATCH_ENTER(scratch);
+        build_template(aTHX_ (HV*) SvRV(attributes), tmpl);
+        SCRATCH_LEAVE();
+    }
+    RETVAL = sv_setref_pv(newSV(0), klass, tmpl);
+#line 3057 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Template_bake); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Template_bake)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "self, name, value");
+    {
+#line 2290 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+#line 3075 "baker.c"
+	SV *	RETVAL;
+	HTTP__XSCookies__Template	self;
+	SV*	name = ST(1)
+;
+	SV*	value = ST(2)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Template")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Template,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Template::bake",
+			"self", "HTTP::XSCookies::Template",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2293 "baker.xs"
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    bake_template(aTHX_ self, name, value, cookie);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+#line 3102 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Template_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Template_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2303 "baker.xs"
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+#line 3123 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Template_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Template_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Template	self;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Template,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"HTTP::XSCookies::Template::DESTROY",
+			"self")
+;
+#line 2311 "baker.xs"
+    buffer_fini(&self->tail);
+    if (self->expires) {
+        SvREFCNT_dec(self->expires);
+    }
+    Safefree(self);
+#line 3155 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_new)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "klass");
+    {
+#line 2326 "baker.xs"
+    Jar* jar = 0;
+#line 3170 "baker.c"
+	SV *	RETVAL;
+	char*	klass = (char *)SvPV_nolen(ST(0))
+;
+#line 2328 "baker.xs"
+    Newxz(jar, 1, Jar);
+    jar_init(jar);
+    RETVAL = sv_setref_pv(newSV(0), klass, jar);
+#line 3178 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_add); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_add)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "self, url, set_cookie, now= 0");
+    {
+#line 2336 "baker.xs"
+    JarRequest req;
+    double epoch = 0;
+    AV* headers = 0;
+    int count = 1;
+    int j = 0;
+#line 3199 "baker.c"
+	int	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__Jar	self;
+	SV*	url = ST(1)
+;
+	SV*	set_cookie = ST(2)
+;
+	SV*	now;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::add",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 4)
+	    now = 0;
+	else {
+	    now = ST(3)
+;
+	}
+#line 2342 "baker.xs"
+    get_jar_request(aTHX_ url, &req);
+    epoch = get_jar_now(aTHX_ now);
+    if (SvROK(set_cookie) && SvTYPE(SvRV(set_cookie)) == SVt_PVAV) {
+        headers = (AV*) SvRV(set_cookie);
+        count = av_len(headers) + 1;
+    }
+    RETVAL = 0;
+    for (j = 0; j < count; ++j) {
+        SV* header = set_cookie;
+        const char* hstr = 0;
+        STRLEN hlen = 0;
+        if (headers) {
+            SV** elem = av_fetch(headers, j, 0);
+            header = elem ? *elem : 0;
+        }
+        if (!header || !SvOK(header)) {
+            continue;
+        }
+        hstr = SvPV_const(header, hlen);
+        RETVAL += jar_store(self, &req, hstr, hlen, epoch);
+    }
+#line 3251 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_cookie_header); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_cookie_header)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "self, url, site= 0, now= 0");
+    {
+#line 2368 "baker.xs"
+    Scratch* scratch = get_scratch(aTHX);
+    JarRequest req;
+    int context = 0;
+    unsigned int mark = 0;
+    Buffer* header = 0;
+#line 3272 "baker.c"
+	SV *	RETVAL;
+	HTTP__XSCookies__Jar	self;
+	SV*	url = ST(1)
+;
+	SV*	site;
+	SV*	now;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::cookie_header",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 3)
+	    site = 0;
+	else {
+	    site = ST(2)
+;
+	}
+
+	if (items < 4)
+	    now = 0;
+	else {
+	    now = ST(3)
+;
+	}
+#line 2374 "baker.xs"
+    get_jar_request(aTHX_ url, &req);
+    context = get_jar_site(aTHX_ site);
+    mark = scratch_mark(scratch);
+    header = scratch_get(scratch);
+    jar_header(self, &req, context, get_jar_now(aTHX_ now), header);
+    RETVAL = newSVpvn(header->data, header->wpos);
+    scratch_release(scratch, mark);
+#line 3315 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_cookies); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_cookies)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "self, now= 0");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 2386 "baker.xs"
+    unsigned int j = 0;
+#line 3334 "baker.c"
+	HTTP__XSCookies__Jar	self;
+	SV*	now;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::cookies",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    now = 0;
+	else {
+	    now = ST(1)
+;
+	}
+#line 2388 "baker.xs"
+    jar_purge(self, get_jar_now(aTHX_ now));
+    EXTEND(SP, (int) self->count);
+    for (j = 0; j < self->dcount; ++j) {
+        int cpos = 0;
+        for (cpos = self->domains[j].first; cpos >= 0; cpos = self->cookies[cpos].next) {
+            mPUSHs(new_jar_cookie_sv(aTHX_ self, &self->cookies[cpos]));
+        }
+    }
+#line 3367 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_count); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_count)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "self, now= 0");
+    {
+	IV	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__Jar	self;
+	SV*	now;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::count",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    now = 0;
+	else {
+	    now = ST(1)
+;
+	}
+#line 2400 "baker.xs"
+    jar_purge(self, get_jar_now(aTHX_ now));
+    RETVAL = self->count;
+#line 3409 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_purge); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_purge)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "self, now= 0");
+    {
+	IV	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__Jar	self;
+	SV*	now;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::purge",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    now = 0;
+	else {
+	    now = ST(1)
+;
+	}
+#line 2407 "baker.xs"
+    RETVAL = jar_purge(self, get_jar_now(aTHX_ now));
+#line 3451 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_clear); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_clear)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Jar	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Jar")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Jar::clear",
+			"self", "HTTP::XSCookies::Jar",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2413 "baker.xs"
+    jar_clear(self);
+#line 3483 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2418 "baker.xs"
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+#line 3502 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Jar_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Jar_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Jar	self;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Jar,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"HTTP::XSCookies::Jar::DESTROY",
+			"self")
+;
+#line 2426 "baker.xs"
+    jar_fini(self);
+    Safefree(self);
+#line 3531 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_new)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "klass, ...");
+    {
+#line 2438 "baker.xs"
+    NameSet* set = 0;
+    int j = 0;
+#line 3547 "baker.c"
+	SV *	RETVAL;
+	char*	klass = (char *)SvPV_nolen(ST(0))
+;
+#line 2441 "baker.xs"
+    Newxz(set, 1, NameSet);
+    nameset_init(set);
+    for (j = 1; j < items; ++j) {
+        const char* nstr = 0;
+        STRLEN nlen = 0;
+        if (!SvOK(ST(j))) {
+            continue;
+        }
+        nstr = SvPV_const(ST(j), nlen);
+        if (nameset_find(set, nstr, nlen) < 0) {
+            nameset_add(set, nstr, nlen);
+        }
+    }
+    nameset_compile(set);
+    RETVAL = sv_setref_pv(newSV(0), klass, set);
+#line 3567 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_names); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_names)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 2461 "baker.xs"
+    unsigned int j = 0;
+#line 3586 "baker.c"
+	HTTP__XSCookies__NameSet	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::NameSet")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__NameSet,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::NameSet::names",
+			"self", "HTTP::XSCookies::NameSet",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2463 "baker.xs"
+    EXTEND(SP, (int) self->count);
+    for (j = 0; j < self->count; ++j) {
+        mPUSHp(self->entries[j].name, self->entries[j].nlen);
+    }
+#line 3607 "baker.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_contains); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_contains)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, name");
+    {
+#line 2471 "baker.xs"
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+#line 3624 "baker.c"
+	int	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__NameSet	self;
+	SV*	name = ST(1)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::NameSet")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__NameSet,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::NameSet::contains",
+			"self", "HTTP::XSCookies::NameSet",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2474 "baker.xs"
+    nstr = SvPV_const(name, nlen);
+    RETVAL = nameset_find(self, nstr, nlen) >= 0;
+#line 3647 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2481 "baker.xs"
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+#line 3668 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__NameSet_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__NameSet	self;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__NameSet,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"HTTP::XSCookies::NameSet::DESTROY",
+			"self")
+;
+#line 2489 "baker.xs"
+    nameset_fini(self);
+    Safefree(self);
+#line 3697 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_FETCH); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_FETCH)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, key");
+    {
+#line 2501 "baker.xs"
+    const char* kstr = 0;
+    STRLEN klen = 0;
+    int pos = 0;
+#line 3714 "baker.c"
+	SV *	RETVAL;
+	HTTP__XSCookies__Lazy	self;
+	SV*	key = ST(1)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::FETCH",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2505 "baker.xs"
+    kstr = SvPV_const(key, klen);
+    pos = pairs_find(&self->index, kstr, klen);
+    RETVAL = pos < 0 ? newSV(0) : SvREFCNT_inc(lazy_fetch(aTHX_ self, pos));
+#line 3737 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_EXISTS); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_EXISTS)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, key");
+    {
+#line 2513 "baker.xs"
+    const char* kstr = 0;
+    STRLEN klen = 0;
+#line 3755 "baker.c"
+	int	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__Lazy	self;
+	SV*	key = ST(1)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::EXISTS",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2516 "baker.xs"
+    kstr = SvPV_const(key, klen);
+    RETVAL = pairs_find(&self->index, kstr, klen) >= 0;
+#line 3778 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_FIRSTKEY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_FIRSTKEY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	SV *	RETVAL;
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::FIRSTKEY",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2523 "baker.xs"
+    self->iter = 0;
+    RETVAL = lazy_next_key(aTHX_ self);
+#line 3812 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_NEXTKEY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_NEXTKEY)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, last");
+    {
+	SV *	RETVAL;
+	HTTP__XSCookies__Lazy	self;
+	SV*	last = ST(1)
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::NEXTKEY",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2530 "baker.xs"
+    PERL_UNUSED_VAR(last);
+    RETVAL = lazy_next_key(aTHX_ self);
+#line 3848 "baker.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_SCALAR); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_SCALAR)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+#line 2537 "baker.xs"
+    unsigned int j = 0;
+#line 3865 "baker.c"
+	IV	RETVAL;
+	dXSTARG;
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::SCALAR",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2539 "baker.xs"
+    /* count each name once, just like keys() would */
+    RETVAL = 0;
+    for (j = 0; j < self->index.count; ++j) {
+        if (!pairs_is_repeated(&self->index, j)) {
+            ++RETVAL;
+        }
+    }
+#line 3891 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_STORE); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_STORE)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "self, ...");
+    {
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::STORE",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2551 "baker.xs"
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+#line 3924 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_DELETE); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_DELETE)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "self, ...");
+    {
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::DELETE",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2557 "baker.xs"
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+#line 3955 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_CLEAR); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_CLEAR)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "HTTP::XSCookies::Lazy")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"HTTP::XSCookies::Lazy::CLEAR",
+			"self", "HTTP::XSCookies::Lazy",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2563 "baker.xs"
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+#line 3986 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2569 "baker.xs"
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+#line 4005 "baker.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_HTTP__XSCookies__Lazy_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	HTTP__XSCookies__Lazy	self;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    self = INT2PTR(HTTP__XSCookies__Lazy,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"HTTP::XSCookies::Lazy::DESTROY",
+			"self")
+;
+#line 2577 "baker.xs"
+    pairs_fini(&self->index);
+    SvREFCNT_dec(self->values);
+    if (self->str) {
+        SvREFCNT_dec(self->str);
+    }
+    Safefree(self);
+#line 4038 "baker.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_HTTP__XSCookies); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_HTTP__XSCookies)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("HTTP::XSCookies::CLONE", XS_HTTP__XSCookies_CLONE);
+        newXS_deffile("HTTP::XSCookies::bake_cookie", XS_HTTP__XSCookies_bake_cookie);
+        newXS_deffile("HTTP::XSCookies::bake_cookies", XS_HTTP__XSCookies_bake_cookies);
+        newXS_deffile("HTTP::XSCookies::bake_signed_cookie", XS_HTTP__XSCookies_bake_signed_cookie);
+        newXS_deffile("HTTP::XSCookies::verify_signed_cookie", XS_HTTP__XSCookies_verify_signed_cookie);
+        newXS_deffile("HTTP::XSCookies::bake_sealed_cookie", XS_HTTP__XSCookies_bake_sealed_cookie);
+        newXS_deffile("HTTP::XSCookies::open_sealed_cookie", XS_HTTP__XSCookies_open_sealed_cookie);
+        newXS_deffile("HTTP::XSCookies::unpack_cookie_value", XS_HTTP__XSCookies_unpack_cookie_value);
+        newXS_deffile("HTTP::XSCookies::decompress_cookie_value", XS_HTTP__XSCookies_decompress_cookie_value);
+        newXS_deffile("HTTP::XSCookies::crush_cookie", XS_HTTP__XSCookies_crush_cookie);
+        newXS_deffile("HTTP::XSCookies::crush_set_cookie", XS_HTTP__XSCookies_crush_set_cookie);
+        newXS_deffile("HTTP::XSCookies::parse_http_date", XS_HTTP__XSCookies_parse_http_date);
+        newXS_deffile("HTTP::XSCookies::public_suffix", XS_HTTP__XSCookies_public_suffix);
+        newXS_deffile("HTTP::XSCookies::uri_encode", XS_HTTP__XSCookies_uri_encode);
+        newXS_deffile("HTTP::XSCookies::uri_decode", XS_HTTP__XSCookies_uri_decode);
+        newXS_deffile("HTTP::XSCookies::uri_encode_append", XS_HTTP__XSCookies_uri_encode_append);
+        newXS_deffile("HTTP::XSCookies::uri_decode_append", XS_HTTP__XSCookies_uri_decode_append);
+        newXS_deffile("HTTP::XSCookies::uri_encode_inplace", XS_HTTP__XSCookies_uri_encode_inplace);
+        newXS_deffile("HTTP::XSCookies::uri_decode_inplace", XS_HTTP__XSCookies_uri_decode_inplace);
+        newXS_deffile("HTTP::XSCookies::crush_cookies", XS_HTTP__XSCookies_crush_cookies);
+        newXS_deffile("HTTP::XSCookies::crush_cookie_lazy", XS_HTTP__XSCookies_crush_cookie_lazy);
+        newXS_deffile("HTTP::XSCookies::_scratch_stats", XS_HTTP__XSCookies__scratch_stats);
+        newXS_deffile("HTTP::XSCookies::_gmem_allocs", XS_HTTP__XSCookies__gmem_allocs);
+        newXS_deffile("HTTP::XSCookies::_chacha20", XS_HTTP__XSCookies__chacha20);
+        newXS_deffile("HTTP::XSCookies::_poly1305", XS_HTTP__XSCookies__poly1305);
+        newXS_deffile("HTTP::XSCookies::_aead_seal", XS_HTTP__XSCookies__aead_seal);
+        newXS_deffile("HTTP::XSCookies::_aead_open", XS_HTTP__XSCookies__aead_open);
+        newXS_deffile("HTTP::XSCookies::crush_cookie_get", XS_HTTP__XSCookies_crush_cookie_get);
+        newXS_deffile("HTTP::XSCookies::crush_cookie_pick", XS_HTTP__XSCookies_crush_cookie_pick);
+        newXS_deffile("HTTP::XSCookies::Parser::new", XS_HTTP__XSCookies__Parser_new);
+        newXS_deffile("HTTP::XSCookies::Parser::feed", XS_HTTP__XSCookies__Parser_feed);
+        newXS_deffile("HTTP::XSCookies::Parser::finish", XS_HTTP__XSCookies__Parser_finish);
+        newXS_deffile("HTTP::XSCookies::Parser::crushed", XS_HTTP__XSCookies__Parser_crushed);
+        newXS_deffile("HTTP::XSCookies::Parser::reset", XS_HTTP__XSCookies__Parser_reset);
+        newXS_deffile("HTTP::XSCookies::Parser::CLONE_SKIP", XS_HTTP__XSCookies__Parser_CLONE_SKIP);
+        newXS_deffile("HTTP::XSCookies::Parser::DESTROY", XS_HTTP__XSCookies__Parser_DESTROY);
+        newXS_deffile("HTTP::XSCookies::Template::new", XS_HTTP__XSCookies__Template_new);
+        newXS_deffile("HTTP::XSCookies::Template::bake", XS_HTTP__XSCookies__Template_bake);
+        newXS_deffile("HTTP::XSCookies::Template::CLONE_SKIP", XS_HTTP__XSCookies__Template_CLONE_SKIP);
+        newXS_deffile("HTTP::XSCookies::Template::DESTROY", XS_HTTP__XSCookies__Template_DESTROY);
+        newXS_deffile("HTTP::XSCookies::Jar::new", XS_HTTP__XSCookies__Jar_new);
+        newXS_deffile("HTTP::XSCookies::Jar::add", XS_HTTP__XSCookies__Jar_add);
+        newXS_deffile("HTTP::XSCookies::Jar::cookie_header", XS_HTTP__XSCookies__Jar_cookie_header);
+        newXS_deffile("HTTP::XSCookies::Jar::cookies", XS_HTTP__XSCookies__Jar_cookies);
+        newXS_deffile("HTTP::XSCookies::Jar::count", XS_HTTP__XSCookies__Jar_count);
+        newXS_deffile("HTTP::XSCookies::Jar::purge", XS_HTTP__XSCookies__Jar_purge);
+        newXS_deffile("HTTP::XSCookies::Jar::clear", XS_HTTP__XSCookies__Jar_clear);
+        newXS_deffile("HTTP::XSCookies::Jar::CLONE_SKIP", XS_HTTP__XSCookies__Jar_CLONE_SKIP);
+        newXS_deffile("HTTP::XSCookies::Jar::DESTROY", XS_HTTP__XSCookies__Jar_DESTROY);
+        newXS_deffile("HTTP::XSCookies::NameSet::new", XS_HTTP__XSCookies__NameSet_new);
+        newXS_deffile("HTTP::XSCookies::NameSet::names", XS_HTTP__XSCookies__NameSet_names);
+        newXS_deffile("HTTP::XSCookies::NameSet::contains", XS_HTTP__XSCookies__NameSet_contains);
+        newXS_deffile("HTTP::XSCookies::NameSet::CLONE_SKIP", XS_HTTP__XSCookies__NameSet_CLONE_SKIP);
+        newXS_deffile("HTTP::XSCookies::NameSet::DESTROY", XS_HTTP__XSCookies__NameSet_DESTROY);
+        newXS_deffile("HTTP::XSCookies::Lazy::FETCH", XS_HTTP__XSCookies__Lazy_FETCH);
+        newXS_deffile("HTTP::XSCookies::Lazy::EXISTS", XS_HTTP__XSCookies__Lazy_EXISTS);
+        newXS_deffile("HTTP::XSCookies::Lazy::FIRSTKEY", XS_HTTP__XSCookies__Lazy_FIRSTKEY);
+        newXS_deffile("HTTP::XSCookies::Lazy::NEXTKEY", XS_HTTP__XSCookies__Lazy_NEXTKEY);
+        newXS_deffile("HTTP::XSCookies::Lazy::SCALAR", XS_HTTP__XSCookies__Lazy_SCALAR);
+        newXS_deffile("HTTP::XSCookies::Lazy::STORE", XS_HTTP__XSCookies__Lazy_STORE);
+        newXS_deffile("HTTP::XSCookies::Lazy::DELETE", XS_HTTP__XSCookies__Lazy_DELETE);
+        newXS_deffile("HTTP::XSCookies::Lazy::CLEAR", XS_HTTP__XSCookies__Lazy_CLEAR);
+        newXS_deffile("HTTP::XSCookies::Lazy::CLONE_SKIP", XS_HTTP__XSCookies__Lazy_CLONE_SKIP);
+        newXS_deffile("HTTP::XSCookies::Lazy::DESTROY", XS_HTTP__XSCookies__Lazy_DESTROY);
+
+    /* Initialisation Section */
+
+#line 1514 "baker.xs"
+{
+    MY_CXT_INIT;
+    date_cache_init(&MY_CXT.date_cache);
+    scratch_init(&MY_CXT.scratch);
+    call_atexit(scratch_destroy, 0);
+    sign_key_init(&MY_CXT.sign_key);
+    seal_nonces_init(&MY_CXT.seal_nonces);
+    scan_init();
+}
+
+#line 4149 "baker.c"
+
+    /* End of Initialisation Section */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
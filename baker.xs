@@ -6,8 +6,20 @@
 
 #include <string.h>
 #include "buffer.h"
+#include "scratch.h"
 #include "uri.h"
+#include "scan.h"
 #include "cookie.h"
+#include "pairs.h"
+#include "names.h"
+#include "parser.h"
+#include "date.h"
+#include "sign.h"
+#include "seal.h"
+#include "pack.h"
+#include "compress.h"
+#include "psl.h"
+#include "jar.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #define snprintf    _snprintf
@@ -31,6 +43,114 @@
 #define COOKIE_NAME_HTTP_ONLY  "HttpOnly"
 #define COOKIE_NAME_SAME_SITE  "SameSite"
 
+/*
+ * Not fields: flags that ask for the value to be packed (see pack.h) or
+ * compressed (see compress.h).
+ */
+#define COOKIE_NAME_PACKED     "packed"
+#define COOKIE_NAME_COMPRESS   "compress"
+
+/*
+ * Per-interpreter data.
+ */
+#define MY_CXT_KEY "HTTP::XSCookies::_guts" XS_VERSION
+
+typedef struct {
+    DateCache date_cache;   /* last formatted Expires date */
+    Scratch scratch;        /* scratch buffers, reused by all calls */
+    SignKey sign_key;       /* last key used to sign cookies */
+    SealNonces seal_nonces; /* nonces to seal cookies */
+} my_cxt_t;
+
+START_MY_CXT
+
+/*
+ * Scratch buffers come from a per-interpreter pool (see scratch.h), so
+ * that once the pool has warmed up we allocate no memory for them.  Each
+ * function gives back the buffers it takes; XSUBs that can run Perl code
+ * (magic, overloading) while holding buffers use SCRATCH_ENTER / LEAVE,
+ * so that the buffers are also given back if that code dies.
+ */
+static Scratch* get_scratch(pTHX)
+{
+    dMY_CXT;
+    return &MY_CXT.scratch;
+}
+
+static void scratch_unwind(pTHX_ void* mark)
+{
+    scratch_release(get_scratch(aTHX), (unsigned int) PTR2UV(mark));
+}
+
+static void scratch_destroy(pTHX_ void* unused)
+{
+    PERL_UNUSED_VAR(unused);
+    scratch_fini(get_scratch(aTHX));
+}
+
+#define SCRATCH_ENTER(scratch) \
+    do { \
+        ENTER; \
+        SAVEDESTRUCTOR_X(scratch_unwind, INT2PTR(void*, (UV) scratch_mark(scratch))); \
+    } while (0)
+
+#define SCRATCH_LEAVE() \
+    LEAVE
+
+/*
+ * A lazily crushed cookie: when created, we only build an index of the
+ * pairs in the cookie, and each value is decoded the first time it is
+ * fetched.  This is the object behind the (tied) hash returned by
+ * crush_cookie_lazy().
+ */
+typedef struct LazyCookie {
+    SV* str;            /* private (COW if possible) copy of the cookie */
+    AV* values;         /* values already decoded, by position in index */
+    unsigned int iter;  /* current position for FIRSTKEY / NEXTKEY */
+    PairIndex index;
+} LazyCookie;
+
+typedef LazyCookie* HTTP__XSCookies__Lazy;
+typedef NameSet* HTTP__XSCookies__NameSet;
+
+/*
+ * A cookie being crushed incrementally, as its chunks arrive; this is the
+ * object behind HTTP::XSCookies::Parser.  The pairs parsed so far are kept
+ * in a hash, with the same rules as crush_cookie().
+ */
+typedef struct CookieStream {
+    CookieParser parser;
+    HV* crushed;
+    int allow_no_value;
+} CookieStream;
+
+typedef CookieStream* HTTP__XSCookies__Parser;
+
+/*
+ * A template to bake many cookies with the same attributes: the attributes
+ * are rendered once, when the template is created, and baking a cookie just
+ * needs to encode its name and value and append the rendered attributes.
+ * An Expires attribute relative to the current time is rendered every time.
+ */
+typedef struct CookieTemplate {
+    Buffer tail;        /* all attributes, already rendered */
+    SV* expires;        /* relative Expires attribute, if any */
+} CookieTemplate;
+
+typedef CookieTemplate* HTTP__XSCookies__Template;
+
+typedef Jar* HTTP__XSCookies__Jar;
+
+/*
+ * How to protect a value when baking a cookie: sign it with a key for
+ * HMAC-SHA256 (see sign.h) or seal it with a key for ChaCha20-Poly1305
+ * (see seal.h).
+ */
+typedef struct CookieGuard {
+    const HmacSha256* sign;
+    const unsigned char* seal;
+} CookieGuard;
+
 static void get_encoded_value(pTHX_ SV* value, Buffer* encoded, int encode)
 {
     SV* ref = 0;
@@ -57,7 +177,9 @@ static void get_encoded_value(pTHX_ SV* value, Buffer* encoded, int encode)
     if (SvTYPE(ref) == SVt_PVAV) {
         AV* values = (AV*) ref;
         int count = 0;
-        buffer_init(&unencoded , 0);
+        Scratch* scratch = get_scratch(aTHX);
+        unsigned int mark = scratch_mark(scratch);
+        Buffer* joined = scratch_get(scratch);
         while (1) {
             SV* elem = av_shift(values);
             if (!elem || elem == &PL_sv_undef) {
@@ -68,27 +190,307 @@ static void get_encoded_value(pTHX_ SV* value, Buffer* encoded, int encode)
             }
             vstr = SvPV_const(elem, vlen);
             if (count) {
-                buffer_append_str(&unencoded, "&", 1);
+                buffer_append_str(joined, "&", 1);
             }
-            buffer_append_str(&unencoded, vstr, vlen);
+            buffer_append_str(joined, vstr, vlen);
             ++count;
         }
         if (encode) {
-            url_encode(&unencoded, encoded);
+            url_encode(joined, encoded);
         } else {
-            buffer_append_buf(encoded, &unencoded);
+            buffer_append_buf(encoded, joined);
         }
-        buffer_fini(&unencoded);
+        scratch_release(scratch, mark);
     }
 
     /* don't know (yet) how to deal with other ref types */
 }
 
+/*
+ * Pack a scalar; croak if it is a reference, since we only pack flat
+ * arrays and hashes.
+ */
+static void pack_scalar(pTHX_ SV* value, Buffer* packed)
+{
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    int negative = 0;
+    unsigned long long num = 0;
+
+    if (!SvOK(value)) {
+        pack_put_undef(packed);
+        return;
+    }
+    if (SvROK(value)) {
+        croak("Packed cookie values can only have strings and numbers");
+    }
+
+    vstr = SvPV_const(value, vlen);
+    if (pack_scan_int(vstr, vlen, &negative, &num)) {
+        pack_put_int(packed, negative, num);
+    } else {
+        pack_put_string(packed, vstr, vlen, SvUTF8(value) ? 1 : 0);
+    }
+}
+
+/*
+ * Pack a value, which can be a string, an arrayref or a hashref, and put
+ * it in a buffer in base64url.
+ */
+static void get_packed_value(pTHX_ SV* value, Buffer* encoded)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* packed = scratch_get(scratch);
+    SV* ref = SvROK(value) ? SvRV(value) : 0;
+
+    if (ref && SvTYPE(ref) == SVt_PVAV) {
+        AV* values = (AV*) ref;
+        SSize_t top = av_len(values);
+        SSize_t j = 0;
+        pack_put_list(packed, PACK_TYPE_ARRAY, (unsigned int) (top + 1));
+        for (j = 0; j <= top; ++j) {
+            SV** elem = av_fetch(values, j, 0);
+            pack_scalar(aTHX_ elem ? *elem : &PL_sv_undef, packed);
+        }
+    } else if (ref && SvTYPE(ref) == SVt_PVHV) {
+        /* pack the pairs first, since we only know how many there are
+         * (for example, for a tied hash) after going over them */
+        HV* values = (HV*) ref;
+        Buffer* pairs = scratch_get(scratch);
+        unsigned int count = 0;
+        HE* entry = 0;
+        hv_iterinit(values);
+        while ((entry = hv_iternext(values))) {
+            STRLEN klen = 0;
+            const char* kstr = HePV(entry, klen);
+            pack_put_string(pairs, kstr, klen, HeUTF8(entry) ? 1 : 0);
+            pack_scalar(aTHX_ hv_iterval(values, entry), pairs);
+            ++count;
+        }
+        pack_put_list(packed, PACK_TYPE_HASH, count);
+        buffer_append_buf(packed, pairs);
+    } else {
+        pack_scalar(aTHX_ value, packed);
+    }
+
+    buffer_reset(encoded);
+    base64_encode(packed->data, packed->wpos, encoded);
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Create an SV for an item in a packed value; return 0 if the item is not
+ * a valid scalar.
+ */
+static SV* new_packed_sv(pTHX_ const PackItem* item)
+{
+    SV* sv = 0;
+
+    switch (item->type) {
+    case PACK_TYPE_UNDEF:
+        return newSV(0);
+
+    case PACK_TYPE_BYTES:
+        return newSVpvn(item->str, item->len);
+
+    case PACK_TYPE_UTF8:
+        /* is_utf8_string() would use strlen() for an empty string */
+        if (item->len && !is_utf8_string((const U8*) item->str, item->len)) {
+            return 0;
+        }
+        sv = newSVpvn(item->str, item->len);
+        SvUTF8_on(sv);
+        return sv;
+
+    case PACK_TYPE_INT:
+        if (item->negative) {
+            return item->num - 1 <= (unsigned long long) IV_MAX
+                 ? newSViv(-1 - (IV) (item->num - 1))
+                 : newSVnv(-(NV) item->num);
+        }
+        if (item->num <= (unsigned long long) IV_MAX) {
+            return newSViv((IV) item->num);
+        }
+        return item->num <= (unsigned long long) UV_MAX
+             ? newSVuv((UV) item->num)
+             : newSVnv((NV) item->num);
+    }
+
+    return 0;
+}
+
+/*
+ * Unpack a whole packed value into a new SV (a string, an arrayref or a
+ * hashref); return 0 if it is not valid.
+ */
+static SV* unpack_value(pTHX_ Buffer* packed)
+{
+    PackItem item;
+    SV* result = 0;
+    unsigned long long j = 0;
+
+    if (!pack_get_item(packed, &item)) {
+        return 0;
+    }
+
+    if (item.type == PACK_TYPE_ARRAY) {
+        AV* array = 0;
+        /* each element takes at least one byte; checking this first means
+         * a bogus count cannot make us allocate a huge array */
+        if (item.num > buffer_used(packed)) {
+            return 0;
+        }
+        array = newAV();
+        result = newRV_noinc((SV*) array);
+        if (item.num) {
+            av_extend(array, (SSize_t) item.num - 1);
+        }
+        for (j = 0; j < item.num; ++j) {
+            PackItem elem;
+            SV* sv = 0;
+            if (!pack_get_item(packed, &elem) || !(sv = new_packed_sv(aTHX_ &elem))) {
+                SvREFCNT_dec(result);
+                return 0;
+            }
+            av_push(array, sv);
+        }
+    } else if (item.type == PACK_TYPE_HASH) {
+        HV* hash = 0;
+        if (item.num > buffer_used(packed) / 2) {
+            return 0;
+        }
+        hash = newHV();
+        result = newRV_noinc((SV*) hash);
+        for (j = 0; j < item.num; ++j) {
+            PackItem key;
+            PackItem elem;
+            SV* sv = 0;
+            if (!pack_get_item(packed, &key) ||
+                (key.type != PACK_TYPE_BYTES && key.type != PACK_TYPE_UTF8) ||
+                (key.type == PACK_TYPE_UTF8 && key.len &&
+                 !is_utf8_string((const U8*) key.str, key.len)) ||
+                !pack_get_item(packed, &elem) ||
+                !(sv = new_packed_sv(aTHX_ &elem))) {
+                SvREFCNT_dec(result);
+                return 0;
+            }
+            /* a negative length tells hv_store the key is in UTF-8 */
+            hv_store(hash, key.str, key.type == PACK_TYPE_UTF8 ? -(I32) key.len : (I32) key.len, sv, 0);
+        }
+    } else {
+        result = new_packed_sv(aTHX_ &item);
+    }
+
+    /* there can be nothing after the value */
+    if (result && buffer_used(packed)) {
+        SvREFCNT_dec(result);
+        result = 0;
+    }
+    return result;
+}
+
+/*
+ * Add to a cookie the attribute with a given name and value.
+ * Names for unknown attributes are silently ignored.
+ */
+static void put_attribute(pTHX_ Buffer* cookie, const char* kstr,
+                          SV* value, Buffer* encoded)
+{
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    dMY_CXT;
+
+    /* value could be a string or an array, so need to encode it */
+    get_encoded_value(aTHX_ value, encoded, 0);
+    vstr = encoded->data;
+    vlen = encoded->wpos;
+    if (vstr == 0) {
+        return;
+    }
+
+    /* TODO: should we skip if vstr is invalid / empty? */
+
+    if        (strcasecmp(kstr, COOKIE_NAME_DOMAIN) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_DOMAIN   , sizeof(COOKIE_NAME_DOMAIN)      - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_PATH      ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_PATH     , sizeof(COOKIE_NAME_PATH)        - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_MAX_AGE   ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_MAX_AGE  , sizeof(COOKIE_NAME_MAX_AGE)     - 1, vstr, vlen, 0, 0);
+    } else if (strcasecmp(kstr, COOKIE_NAME_EXPIRES   ) == 0) {
+        cookie_put_date (cookie, COOKIE_NAME_EXPIRES    , sizeof(COOKIE_NAME_EXPIRES)     - 1, vstr, vlen, &MY_CXT.date_cache);
+    } else if (strcasecmp(kstr, COOKIE_NAME_SECURE    ) == 0) {
+        cookie_put_boolean(cookie, COOKIE_NAME_SECURE   , sizeof(COOKIE_NAME_SECURE)      - 1, SvTRUE(value));
+    } else if (strcasecmp(kstr, COOKIE_NAME_HTTP_ONLY ) == 0) {
+        cookie_put_boolean(cookie, COOKIE_NAME_HTTP_ONLY, sizeof(COOKIE_NAME_HTTP_ONLY)   - 1, SvTRUE(value));
+    } else if (strcasecmp(kstr, COOKIE_NAME_SAME_SITE ) == 0) {
+        cookie_put_string (cookie, COOKIE_NAME_SAME_SITE  , sizeof(COOKIE_NAME_SAME_SITE) - 1, vstr, vlen, 0, 0);
+    }
+}
+
+/*
+ * Sign or seal the value in a buffer for a cookie with the given name, as
+ * a guard says.
+ */
+static void guard_value(pTHX_ const CookieGuard* guard,
+                        const char* name, unsigned int nlen, Buffer* value)
+{
+    Scratch* scratch = 0;
+    unsigned int mark = 0;
+    Buffer* sealed = 0;
+    int ok = 0;
+    dMY_CXT;
+
+    if (guard->sign) {
+        sign_append(value, name, nlen, guard->sign);
+        return;
+    }
+
+    scratch = get_scratch(aTHX);
+    mark = scratch_mark(scratch);
+    sealed = scratch_get(scratch);
+    ok = seal_append(value, name, nlen, guard->seal, &MY_CXT.seal_nonces, sealed);
+    if (ok) {
+        buffer_reset(value);
+        buffer_append_buf(value, sealed);
+    }
+    scratch_release(scratch, mark);
+    if (!ok) {
+        croak("Could not get random bytes to seal a cookie");
+    }
+}
+
+/*
+ * Compress the value in a buffer, if that makes it shorter than it would
+ * be otherwise (URL-encoded, if encode is non-zero); return whether it
+ * was compressed.
+ */
+static int compress_value(pTHX_ Buffer* value, int encode)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* compressed = scratch_get(scratch);
+    unsigned int limit = encode
+                       ? url_encoded_len(value->data + value->rpos, buffer_used(value))
+                       : buffer_used(value);
+    int ok = compress_append(value, limit, compressed);
+
+    if (ok) {
+        buffer_reset(value);
+        buffer_append_buf(value, compressed);
+    }
+    scratch_release(scratch, mark);
+    return ok;
+}
+
 /*
  * Given a name and a value, which can be a string or a hashref,
- * build a cookie with that data.
+ * build a cookie with that data.  Buffer encoded is used as scratch
+ * space; this allows reusing it when baking many cookies.  If a guard
+ * is given, the value is signed or sealed as it says.
  */
-static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
+static void build_cookie(pTHX_ SV* pname, SV* pvalue, const CookieGuard* guard,
+                         Buffer* cookie, Buffer* encoded)
 {
     const char* nstr = 0;
     STRLEN nlen = 0;
@@ -97,7 +499,10 @@ static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
     SV* ref = 0;
     HV* values = 0;
     SV** nval = 0;
-    Buffer encoded;
+    SV** flag = 0;
+    int packed = 0;
+    int compress = 0;
+    int encode = 0;
 
     /* name not a valid string? bail out */
     if (!SvOK(pname) || !SvPOK(pname)) {
@@ -114,6 +519,13 @@ static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
     if (SvPOK(pvalue)) {
         /* value is a simple string */
         vstr = SvPV_const(pvalue, vlen);
+        if (guard) {
+            buffer_reset(encoded);
+            buffer_append_str(encoded, vstr, vlen);
+            guard_value(aTHX_ guard, nstr, nlen, encoded);
+            vstr = encoded->data;
+            vlen = encoded->wpos;
+        }
         cookie_put_string(cookie, nstr, nlen, vstr, vlen, 1, 1);
         return;
     }
@@ -136,11 +548,33 @@ static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
         return;
     }
 
-    buffer_init(&encoded , 0);
+    flag = hv_fetch(values, COOKIE_NAME_PACKED, sizeof(COOKIE_NAME_PACKED) - 1, 0);
+    packed = flag && SvTRUE(*flag);
+    flag = hv_fetch(values, COOKIE_NAME_COMPRESS, sizeof(COOKIE_NAME_COMPRESS) - 1, 0);
+    compress = flag && SvTRUE(*flag);
+
+    /* the length of a sealed value would tell something about its contents,
+     * so don't let secrets be compressed along with other data */
+    if (compress && guard && guard->seal) {
+        croak("Cannot compress a value that will be sealed");
+    }
 
-    /* first store cookie name and value, URL-encoding both */
-    get_encoded_value(aTHX_ *nval, &encoded, 1);
-    cookie_put_string(cookie, nstr, nlen, encoded.data, encoded.wpos, 1, 0);
+    /* first store cookie name and value, URL-encoding both; a value to be
+     * compressed, signed or sealed is encoded after that, and a packed or
+     * compressed value is in base64url, which needs no encoding */
+    if (packed) {
+        get_packed_value(aTHX_ *nval, encoded);
+    } else {
+        encode = guard || compress;
+        get_encoded_value(aTHX_ *nval, encoded, !encode);
+    }
+    if (compress && compress_value(aTHX_ encoded, encode)) {
+        encode = 0;
+    }
+    if (guard) {
+        guard_value(aTHX_ guard, nstr, nlen, encoded);
+    }
+    cookie_put_string(cookie, nstr, nlen, encoded->data, encoded->wpos, 1, encode);
 
     /* now iterate over all other values */
     hv_iterinit(values);
@@ -160,7 +594,9 @@ static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
             continue;
         }
 
-        if (strcmp(kstr, COOKIE_NAME_VALUE) == 0) {
+        if (strcmp(kstr, COOKIE_NAME_VALUE) == 0 ||
+            strcmp(kstr, COOKIE_NAME_PACKED) == 0 ||
+            strcmp(kstr, COOKIE_NAME_COMPRESS) == 0) {
             /* name was already processed */
             continue;
         }
@@ -170,46 +606,207 @@ static void build_cookie(pTHX_ SV* pname, SV* pvalue, Buffer* cookie)
             continue;
         }
 
-        /* value could be a string or an array, so need to encode it */
-        get_encoded_value(aTHX_ value, &encoded, 0);
-        vstr = encoded.data;
-        vlen = encoded.wpos;
-        if (vstr == 0) {
+        put_attribute(aTHX_ cookie, kstr, value, encoded);
+    }
+}
+
+/*
+ * Get the key used to sign cookies, ready to use; croak if there is no
+ * valid key, since a cookie signed with an empty key is not signed at all.
+ */
+static const HmacSha256* get_signing_key(pTHX_ SV* key, const char* func)
+{
+    const char* kstr = 0;
+    STRLEN klen = 0;
+    dMY_CXT;
+
+    if (SvOK(key)) {
+        kstr = SvPV_const(key, klen);
+    }
+    if (!klen) {
+        croak("Key for %s must be a non-empty string", func);
+    }
+    return sign_key_get(&MY_CXT.sign_key, kstr, klen);
+}
+
+/*
+ * Copy the key used to seal cookies; croak if it does not have the right
+ * length.
+ */
+static void get_sealing_key(pTHX_ SV* key, unsigned char copy[AEAD_KEY_LEN], const char* func)
+{
+    const char* kstr = 0;
+    STRLEN klen = 0;
+
+    if (SvOK(key)) {
+        kstr = SvPV_const(key, klen);
+    }
+    if (klen != AEAD_KEY_LEN) {
+        croak("Key for %s must be a string of %d bytes", func, AEAD_KEY_LEN);
+    }
+    memcpy(copy, kstr, AEAD_KEY_LEN);
+}
+
+/*
+ * Get the bytes in an argument for the functions we only use to test the
+ * AEAD primitives; croak if it is not defined or, if we want a given length,
+ * it does not have it.
+ */
+static const unsigned char* get_test_bytes(pTHX_ SV* sv, STRLEN* len, STRLEN want)
+{
+    const char* str = 0;
+    if (!SvOK(sv)) {
+        croak("Undefined argument");
+    }
+    str = SvPV_const(sv, *len);
+    if (want && *len != want) {
+        croak("Argument must be a string of %d bytes", (int) want);
+    }
+    return (const unsigned char*) str;
+}
+
+/*
+ * Render all the attributes in a hash into a template; a relative Expires
+ * attribute is just remembered, to be rendered when baking each cookie.
+ */
+static void build_template(pTHX_ HV* values, CookieTemplate* tmpl)
+{
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* encoded = scratch_get(scratch);
+
+    hv_iterinit(values);
+    while (1) {
+        SV* value = 0;
+        I32 klen = 0;
+        char* kstr = 0;
+        HE* entry = hv_iternext(values);
+        if (!entry) {
+            break;
+        }
+
+        kstr = hv_iterkey(entry, &klen);
+        if (!kstr || klen <= 0) {
+            continue;
+        }
+
+        if (strcmp(kstr, COOKIE_NAME_VALUE) == 0) {
+            /* values are given for each cookie */
             continue;
         }
 
-        /* TODO: should we skip if vstr is invalid / empty? */
+        value = hv_iterval(values, entry);
+        if (!SvOK(value)) {
+            continue;
+        }
 
-        if        (strcasecmp(kstr, COOKIE_NAME_DOMAIN) == 0) {
-            cookie_put_string (cookie, COOKIE_NAME_DOMAIN   , sizeof(COOKIE_NAME_DOMAIN)      - 1, vstr, vlen, 0, 0);
-        } else if (strcasecmp(kstr, COOKIE_NAME_PATH      ) == 0) {
-            cookie_put_string (cookie, COOKIE_NAME_PATH     , sizeof(COOKIE_NAME_PATH)        - 1, vstr, vlen, 0, 0);
-        } else if (strcasecmp(kstr, COOKIE_NAME_MAX_AGE   ) == 0) {
-            cookie_put_string (cookie, COOKIE_NAME_MAX_AGE  , sizeof(COOKIE_NAME_MAX_AGE)     - 1, vstr, vlen, 0, 0);
-        } else if (strcasecmp(kstr, COOKIE_NAME_EXPIRES   ) == 0) {
-            cookie_put_date (cookie, COOKIE_NAME_EXPIRES    , sizeof(COOKIE_NAME_EXPIRES)     - 1, vstr, vlen);
-        } else if (strcasecmp(kstr, COOKIE_NAME_SECURE    ) == 0) {
-            cookie_put_boolean(cookie, COOKIE_NAME_SECURE   , sizeof(COOKIE_NAME_SECURE)      - 1, SvTRUE(value));
-        } else if (strcasecmp(kstr, COOKIE_NAME_HTTP_ONLY ) == 0) {
-            cookie_put_boolean(cookie, COOKIE_NAME_HTTP_ONLY, sizeof(COOKIE_NAME_HTTP_ONLY)   - 1, SvTRUE(value));
-        } else if (strcasecmp(kstr, COOKIE_NAME_SAME_SITE ) == 0) {
-            cookie_put_string (cookie, COOKIE_NAME_SAME_SITE  , sizeof(COOKIE_NAME_SAME_SITE) - 1, vstr, vlen, 0, 0);
+        if (strcasecmp(kstr, COOKIE_NAME_EXPIRES) == 0 && !SvROK(value)) {
+            STRLEN vlen = 0;
+            const char* vstr = SvPV_const(value, vlen);
+            if (date_is_relative(vstr, vlen)) {
+                tmpl->expires = newSVpvn(vstr, vlen);
+                continue;
+            }
         }
+
+        put_attribute(aTHX_ &tmpl->tail, kstr, value, encoded);
+    }
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Bake a cookie with a given name and value, using a template.
+ */
+static void bake_template(pTHX_ const CookieTemplate* tmpl,
+                          SV* pname, SV* pvalue, Buffer* cookie)
+{
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    dMY_CXT;
+
+    /* name or value not a valid string? bail out, just like build_cookie() */
+    if (!SvOK(pname) || !SvPOK(pname) || !SvOK(pvalue) || !SvPOK(pvalue)) {
+        return;
+    }
+
+    nstr = SvPV_const(pname, nlen);
+    vstr = SvPV_const(pvalue, vlen);
+    buffer_ensure_unused(cookie, 3 * (nlen + vlen) + 3 + tmpl->tail.wpos);
+    cookie_put_string(cookie, nstr, nlen, vstr, vlen, 1, 1);
+    if (tmpl->tail.wpos) {
+        buffer_append_str(cookie, "; ", 2);
+        buffer_append_str(cookie, tmpl->tail.data, tmpl->tail.wpos);
+    }
+    if (tmpl->expires) {
+        vstr = SvPV_const(tmpl->expires, vlen);
+        cookie_put_date(cookie, COOKIE_NAME_EXPIRES, sizeof(COOKIE_NAME_EXPIRES) - 1, vstr, vlen, &MY_CXT.date_cache);
     }
-    buffer_fini(&encoded);
 }
 
 static int search_char(char c, const Buffer* buf, int start)
 {
-    int pos = -1;
-    unsigned int j = 0;
-    for (j = start; j < buf->wpos; ++j) {
-        if (buf->data[j] == c) {
-            pos = j;
+    const char* found = 0;
+    if ((unsigned int) start >= buf->wpos) {
+        return -1;
+    }
+    found = (const char*) memchr(buf->data + start, c, buf->wpos - start);
+    return found ? (int) (found - buf->data) : -1;
+}
+
+/*
+ * Create an SV for a (URL-decoded) value.  If the value contains any
+ * '&' characters, it is interpreted as multiple values, and we return
+ * an arrayref with each of them; otherwise, we return a simple string.
+ */
+static SV* new_value_sv(pTHX_ const Buffer* value)
+{
+    int pos = 0;
+    AV* array = 0;
+    int key = 0;
+    unsigned int ini = 0;
+    unsigned int end = 0;
+
+    pos = search_char('&', value, value->rpos);
+    if (pos < 0) {
+        /* no & chars? simple string */
+        return newSVpvn(value->data, value->wpos);
+    }
+
+    /* & chars => create arrayref */
+    array = newAV();
+    end = (unsigned int) pos;
+    while (1) {
+        SV* str = 0;
+        if (ini >= value->wpos) {
             break;
         }
+        str = sv_2mortal(newSVpvn(value->data + ini, end - ini));
+        if (av_store(array, key, str)) {
+            SvREFCNT_inc(str);
+        }
+        ++key;
+        ini = ++end;
+        pos = search_char('&', value, end);
+        end = pos < 0 ? value->wpos : (unsigned int) pos;
+    }
+    return newRV_noinc((SV*) array);
+}
+
+/*
+ * Copy an SV created by new_value_sv; an arrayref gets its own array, so
+ * that changing one of the copies does not change the other.
+ */
+static SV* copy_value_sv(pTHX_ SV* value)
+{
+    AV* array = 0;
+
+    if (!SvROK(value)) {
+        return newSVsv(value);
     }
-    return pos;
+    array = (AV*) SvRV(value);
+    return newRV_noinc((SV*) av_make(av_len(array) + 1, AvARRAY(array)));
 }
 
 /*
@@ -225,8 +822,19 @@ static int search_char(char c, const Buffer* buf, int start)
  *
  * =0: ignore these names, as if they had not been specified
  * >0: always treat these names as having a value of undef
+ *
+ * If filter is not null, only the (distinct) names in that set are
+ * returned; values for all other names are never copied or decoded, and
+ * we stop parsing as soon as all names in the set have been found.
+ *
+ * If decompress is non-zero, compressed values (see compress.h) are
+ * returned decompressed.
+ *
+ * Buffers name and value are used as scratch space; this allows reusing
+ * them when crushing many cookies.
  */
-static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value)
+static HV* parse_cookie_buffers(pTHX_ SV* pstr, int allow_no_value, const NameSet* filter,
+                                int decompress, Buffer* name, Buffer* value)
 {
     /* we will always return a hashref, maybe empty */
     HV* hv = newHV();
@@ -235,8 +843,6 @@ static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value)
         const char* cstr = 0;
         STRLEN clen = 0;
         Buffer cookie;
-        Buffer name;
-        Buffer value;
 
         /* string not valid? bail out */
         if (!SvOK(pstr) || !SvPOK(pstr)) {
@@ -253,33 +859,31 @@ static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value)
          * more easily work with it */
         buffer_wrap(&cookie, cstr, clen);
 
-        /* prepare memory for name / value buffers */
-        buffer_init(&name , 0);
-        buffer_init(&value, 0);
-
         while (1) {
             int equals = 0;
-            int pos = 0;
-            AV* array = 0;
-            int key = 0;
-            unsigned int ini = 0;
-            unsigned int end = 0;
-            SV* ref = 0;
+            CookieSpan span;
+            Buffer found;
 
             /* reset buffers for name / value, avoiding memory reallocation */
-            buffer_reset(&name);
-            buffer_reset(&value);
+            buffer_reset(name);
+            buffer_reset(value);
 
-            /* get the pair name=value, return whether we saw an equals sign */
-            equals = cookie_get_pair(&cookie, &name, &value);
+            /* get the pair name=value, return whether we saw an equals sign;
+             * when filtering, just get the position of the value */
+            equals = cookie_get_pair_span(&cookie, name, filter ? 0 : value, &span);
 
             /* got an empty name => ran out of data */
-            if (name.wpos == 0) {
+            if (name->wpos == 0) {
                 break;
             }
 
+            /* not a name we want? skip it */
+            if (filter && nameset_find(filter, name->data, name->wpos) < 0) {
+                continue;
+            }
+
             /* only first value seen for a name is kept */
-            if (hv_exists(hv, name.data, name.wpos)) {
+            if (hv_exists(hv, name->data, name->wpos)) {
                 continue;
             }
 
@@ -288,72 +892,1691 @@ static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value)
                 if (allow_no_value) {
                     /* store a name => undef pair*/
                     SV* nil = newSV(0);
-                    hv_store(hv, name.data, name.wpos, nil, 0);
+                    hv_store(hv, name->data, name->wpos, nil, 0);
                 }
-                continue;
-            }
-
-            pos = search_char('&', &value, value.rpos);
-            if (pos < 0) {
-                /* no & chars? simple string */
-                SV* str = newSVpvn(value.data, value.wpos);
-                hv_store(hv, name.data, name.wpos, str, 0);
-                continue;
-            }
-
-            /* & chars => create arrayref */
-            array = newAV();
-            end = (unsigned int) pos;
-            while (1) {
-                SV* str = 0;
-                if (ini >= value.wpos) {
-                    break;
+            } else {
+                /* a value that needed no decoding was not copied and is
+                 * still in the cookie; otherwise, it is in our buffer,
+                 * unless we skipped it while filtering */
+                if (span.verbatim && span.escaped) {
+                    cookie_get_span_value(&cookie, &span, value);
                 }
-                str = sv_2mortal(newSVpvn(value.data + ini, end - ini));
-                if (av_store(array, key, str)) {
-                    SvREFCNT_inc(str);
+                if (span.verbatim && !span.escaped) {
+                    /* a compressed value is never URL-encoded, and we
+                     * leave it alone if it does not decompress */
+                    if (decompress && span.vlen && cstr[span.vpos] == COMPRESS_MARKER &&
+                        compress_open(cstr + span.vpos, span.vlen, value)) {
+                        buffer_wrap(&found, value->data, value->wpos);
+                    } else {
+                        buffer_wrap(&found, cstr + span.vpos, span.vlen);
+                    }
+                } else {
+                    buffer_wrap(&found, value->data, value->wpos);
                 }
-                ++key;
-                ini = ++end;
-                pos = search_char('&', &value, end);
-                end = pos < 0 ? value.wpos : (unsigned int) pos;
+                hv_store(hv, name->data, name->wpos, new_value_sv(aTHX_ &found), 0);
             }
-            ref = newRV_noinc((SV*) array);
-            hv_store(hv, name.data, name.wpos, ref, 0);
-        }
 
-        /* release memory for name / value buffers */
-        buffer_fini(&value);
-        buffer_fini(&name );
+            /* found all the names we want? we are done */
+            if (filter && HvUSEDKEYS(hv) >= filter->count) {
+                break;
+            }
+        }
     } while (0);
 
     return hv;
 }
 
+static HV* parse_cookie(pTHX_ SV* pstr, int allow_no_value, const NameSet* filter,
+                        int decompress)
+{
+    HV* hv = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+    Buffer* name = scratch_get(scratch);
+    Buffer* value = scratch_get(scratch);
 
-MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies
-PROTOTYPES: DISABLE
+    hv = parse_cookie_buffers(aTHX_ pstr, allow_no_value, filter, decompress, name, value);
 
-#################################################################
+    scratch_release(scratch, mark);
+    return hv;
+}
 
-SV*
-bake_cookie(SV* name, SV* value)
-  PREINIT:
-    Buffer cookie;
-  CODE:
-    buffer_init(&cookie, 0);
-    build_cookie(aTHX_ name, value, &cookie);
-    RETVAL = newSVpvn(cookie.data, cookie.wpos);
-    buffer_fini(&cookie);
-  OUTPUT: RETVAL
+/*
+ * Given a string, parse it as a cookie looking for a given name, and
+ * return the value for the first occurrence of that name with a value;
+ * return undef if there is no such value.
+ *
+ * We stop parsing as soon as we find the name, and we only decode the
+ * value we return, so this is faster than crushing the whole cookie.
+ */
+static SV* find_cookie(pTHX_ SV* pstr, SV* pname)
+{
+    SV* found = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = scratch_mark(scratch);
+
+    do {
+        const char* cstr = 0;
+        STRLEN clen = 0;
+        const char* nstr = 0;
+        STRLEN nlen = 0;
+        Buffer cookie;
+        Buffer* name = 0;
+
+        /* string or name not valid? bail out */
+        if (!SvOK(pstr) || !SvPOK(pstr) || !SvOK(pname)) {
+            break;
+        }
+
+        /* empty string? bail out */
+        cstr = SvPV_const(pstr, clen);
+        if (!cstr || !clen) {
+            break;
+        }
+        nstr = SvPV_const(pname, nlen);
+
+        buffer_wrap(&cookie, cstr, clen);
+        name = scratch_get(scratch);
+
+        while (1) {
+            int equals = 0;
+            CookieSpan span;
+            Buffer* value = 0;
+
+            /* get the name and where the value is, without copying it */
+            buffer_reset(name);
+            equals = cookie_get_pair_span(&cookie, name, 0, &span);
+
+            /* got an empty name => ran out of data */
+            if (name->wpos == 0) {
+                break;
+            }
+
+            /* not the name we want, or no value? keep looking */
+            if (!equals ||
+                name->wpos != nlen ||
+                memcmp(name->data, nstr, nlen) != 0) {
+                continue;
+            }
+
+            value = scratch_get(scratch);
+            cookie_get_span_value(&cookie, &span, value);
+            found = new_value_sv(aTHX_ value);
+            break;
+        }
+
+    } while (0);
+
+    scratch_release(scratch, mark);
+    return found ? found : newSV(0);
+}
+
+/*
+ * Given a string, parse it as a cookie looking for all the names in a set,
+ * and store in values[j] the value for the first occurrence (with a value)
+ * of the j-th name in the set; values for names not found are left null.
+ *
+ * We stop parsing as soon as all names have been found, and we only decode
+ * the values we return.
+ */
+static void pick_cookie(pTHX_ SV* pstr, const NameSet* set, SV** values)
+{
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    unsigned int missing = set->count;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    Buffer cookie;
+    Buffer* name = 0;
+
+    /* string not valid? bail out */
+    if (!SvOK(pstr) || !SvPOK(pstr)) {
+        return;
+    }
+
+    /* empty string? bail out */
+    cstr = SvPV_const(pstr, clen);
+    if (!cstr || !clen) {
+        return;
+    }
+
+    buffer_wrap(&cookie, cstr, clen);
+    mark = scratch_mark(scratch);
+    name = scratch_get(scratch);
+
+    while (missing > 0) {
+        int equals = 0;
+        int pos = 0;
+        SV* value = 0;
+        CookieSpan span;
+
+        /* get the name and where the value is, without copying it */
+        buffer_reset(name);
+        equals = cookie_get_pair_span(&cookie, name, 0, &span);
+
+        /* got an empty name => ran out of data */
+        if (name->wpos == 0) {
+            break;
+        }
+
+        /* no value? keep looking */
+        if (!equals) {
+            continue;
+        }
+
+        /* the same name could have been requested more than once */
+        for (pos = nameset_find(set, name->data, name->wpos);
+             pos >= 0;
+             pos = nameset_next(set, pos)) {
+            if (values[pos]) {
+                /* only first value seen for a name is kept */
+                continue;
+            }
+            if (!value) {
+                unsigned int vmark = scratch_mark(scratch);
+                Buffer* decoded = scratch_get(scratch);
+                cookie_get_span_value(&cookie, &span, decoded);
+                value = new_value_sv(aTHX_ decoded);
+                scratch_release(scratch, vmark);
+                values[pos] = value;
+            } else {
+                values[pos] = copy_value_sv(aTHX_ value);
+            }
+            --missing;
+        }
+    }
+
+    scratch_release(scratch, mark);
+}
+
+/*
+ * Return non-zero if the name in a buffer is a given attribute name,
+ * ignoring case.
+ */
+#define IS_ATTRIBUTE(buf, attr) \
+    ((buf)->wpos == sizeof(attr) - 1 && \
+     strncasecmp((buf)->data, attr, sizeof(attr) - 1) == 0)
+
+/*
+ * Parse the delta-seconds for a Max-Age attribute: an optional minus
+ * sign followed by digits.  Return zero if the value is not valid.
+ */
+static int get_max_age(const Buffer* value, IV* age)
+{
+    unsigned int j = 0;
+    int negative = 0;
+    IV number = 0;
+
+    if (j < value->wpos && value->data[j] == '-') {
+        negative = 1;
+        ++j;
+    }
+    if (j >= value->wpos) {
+        return 0;
+    }
+    for (; j < value->wpos; ++j) {
+        char c = value->data[j];
+        IV digit = c - '0';
+        if (c < '0' || c > '9') {
+            return 0;
+        }
+        /* saturate very large values, they mean "forever" anyway */
+        if (number > (IV_MAX - digit) / 10) {
+            number = IV_MAX;
+        } else {
+            number = 10 * number + digit;
+        }
+    }
+    *age = negative ? -number : number;
+    return 1;
+}
+
+/*
+ * Get the next attribute from a Set-Cookie header, as RFC 6265 section
+ * 5.2 says: everything up to the next ';', split on the first '=', with
+ * the whitespace around name and value removed.  Attributes are taken
+ * literally, without any URL-decoding, so name and value are just wrapped
+ * around the bytes in the cookie.  Return -1 if there are no attributes
+ * left, otherwise whether there was an '='.
+ */
+static int get_raw_attribute(Buffer* cookie, Buffer* name, Buffer* value)
+{
+    const char* data = cookie->data;
+    unsigned int beg = cookie->rpos;
+    unsigned int end = beg;
+    unsigned int eq = 0;
+    unsigned int vbeg = 0;
+    unsigned int nend = 0;
+    int equals = 0;
+
+    if (beg >= cookie->wpos) {
+        return -1;
+    }
+    while (end < cookie->wpos && data[end] != ';') {
+        ++end;
+    }
+    cookie->rpos = end < cookie->wpos ? end + 1 : end;
+
+    for (eq = beg; eq < end && data[eq] != '='; ++eq) {
+    }
+    equals = eq < end;
+    vbeg = equals ? eq + 1 : end;
+
+    while (beg < eq && (data[beg] == ' ' || data[beg] == '\t')) {
+        ++beg;
+    }
+    for (nend = eq; nend > beg && (data[nend - 1] == ' ' || data[nend - 1] == '\t'); --nend) {
+    }
+    while (vbeg < end && (data[vbeg] == ' ' || data[vbeg] == '\t')) {
+        ++vbeg;
+    }
+    while (end > vbeg && (data[end - 1] == ' ' || data[end - 1] == '\t')) {
+        --end;
+    }
+
+    buffer_wrap(name, data + beg, nend - beg);
+    buffer_wrap(value, data + vbeg, end - vbeg);
+    return equals;
+}
+
+/*
+ * Given the value of a Set-Cookie header, parse it and return a hashref
+ * with the cookie name and value, plus all known attributes, with their
+ * canonical names:
+ *
+ *   name, value  => strings, value can be an arrayref as in parse_cookie()
+ *   Domain, Path, SameSite => strings
+ *   Expires  => epoch, if the date could be parsed
+ *   Max-Age  => integer, if it was valid
+ *   Secure, HttpOnly => 1 if present
+ *
+ * Only the value is URL-decoded; attributes are taken literally.  Unknown
+ * attributes and invalid dates / ages are ignored, and when an attribute
+ * is repeated the last one wins, as in RFC 6265.  If the header
+ * does not start with a name=value pair, return null.
+ */
+static HV* parse_set_cookie(pTHX_ SV* pstr)
+{
+    HV* hv = 0;
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    Buffer cookie;
+    Buffer* name = 0;
+    Buffer* value = 0;
+    Buffer attr_name;
+    Buffer attr_value;
+
+    /* string not valid? bail out */
+    if (!SvOK(pstr) || !SvPOK(pstr)) {
+        return 0;
+    }
+
+    /* empty string? bail out */
+    cstr = SvPV_const(pstr, clen);
+    if (!cstr || !clen) {
+        return 0;
+    }
+
+    buffer_wrap(&cookie, cstr, clen);
+    mark = scratch_mark(scratch);
+    name = scratch_get(scratch);
+    value = scratch_get(scratch);
+
+    /* first we must have the cookie name=value */
+    if (cookie_get_pair(&cookie, name, value) && name->wpos > 0) {
+        hv = newHV();
+        hv_stores(hv, "name", newSVpvn(name->data, name->wpos));
+        hv_stores(hv, COOKIE_NAME_VALUE, new_value_sv(aTHX_ value));
+    }
+    scratch_release(scratch, mark);
+    name = &attr_name;
+    value = &attr_value;
+
+    /* then the attributes, which are taken literally */
+    while (hv) {
+        int equals = get_raw_attribute(&cookie, name, value);
+
+        /* ran out of data */
+        if (equals < 0) {
+            break;
+        }
+
+        /* empty attributes are ignored */
+        if (name->wpos == 0) {
+            continue;
+        }
+
+        if        (IS_ATTRIBUTE(name, COOKIE_NAME_SECURE)) {
+            hv_stores(hv, COOKIE_NAME_SECURE, newSViv(1));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_HTTP_ONLY)) {
+            hv_stores(hv, COOKIE_NAME_HTTP_ONLY, newSViv(1));
+        } else if (!equals) {
+            /* all other attributes need a value */
+            continue;
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_DOMAIN)) {
+            hv_stores(hv, COOKIE_NAME_DOMAIN, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_PATH)) {
+            hv_stores(hv, COOKIE_NAME_PATH, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_SAME_SITE)) {
+            hv_stores(hv, COOKIE_NAME_SAME_SITE, newSVpvn(value->data, value->wpos));
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_EXPIRES)) {
+            double epoch = 0;
+            if (date_parse_http(value->data, value->wpos, &epoch)) {
+                hv_stores(hv, COOKIE_NAME_EXPIRES, newSViv((IV) epoch));
+            }
+        } else if (IS_ATTRIBUTE(name, COOKIE_NAME_MAX_AGE)) {
+            IV age = 0;
+            if (get_max_age(value, &age)) {
+                hv_stores(hv, COOKIE_NAME_MAX_AGE, newSViv(age));
+            }
+        }
+    }
+
+    return hv;
+}
+
+/*
+ * Add the pair just completed by the parser of a cookie stream to the
+ * crushed hash, following the same rules as parse_cookie(); if the pair
+ * was added, also push its name and value onto the Perl stack.
+ */
+static SV** stream_add_pair(pTHX_ CookieStream* stream, SV** sp)
+{
+    const Buffer* name = &stream->parser.name;
+    SV* value = 0;
+
+    /* got an empty name => nothing to add */
+    if (name->wpos == 0) {
+        return sp;
+    }
+
+    /* only first value seen for a name is kept */
+    if (hv_exists(stream->crushed, name->data, name->wpos)) {
+        return sp;
+    }
+
+    if (!stream->parser.equals) {
+        /* didn't see an equal sign => name with no value */
+        if (!stream->allow_no_value) {
+            return sp;
+        }
+        value = newSV(0);
+    } else {
+        value = new_value_sv(aTHX_ &stream->parser.value);
+    }
+    hv_store(stream->crushed, name->data, name->wpos, value, 0);
+
+    EXTEND(SP, 2);
+    mPUSHp(name->data, name->wpos);
+    PUSHs(sv_2mortal(copy_value_sv(aTHX_ value)));
+    return sp;
+}
+
+/*
+ * Return the name set inside an HTTP::XSCookies::NameSet object, or null
+ * if the SV is not such an object.
+ */
+static NameSet* get_nameset(pTHX_ SV* sv)
+{
+    SV* obj = 0;
+    const char* klass = 0;
+
+    if (!SvROK(sv)) {
+        return 0;
+    }
+
+    /* check the class name first, it is faster than sv_derived_from */
+    obj = SvRV(sv);
+    klass = SvOBJECT(obj) ? HvNAME(SvSTASH(obj)) : 0;
+    if (!klass ||
+        (strcmp(klass, "HTTP::XSCookies::NameSet") != 0 &&
+         !sv_derived_from(sv, "HTTP::XSCookies::NameSet"))) {
+        return 0;
+    }
+    return INT2PTR(NameSet*, SvIV(SvRV(sv)));
+}
+
+/*
+ * Get the parts of a request URL that a cookie jar needs.
+ */
+static void get_jar_request(pTHX_ SV* url, JarRequest* req)
+{
+    const char* ustr = 0;
+    STRLEN ulen = 0;
+
+    if (SvOK(url)) {
+        ustr = SvPV_const(url, ulen);
+    }
+    if (!ustr || !jar_parse_url(ustr, ulen, req)) {
+        croak("Invalid URL for a cookie jar: %s", ustr ? ustr : "undef");
+    }
+}
+
+/*
+ * The current time for a cookie jar: the given epoch, or the actual time.
+ */
+static double get_jar_now(pTHX_ SV* now)
+{
+    if (now && SvOK(now)) {
+        return SvNV(now);
+    }
+    return (double) time(0);
+}
+
+/*
+ * Which SameSite cookies can be sent with a request, from a string.
+ */
+static int get_jar_site(pTHX_ SV* site)
+{
+    const char* sstr = 0;
+    STRLEN slen = 0;
+
+    if (!site || !SvOK(site)) {
+        return JAR_SITE_SAME;
+    }
+    sstr = SvPV_const(site, slen);
+    if (slen == 9 && memcmp(sstr, "same-site", 9) == 0) {
+        return JAR_SITE_SAME;
+    }
+    if (slen == 10 && memcmp(sstr, "navigation", 10) == 0) {
+        return JAR_SITE_NAVIGATION;
+    }
+    if (slen == 10 && memcmp(sstr, "cross-site", 10) == 0) {
+        return JAR_SITE_CROSS;
+    }
+    croak("Invalid site for a cookie jar request: %s", sstr);
+    return JAR_SITE_SAME;
+}
+
+/*
+ * Return a hashref describing a cookie stored in a jar.
+ */
+static SV* new_jar_cookie_sv(pTHX_ const Jar* jar, const JarCookie* cookie)
+{
+    static const char* same_site[] = { 0, "None", "Lax", "Strict" };
+    const JarDomain* domain = &jar->domains[cookie->domain];
+    HV* hv = newHV();
+
+    hv_stores(hv, "name", newSVpvn(cookie->data, cookie->nlen));
+    hv_stores(hv, COOKIE_NAME_VALUE, newSVpvn(cookie->data + cookie->nlen, cookie->vlen));
+    hv_stores(hv, COOKIE_NAME_DOMAIN, newSVpvn(domain->name, domain->len));
+    hv_stores(hv, COOKIE_NAME_PATH, newSVpvn(cookie->data + cookie->nlen + cookie->vlen, cookie->plen));
+    if (cookie->flags & JAR_PERSISTENT) {
+        hv_stores(hv, COOKIE_NAME_EXPIRES, newSViv((IV) cookie->expires));
+    }
+    if (cookie->flags & JAR_SECURE) {
+        hv_stores(hv, COOKIE_NAME_SECURE, newSViv(1));
+    }
+    if (cookie->flags & JAR_HTTP_ONLY) {
+        hv_stores(hv, COOKIE_NAME_HTTP_ONLY, newSViv(1));
+    }
+    if (cookie->flags & JAR_HOST_ONLY) {
+        hv_stores(hv, "host_only", newSViv(1));
+    }
+    if (same_site[cookie->same_site]) {
+        hv_stores(hv, COOKIE_NAME_SAME_SITE, newSVpv(same_site[cookie->same_site], 0));
+    }
+    return newRV_noinc((SV*) hv);
+}
+
+/*
+ * Return the value for the pair at a given position in a lazy cookie,
+ * decoding it (only) the first time it is requested.
+ */
+static SV* lazy_fetch(pTHX_ LazyCookie* lazy, unsigned int pos)
+{
+    SV** cached = av_fetch(lazy->values, pos, 0);
+    SV* sv = 0;
+
+    if (cached) {
+        return *cached;
+    }
+
+    if (!(lazy->index.pairs[pos].flags & PAIR_EQUALS)) {
+        /* name with no value */
+        sv = newSV(0);
+    } else {
+        Scratch* scratch = get_scratch(aTHX);
+        unsigned int mark = scratch_mark(scratch);
+        Buffer* value = scratch_get(scratch);
+        pairs_get_value(&lazy->index, pos, value);
+        sv = new_value_sv(aTHX_ value);
+        scratch_release(scratch, mark);
+    }
+
+    av_store(lazy->values, pos, sv);
+    return sv;
+}
+
+/*
+ * Return the next name in a lazy cookie, skipping repeated names,
+ * or undef if there are no more names.
+ */
+static SV* lazy_next_key(pTHX_ LazyCookie* lazy)
+{
+    while (lazy->iter < lazy->index.count) {
+        unsigned int pos = lazy->iter++;
+        const Pair* pair = &lazy->index.pairs[pos];
+        if (!pairs_is_repeated(&lazy->index, pos)) {
+            return newSVpvn(lazy->index.names.data + pair->npos, pair->nlen);
+        }
+    }
+    return newSV(0);
+}
+
+/*
+ * URL-encode (or decode) a string and append the result to a target SV,
+ * writing straight into the target's buffer; return the target.
+ */
+static SV* uri_append(pTHX_ SV* tgt, SV* src, int encode)
+{
+    const char* sstr = 0;
+    STRLEN slen = 0;
+    STRLEN tlen = 0;
+    char* tstr = 0;
+
+    if (!SvOK(tgt)) {
+        sv_setpvs(tgt, "");
+    }
+    if (!SvOK(src)) {
+        return tgt;
+    }
+    if (src == tgt) {
+        /* growing the target would move the source */
+        src = sv_mortalcopy(src);
+    }
+    sstr = SvPV_const(src, slen);
+
+    if (!encode && SvUTF8(tgt)) {
+        /* decoded bytes must be upgraded to characters, let perl do it */
+        sv_catsv(tgt, sv_2mortal(uri_append(aTHX_ newSVpvs(""), src, 0)));
+        SvSETMAGIC(tgt);
+        return tgt;
+    }
+
+    SvPV_force(tgt, tlen);
+    tstr = SvGROW(tgt, tlen + (encode ? 3 : 1) * slen + 1);
+    tlen += encode ? url_encode_str(sstr, slen, tstr + tlen)
+                   : url_decode_str(sstr, slen, tstr + tlen);
+    tstr[tlen] = '\0';
+    SvCUR_set(tgt, tlen);
+    SvSETMAGIC(tgt);
+    return tgt;
+}
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies
+PROTOTYPES: DISABLE
+
+BOOT:
+{
+    MY_CXT_INIT;
+    date_cache_init(&MY_CXT.date_cache);
+    scratch_init(&MY_CXT.scratch);
+    call_atexit(scratch_destroy, 0);
+    sign_key_init(&MY_CXT.sign_key);
+    seal_nonces_init(&MY_CXT.seal_nonces);
+    scan_init();
+}
+
+void
+CLONE(...)
+  CODE:
+    {
+        MY_CXT_CLONE;
+        date_cache_init(&MY_CXT.date_cache);
+        /* the buffers we copied belong to the parent interpreter */
+        scratch_init(&MY_CXT.scratch);
+        call_atexit(scratch_destroy, 0);
+        sign_key_init(&MY_CXT.sign_key);
+        /* never share nonces with the parent interpreter */
+        seal_nonces_init(&MY_CXT.seal_nonces);
+    }
+    PERL_UNUSED_VAR(items);
+
+#################################################################
+
+SV*
+bake_cookie(SV* name, SV* value)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+  CODE:
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, 0, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+  OUTPUT: RETVAL
+
+SV*
+bake_cookies(SV* cookies)
+  PREINIT:
+    AV* baked = 0;
+    SV* ref = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+  CODE:
+    ref = SvROK(cookies) ? SvRV(cookies) : 0;
+    if (!ref || (SvTYPE(ref) != SVt_PVAV && SvTYPE(ref) != SVt_PVHV)) {
+        croak("Cookies for bake_cookies must be an arrayref or a hashref");
+    }
+    baked = newAV();
+
+    /* the same buffers are used for all the cookies */
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    if (SvTYPE(ref) == SVt_PVAV) {
+        /* name / value pairs */
+        AV* pairs = (AV*) ref;
+        SSize_t top = av_len(pairs);
+        SSize_t j = 0;
+        for (j = 0; j + 1 <= top; j += 2) {
+            SV** name = av_fetch(pairs, j, 0);
+            SV** value = av_fetch(pairs, j + 1, 0);
+            buffer_reset(cookie);
+            if (name && value) {
+                build_cookie(aTHX_ *name, *value, 0, cookie, encoded);
+            }
+            av_push(baked, newSVpvn(cookie->data, cookie->wpos));
+        }
+    } else {
+        /* name => value */
+        HV* specs = (HV*) ref;
+        HE* entry = 0;
+        hv_iterinit(specs);
+        while ((entry = hv_iternext(specs))) {
+            buffer_reset(cookie);
+            build_cookie(aTHX_ hv_iterkeysv(entry), hv_iterval(specs, entry), 0, cookie, encoded);
+            av_push(baked, newSVpvn(cookie->data, cookie->wpos));
+        }
+    }
+    SCRATCH_LEAVE();
+
+    RETVAL = newRV_noinc((SV*) baked);
+  OUTPUT: RETVAL
+
+SV*
+bake_signed_cookie(SV* name, SV* value, SV* key)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+    HmacSha256 signing;
+    CookieGuard guard;
+  CODE:
+    /* copy the key: baking / verifying might run code that signs
+     * with another key */
+    signing = *get_signing_key(aTHX_ key, "bake_signed_cookie");
+    guard.sign = &signing;
+    guard.seal = 0;
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, &guard, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+  OUTPUT: RETVAL
+
+SV*
+verify_signed_cookie(SV* name, SV* value, SV* key)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    HmacSha256 signing;
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    Buffer* joined = 0;
+    Buffer payload;
+    int vlen = -1;
+  CODE:
+    /* copy the key: baking / verifying might run code that signs
+     * with another key */
+    signing = *get_signing_key(aTHX_ key, "verify_signed_cookie");
+    SCRATCH_ENTER(scratch);
+    joined = scratch_get(scratch);
+    if (SvROK(value) && SvTYPE(SvRV(value)) == SVt_PVAV) {
+        /* crush gave us several values: put them back together, as
+         * they were when signed, without touching the array */
+        AV* values = (AV*) SvRV(value);
+        SSize_t top = av_len(values);
+        SSize_t j = 0;
+        for (j = 0; j <= top; ++j) {
+            SV** elem = av_fetch(values, j, 0);
+            const char* estr = 0;
+            STRLEN elen = 0;
+            if (!elem || !SvOK(*elem)) {
+                continue;
+            }
+            estr = SvPV_const(*elem, elen);
+            if (joined->wpos) {
+                buffer_append_str(joined, "&", 1);
+            }
+            buffer_append_str(joined, estr, elen);
+        }
+    } else if (SvOK(value) && !SvROK(value)) {
+        const char* vstr = 0;
+        STRLEN len = 0;
+        vstr = SvPV_const(value, len);
+        buffer_append_str(joined, vstr, len);
+    }
+    if (joined->wpos && SvOK(name)) {
+        nstr = SvPV_const(name, nlen);
+        vlen = sign_verify(nstr, nlen, joined->data, joined->wpos, &signing);
+    }
+    if (vlen < 0) {
+        RETVAL = newSV(0);
+    } else {
+        /* return the value as crush would have returned it */
+        buffer_wrap(&payload, joined->data, vlen);
+        RETVAL = new_value_sv(aTHX_ &payload);
+    }
+    SCRATCH_LEAVE();
+  OUTPUT: RETVAL
+
+SV*
+bake_sealed_cookie(SV* name, SV* value, SV* key)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+    Buffer* encoded = 0;
+    unsigned char sealing[AEAD_KEY_LEN];
+    CookieGuard guard;
+  CODE:
+    get_sealing_key(aTHX_ key, sealing, "bake_sealed_cookie");
+    guard.sign = 0;
+    guard.seal = sealing;
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    encoded = scratch_get(scratch);
+    build_cookie(aTHX_ name, value, &guard, cookie, encoded);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+  OUTPUT: RETVAL
+
+SV*
+open_sealed_cookie(SV* name, SV* value, SV* key)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned char sealing[AEAD_KEY_LEN];
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* opened = 0;
+  CODE:
+    get_sealing_key(aTHX_ key, sealing, "open_sealed_cookie");
+    RETVAL = 0;
+    if (SvOK(name) && SvOK(value) && !SvROK(value)) {
+        nstr = SvPV_const(name, nlen);
+        vstr = SvPV_const(value, vlen);
+        SCRATCH_ENTER(scratch);
+        opened = scratch_get(scratch);
+        if (seal_open(nstr, nlen, vstr, vlen, sealing, opened)) {
+            /* return the value as crush would have returned it */
+            RETVAL = new_value_sv(aTHX_ opened);
+        }
+        SCRATCH_LEAVE();
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+  OUTPUT: RETVAL
+
+SV*
+unpack_cookie_value(SV* value)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* packed = 0;
+    int plen = 0;
+  CODE:
+    RETVAL = 0;
+    if (SvOK(value) && !SvROK(value)) {
+        vstr = SvPV_const(value, vlen);
+        mark = scratch_mark(scratch);
+        packed = scratch_get(scratch);
+        buffer_ensure_unused(packed, BASE64_DECODED_LEN(vlen));
+        plen = base64_decode_str(vstr, vlen, packed->data);
+        if (plen >= 0) {
+            packed->wpos = plen;
+            RETVAL = unpack_value(aTHX_ packed);
+        }
+        scratch_release(scratch, mark);
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+  OUTPUT: RETVAL
+
+SV*
+decompress_cookie_value(SV* value)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    unsigned int mark = 0;
+    const char* vstr = 0;
+    STRLEN vlen = 0;
+    Buffer* opened = 0;
+  CODE:
+    RETVAL = 0;
+    if (SvOK(value) && !SvROK(value)) {
+        vstr = SvPV_const(value, vlen);
+        mark = scratch_mark(scratch);
+        opened = scratch_get(scratch);
+        if (compress_open(vstr, vlen, opened)) {
+            /* return the value as crush would have returned it */
+            RETVAL = new_value_sv(aTHX_ opened);
+        }
+        scratch_release(scratch, mark);
+    }
+    if (!RETVAL) {
+        /* not compressed: return the value as it was */
+        RETVAL = newSVsv(value);
+    }
+  OUTPUT: RETVAL
+
+SV*
+crush_cookie(SV* str, ...)
+  PREINIT:
+    IV allow_no_value = 0;
+    NameSet* filter = 0;
+    int decompress = 0;
+  CODE:
+    if (items > 1) {
+        allow_no_value = SvIV(ST(1));
+    }
+    if (items > 2 && SvOK(ST(2))) {
+        filter = get_nameset(aTHX_ ST(2));
+        if (!filter) {
+            croak("Filter for crush_cookie must be an HTTP::XSCookies::NameSet");
+        }
+    }
+    if (items > 3) {
+        decompress = SvTRUE(ST(3));
+    }
+    RETVAL = newRV_noinc((SV *) parse_cookie(aTHX_ str, allow_no_value, filter, decompress));
+  OUTPUT: RETVAL
+
+SV*
+crush_set_cookie(SV* str)
+  PREINIT:
+    HV* hv = 0;
+  CODE:
+    hv = parse_set_cookie(aTHX_ str);
+    RETVAL = hv ? newRV_noinc((SV *) hv) : newSV(0);
+  OUTPUT: RETVAL
+
+SV*
+parse_http_date(SV* str)
+  PREINIT:
+    const char* dstr = 0;
+    STRLEN dlen = 0;
+    double epoch = 0;
+  CODE:
+    if (SvOK(str)) {
+        dstr = SvPV_const(str, dlen);
+    }
+    if (dstr && date_parse_http(dstr, dlen, &epoch)) {
+        RETVAL = newSViv((IV) epoch);
+    } else {
+        RETVAL = newSV(0);
+    }
+  OUTPUT: RETVAL
+
+SV*
+public_suffix(SV* host)
+  PREINIT:
+    char lower[JAR_HOST_MAX + 1];
+    const char* hstr = 0;
+    STRLEN hlen = 0;
+    STRLEN j = 0;
+    int pos = -1;
+  CODE:
+    if (SvOK(host)) {
+        hstr = SvPV_const(host, hlen);
+    }
+    if (hstr && hlen <= JAR_HOST_MAX) {
+        for (j = 0; j < hlen; ++j) {
+            char c = hstr[j];
+            lower[j] = c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+        }
+        pos = psl_suffix(lower, hlen);
+    }
+    if (pos < 0) {
+        RETVAL = newSV(0);
+    } else {
+        RETVAL = newSVpvn(lower + pos, hlen - pos);
+        if (SvUTF8(host)) {
+            SvUTF8_on(RETVAL);
+        }
+    }
+  OUTPUT: RETVAL
+
+SV*
+uri_encode(SV* str)
+  PREINIT:
+    const char* sstr = 0;
+    STRLEN slen = 0;
+  CODE:
+    if (!SvOK(str)) {
+        RETVAL = newSV(0);
+    } else {
+        sstr = SvPV_const(str, slen);
+        if (scan_unreserved(sstr, slen) == slen) {
+            /* nothing to encode, don't reserve room for it */
+            RETVAL = newSVpvn(sstr, slen);
+        } else {
+            RETVAL = uri_append(aTHX_ newSVpvs(""), str, 1);
+        }
+    }
+  OUTPUT: RETVAL
 
 SV*
-crush_cookie(SV* str, ...)
+uri_decode(SV* str)
+  CODE:
+    /* decoding never makes a string longer, so this allocates once */
+    RETVAL = SvOK(str) ? uri_append(aTHX_ newSVpvs(""), str, 0) : newSV(0);
+  OUTPUT: RETVAL
+
+void
+uri_encode_append(SV* tgt, SV* str)
+  CODE:
+    uri_append(aTHX_ tgt, str, 1);
+
+void
+uri_decode_append(SV* tgt, SV* str)
+  CODE:
+    uri_append(aTHX_ tgt, str, 0);
+
+void
+uri_encode_inplace(SV* str)
+  PREINIT:
+    char* sstr = 0;
+    STRLEN slen = 0;
+    unsigned int tlen = 0;
+  CODE:
+    if (SvOK(str)) {
+        sstr = SvPV_force(str, slen);
+        if (scan_unreserved(sstr, slen) < slen) {
+            /* move the string to the end of a buffer three times as
+             * long and encode it from there into the start */
+            sstr = SvGROW(str, 3 * slen + 1);
+            memmove(sstr + 2 * slen, sstr, slen);
+            tlen = url_encode_str(sstr + 2 * slen, slen, sstr);
+            sstr[tlen] = '\0';
+            SvCUR_set(str, tlen);
+            SvSETMAGIC(str);
+        }
+    }
+
+void
+uri_decode_inplace(SV* str)
+  PREINIT:
+    char* sstr = 0;
+    STRLEN slen = 0;
+    unsigned int tlen = 0;
+  CODE:
+    if (SvOK(str)) {
+        sstr = SvPV_force(str, slen);
+        tlen = url_decode_str(sstr, slen, sstr);
+        sstr[tlen] = '\0';
+        SvCUR_set(str, tlen);
+        /* decoded bytes are just bytes */
+        SvUTF8_off(str);
+        SvSETMAGIC(str);
+    }
+
+SV*
+crush_cookies(SV* headers, ...)
+  PREINIT:
+    IV allow_no_value = 0;
+    NameSet* filter = 0;
+    int decompress = 0;
+    AV* strs = 0;
+    AV* crushed = 0;
+    SSize_t top = 0;
+    SSize_t j = 0;
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* name = 0;
+    Buffer* value = 0;
+  CODE:
+    if (!SvROK(headers) || SvTYPE(SvRV(headers)) != SVt_PVAV) {
+        croak("Headers for crush_cookies must be an arrayref");
+    }
+    if (items > 1) {
+        allow_no_value = SvIV(ST(1));
+    }
+    if (items > 2 && SvOK(ST(2))) {
+        filter = get_nameset(aTHX_ ST(2));
+        if (!filter) {
+            croak("Filter for crush_cookies must be an HTTP::XSCookies::NameSet");
+        }
+    }
+    if (items > 3) {
+        decompress = SvTRUE(ST(3));
+    }
+    strs = (AV*) SvRV(headers);
+    top = av_len(strs);
+    crushed = newAV();
+    av_extend(crushed, top);
+
+    /* the same buffers are used for all the cookies */
+    SCRATCH_ENTER(scratch);
+    name = scratch_get(scratch);
+    value = scratch_get(scratch);
+    for (j = 0; j <= top; ++j) {
+        SV** str = av_fetch(strs, j, 0);
+        HV* hv = parse_cookie_buffers(aTHX_ str ? *str : &PL_sv_undef, allow_no_value, filter,
+                                      decompress, name, value);
+        av_store(crushed, j, newRV_noinc((SV*) hv));
+    }
+    SCRATCH_LEAVE();
+
+    RETVAL = newRV_noinc((SV*) crushed);
+  OUTPUT: RETVAL
+
+SV*
+crush_cookie_lazy(SV* str, ...)
   PREINIT:
     IV allow_no_value = 0;
+    LazyCookie* lazy = 0;
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    SV* obj = 0;
+    HV* hv = 0;
   CODE:
     if (items > 1) {
         allow_no_value = SvIV(ST(1));
     }
-    RETVAL = newRV_noinc((SV *) parse_cookie(aTHX_ str, allow_no_value));
+    Newxz(lazy, 1, LazyCookie);
+    lazy->values = newAV();
+    if (SvOK(str) && SvPOK(str)) {
+        lazy->str = newSVsv(str);
+        cstr = SvPV_const(lazy->str, clen);
+    }
+    pairs_init(&lazy->index, cstr, clen, allow_no_value);
+
+    /* tie a new hash to the lazy cookie */
+    obj = sv_setref_pv(newSV(0), "HTTP::XSCookies::Lazy", lazy);
+    hv = newHV();
+    sv_magic((SV*) hv, obj, PERL_MAGIC_tied, 0, 0);
+    SvREFCNT_dec(obj);
+    RETVAL = newRV_noinc((SV*) hv);
+  OUTPUT: RETVAL
+
+void
+_scratch_stats()
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+  PPCODE:
+    EXTEND(SP, 3);
+    mPUSHu(scratch->allocs);
+    mPUSHu(scratch->used);
+    mPUSHu(scratch->count);
+
+SV*
+_gmem_allocs()
+  CODE:
+    /* memory is only counted when built with GMEM_CHECK */
+#if defined(GMEM_CHECK) && GMEM_CHECK >= 1
+    RETVAL = newSViv(gmem_allocs);
+#else
+    RETVAL = newSV(0);
+#endif
+  OUTPUT: RETVAL
+
+SV*
+_chacha20(SV* key, UV counter, SV* nonce, SV* data)
+  PREINIT:
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* dstr = 0;
+  CODE:
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    RETVAL = newSV(dlen + 1);
+    SvPOK_on(RETVAL);
+    chacha20_xor(kstr, (unsigned int) counter, nstr, dstr, dlen,
+                 (unsigned char*) SvPVX(RETVAL));
+    SvCUR_set(RETVAL, dlen);
+  OUTPUT: RETVAL
+
+SV*
+_poly1305(SV* key, SV* msg)
+  PREINIT:
+    STRLEN klen = 0;
+    STRLEN mlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* mstr = 0;
+    unsigned char tag[AEAD_TAG_LEN];
+  CODE:
+    kstr = get_test_bytes(aTHX_ key, &klen, 32);
+    mstr = get_test_bytes(aTHX_ msg, &mlen, 0);
+    poly1305_mac(kstr, mstr, mlen, tag);
+    RETVAL = newSVpvn((const char*) tag, AEAD_TAG_LEN);
+  OUTPUT: RETVAL
+
+SV*
+_aead_seal(SV* key, SV* nonce, SV* aad, SV* data)
+  PREINIT:
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN alen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* astr = 0;
+    const unsigned char* dstr = 0;
+    unsigned char* out = 0;
+  CODE:
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    astr = get_test_bytes(aTHX_ aad, &alen, 0);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    /* ciphertext followed by tag */
+    RETVAL = newSV(dlen + AEAD_TAG_LEN + 1);
+    SvPOK_on(RETVAL);
+    out = (unsigned char*) SvPVX(RETVAL);
+    aead_seal(kstr, nstr, astr, alen, dstr, dlen, out, out + dlen);
+    SvCUR_set(RETVAL, dlen + AEAD_TAG_LEN);
+  OUTPUT: RETVAL
+
+SV*
+_aead_open(SV* key, SV* nonce, SV* aad, SV* data)
+  PREINIT:
+    STRLEN klen = 0;
+    STRLEN nlen = 0;
+    STRLEN alen = 0;
+    STRLEN dlen = 0;
+    const unsigned char* kstr = 0;
+    const unsigned char* nstr = 0;
+    const unsigned char* astr = 0;
+    const unsigned char* dstr = 0;
+  CODE:
+    kstr = get_test_bytes(aTHX_ key, &klen, AEAD_KEY_LEN);
+    nstr = get_test_bytes(aTHX_ nonce, &nlen, AEAD_NONCE_LEN);
+    astr = get_test_bytes(aTHX_ aad, &alen, 0);
+    dstr = get_test_bytes(aTHX_ data, &dlen, 0);
+    RETVAL = 0;
+    if (dlen >= AEAD_TAG_LEN) {
+        /* ciphertext followed by tag */
+        dlen -= AEAD_TAG_LEN;
+        RETVAL = newSV(dlen + 1);
+        SvPOK_on(RETVAL);
+        if (aead_open(kstr, nstr, astr, alen, dstr, dlen, dstr + dlen,
+                      (unsigned char*) SvPVX(RETVAL))) {
+            SvCUR_set(RETVAL, dlen);
+        } else {
+            SvREFCNT_dec(RETVAL);
+            RETVAL = 0;
+        }
+    }
+    if (!RETVAL) {
+        RETVAL = newSV(0);
+    }
+  OUTPUT: RETVAL
+
+SV*
+crush_cookie_get(SV* str, SV* name)
+  CODE:
+    RETVAL = find_cookie(aTHX_ str, name);
+  OUTPUT: RETVAL
+
+void
+crush_cookie_pick(SV* str, ...)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    NameSet names;
+    NameSet* set = 0;
+    Buffer* buf = 0;
+    SV** values = 0;
+    int j = 0;
+  PPCODE:
+    /* the names (when given as a list) and the values are kept in scratch
+     * buffers, which are given back even if getting a name dies */
+    SCRATCH_ENTER(scratch);
+
+    /* names can be given as a (compiled) set, or as a list */
+    if (items == 2) {
+        set = get_nameset(aTHX_ ST(1));
+    }
+    if (!set) {
+        set = &names;
+        if (items - 1 > NAMESET_FIXED) {
+            buf = scratch_get(scratch);
+            buffer_ensure_total(buf, (items - 1) * sizeof(NameEntry));
+            nameset_init_entries(set, (NameEntry*) buf->data, items - 1);
+        } else {
+            nameset_init(set);
+        }
+        for (j = 1; j < items; ++j) {
+            const char* nstr = "";
+            STRLEN nlen = 0;
+            if (SvOK(ST(j))) {
+                nstr = SvPV_const(ST(j), nlen);
+            }
+            nameset_add(set, nstr, nlen);
+        }
+    }
+    buf = scratch_get(scratch);
+    buffer_ensure_total(buf, set->count * sizeof(SV*));
+    values = (SV**) buf->data;
+    Zero(values, set->count, SV*);
+
+    pick_cookie(aTHX_ str, set, values);
+
+    /* return the values in the same order as the names */
+    EXTEND(SP, (int) set->count);
+    for (j = 0; j < (int) set->count; ++j) {
+        PUSHs(values[j] ? sv_2mortal(values[j]) : &PL_sv_undef);
+    }
+    SCRATCH_LEAVE();
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies::Parser
+PROTOTYPES: DISABLE
+
+#################################################################
+
+SV*
+new(char* klass, IV allow_no_value = 0)
+  PREINIT:
+    CookieStream* stream = 0;
+  CODE:
+    Newxz(stream, 1, CookieStream);
+    parser_init(&stream->parser);
+    stream->crushed = newHV();
+    stream->allow_no_value = allow_no_value;
+    RETVAL = sv_setref_pv(newSV(0), klass, stream);
+  OUTPUT: RETVAL
+
+void
+feed(HTTP::XSCookies::Parser self, SV* chunk)
+  PREINIT:
+    const char* cstr = 0;
+    STRLEN clen = 0;
+    unsigned int pos = 0;
+  PPCODE:
+    /* chunks are often substr() results, which need get magic */
+    SvGETMAGIC(chunk);
+    if (SvOK(chunk)) {
+        cstr = SvPV_nomg_const(chunk, clen);
+    }
+    while (1) {
+        unsigned int used = 0;
+        int got = parser_feed(&self->parser, cstr + pos, clen - pos, &used);
+        pos += used;
+        if (!got) {
+            break;
+        }
+        SP = stream_add_pair(aTHX_ self, SP);
+    }
+
+void
+finish(HTTP::XSCookies::Parser self)
+  PPCODE:
+    if (parser_finish(&self->parser)) {
+        SP = stream_add_pair(aTHX_ self, SP);
+    }
+
+SV*
+crushed(HTTP::XSCookies::Parser self)
+  CODE:
+    RETVAL = newRV_inc((SV*) self->crushed);
+  OUTPUT: RETVAL
+
+void
+reset(HTTP::XSCookies::Parser self)
+  CODE:
+    parser_reset(&self->parser);
+    SvREFCNT_dec(self->crushed);
+    self->crushed = newHV();
+
+int
+CLONE_SKIP(...)
+  CODE:
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+  OUTPUT: RETVAL
+
+void
+DESTROY(HTTP::XSCookies::Parser self)
+  CODE:
+    parser_fini(&self->parser);
+    SvREFCNT_dec(self->crushed);
+    Safefree(self);
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies::Template
+PROTOTYPES: DISABLE
+
+#################################################################
+
+SV*
+new(char* klass, SV* attributes = 0)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    CookieTemplate* tmpl = 0;
+  CODE:
+    if (attributes && SvOK(attributes) &&
+        (!SvROK(attributes) || SvTYPE(SvRV(attributes)) != SVt_PVHV)) {
+        croak("Attributes for %s must be a hashref", klass);
+    }
+    Newxz(tmpl, 1, CookieTemplate);
+    buffer_init(&tmpl->tail, 0);
+    if (attributes && SvOK(attributes)) {
+        SCRATCH_ENTER(scratch);
+        build_template(aTHX_ (HV*) SvRV(attributes), tmpl);
+        SCRATCH_LEAVE();
+    }
+    RETVAL = sv_setref_pv(newSV(0), klass, tmpl);
+  OUTPUT: RETVAL
+
+SV*
+bake(HTTP::XSCookies::Template self, SV* name, SV* value)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    Buffer* cookie = 0;
+  CODE:
+    SCRATCH_ENTER(scratch);
+    cookie = scratch_get(scratch);
+    bake_template(aTHX_ self, name, value, cookie);
+    RETVAL = newSVpvn(cookie->data, cookie->wpos);
+    SCRATCH_LEAVE();
+  OUTPUT: RETVAL
+
+int
+CLONE_SKIP(...)
+  CODE:
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+  OUTPUT: RETVAL
+
+void
+DESTROY(HTTP::XSCookies::Template self)
+  CODE:
+    buffer_fini(&self->tail);
+    if (self->expires) {
+        SvREFCNT_dec(self->expires);
+    }
+    Safefree(self);
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies::Jar
+PROTOTYPES: DISABLE
+
+#################################################################
+
+SV*
+new(char* klass)
+  PREINIT:
+    Jar* jar = 0;
+  CODE:
+    Newxz(jar, 1, Jar);
+    jar_init(jar);
+    RETVAL = sv_setref_pv(newSV(0), klass, jar);
+  OUTPUT: RETVAL
+
+int
+add(HTTP::XSCookies::Jar self, SV* url, SV* set_cookie, SV* now = 0)
+  PREINIT:
+    JarRequest req;
+    double epoch = 0;
+    AV* headers = 0;
+    int count = 1;
+    int j = 0;
+  CODE:
+    get_jar_request(aTHX_ url, &req);
+    epoch = get_jar_now(aTHX_ now);
+    if (SvROK(set_cookie) && SvTYPE(SvRV(set_cookie)) == SVt_PVAV) {
+        headers = (AV*) SvRV(set_cookie);
+        count = av_len(headers) + 1;
+    }
+    RETVAL = 0;
+    for (j = 0; j < count; ++j) {
+        SV* header = set_cookie;
+        const char* hstr = 0;
+        STRLEN hlen = 0;
+        if (headers) {
+            SV** elem = av_fetch(headers, j, 0);
+            header = elem ? *elem : 0;
+        }
+        if (!header || !SvOK(header)) {
+            continue;
+        }
+        hstr = SvPV_const(header, hlen);
+        RETVAL += jar_store(self, &req, hstr, hlen, epoch);
+    }
+  OUTPUT: RETVAL
+
+SV*
+cookie_header(HTTP::XSCookies::Jar self, SV* url, SV* site = 0, SV* now = 0)
+  PREINIT:
+    Scratch* scratch = get_scratch(aTHX);
+    JarRequest req;
+    int context = 0;
+    unsigned int mark = 0;
+    Buffer* header = 0;
+  CODE:
+    get_jar_request(aTHX_ url, &req);
+    context = get_jar_site(aTHX_ site);
+    mark = scratch_mark(scratch);
+    header = scratch_get(scratch);
+    jar_header(self, &req, context, get_jar_now(aTHX_ now), header);
+    RETVAL = newSVpvn(header->data, header->wpos);
+    scratch_release(scratch, mark);
+  OUTPUT: RETVAL
+
+void
+cookies(HTTP::XSCookies::Jar self, SV* now = 0)
+  PREINIT:
+    unsigned int j = 0;
+  PPCODE:
+    jar_purge(self, get_jar_now(aTHX_ now));
+    EXTEND(SP, (int) self->count);
+    for (j = 0; j < self->dcount; ++j) {
+        int cpos = 0;
+        for (cpos = self->domains[j].first; cpos >= 0; cpos = self->cookies[cpos].next) {
+            mPUSHs(new_jar_cookie_sv(aTHX_ self, &self->cookies[cpos]));
+        }
+    }
+
+IV
+count(HTTP::XSCookies::Jar self, SV* now = 0)
+  CODE:
+    jar_purge(self, get_jar_now(aTHX_ now));
+    RETVAL = self->count;
+  OUTPUT: RETVAL
+
+IV
+purge(HTTP::XSCookies::Jar self, SV* now = 0)
+  CODE:
+    RETVAL = jar_purge(self, get_jar_now(aTHX_ now));
+  OUTPUT: RETVAL
+
+void
+clear(HTTP::XSCookies::Jar self)
+  CODE:
+    jar_clear(self);
+
+int
+CLONE_SKIP(...)
+  CODE:
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+  OUTPUT: RETVAL
+
+void
+DESTROY(HTTP::XSCookies::Jar self)
+  CODE:
+    jar_fini(self);
+    Safefree(self);
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies::NameSet
+PROTOTYPES: DISABLE
+
+#################################################################
+
+SV*
+new(char* klass, ...)
+  PREINIT:
+    NameSet* set = 0;
+    int j = 0;
+  CODE:
+    Newxz(set, 1, NameSet);
+    nameset_init(set);
+    for (j = 1; j < items; ++j) {
+        const char* nstr = 0;
+        STRLEN nlen = 0;
+        if (!SvOK(ST(j))) {
+            continue;
+        }
+        nstr = SvPV_const(ST(j), nlen);
+        if (nameset_find(set, nstr, nlen) < 0) {
+            nameset_add(set, nstr, nlen);
+        }
+    }
+    nameset_compile(set);
+    RETVAL = sv_setref_pv(newSV(0), klass, set);
+  OUTPUT: RETVAL
+
+void
+names(HTTP::XSCookies::NameSet self)
+  PREINIT:
+    unsigned int j = 0;
+  PPCODE:
+    EXTEND(SP, (int) self->count);
+    for (j = 0; j < self->count; ++j) {
+        mPUSHp(self->entries[j].name, self->entries[j].nlen);
+    }
+
+int
+contains(HTTP::XSCookies::NameSet self, SV* name)
+  PREINIT:
+    const char* nstr = 0;
+    STRLEN nlen = 0;
+  CODE:
+    nstr = SvPV_const(name, nlen);
+    RETVAL = nameset_find(self, nstr, nlen) >= 0;
+  OUTPUT: RETVAL
+
+int
+CLONE_SKIP(...)
+  CODE:
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
+  OUTPUT: RETVAL
+
+void
+DESTROY(HTTP::XSCookies::NameSet self)
+  CODE:
+    nameset_fini(self);
+    Safefree(self);
+
+
+MODULE = HTTP::XSCookies        PACKAGE = HTTP::XSCookies::Lazy
+PROTOTYPES: DISABLE
+
+#################################################################
+
+SV*
+FETCH(HTTP::XSCookies::Lazy self, SV* key)
+  PREINIT:
+    const char* kstr = 0;
+    STRLEN klen = 0;
+    int pos = 0;
+  CODE:
+    kstr = SvPV_const(key, klen);
+    pos = pairs_find(&self->index, kstr, klen);
+    RETVAL = pos < 0 ? newSV(0) : SvREFCNT_inc(lazy_fetch(aTHX_ self, pos));
+  OUTPUT: RETVAL
+
+int
+EXISTS(HTTP::XSCookies::Lazy self, SV* key)
+  PREINIT:
+    const char* kstr = 0;
+    STRLEN klen = 0;
+  CODE:
+    kstr = SvPV_const(key, klen);
+    RETVAL = pairs_find(&self->index, kstr, klen) >= 0;
+  OUTPUT: RETVAL
+
+SV*
+FIRSTKEY(HTTP::XSCookies::Lazy self)
+  CODE:
+    self->iter = 0;
+    RETVAL = lazy_next_key(aTHX_ self);
+  OUTPUT: RETVAL
+
+SV*
+NEXTKEY(HTTP::XSCookies::Lazy self, SV* last)
+  CODE:
+    PERL_UNUSED_VAR(last);
+    RETVAL = lazy_next_key(aTHX_ self);
+  OUTPUT: RETVAL
+
+IV
+SCALAR(HTTP::XSCookies::Lazy self)
+  PREINIT:
+    unsigned int j = 0;
+  CODE:
+    /* count each name once, just like keys() would */
+    RETVAL = 0;
+    for (j = 0; j < self->index.count; ++j) {
+        if (!pairs_is_repeated(&self->index, j)) {
+            ++RETVAL;
+        }
+    }
+  OUTPUT: RETVAL
+
+void
+STORE(HTTP::XSCookies::Lazy self, ...)
+  CODE:
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+
+void
+DELETE(HTTP::XSCookies::Lazy self, ...)
+  CODE:
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+
+void
+CLEAR(HTTP::XSCookies::Lazy self)
+  CODE:
+    PERL_UNUSED_VAR(self);
+    croak("Cannot modify a lazily crushed cookie");
+
+int
+CLONE_SKIP(...)
+  CODE:
+    /* the C data behind each object cannot be shared with a new thread */
+    PERL_UNUSED_VAR(items);
+    RETVAL = 1;
   OUTPUT: RETVAL
+
+void
+DESTROY(HTTP::XSCookies::Lazy self)
+  CODE:
+    pairs_fini(&self->index);
+    SvREFCNT_dec(self->values);
+    if (self->str) {
+        SvREFCNT_dec(self->str);
+    }
+    Safefree(self);
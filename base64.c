@@ -0,0 +1,108 @@
+#include <memory.h>
+#include "base64.h"
+
+static const char base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/*
+ * Value for each character in the alphabet, or 0xff for invalid ones.
+ */
+static unsigned char base64_values[256];
+static int base64_values_ready = 0;
+
+static void base64_init_values(void)
+{
+    int j = 0;
+    memset(base64_values, 0xff, sizeof(base64_values));
+    for (j = 0; j < 64; ++j) {
+        base64_values[(unsigned char) base64_alphabet[j]] = (unsigned char) j;
+    }
+    base64_values_ready = 1;
+}
+
+unsigned int base64_encode_str(const char* src, unsigned int len, char* tgt)
+{
+    const unsigned char* s = (const unsigned char*) src;
+    unsigned int j = 0;
+    char* t = tgt;
+
+    /* three bytes become four characters */
+    for (j = 0; j + 3 <= len; j += 3) {
+        unsigned int v = (s[j] << 16) | (s[j+1] << 8) | s[j+2];
+        *t++ = base64_alphabet[(v >> 18) & 0x3f];
+        *t++ = base64_alphabet[(v >> 12) & 0x3f];
+        *t++ = base64_alphabet[(v >>  6) & 0x3f];
+        *t++ = base64_alphabet[(v      ) & 0x3f];
+    }
+
+    /* one or two bytes left become two or three characters */
+    if (j < len) {
+        unsigned int v = s[j] << 16;
+        if (j + 1 < len) {
+            v |= s[j+1] << 8;
+        }
+        *t++ = base64_alphabet[(v >> 18) & 0x3f];
+        *t++ = base64_alphabet[(v >> 12) & 0x3f];
+        if (j + 1 < len) {
+            *t++ = base64_alphabet[(v >> 6) & 0x3f];
+        }
+    }
+
+    return t - tgt;
+}
+
+Buffer* base64_encode(const char* src, unsigned int len, Buffer* tgt)
+{
+    buffer_ensure_unused(tgt, BASE64_ENCODED_LEN(len));
+    tgt->wpos += base64_encode_str(src, len, tgt->data + tgt->wpos);
+    return tgt;
+}
+
+int base64_decode_str(const char* src, unsigned int len, char* tgt)
+{
+    const unsigned char* s = (const unsigned char*) src;
+    unsigned char* t = (unsigned char*) tgt;
+    unsigned int bad = 0;
+    unsigned int j = 0;
+
+    if (!base64_values_ready) {
+        base64_init_values();
+    }
+
+    /* a single character left over cannot hold a whole byte */
+    if (len % 4 == 1) {
+        return -1;
+    }
+
+    /* four characters become three bytes; invalid characters have all
+     * bits set, so we can check them all at once at the end */
+    for (j = 0; j + 4 <= len; j += 4) {
+        unsigned int a = base64_values[s[j  ]];
+        unsigned int b = base64_values[s[j+1]];
+        unsigned int c = base64_values[s[j+2]];
+        unsigned int d = base64_values[s[j+3]];
+        unsigned int v = (a << 18) | (b << 12) | (c << 6) | d;
+        bad |= a | b | c | d;
+        *t++ = (unsigned char) (v >> 16);
+        *t++ = (unsigned char) (v >>  8);
+        *t++ = (unsigned char) (v      );
+    }
+
+    /* two or three characters left become one or two bytes */
+    if (j < len) {
+        unsigned int a = base64_values[s[j  ]];
+        unsigned int b = base64_values[s[j+1]];
+        unsigned int c = j + 2 < len ? base64_values[s[j+2]] : 0;
+        unsigned int v = (a << 18) | (b << 12) | (c << 6);
+        bad |= a | b | c;
+        *t++ = (unsigned char) (v >> 16);
+        if (j + 2 < len) {
+            *t++ = (unsigned char) (v >> 8);
+        }
+    }
+
+    if (bad & 0x40) {
+        return -1;
+    }
+    return (int) (t - (unsigned char*) tgt);
+}
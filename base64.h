@@ -0,0 +1,41 @@
+#ifndef BASE64_H_
+#define BASE64_H_
+
+/*
+ * The URL and filename safe variant of base64 (RFC 4648, section 5), with
+ * no padding.  All the characters it produces are unreserved, so a value
+ * in base64url can be put in a cookie without URL-encoding it.
+ */
+
+#include "buffer.h"
+
+/*
+ * Number of characters needed to encode len bytes.
+ */
+#define BASE64_ENCODED_LEN(len) (((len) * 4 + 2) / 3)
+
+/*
+ * Encode len bytes from src, appending the result to tgt.
+ */
+Buffer* base64_encode(const char* src, unsigned int len, Buffer* tgt);
+
+/*
+ * Encode len bytes from src into tgt, which must have room for
+ * BASE64_ENCODED_LEN(len) characters; return the number of characters
+ * written.
+ */
+unsigned int base64_encode_str(const char* src, unsigned int len, char* tgt);
+
+/*
+ * Largest number of bytes that len characters can decode to.
+ */
+#define BASE64_DECODED_LEN(len) ((len) * 3 / 4)
+
+/*
+ * Decode len characters from src into tgt, which must have room for
+ * BASE64_DECODED_LEN(len) bytes; return the number of bytes written, or -1
+ * if src is not valid base64url (including padding, which we never add).
+ */
+int base64_decode_str(const char* src, unsigned int len, char* tgt);
+
+#endif
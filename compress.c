@@ -0,0 +1,92 @@
+#include <memory.h>
+#include "base64.h"
+#include "lz.h"
+#include "compress.h"
+
+/*
+ * Most bytes needed for the original length: 21 bits are enough for
+ * COMPRESS_MAX_LEN.
+ */
+#define COMPRESS_HEADER_MAX 3
+
+int compress_append(const Buffer* value, unsigned int limit, Buffer* tgt)
+{
+    unsigned int vlen = buffer_used(value);
+    unsigned int rlen = 0;
+    unsigned int rpos = 0;
+    unsigned int num = vlen;
+    unsigned char* raw = 0;
+
+    if (vlen < COMPRESS_THRESHOLD || vlen > COMPRESS_MAX_LEN) {
+        return 0;
+    }
+
+    /* lay out the length and the compressed value at the end of the
+     * target, and encode them into base64url right before them */
+    rlen = COMPRESS_HEADER_MAX + LZ_COMPRESS_BOUND(vlen);
+    buffer_ensure_unused(tgt, 1 + BASE64_ENCODED_LEN(rlen) + rlen);
+    rpos = tgt->wpos + 1 + BASE64_ENCODED_LEN(rlen);
+    raw = (unsigned char*) tgt->data + rpos;
+
+    rlen = 0;
+    while (num >= 0x80) {
+        raw[rlen++] = (unsigned char) ((num & 0x7f) | 0x80);
+        num >>= 7;
+    }
+    raw[rlen++] = (unsigned char) num;
+    rlen += lz_compress(value->data + value->rpos, vlen, (char*) raw + rlen);
+
+    /* not worth it? */
+    if (1 + BASE64_ENCODED_LEN(rlen) >= limit) {
+        return 0;
+    }
+
+    tgt->data[tgt->wpos++] = COMPRESS_MARKER;
+    tgt->wpos += base64_encode_str((const char*) raw, rlen, tgt->data + tgt->wpos);
+    return 1;
+}
+
+int compress_open(const char* data, unsigned int len, Buffer* tgt)
+{
+    unsigned int rpos = 0;
+    unsigned int hlen = 0;
+    unsigned int vlen = 0;
+    unsigned int shift = 0;
+    unsigned char byte = 0;
+    int rlen = 0;
+
+    if (!len || data[0] != COMPRESS_MARKER) {
+        return 0;
+    }
+
+    /* decode into the target; once we know the length of the original
+     * value, we move the compressed bytes out of its way */
+    buffer_ensure_unused(tgt, BASE64_DECODED_LEN(len - 1));
+    rpos = tgt->wpos;
+    rlen = base64_decode_str(data + 1, len - 1, tgt->data + rpos);
+    if (rlen <= 0) {
+        return 0;
+    }
+
+    do {
+        if ((int) hlen >= rlen || hlen >= COMPRESS_HEADER_MAX) {
+            return 0;
+        }
+        byte = (unsigned char) tgt->data[rpos + hlen++];
+        vlen |= (unsigned int) (byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    if (vlen > COMPRESS_MAX_LEN) {
+        return 0;
+    }
+
+    /* the buffer might move when we make room for the original value */
+    buffer_ensure_unused(tgt, rlen + vlen);
+    memmove(tgt->data + rpos + vlen, tgt->data + rpos, rlen);
+    if (!lz_decompress(tgt->data + rpos + vlen + hlen, rlen - hlen,
+                       tgt->data + rpos, vlen)) {
+        return 0;
+    }
+    tgt->wpos += vlen;
+    return 1;
+}
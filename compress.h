@@ -0,0 +1,45 @@
+#ifndef COMPRESS_H_
+#define COMPRESS_H_
+
+/*
+ * Compressed cookie values.  A compressed value is a '!' followed, in
+ * base64url, by the length of the original value (unsigned LEB128) and the
+ * value compressed with our LZ block compressor (see lz.h).
+ *
+ * When baking, all characters other than the unreserved ones are
+ * URL-encoded, so a plain value never starts with a verbatim '!'; that is
+ * how we tell compressed values apart when crushing a cookie.
+ */
+
+#include "buffer.h"
+
+#define COMPRESS_MARKER '!'
+
+/*
+ * Values shorter than this are never compressed: they would not get
+ * much shorter, if at all.
+ */
+#define COMPRESS_THRESHOLD 128
+
+/*
+ * Longest value we will decompress, so that a small bogus cookie cannot
+ * make us allocate lots of memory.
+ */
+#define COMPRESS_MAX_LEN (1U << 20)
+
+/*
+ * Compress the unread contents of a buffer, appending the compressed value
+ * to tgt.  Return zero, appending nothing, if the value is shorter than
+ * COMPRESS_THRESHOLD or the compressed value would not be shorter than
+ * limit characters (how long the value would be in the cookie otherwise).
+ */
+int compress_append(const Buffer* value, unsigned int limit, Buffer* tgt);
+
+/*
+ * Decompress a compressed value (including its leading '!'), appending
+ * the original value to tgt.  Return zero if the value is not valid,
+ * non-zero otherwise.
+ */
+int compress_open(const char* data, unsigned int len, Buffer* tgt);
+
+#endif
@@ -4,14 +4,37 @@
 #include "buffer.h"
 #include "uri.h"
 #include "date.h"
+#include "format.h"
+#include "scan.h"
 #include "cookie.h"
 
 /*
  * This file is generated automatically with program "encode".
  * We include it because we will do our own URL decoding.
  */
+#define URI_TABLES_SOME
+#define URI_TABLE_DECODE
+#define URI_TABLE_STATE
+#define URI_TABLE_PLAIN
 #include "uri_tables.h"
 
+/*
+ * Return non-zero if there is an escape ("%XY", with two hex digits) at the
+ * current position in a cookie.  The second digit is only looked at when the
+ * first one is valid, so we never read past the terminating null.
+ */
+#define COOKIE_AT_ESCAPE(cookie) \
+    ((cookie)->data[(cookie)->rpos] == '%' && \
+     uri_decode_tbl[(unsigned char) (cookie)->data[(cookie)->rpos+1]] < NIBBLE_NONE && \
+     uri_decode_tbl[(unsigned char) (cookie)->data[(cookie)->rpos+2]] < NIBBLE_NONE)
+
+/*
+ * Return the byte for the escape at the current position in a cookie.
+ */
+#define COOKIE_ESCAPE_BYTE(cookie) \
+    MAKE_BYTE(uri_decode_tbl[(unsigned char) (cookie)->data[(cookie)->rpos+1]], \
+              uri_decode_tbl[(unsigned char) (cookie)->data[(cookie)->rpos+2]])
+
 static Buffer* cookie_put_value(Buffer* cookie,
                                 const char* name, int nlen,
                                 const char* value, int vlen,
@@ -22,6 +45,10 @@ static Buffer* cookie_put_value(Buffer* cookie,
     buffer_wrap(&dnam, name , nlen);
     buffer_wrap(&dval, value, vlen);
 
+    /* make room for everything at once; encoding at most triples a size */
+    buffer_ensure_unused(cookie, 2 + (enc_nam ? 3 : 1) * nlen +
+                                 1 + (enc_val ? 3 : 1) * vlen);
+
     /* output each part into the cookie */
     do {
         if (cookie->wpos > 0) {
@@ -60,32 +87,32 @@ Buffer* cookie_put_string(Buffer* cookie,
 
 Buffer* cookie_put_date(Buffer* cookie,
                         const char* name, int nlen,
-                        const char* value, int vlen)
+                        const char* value, int vlen,
+                        DateCache* cache)
 {
-    Buffer format;
+    DateCache local;
+    const char* format = 0;
 
+    /* a date specification, or else an absolute HTTP date */
     double date = date_compute(value, vlen);
-    if (date < 0) {
+    if (date < 0 && !date_parse_http(value, vlen, &date)) {
         return cookie_put_value(cookie, name, nlen, value, vlen, 0, 0, 0);
     }
 
-    buffer_init(&format, 0);
-    date_format(date, &format);
-    cookie_put_value(cookie, name, nlen, format.data, format.wpos, 0, 0, 0);
-    buffer_fini(&format);
-
-    return cookie;
+    if (!cache) {
+        date_cache_init(&local);
+        cache = &local;
+    }
+    format = date_format_cached(date, cache);
+    return cookie_put_value(cookie, name, nlen, format, DATE_FORMAT_LEN, 0, 0, 0);
 }
 
 Buffer* cookie_put_integer(Buffer* cookie,
                            const char* name, int nlen,
                            long value)
 {
-    char buf[50]; /* FIXED BUFFER OK: to format a long */
-    int blen = 0;
-
-    sprintf(buf, "%ld", value);
-    blen = strlen(buf);
+    char buf[FORMAT_LONG_LEN]; /* FIXED BUFFER OK: to format a long */
+    int blen = format_long(buf, value);
     return cookie_put_value(cookie, name, nlen, buf, blen, 0, 0, 0);
 }
 
@@ -105,6 +132,20 @@ Buffer* cookie_put_boolean(Buffer* cookie,
     return cookie_put_value(cookie, name, nlen, buf, blen, 1, 0, 0);
 }
 
+/*
+ * Return how many characters are left in the current pair of a cookie,
+ * up to the next ';'.  Since URL-decoding never makes anything longer,
+ * this is as much as we will need in a buffer for the rest of the name
+ * or value we are parsing, so we can make room for it once instead of
+ * checking for every character.
+ */
+static unsigned int cookie_pair_left(const Buffer* cookie)
+{
+    const char* semi = (const char*) memchr(cookie->data + cookie->rpos, ';',
+                                            buffer_used(cookie));
+    return semi ? (unsigned int) (semi - (cookie->data + cookie->rpos)) : buffer_used(cookie);
+}
+
 /*
  * Given a buffer that holds a cookie (and therefore has an idea
  * of the current position within the cookie), parse the next
@@ -131,13 +172,40 @@ Buffer* cookie_put_boolean(Buffer* cookie,
  * This table (as well as the other tables that ease the process
  * of URL encoding and decoding) was generated with a C program,
  * which can be found in tools/encode/encode.
+ *
+ * Most characters in a name or value don't change the state and
+ * are copied verbatim; when we see one of these, we use scan_plain()
+ * to find the whole run of such characters and copy it in one go.
  */
 int cookie_get_pair(Buffer* cookie,
                     Buffer* name, Buffer* value)
+{
+    return cookie_get_pair_span(cookie, name, value, 0);
+}
+
+/*
+ * Same as cookie_get_pair(), but if span is not null, values that
+ * don't need any URL-decoding are not copied into the value buffer;
+ * in that case, span is filled in with their position within the
+ * cookie.  We only start copying a value into the buffer when we find
+ * the first character that must be decoded.
+ *
+ * If value is null (which requires a span), values are never copied;
+ * the span will indicate whether they need to be URL-decoded.
+ */
+int cookie_get_pair_span(Buffer* cookie,
+                         Buffer* name, Buffer* value,
+                         CookieSpan* span)
 {
     int norig = name->wpos;
-    int vorig = value->wpos;
+    int vorig = value ? (int) value->wpos : 0;
     int vend = 0;
+    int vpos = -1;
+    unsigned int vraw = 0;
+    int verbatim = span != 0;
+    int escaped = 0;
+    int nready = 0;
+    int vready = 0;
     int state = 0;
     int current = 0;
     int equals = 0;
@@ -148,20 +216,29 @@ int cookie_get_pair(Buffer* cookie,
     for (state = URI_STATE_START; state < URI_STATE_TERMINATE; ) {
         /* Switch to next state based on last character read
          * and current state. */
-        current = cookie->data[cookie->rpos];
+        current = (unsigned char) cookie->data[cookie->rpos];
         state = uri_state_tbl[current][state];
 
         switch (state) {
             /* If we are reading the name part, add the current
              * character (possibly URL-decoded) */
             case URI_STATE_NAME:
-                buffer_ensure_unused(name, 1);
-                if (current == '%' &&
-                    isxdigit(cookie->data[cookie->rpos+1]) &&
-                    isxdigit(cookie->data[cookie->rpos+2])) {
+                if (uri_plain_tbl[current] && cookie->rpos < cookie->wpos) {
+                    /* copy the whole run of plain characters */
+                    unsigned int run = scan_plain(cookie->data + cookie->rpos,
+                                                  buffer_used(cookie));
+                    buffer_append_str(name, cookie->data + cookie->rpos, run);
+                    cookie->rpos += run;
+                    break;
+                }
+                if (!nready) {
+                    /* make room for the rest of the name at once */
+                    buffer_ensure_unused(name, cookie_pair_left(cookie));
+                    nready = 1;
+                }
+                if (COOKIE_AT_ESCAPE(cookie)) {
                     /* put a byte together from the next two hex digits */
-                    name->data[name->wpos++] = MAKE_BYTE(uri_decode_tbl[(int)cookie->data[cookie->rpos+1]],
-                                                         uri_decode_tbl[(int)cookie->data[cookie->rpos+2]]);
+                    name->data[name->wpos++] = COOKIE_ESCAPE_BYTE(cookie);
                     cookie->rpos += 3;
                 } else {
                     /* just copy current character */
@@ -178,13 +255,57 @@ int cookie_get_pair(Buffer* cookie,
             /* If we are reading the value part, add the current
              * character (possibly URL-decoded) */
             case URI_STATE_VALUE:
-                buffer_ensure_unused(value, 1);
-                if (current == '%' &&
-                    isxdigit(cookie->data[cookie->rpos+1]) &&
-                    isxdigit(cookie->data[cookie->rpos+2])) {
+                if (vpos < 0) {
+                    vpos = cookie->rpos;
+                }
+                if (verbatim) {
+                    int escape = COOKIE_AT_ESCAPE(cookie);
+                    if (!escape || !value) {
+                        /* nothing to decode (yet), just skip characters,
+                         * remembering where the last non-space one was */
+                        if (escape) {
+                            cookie->rpos += 3;
+                            vraw = cookie->rpos;
+                            escaped = 1;
+                        } else if (uri_plain_tbl[current] && cookie->rpos < cookie->wpos) {
+                            cookie->rpos += scan_plain(cookie->data + cookie->rpos,
+                                                       buffer_used(cookie));
+                            vraw = cookie->rpos;
+                        } else {
+                            ++cookie->rpos;
+                            if (!isspace(current)) {
+                                vraw = cookie->rpos;
+                            }
+                        }
+                        break;
+                    }
+
+                    /* we must decode this value, so copy what we skipped
+                     * so far and continue as usual */
+                    buffer_append_str(value, cookie->data + vpos, cookie->rpos - vpos);
+                    if (vraw) {
+                        vend = vorig + vraw - vpos;
+                    }
+                    verbatim = 0;
+                    escaped = 1;
+                }
+                if (uri_plain_tbl[current] && cookie->rpos < cookie->wpos) {
+                    /* copy the whole run of plain characters */
+                    unsigned int run = scan_plain(cookie->data + cookie->rpos,
+                                                  buffer_used(cookie));
+                    buffer_append_str(value, cookie->data + cookie->rpos, run);
+                    cookie->rpos += run;
+                    vend = value->wpos;
+                    break;
+                }
+                if (!vready) {
+                    /* make room for the rest of the value at once */
+                    buffer_ensure_unused(value, cookie_pair_left(cookie));
+                    vready = 1;
+                }
+                if (COOKIE_AT_ESCAPE(cookie)) {
                     /* put a byte together from the next two hex digits */
-                    value->data[value->wpos++] = MAKE_BYTE(uri_decode_tbl[(int)cookie->data[cookie->rpos+1]],
-                                                           uri_decode_tbl[(int)cookie->data[cookie->rpos+2]]);
+                    value->data[value->wpos++] = COOKIE_ESCAPE_BYTE(cookie);
                     cookie->rpos += 3;
                     vend = value->wpos;
                 } else {
@@ -212,7 +333,9 @@ int cookie_get_pair(Buffer* cookie,
     /* If we didn't end in URI_STATE_END, reset buffers. */
     if (state != URI_STATE_END) {
         name->wpos = norig;
-        value->wpos = vorig;
+        if (value) {
+            value->wpos = vorig;
+        }
     } else {
         /* Maybe correct end position for value. */
         if (vend) {
@@ -220,5 +343,27 @@ int cookie_get_pair(Buffer* cookie,
         }
     }
 
+    if (span) {
+        span->verbatim = verbatim;
+        span->escaped = escaped;
+        span->vpos = vpos < 0 ? cookie->rpos : (unsigned int) vpos;
+        span->vlen = (state == URI_STATE_END && vraw) ? vraw - span->vpos : 0;
+    }
+
     return equals;
 }
+
+Buffer* cookie_get_span_value(const Buffer* cookie,
+                              const CookieSpan* span,
+                              Buffer* value)
+{
+    Buffer raw;
+
+    buffer_wrap(&raw, cookie->data + span->vpos, span->vlen);
+    if (span->escaped) {
+        url_decode(&raw, value);
+    } else {
+        buffer_append_buf(value, &raw);
+    }
+    return value;
+}
@@ -8,14 +8,21 @@
  */
 
 #include "buffer.h"
+#include "date.h"
 
 Buffer* cookie_put_string(Buffer* cookie,
                           const char* name, int nlen,
                           const char* value, int vlen,
                           int enc_nam, int enc_val);
+/*
+ * The value can be a date specification (see date_compute()) or an HTTP
+ * date, which is normalized; anything else is copied verbatim.  The cache
+ * for formatted dates is optional (can be null).
+ */
 Buffer* cookie_put_date(Buffer* cookie,
                         const char* name, int nlen,
-                        const char* value, int vlen);
+                        const char* value, int vlen,
+                        DateCache* cache);
 Buffer* cookie_put_integer(Buffer* cookie,
                           const char* name, int nlen,
                           long value);
@@ -23,7 +30,31 @@ Buffer* cookie_put_boolean(Buffer* cookie,
                           const char* name, int nlen,
                           int value);
 
+/*
+ * Where a value was found within the cookie.  If the value was not copied
+ * into the value buffer, verbatim will be non-zero and the value can be
+ * found in the cookie itself, at position vpos and with length vlen;
+ * escaped indicates whether those bytes still need URL-decoding.
+ */
+typedef struct CookieSpan {
+    int verbatim;
+    int escaped;
+    unsigned int vpos;
+    unsigned int vlen;
+} CookieSpan;
+
 int cookie_get_pair(Buffer* cookie,
                     Buffer* name, Buffer* value);
+int cookie_get_pair_span(Buffer* cookie,
+                         Buffer* name, Buffer* value,
+                         CookieSpan* span);
+
+/*
+ * Append to value the (URL-decoded) value described by a span that was
+ * filled in by cookie_get_pair_span() without copying the value.
+ */
+Buffer* cookie_get_span_value(const Buffer* cookie,
+                              const CookieSpan* span,
+                              Buffer* value);
 
 #endif
@@ -1,17 +1,14 @@
 #include <ctype.h>
-#include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include "format.h"
 #include "date.h"
 
-/* length of a string like "Sun, 08-Jan-2006 13:56:17 GMT"]" */
-#define DATE_FORMAT_LEN 29
-
 double date_compute(const char *date, int len)
 {
     int state = 0;
     int negative = -1;
-    int part[2] = {0,0};
+    double part[2] = {0,0};
     int p = 0;
     double decimals = 1;
     char term = 's';
@@ -91,14 +88,14 @@ double date_compute(const char *date, int len)
         return -1;
     }
 
-    offset = (double) part[0];
+    offset = part[0];
 
     /* digits only => epoch */
     if (state == 2 && negative < 0) {
         return offset;
     }
 
-    offset += (double) part[1] / decimals;
+    offset += part[1] / decimals;
     if (negative == 1) {
         offset = - offset;
     }
@@ -132,58 +129,280 @@ double date_compute(const char *date, int len)
     return base + offset;
 }
 
-Buffer* date_format(double date, Buffer* format)
+int date_is_relative(const char *date, int len)
 {
-    static const char* Mon[] = {
-        "Jan",
-        "Feb",
-        "Mar",
-        "Apr",
-        "May",
-        "Jun",
-        "Jul",
-        "Aug",
-        "Sep",
-        "Oct",
-        "Nov",
-        "Dec",
-    };
-    static const char* Day[] = {
-        "Sun",
-        "Mon",
-        "Tue",
-        "Wed",
-        "Thu",
-        "Fri",
-        "Sat",
-    };
-
-    time_t t = (time_t) date;
-    struct tm gmt;
-
-#if defined(_WIN32) || defined(_WIN64)
-    /* Damn you Windows... */
-    struct tm* p = gmtime(&t);
-    if (p) {
-        gmt = *p;
-    } else {
-        memset(&gmt, 0, sizeof(gmt));
+    int e = 0;
+
+    if (len < 0) {
+        len = strlen(date);
+    }
+    if (len == 3 &&
+        date[0] == 'n' &&
+        date[1] == 'o' &&
+        date[2] == 'w') {
+        return 1;
     }
-#else
-    gmtime_r(&t, &gmt);
-#endif
+    for (; e < len; ++e) {
+        if (!isspace(date[e])) {
+            return date[e] == '+' || date[e] == '-';
+        }
+    }
+    return 0;
+}
 
+Buffer* date_format(double date, Buffer* format)
+{
+    if (date > FORMAT_DATE_MAX) {
+        date = FORMAT_DATE_MAX;
+    }
     buffer_ensure_unused(format, DATE_FORMAT_LEN);
-    sprintf(format->data + format->wpos,
-            "%3s, %02d-%3s-%04d %02d:%02d:%02d %3s",
-            Day[gmt.tm_wday % 7],
-            gmt.tm_mday,
-            Mon[gmt.tm_mon % 12],
-            gmt.tm_year + 1900,
-            gmt.tm_hour,
-            gmt.tm_min,
-            gmt.tm_sec,
-            "GMT");
+    format_date(format->data + format->wpos, (time_t) date, FORMAT_DATE_NETSCAPE);
     format->wpos += DATE_FORMAT_LEN;
     return format;
 }
+
+void date_cache_init(DateCache* cache)
+{
+    unsigned int j = 0;
+    for (j = 0; j < DATE_CACHE_SIZE; ++j) {
+        cache->entries[j].valid = 0;
+        cache->entries[j].second = 0;
+    }
+    cache->next = 0;
+}
+
+const char* date_format_cached(double date, DateCache* cache)
+{
+    time_t t = 0;
+    DateCacheEntry* entry = 0;
+    unsigned int j = 0;
+
+    /* clamp before converting, a time_t may not hold a date that far */
+    if (date > FORMAT_DATE_MAX) {
+        date = FORMAT_DATE_MAX;
+    }
+    t = (time_t) date;
+
+    for (j = 0; j < DATE_CACHE_SIZE; ++j) {
+        entry = &cache->entries[j];
+        if (entry->valid && entry->second == t) {
+            return entry->text;
+        }
+    }
+
+    /* not there, replace the oldest entry */
+    entry = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % DATE_CACHE_SIZE;
+    format_date(entry->text, t, FORMAT_DATE_NETSCAPE);
+    entry->second = t;
+    entry->valid = 1;
+    return entry->text;
+}
+
+/*
+ * Skip spaces in a date string, and return the new position.
+ */
+static int date_skip_spaces(const char* date, int len, int pos)
+{
+    while (pos < len && date[pos] == ' ') {
+        ++pos;
+    }
+    return pos;
+}
+
+/*
+ * Get a number of up to four digits at pos; return how many digits we saw
+ * and advance pos past them.
+ */
+static int date_get_number(const char* date, int len, int* pos, int* value)
+{
+    int digits = 0;
+    *value = 0;
+    while (*pos < len && digits < 4 && isdigit((unsigned char) date[*pos])) {
+        *value = 10 * *value + date[*pos] - '0';
+        ++*pos;
+        ++digits;
+    }
+    return digits;
+}
+
+/*
+ * Pack three characters into an int, turning upper case letters into
+ * lower case, so that a month name can be found with a single switch.
+ */
+#define DATE_MONTH_KEY(a, b, c) \
+    ((((a) | 0x20) << 16) | (((b) | 0x20) << 8) | ((c) | 0x20))
+
+/*
+ * Get a three-letter month name at pos; return its number (1 to 12), or 0
+ * if there is no valid month name there.
+ */
+static int date_get_month(const char* date, int len, int* pos)
+{
+    int month = 0;
+
+    if (*pos + 3 > len) {
+        return 0;
+    }
+    switch (DATE_MONTH_KEY((unsigned char) date[*pos + 0],
+                           (unsigned char) date[*pos + 1],
+                           (unsigned char) date[*pos + 2])) {
+        case DATE_MONTH_KEY('j', 'a', 'n'): month =  1; break;
+        case DATE_MONTH_KEY('f', 'e', 'b'): month =  2; break;
+        case DATE_MONTH_KEY('m', 'a', 'r'): month =  3; break;
+        case DATE_MONTH_KEY('a', 'p', 'r'): month =  4; break;
+        case DATE_MONTH_KEY('m', 'a', 'y'): month =  5; break;
+        case DATE_MONTH_KEY('j', 'u', 'n'): month =  6; break;
+        case DATE_MONTH_KEY('j', 'u', 'l'): month =  7; break;
+        case DATE_MONTH_KEY('a', 'u', 'g'): month =  8; break;
+        case DATE_MONTH_KEY('s', 'e', 'p'): month =  9; break;
+        case DATE_MONTH_KEY('o', 'c', 't'): month = 10; break;
+        case DATE_MONTH_KEY('n', 'o', 'v'): month = 11; break;
+        case DATE_MONTH_KEY('d', 'e', 'c'): month = 12; break;
+        default: return 0;
+    }
+    *pos += 3;
+    return month;
+}
+
+/*
+ * Get a time "hh:mm:ss" at pos; return the number of seconds since
+ * midnight, or -1 if the time is not valid.
+ */
+static long date_get_time(const char* date, int len, int* pos)
+{
+    int part[3];
+    int j = 0;
+
+    for (j = 0; j < 3; ++j) {
+        if (j > 0) {
+            if (*pos >= len || date[*pos] != ':') {
+                return -1;
+            }
+            ++*pos;
+        }
+        if (date_get_number(date, len, pos, &part[j]) != 2) {
+            return -1;
+        }
+    }
+    if (part[0] > 23 || part[1] > 59 || part[2] > 60) {
+        return -1;
+    }
+    return part[0] * 3600L + part[1] * 60L + part[2];
+}
+
+/*
+ * Number of days since 1970-01-01 for a given civil date; this is the
+ * inverse of the computation done by format_date().  Algorithm from
+ * http://howardhinnant.github.io/date_algorithms.html
+ */
+static long date_days_from_civil(long y, unsigned int m, unsigned int d)
+{
+    long era = 0;
+    unsigned long yoe = 0;
+    unsigned long doy = 0;
+    unsigned long doe = 0;
+
+    y -= m <= 2;
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = (unsigned long) (y - era * 400);
+    doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long) doe - 719468;
+}
+
+int date_parse_http(const char *date, int len, double* epoch)
+{
+    static const int mdays[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    int pos = 0;
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    int digits = 0;
+    long seconds = 0;
+
+    if (len < 0) {
+        len = strlen(date);
+    }
+
+    /* skip the day name and the comma after it, if any */
+    pos = date_skip_spaces(date, len, pos);
+    while (pos < len && isalpha((unsigned char) date[pos])) {
+        ++pos;
+    }
+    if (pos < len && date[pos] == ',') {
+        ++pos;
+    }
+    pos = date_skip_spaces(date, len, pos);
+
+    if (pos < len && isdigit((unsigned char) date[pos])) {
+        /* "06 Nov 1994 08:49:37 GMT", "06-Nov-94 08:49:37 GMT" */
+        char sep = 0;
+        if (date_get_number(date, len, &pos, &day) > 2 || pos >= len) {
+            return 0;
+        }
+        sep = date[pos];
+        if (sep != ' ' && sep != '-') {
+            return 0;
+        }
+        ++pos;
+        month = date_get_month(date, len, &pos);
+        if (!month || pos >= len || date[pos] != sep) {
+            return 0;
+        }
+        ++pos;
+        digits = date_get_number(date, len, &pos, &year);
+        if (digits == 2) {
+            /* two-digit years, as in RFC 6265 */
+            year += year < 70 ? 2000 : 1900;
+        } else if (digits != 4) {
+            return 0;
+        }
+        pos = date_skip_spaces(date, len, pos);
+        seconds = date_get_time(date, len, &pos);
+        if (seconds < 0) {
+            return 0;
+        }
+        pos = date_skip_spaces(date, len, pos);
+        if (pos + 3 <= len &&
+            (strncmp(date + pos, "GMT", 3) == 0 ||
+             strncmp(date + pos, "UTC", 3) == 0)) {
+            pos += 3;
+        }
+    } else {
+        /* "Nov  6 08:49:37 1994" */
+        month = date_get_month(date, len, &pos);
+        if (!month) {
+            return 0;
+        }
+        pos = date_skip_spaces(date, len, pos);
+        if (date_get_number(date, len, &pos, &day) > 2) {
+            return 0;
+        }
+        pos = date_skip_spaces(date, len, pos);
+        seconds = date_get_time(date, len, &pos);
+        if (seconds < 0) {
+            return 0;
+        }
+        pos = date_skip_spaces(date, len, pos);
+        if (date_get_number(date, len, &pos, &year) != 4) {
+            return 0;
+        }
+    }
+
+    /* only trailing spaces allowed */
+    if (date_skip_spaces(date, len, pos) != len) {
+        return 0;
+    }
+
+    if (day < 1 || day > mdays[month - 1]) {
+        return 0;
+    }
+    if (month == 2 && day == 29 &&
+        (year % 4 != 0 || (year % 100 == 0 && year % 400 != 0))) {
+        return 0;
+    }
+
+    *epoch = date_days_from_civil(year, month, day) * 86400.0 + seconds;
+    return 1;
+}
@@ -14,10 +14,68 @@
  *     this will be added / subtracted to the current time
  */
 
+#include <time.h>
 #include "buffer.h"
 
+#include "format.h"
+
+/* length of a string like "Sun, 08-Jan-2006 13:56:17 GMT" */
+#define DATE_FORMAT_LEN FORMAT_DATE_LEN
+
+/*
+ * A cache for the last few formatted dates.  Many cookies baked within the
+ * same second will have exactly the same expiration date, so we only format
+ * a date when it falls in a different second than the cached ones.  We keep
+ * a few dates, so that baking cookies with a few different expiration dates
+ * (for example, "+1y" and "+30d") does not evict them all the time.
+ *
+ * The cache is not protected in any way, so each thread / interpreter must
+ * use its own.
+ */
+#define DATE_CACHE_SIZE 4
+
+typedef struct DateCacheEntry {
+    int valid;
+    time_t second;
+    char text[DATE_FORMAT_LEN];
+} DateCacheEntry;
+
+typedef struct DateCache {
+    unsigned int next;  /* entry to be replaced next */
+    DateCacheEntry entries[DATE_CACHE_SIZE];
+} DateCache;
+
 double date_compute(const char *date, int len);
 
+/*
+ * Return non-zero if the time_t computed for a date specification depends
+ * on the current time ("now", or an offset such as "+1d").
+ */
+int date_is_relative(const char *date, int len);
+
 Buffer* date_format(double date, Buffer* format);
 
+void date_cache_init(DateCache* cache);
+
+/*
+ * Return the formatted date (DATE_FORMAT_LEN characters, not null
+ * terminated), using the cache if possible.  The returned pointer is only
+ * valid until the next call with the same cache.
+ */
+const char* date_format_cached(double date, DateCache* cache);
+
+/*
+ * Parse a date in any of the formats allowed by HTTP:
+ *
+ *   "Sun, 06 Nov 1994 08:49:37 GMT"    IMF-fixdate (RFC 1123)
+ *   "Sunday, 06-Nov-94 08:49:37 GMT"   RFC 850
+ *   "Sun Nov  6 08:49:37 1994"         asctime
+ *
+ * as well as the Netscape format we use when baking cookies, with a
+ * four-digit year and dashes.  Day and month names are not case sensitive,
+ * and the day name is not checked.  If the date is valid, store its time_t
+ * in epoch and return non-zero; otherwise return zero.
+ */
+int date_parse_http(const char *date, int len, double* epoch);
+
 #endif
@@ -0,0 +1,121 @@
+#include <string.h>
+#include "format.h"
+
+#define SECONDS_PER_DAY (24 * 60 * 60)
+
+/* the text for all numbers from 00 to 99 */
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char* month_names = "JanFebMarAprMayJunJulAugSepOctNovDec";
+static const char* day_names = "ThuFriSatSunMonTueWed"; /* day 0 was a Thursday */
+
+#define FORMAT_PUT_2DIGITS(str, num) \
+    memcpy((str), digit_pairs + 2 * (num), 2)
+
+unsigned int format_long(char* buf, long value)
+{
+    char tmp[FORMAT_LONG_LEN];
+    char* end = tmp + FORMAT_LONG_LEN;
+    char* pos = end;
+    unsigned long number = value < 0 ? 0UL - (unsigned long) value : (unsigned long) value;
+    unsigned int len = 0;
+
+    /* write two digits at a time, from the right */
+    while (number >= 100) {
+        unsigned int pair = (unsigned int) (number % 100);
+        number /= 100;
+        pos -= 2;
+        FORMAT_PUT_2DIGITS(pos, pair);
+    }
+    if (number >= 10) {
+        pos -= 2;
+        FORMAT_PUT_2DIGITS(pos, number);
+    } else {
+        *--pos = '0' + (char) number;
+    }
+    if (value < 0) {
+        *--pos = '-';
+    }
+
+    len = end - pos;
+    memcpy(buf, pos, len);
+    return len;
+}
+
+/*
+ * Convert a number of days since 1970-01-01 into year / month / day.
+ * See http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+ */
+static void civil_from_days(long days, long* year, unsigned int* month, unsigned int* day)
+{
+    long era = 0;
+    unsigned long doe = 0;  /* day of era, [0, 146096] */
+    unsigned long yoe = 0;  /* year of era, [0, 399] */
+    unsigned long doy = 0;  /* day of year, starting in March, [0, 365] */
+    unsigned long mp = 0;   /* month, starting in March, [0, 11] */
+
+    days += 719468;         /* shift epoch to 0000-03-01 */
+    era = (days >= 0 ? days : days - 146096) / 146097;
+    doe = (unsigned long) (days - era * 146097);
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
+
+    *day = (unsigned int) (doy - (153 * mp + 2) / 5 + 1);
+    *month = (unsigned int) (mp < 10 ? mp + 3 : mp - 9);
+    *year = (long) yoe + era * 400 + (*month <= 2);
+}
+
+void format_date(char* text, time_t t, char separator)
+{
+    long days = 0;
+    long secs = 0;
+    long year = 0;
+    unsigned int month = 0;
+    unsigned int day = 0;
+    unsigned int wday = 0;
+
+    if ((double) t > FORMAT_DATE_MAX) {
+        t = (time_t) FORMAT_DATE_MAX;
+    }
+    days = (long) (t / SECONDS_PER_DAY);
+    secs = (long) (t % SECONDS_PER_DAY);
+    if (secs < 0) {
+        secs += SECONDS_PER_DAY;
+        --days;
+    }
+    civil_from_days(days, &year, &month, &day);
+    wday = (unsigned int) (days % 7 < 0 ? days % 7 + 7 : days % 7);
+    year %= 10000;
+    if (year < 0) {
+        year += 10000;
+    }
+
+    /* "Sun, 08-Jan-2006 13:56:17 GMT" */
+    memcpy(text +  0, day_names + 3 * wday, 3);
+    text[3] = ',';
+    text[4] = ' ';
+    FORMAT_PUT_2DIGITS(text + 5, day);
+    text[7] = separator;
+    memcpy(text +  8, month_names + 3 * (month - 1), 3);
+    text[11] = separator;
+    FORMAT_PUT_2DIGITS(text + 12, year / 100);
+    FORMAT_PUT_2DIGITS(text + 14, year % 100);
+    text[16] = ' ';
+    FORMAT_PUT_2DIGITS(text + 17, secs / 3600);
+    text[19] = ':';
+    FORMAT_PUT_2DIGITS(text + 20, secs / 60 % 60);
+    text[22] = ':';
+    FORMAT_PUT_2DIGITS(text + 23, secs % 60);
+    memcpy(text + 25, " GMT", 4);
+}
@@ -0,0 +1,56 @@
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+/*
+ * Fast formatting of integers and dates, used when baking cookies.
+ *
+ * Integers are formatted two digits at a time, using a table with the text
+ * for all numbers from 00 to 99.  Dates are converted from a time_t into
+ * year / month / day with a few integer operations (the "civil from days"
+ * algorithm by Howard Hinnant), instead of calling gmtime_r().
+ *
+ * These functions do not depend on Perl, so they can also be used from the
+ * programs in tools/format.
+ */
+
+#include <time.h>
+
+/*
+ * Maximum number of characters needed to format a long.
+ */
+#define FORMAT_LONG_LEN 21
+
+/*
+ * Number of characters in a formatted date, such as
+ * "Sun, 08-Jan-2006 13:56:17 GMT".
+ */
+#define FORMAT_DATE_LEN 29
+
+/*
+ * Separators between the day, month and year in a formatted date.
+ */
+#define FORMAT_DATE_NETSCAPE '-'    /* Sun, 08-Jan-2006 13:56:17 GMT */
+#define FORMAT_DATE_RFC1123  ' '    /* Sun, 08 Jan 2006 13:56:17 GMT */
+
+/*
+ * Latest date we can write with a four digit year, 9999-12-31 23:59:59;
+ * later dates are written as this one, so they stay in the future.
+ */
+#define FORMAT_DATE_MAX 253402300799.0
+
+/*
+ * Write the decimal text for value into buf, which must have room for at
+ * least FORMAT_LONG_LEN characters; no null terminator is written.
+ * Return the number of characters written.
+ */
+unsigned int format_long(char* buf, long value);
+
+/*
+ * Write exactly FORMAT_DATE_LEN characters into text, with the (GMT) date
+ * for t; no null terminator is written.  Dates after FORMAT_DATE_MAX are
+ * written as FORMAT_DATE_MAX, and years before 0 modulo 10000, so that
+ * years always take four digits.
+ */
+void format_date(char* text, time_t t, char separator);
+
+#endif
@@ -10,6 +10,7 @@ int gmem_unused = 0;
 
 long gmem_new = 0;
 long gmem_del = 0;
+long gmem_allocs = 0;
 
 static int gmem_inited = 0;
 
@@ -81,6 +82,7 @@ int gmem_new_called(const char* file,
 #endif
 
   gmem_new += total;
+  ++gmem_allocs;
   return total;
 }
 
@@ -127,6 +127,7 @@ void gmem_fini(void);
 
 extern long gmem_new;
 extern long gmem_del;
+extern long gmem_allocs;    /* times memory was allocated or reallocated */
 
 int gmem_new_called(const char* file,
                     int line,
@@ -0,0 +1,1035 @@
+#include <memory.h>
+#include "date.h"
+#include "cookie.h"
+#include "psl.h"
+#include "jar.h"
+
+#define JAR_COOKIES_INIT 16
+#define JAR_SLOTS_INIT   16
+
+/*
+ * How many matching cookies we can collect without allocating any memory.
+ */
+#define JAR_MATCH_FIXED  32
+
+/*
+ * FNV-1a, used on domains from their last character backwards.
+ */
+#define JAR_HASH_BASIS   2166136261U
+#define JAR_HASH_PRIME   16777619U
+#define JAR_HASH_STEP(hash, c) (((hash) ^ (unsigned char) (c)) * JAR_HASH_PRIME)
+
+#define JAR_LOWER(c)     ((c) >= 'A' && (c) <= 'Z' ? (c) - 'A' + 'a' : (c))
+#define JAR_IS_SPACE(c)  ((c) == ' ' || (c) == '\t')
+
+#define JAR_NAME(cookie)  ((cookie)->data)
+#define JAR_VALUE(cookie) ((cookie)->data + (cookie)->nlen)
+#define JAR_PATH(cookie)  ((cookie)->data + (cookie)->nlen + (cookie)->vlen)
+#define JAR_SIZE(cookie)  ((cookie)->nlen + (cookie)->vlen + (cookie)->plen)
+
+/*
+ * Prefixes that put restrictions on the cookies using them.
+ */
+#define JAR_PREFIX_SECURE "__secure-"
+#define JAR_PREFIX_HOST   "__host-"
+
+/*
+ * Return non-zero if a string is equal to a lowercase word, ignoring case.
+ */
+static int jar_same_word(const char* str, unsigned int len, const char* word)
+{
+    unsigned int j = 0;
+    for (j = 0; j < len; ++j) {
+        if (!word[j] || JAR_LOWER(str[j]) != word[j]) {
+            return 0;
+        }
+    }
+    return !word[j];
+}
+
+/*
+ * Return non-zero if a string starts with a lowercase word, ignoring case.
+ */
+static int jar_has_prefix(const char* str, unsigned int len, const char* word)
+{
+    unsigned int j = 0;
+    for (j = 0; word[j]; ++j) {
+        if (j >= len || JAR_LOWER(str[j]) != word[j]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static unsigned int jar_hash(const char* str, unsigned int len)
+{
+    unsigned int hash = JAR_HASH_BASIS;
+    while (len-- > 0) {
+        hash = JAR_HASH_STEP(hash, str[len]);
+    }
+    return hash;
+}
+
+/*
+ * Return the position of the first c in str, between pos and len; return
+ * len if there is none.
+ */
+static unsigned int jar_find(const char* str, unsigned int len, unsigned int pos, char c)
+{
+    while (pos < len && str[pos] != c) {
+        ++pos;
+    }
+    return pos;
+}
+
+static void jar_trim(const char* str, unsigned int* beg, unsigned int* end)
+{
+    while (*beg < *end && JAR_IS_SPACE(str[*beg])) {
+        ++*beg;
+    }
+    while (*end > *beg && JAR_IS_SPACE(str[*end - 1])) {
+        --*end;
+    }
+}
+
+/*
+ * Names and values cannot have control characters (other than tabs).
+ */
+static int jar_valid_chars(const char* str, unsigned int len)
+{
+    unsigned int j = 0;
+    for (j = 0; j < len; ++j) {
+        unsigned char c = (unsigned char) str[j];
+        if ((c < 0x20 && c != '\t') || c == 0x7f) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Get a Max-Age value: an optional minus sign followed by digits.
+ */
+static int jar_max_age(const char* str, unsigned int len, double* age)
+{
+    unsigned int j = 0;
+    int negative = 0;
+    double number = 0;
+
+    if (j < len && str[j] == '-') {
+        negative = 1;
+        ++j;
+    }
+    if (j >= len) {
+        return 0;
+    }
+    for (; j < len; ++j) {
+        if (str[j] < '0' || str[j] > '9') {
+            return 0;
+        }
+        number = 10 * number + str[j] - '0';
+    }
+    *age = negative ? -number : number;
+    return 1;
+}
+
+/*
+ * A host is an IPv4 address if it only has digits and dots.
+ */
+static int jar_is_ipv4(const char* host, unsigned int len)
+{
+    unsigned int j = 0;
+    for (j = 0; j < len; ++j) {
+        if ((host[j] < '0' || host[j] > '9') && host[j] != '.') {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Domain matching, as in RFC 6265, section 5.1.3: the host is the domain,
+ * or it is a name (not an IP address) that ends in a dot and the domain.
+ */
+static int jar_domain_match(const JarRequest* req, const char* domain, unsigned int dlen)
+{
+    if (req->hlen == dlen) {
+        return memcmp(req->host, domain, dlen) == 0;
+    }
+    return !req->is_ip && req->hlen > dlen &&
+           req->host[req->hlen - dlen - 1] == '.' &&
+           memcmp(req->host + req->hlen - dlen, domain, dlen) == 0;
+}
+
+/*
+ * Return non-zero if a name is a domain, or a subdomain of it.
+ */
+static int jar_is_subdomain(const char* name, unsigned int nlen,
+                            const char* domain, unsigned int dlen)
+{
+    if (nlen == dlen) {
+        return memcmp(name, domain, dlen) == 0;
+    }
+    return nlen > dlen && name[nlen - dlen - 1] == '.' &&
+           memcmp(name + nlen - dlen, domain, dlen) == 0;
+}
+
+/*
+ * Path matching, as in RFC 6265, section 5.1.4: the cookie path is the
+ * request path, or a prefix of it ending at a '/'.
+ */
+static int jar_path_prefix(const char* path, unsigned int plen,
+                           const char* req_path, unsigned int req_plen)
+{
+    if (plen > req_plen || memcmp(path, req_path, plen) != 0) {
+        return 0;
+    }
+    return plen == req_plen || path[plen - 1] == '/' || req_path[plen] == '/';
+}
+
+static int jar_path_match(const JarCookie* cookie, const JarRequest* req)
+{
+    return jar_path_prefix(JAR_PATH(cookie), cookie->plen, req->path, req->plen);
+}
+
+/*
+ * The default path for a cookie: the request path up to, but not
+ * including, its last '/'; or just "/" if there is no such path.
+ */
+static void jar_default_path(const JarRequest* req, const char** path, unsigned int* plen)
+{
+    unsigned int last = 0;
+    unsigned int j = 0;
+
+    if (req->plen > 0 && req->path[0] == '/') {
+        for (j = 1; j < req->plen; ++j) {
+            if (req->path[j] == '/') {
+                last = j;
+            }
+        }
+    }
+    *path = last ? req->path : "/";
+    *plen = last ? last : 1;
+}
+
+static int jar_same_site_allowed(const JarCookie* cookie, int site)
+{
+    switch (site) {
+    case JAR_SITE_NAVIGATION:
+        return cookie->same_site != JAR_SAME_SITE_STRICT;
+    case JAR_SITE_CROSS:
+        return cookie->same_site != JAR_SAME_SITE_STRICT &&
+               cookie->same_site != JAR_SAME_SITE_LAX;
+    default:
+        return 1;
+    }
+}
+
+static int jar_find_domain(const Jar* jar, const char* name, unsigned int len, unsigned int hash)
+{
+    unsigned int slot = 0;
+
+    if (!jar->slots) {
+        return -1;
+    }
+    for (slot = hash & jar->mask; jar->slots[slot] >= 0; slot = (slot + 1) & jar->mask) {
+        const JarDomain* domain = &jar->domains[jar->slots[slot]];
+        if (domain->hash == hash && domain->len == len &&
+            memcmp(domain->name, name, len) == 0) {
+            return jar->slots[slot];
+        }
+    }
+    return -1;
+}
+
+static void jar_rehash(Jar* jar, unsigned int nslots)
+{
+    unsigned int j = 0;
+
+    if (jar->slots) {
+        GMEM_DEL(jar->slots, int, jar->mask + 1);
+    }
+    GMEM_NEW(jar->slots, int, nslots);
+    jar->mask = nslots - 1;
+    for (j = 0; j < nslots; ++j) {
+        jar->slots[j] = -1;
+    }
+    for (j = 0; j < jar->dcount; ++j) {
+        unsigned int slot = jar->domains[j].hash & jar->mask;
+        while (jar->slots[slot] >= 0) {
+            slot = (slot + 1) & jar->mask;
+        }
+        jar->slots[slot] = (int) j;
+    }
+}
+
+/*
+ * Return the position of a domain, adding it if it is not there yet.
+ * Domains are never removed (other than when clearing the jar): a domain
+ * that had cookies will probably get them again.
+ */
+static int jar_add_domain(Jar* jar, const char* name, unsigned int len, unsigned int hash)
+{
+    JarDomain* domain = 0;
+    int pos = jar_find_domain(jar, name, len, hash);
+
+    if (pos >= 0) {
+        return pos;
+    }
+
+    if (jar->dcount >= jar->dsize) {
+        unsigned int size = jar->dsize ? jar->dsize * 2 : JAR_SLOTS_INIT / 2;
+        if (!jar->domains) {
+            GMEM_NEW(jar->domains, JarDomain, size);
+        } else {
+            GMEM_REALLOC(jar->domains, JarDomain, jar->dsize, size);
+        }
+        jar->dsize = size;
+    }
+
+    pos = (int) jar->dcount++;
+    domain = &jar->domains[pos];
+    GMEM_NEW(domain->name, char, len);
+    memcpy(domain->name, name, len);
+    domain->len = len;
+    domain->hash = hash;
+    domain->first = -1;
+
+    /* keep the hash table at most half full */
+    if (2 * jar->dcount > jar->mask + 1) {
+        jar_rehash(jar, jar->slots ? 2 * (jar->mask + 1) : JAR_SLOTS_INIT);
+    } else {
+        unsigned int slot = hash & jar->mask;
+        while (jar->slots[slot] >= 0) {
+            slot = (slot + 1) & jar->mask;
+        }
+        jar->slots[slot] = pos;
+    }
+    return pos;
+}
+
+static void jar_heap_up(JarExpiry* heap, unsigned int pos)
+{
+    JarExpiry entry = heap[pos];
+    while (pos > 0) {
+        unsigned int parent = (pos - 1) / 2;
+        if (heap[parent].expires <= entry.expires) {
+            break;
+        }
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = entry;
+}
+
+static void jar_heap_down(JarExpiry* heap, unsigned int count, unsigned int pos)
+{
+    JarExpiry entry = heap[pos];
+    while (1) {
+        unsigned int child = 2 * pos + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && heap[child + 1].expires < heap[child].expires) {
+            ++child;
+        }
+        if (entry.expires <= heap[child].expires) {
+            break;
+        }
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = entry;
+}
+
+/*
+ * Drop all stale entries from the heap, and build it again.
+ */
+static void jar_heap_rebuild(Jar* jar)
+{
+    unsigned int count = 0;
+    unsigned int j = 0;
+
+    for (j = 0; j < jar->hcount; ++j) {
+        const JarExpiry* entry = &jar->heap[j];
+        if (jar->cookies[entry->cookie].serial == entry->serial) {
+            jar->heap[count++] = *entry;
+        }
+    }
+    jar->hcount = count;
+    for (j = count / 2; j-- > 0; ) {
+        jar_heap_down(jar->heap, count, j);
+    }
+}
+
+static void jar_heap_push(Jar* jar, int pos)
+{
+    const JarCookie* cookie = &jar->cookies[pos];
+    JarExpiry* entry = 0;
+
+    /* replaced cookies leave stale entries behind; when they are at least
+     * half of a full heap, drop them instead of growing it */
+    if (jar->hcount >= jar->hsize && jar->persistent <= jar->hsize / 2) {
+        jar_heap_rebuild(jar);
+    }
+    if (jar->hcount >= jar->hsize) {
+        if (!jar->heap) {
+            GMEM_NEW(jar->heap, JarExpiry, JAR_COOKIES_INIT);
+            jar->hsize = JAR_COOKIES_INIT;
+        } else {
+            GMEM_REALLOC(jar->heap, JarExpiry, jar->hsize, jar->hsize * 2);
+            jar->hsize *= 2;
+        }
+    }
+
+    entry = &jar->heap[jar->hcount];
+    entry->expires = cookie->expires;
+    entry->cookie = pos;
+    entry->serial = cookie->serial;
+    jar_heap_up(jar->heap, jar->hcount++);
+}
+
+/*
+ * Get a free cookie record, growing the array if needed.
+ */
+static int jar_new_cookie(Jar* jar)
+{
+    int pos = 0;
+
+    if (jar->free < 0) {
+        unsigned int size = jar->csize ? jar->csize * 2 : JAR_COOKIES_INIT;
+        unsigned int j = 0;
+        if (!jar->cookies) {
+            GMEM_NEW(jar->cookies, JarCookie, size);
+        } else {
+            GMEM_REALLOC(jar->cookies, JarCookie, jar->csize, size);
+        }
+        for (j = jar->csize; j < size; ++j) {
+            memset(&jar->cookies[j], 0, sizeof(JarCookie));
+            jar->cookies[j].next = j + 1 < size ? (int) j + 1 : -1;
+        }
+        jar->free = (int) jar->csize;
+        jar->csize = size;
+    }
+
+    pos = jar->free;
+    jar->free = jar->cookies[pos].next;
+    return pos;
+}
+
+/*
+ * The hash of a cookie name and its site: the domain label just below the
+ * public suffix, with everything after it ("example.co.uk" for both
+ * "www.example.co.uk" and "example.co.uk").  A domain and its subdomains
+ * share the same site, unless the domain is itself a public suffix or an
+ * IP address, in which case its site is the whole domain.
+ */
+static unsigned int jar_site_hash(const char* name, unsigned int nlen,
+                                  const char* domain, unsigned int dlen, int is_ip)
+{
+    unsigned int hash = JAR_HASH_BASIS;
+    unsigned int j = 0;
+    int suffix = is_ip ? 0 : psl_suffix(domain, dlen);
+
+    if (suffix > 0) {
+        j = (unsigned int) suffix - 1;
+        while (j > 0 && domain[j - 1] != '.') {
+            --j;
+        }
+    }
+    for (; j < dlen; ++j) {
+        hash = JAR_HASH_STEP(hash, domain[j]);
+    }
+    hash = JAR_HASH_STEP(hash, '\0');
+    for (j = 0; j < nlen; ++j) {
+        hash = JAR_HASH_STEP(hash, name[j]);
+    }
+    return hash;
+}
+
+static void jar_secure_link(Jar* jar, int pos)
+{
+    JarCookie* cookie = &jar->cookies[pos];
+    int* slot = &jar->secure_slots[cookie->shash & jar->secure_mask];
+
+    cookie->sprev = -1;
+    cookie->snext = *slot;
+    if (*slot >= 0) {
+        jar->cookies[*slot].sprev = pos;
+    }
+    *slot = pos;
+}
+
+static void jar_secure_unlink(Jar* jar, int pos)
+{
+    JarCookie* cookie = &jar->cookies[pos];
+
+    if (cookie->sprev >= 0) {
+        jar->cookies[cookie->sprev].snext = cookie->snext;
+    } else {
+        jar->secure_slots[cookie->shash & jar->secure_mask] = cookie->snext;
+    }
+    if (cookie->snext >= 0) {
+        jar->cookies[cookie->snext].sprev = cookie->sprev;
+    }
+    --jar->secure;
+}
+
+/*
+ * Add a Secure cookie to the index, growing the hash table so that it has
+ * at least as many slots as Secure cookies.
+ */
+static void jar_secure_add(Jar* jar, int pos)
+{
+    unsigned int j = 0;
+
+    ++jar->secure;
+    if (jar->secure_slots && jar->secure <= jar->secure_mask + 1) {
+        jar_secure_link(jar, pos);
+        return;
+    }
+
+    if (jar->secure_slots) {
+        GMEM_DEL(jar->secure_slots, int, jar->secure_mask + 1);
+        jar->secure_mask = 2 * (jar->secure_mask + 1) - 1;
+    } else {
+        jar->secure_mask = JAR_SLOTS_INIT - 1;
+    }
+    GMEM_NEW(jar->secure_slots, int, jar->secure_mask + 1);
+    for (j = 0; j <= jar->secure_mask; ++j) {
+        jar->secure_slots[j] = -1;
+    }
+    for (j = 0; j < jar->csize; ++j) {
+        const JarCookie* cookie = &jar->cookies[j];
+        if (cookie->data && (cookie->flags & JAR_SECURE) && (int) j != pos) {
+            jar_secure_link(jar, (int) j);
+        }
+    }
+    jar_secure_link(jar, pos);
+}
+
+/*
+ * Return non-zero if a cookie that is not Secure, set by a request that is
+ * not secure either, would shadow a Secure cookie in the jar, which the
+ * successor draft of RFC 6265 forbids: a Secure cookie with the same name,
+ * a domain that is the new one, a parent or a subdomain of it, and a path
+ * that the new path matches.  The domain and its parents are looked up as
+ * in jar_header; its subdomains are found through the index of Secure
+ * cookies, so they must be in the same site (shash is the site hash for
+ * the new cookie).
+ */
+static int jar_shadows_secure(const Jar* jar, const char* name, unsigned int nlen,
+                              const char* domain, unsigned int dlen,
+                              const char* path, unsigned int plen, unsigned int shash)
+{
+    unsigned int hash = JAR_HASH_BASIS;
+    unsigned int j = dlen;
+    int cpos = 0;
+
+    if (!jar->secure) {
+        return 0;
+    }
+
+    while (j-- > 0) {
+        int dpos = 0;
+
+        hash = JAR_HASH_STEP(hash, domain[j]);
+        if (j > 0 && domain[j - 1] != '.') {
+            continue;
+        }
+        dpos = jar_find_domain(jar, domain + j, dlen - j, hash);
+        if (dpos < 0) {
+            continue;
+        }
+        for (cpos = jar->domains[dpos].first; cpos >= 0; cpos = jar->cookies[cpos].next) {
+            const JarCookie* cookie = &jar->cookies[cpos];
+            if ((cookie->flags & JAR_SECURE) && cookie->nlen == nlen &&
+                memcmp(JAR_NAME(cookie), name, nlen) == 0 &&
+                jar_path_prefix(JAR_PATH(cookie), cookie->plen, path, plen)) {
+                return 1;
+            }
+        }
+    }
+
+    for (cpos = jar->secure_slots[shash & jar->secure_mask]; cpos >= 0;
+         cpos = jar->cookies[cpos].snext) {
+        const JarCookie* cookie = &jar->cookies[cpos];
+        const JarDomain* other = &jar->domains[cookie->domain];
+        if (cookie->shash == shash && cookie->nlen == nlen && other->len > dlen &&
+            memcmp(JAR_NAME(cookie), name, nlen) == 0 &&
+            jar_is_subdomain(other->name, other->len, domain, dlen) &&
+            jar_path_prefix(JAR_PATH(cookie), cookie->plen, path, plen)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void jar_remove(Jar* jar, int pos)
+{
+    JarCookie* cookie = &jar->cookies[pos];
+
+    if (cookie->prev >= 0) {
+        jar->cookies[cookie->prev].next = cookie->next;
+    } else {
+        jar->domains[cookie->domain].first = cookie->next;
+    }
+    if (cookie->next >= 0) {
+        jar->cookies[cookie->next].prev = cookie->prev;
+    }
+    if (cookie->flags & JAR_PERSISTENT) {
+        --jar->persistent;
+    }
+    if (cookie->flags & JAR_SECURE) {
+        jar_secure_unlink(jar, pos);
+    }
+
+    GMEM_DEL(cookie->data, char, JAR_SIZE(cookie));
+    cookie->flags = 0;
+    ++cookie->serial;
+    cookie->next = jar->free;
+    jar->free = pos;
+    --jar->count;
+}
+
+void jar_init(Jar* jar)
+{
+    memset(jar, 0, sizeof(Jar));
+    jar->free = -1;
+}
+
+void jar_fini(Jar* jar)
+{
+    unsigned int j = 0;
+
+    for (j = 0; j < jar->csize; ++j) {
+        JarCookie* cookie = &jar->cookies[j];
+        if (cookie->data) {
+            GMEM_DEL(cookie->data, char, JAR_SIZE(cookie));
+        }
+    }
+    for (j = 0; j < jar->dcount; ++j) {
+        GMEM_DEL(jar->domains[j].name, char, jar->domains[j].len);
+    }
+    if (jar->cookies) {
+        GMEM_DEL(jar->cookies, JarCookie, jar->csize);
+    }
+    if (jar->domains) {
+        GMEM_DEL(jar->domains, JarDomain, jar->dsize);
+    }
+    if (jar->slots) {
+        GMEM_DEL(jar->slots, int, jar->mask + 1);
+    }
+    if (jar->heap) {
+        GMEM_DEL(jar->heap, JarExpiry, jar->hsize);
+    }
+    if (jar->secure_slots) {
+        GMEM_DEL(jar->secure_slots, int, jar->secure_mask + 1);
+    }
+    jar_init(jar);
+}
+
+void jar_clear(Jar* jar)
+{
+    jar_fini(jar);
+}
+
+int jar_parse_url(const char* url, unsigned int len, JarRequest* req)
+{
+    unsigned int j = 0;
+    unsigned int start = 0;
+    unsigned int end = 0;
+    unsigned int hend = 0;
+
+    /* the scheme, followed by "://" */
+    for (j = 0; j < len && url[j] != ':'; ++j) {
+        char c = JAR_LOWER(url[j]);
+        if ((c < 'a' || c > 'z') && (c < '0' || c > '9') &&
+            c != '+' && c != '-' && c != '.') {
+            return 0;
+        }
+    }
+    if (j == 0 || j + 3 > len || url[j + 1] != '/' || url[j + 2] != '/') {
+        return 0;
+    }
+    req->secure = jar_same_word(url, j, "https") || jar_same_word(url, j, "wss");
+
+    /* the authority, skipping any user info */
+    start = j + 3;
+    for (end = start; end < len && url[end] != '/' && url[end] != '?' && url[end] != '#'; ++end) {
+        if (url[end] == '@') {
+            start = end + 1;
+        }
+    }
+
+    /* the host, without the port; IPv6 addresses keep their brackets */
+    if (start < end && url[start] == '[') {
+        hend = jar_find(url, end, start, ']');
+        if (hend >= end) {
+            return 0;
+        }
+        ++hend;
+        req->is_ip = 1;
+    } else {
+        hend = jar_find(url, end, start, ':');
+        req->is_ip = jar_is_ipv4(url + start, hend - start);
+    }
+    if (hend == start || hend - start > JAR_HOST_MAX) {
+        return 0;
+    }
+    req->hlen = hend - start;
+    for (j = 0; j < req->hlen; ++j) {
+        char c = url[start + j];
+        if ((unsigned char) c <= ' ' || c == 0x7f) {
+            return 0;
+        }
+        req->host[j] = JAR_LOWER(c);
+    }
+    req->host[req->hlen] = '\0';
+
+    /* the path, without the query or fragment */
+    if (end < len && url[end] == '/') {
+        j = end;
+        while (j < len && url[j] != '?' && url[j] != '#') {
+            ++j;
+        }
+        req->path = url + end;
+        req->plen = j - end;
+    } else {
+        req->path = "/";
+        req->plen = 1;
+    }
+    return 1;
+}
+
+int jar_store(Jar* jar, const JarRequest* req,
+              const char* header, unsigned int len, double now)
+{
+    char domain[JAR_HOST_MAX + 1];
+    const char* dstr = 0;
+    unsigned int dlen = 0;
+    const char* pstr = 0;
+    unsigned int plen = 0;
+    unsigned int nbeg = 0, nend = 0, vbeg = 0, vend = 0;
+    unsigned int pos = 0, end = 0, eq = 0, j = 0;
+    unsigned int flags = 0;
+    int same_site = JAR_SAME_SITE_UNSET;
+    int has_max_age = 0, has_expires = 0;
+    double max_age = 0, expires = 0;
+    unsigned int hash = 0;
+    unsigned int shash = 0;
+    int dpos = 0, cpos = -1;
+    JarCookie* cookie = 0;
+
+    jar_purge(jar, now);
+
+    /* the name=value pair, up to the first ';'; it must have a '=' */
+    end = jar_find(header, len, 0, ';');
+    eq = jar_find(header, end, 0, '=');
+    if (eq >= end) {
+        return 0;
+    }
+    nbeg = 0;
+    nend = eq;
+    jar_trim(header, &nbeg, &nend);
+    vbeg = eq + 1;
+    vend = end;
+    jar_trim(header, &vbeg, &vend);
+    if (nbeg == nend || (nend - nbeg) + (vend - vbeg) > JAR_PAIR_MAX ||
+        !jar_valid_chars(header + nbeg, nend - nbeg) ||
+        !jar_valid_chars(header + vbeg, vend - vbeg)) {
+        return 0;
+    }
+
+    /* the attributes; when one is repeated, the last one wins */
+    for (pos = end; pos < len; pos = end) {
+        unsigned int abeg = pos + 1, aend = 0, xbeg = 0, xend = 0;
+        const char* xstr = 0;
+        unsigned int xlen = 0;
+
+        end = jar_find(header, len, abeg, ';');
+        eq = jar_find(header, end, abeg, '=');
+        aend = eq;
+        jar_trim(header, &abeg, &aend);
+        xbeg = eq < end ? eq + 1 : end;
+        xend = end;
+        jar_trim(header, &xbeg, &xend);
+        xstr = header + xbeg;
+        xlen = xend - xbeg;
+
+        if        (jar_same_word(header + abeg, aend - abeg, "secure")) {
+            flags |= JAR_SECURE;
+        } else if (jar_same_word(header + abeg, aend - abeg, "httponly")) {
+            flags |= JAR_HTTP_ONLY;
+        } else if (jar_same_word(header + abeg, aend - abeg, "expires")) {
+            if (date_parse_http(xstr, xlen, &expires)) {
+                has_expires = 1;
+            }
+        } else if (jar_same_word(header + abeg, aend - abeg, "max-age")) {
+            if (jar_max_age(xstr, xlen, &max_age)) {
+                has_max_age = 1;
+            }
+        } else if (jar_same_word(header + abeg, aend - abeg, "domain")) {
+            /* an empty domain is ignored; a leading dot is dropped */
+            if (xlen > 0 && xstr[0] == '.') {
+                ++xstr;
+                --xlen;
+            }
+            if (xlen > 0) {
+                dstr = xstr;
+                dlen = xlen;
+            }
+        } else if (jar_same_word(header + abeg, aend - abeg, "path")) {
+            /* a path that does not start with '/' means the default one */
+            pstr = xlen > 0 && xstr[0] == '/' ? xstr : 0;
+            plen = xlen;
+        } else if (jar_same_word(header + abeg, aend - abeg, "samesite")) {
+            if (jar_same_word(xstr, xlen, "strict")) {
+                same_site = JAR_SAME_SITE_STRICT;
+            } else if (jar_same_word(xstr, xlen, "lax")) {
+                same_site = JAR_SAME_SITE_LAX;
+            } else if (jar_same_word(xstr, xlen, "none")) {
+                same_site = JAR_SAME_SITE_NONE;
+            } else {
+                same_site = JAR_SAME_SITE_UNSET;
+            }
+        }
+    }
+
+    /* Secure cookies can only come from secure requests */
+    if ((flags & JAR_SECURE) && !req->secure) {
+        return 0;
+    }
+
+    /* the domain must include the host, and not be a public suffix */
+    if (dstr) {
+        int suffix = 0;
+        if (dlen > JAR_HOST_MAX) {
+            return 0;
+        }
+        for (j = 0; j < dlen; ++j) {
+            domain[j] = JAR_LOWER(dstr[j]);
+        }
+        dstr = domain;
+        suffix = psl_suffix(dstr, dlen);
+        if (suffix < 0 || !jar_domain_match(req, dstr, dlen)) {
+            return 0;
+        }
+        if (suffix == 0) {
+            /* only allowed as the host itself, and then it is host-only */
+            if (dlen != req->hlen) {
+                return 0;
+            }
+            dstr = 0;
+        }
+    }
+    if (!dstr) {
+        flags |= JAR_HOST_ONLY;
+        dstr = req->host;
+        dlen = req->hlen;
+    }
+
+    if (!pstr) {
+        jar_default_path(req, &pstr, &plen);
+    }
+
+    /* cookie prefixes */
+    if (jar_has_prefix(header + nbeg, nend - nbeg, JAR_PREFIX_SECURE) &&
+        !(flags & JAR_SECURE)) {
+        return 0;
+    }
+    if (jar_has_prefix(header + nbeg, nend - nbeg, JAR_PREFIX_HOST) &&
+        (!(flags & JAR_SECURE) || !(flags & JAR_HOST_ONLY) || plen != 1 || pstr[0] != '/')) {
+        return 0;
+    }
+
+    /* plain HTTP cannot set a cookie that would shadow a Secure one */
+    shash = jar_site_hash(header + nbeg, nend - nbeg, dstr, dlen, req->is_ip);
+    if (!req->secure &&
+        jar_shadows_secure(jar, header + nbeg, nend - nbeg, dstr, dlen, pstr, plen, shash)) {
+        return 0;
+    }
+
+    /* Max-Age wins over Expires */
+    if (has_max_age) {
+        expires = max_age > 0 ? now + max_age : now;
+    }
+    if (has_max_age || has_expires) {
+        flags |= JAR_PERSISTENT;
+    }
+
+    /* look for a cookie this one replaces: same name, domain and path */
+    hash = jar_hash(dstr, dlen);
+    dpos = jar_find_domain(jar, dstr, dlen, hash);
+    if (dpos >= 0) {
+        for (cpos = jar->domains[dpos].first; cpos >= 0; cpos = jar->cookies[cpos].next) {
+            cookie = &jar->cookies[cpos];
+            if (cookie->nlen == nend - nbeg && cookie->plen == plen &&
+                memcmp(JAR_NAME(cookie), header + nbeg, cookie->nlen) == 0 &&
+                memcmp(JAR_PATH(cookie), pstr, plen) == 0) {
+                break;
+            }
+        }
+    }
+
+    /* an expired cookie just removes the one it replaces */
+    if ((flags & JAR_PERSISTENT) && expires <= now) {
+        if (cpos >= 0) {
+            jar_remove(jar, cpos);
+        }
+        return 0;
+    }
+
+    if (cpos >= 0) {
+        /* replace it, keeping its creation order */
+        cookie = &jar->cookies[cpos];
+        if (cookie->flags & JAR_PERSISTENT) {
+            --jar->persistent;
+        }
+        if (cookie->flags & JAR_SECURE) {
+            jar_secure_unlink(jar, cpos);
+        }
+        GMEM_DEL(cookie->data, char, JAR_SIZE(cookie));
+        ++cookie->serial;
+    } else {
+        dpos = jar_add_domain(jar, dstr, dlen, hash);
+        cpos = jar_new_cookie(jar);
+        cookie = &jar->cookies[cpos];
+        cookie->domain = dpos;
+        cookie->prev = -1;
+        cookie->next = jar->domains[dpos].first;
+        if (cookie->next >= 0) {
+            jar->cookies[cookie->next].prev = cpos;
+        }
+        jar->domains[dpos].first = cpos;
+        cookie->created = jar->sequence++;
+        ++jar->count;
+    }
+
+    cookie->nlen = nend - nbeg;
+    cookie->vlen = vend - vbeg;
+    cookie->plen = plen;
+    GMEM_NEW(cookie->data, char, JAR_SIZE(cookie));
+    memcpy(JAR_NAME(cookie), header + nbeg, cookie->nlen);
+    memcpy(JAR_VALUE(cookie), header + vbeg, cookie->vlen);
+    memcpy(JAR_PATH(cookie), pstr, cookie->plen);
+    cookie->flags = flags;
+    cookie->same_site = same_site;
+    cookie->expires = expires;
+    cookie->shash = shash;
+
+    if (flags & JAR_SECURE) {
+        jar_secure_add(jar, cpos);
+    }
+    if (flags & JAR_PERSISTENT) {
+        ++jar->persistent;
+        jar_heap_push(jar, cpos);
+    }
+    return 1;
+}
+
+/*
+ * Longer paths first; for the same path length, older cookies first.
+ */
+static int jar_compare(const void* a, const void* b)
+{
+    const JarCookie* ca = *(const JarCookie* const*) a;
+    const JarCookie* cb = *(const JarCookie* const*) b;
+
+    if (ca->plen != cb->plen) {
+        return ca->plen > cb->plen ? -1 : 1;
+    }
+    if (ca->created != cb->created) {
+        return ca->created < cb->created ? -1 : 1;
+    }
+    return 0;
+}
+
+Buffer* jar_header(Jar* jar, const JarRequest* req, int site,
+                   double now, Buffer* header)
+{
+    JarCookie* fixed[JAR_MATCH_FIXED];
+    JarCookie** matches = fixed;
+    unsigned int size = JAR_MATCH_FIXED;
+    unsigned int count = 0;
+    unsigned int hash = JAR_HASH_BASIS;
+    unsigned int j = req->hlen;
+    int suffix = 0;
+
+    jar_purge(jar, now);
+    if (!jar->count) {
+        return header;
+    }
+
+    /* look up the host and its parent domains, from the shortest one;
+     * public suffixes cannot have cookies (other than host-only ones),
+     * and an IP address has no parent domains */
+    suffix = req->is_ip ? (int) req->hlen : psl_suffix(req->host, req->hlen);
+    while (j-- > 0) {
+        int dpos = 0;
+        int cpos = 0;
+
+        hash = JAR_HASH_STEP(hash, req->host[j]);
+        if (j > 0 && ((int) j >= suffix || req->host[j - 1] != '.')) {
+            continue;
+        }
+        dpos = jar_find_domain(jar, req->host + j, req->hlen - j, hash);
+        if (dpos < 0) {
+            continue;
+        }
+
+        for (cpos = jar->domains[dpos].first; cpos >= 0; cpos = jar->cookies[cpos].next) {
+            JarCookie* cookie = &jar->cookies[cpos];
+            if (((cookie->flags & JAR_HOST_ONLY) && j > 0) ||
+                ((cookie->flags & JAR_SECURE) && !req->secure) ||
+                !jar_same_site_allowed(cookie, site) ||
+                !jar_path_match(cookie, req)) {
+                continue;
+            }
+            if (count >= size) {
+                if (matches == fixed) {
+                    GMEM_NEW(matches, JarCookie*, size * 2);
+                    memcpy(matches, fixed, sizeof(fixed));
+                } else {
+                    GMEM_REALLOC(matches, JarCookie*, size, size * 2);
+                }
+                size *= 2;
+            }
+            matches[count++] = cookie;
+        }
+    }
+
+    if (count > 1) {
+        qsort(matches, count, sizeof(JarCookie*), jar_compare);
+    }
+    for (j = 0; j < count; ++j) {
+        const JarCookie* cookie = matches[j];
+        cookie_put_string(header, JAR_NAME(cookie), cookie->nlen,
+                          JAR_VALUE(cookie), cookie->vlen, 0, 0);
+    }
+
+    if (matches != fixed) {
+        GMEM_DEL(matches, JarCookie*, size);
+    }
+    return header;
+}
+
+unsigned int jar_purge(Jar* jar, double now)
+{
+    unsigned int removed = 0;
+
+    while (jar->hcount > 0 && jar->heap[0].expires <= now) {
+        JarExpiry top = jar->heap[0];
+        jar->heap[0] = jar->heap[--jar->hcount];
+        if (jar->hcount > 0) {
+            jar_heap_down(jar->heap, jar->hcount, 0);
+        }
+        if (jar->cookies[top.cookie].serial != top.serial) {
+            /* stale entry */
+            continue;
+        }
+        jar_remove(jar, top.cookie);
+        ++removed;
+    }
+    return removed;
+}
@@ -0,0 +1,175 @@
+#ifndef JAR_H_
+#define JAR_H_
+
+/*
+ * A cookie jar for HTTP clients, following the storage model in RFC 6265
+ * (plus the Secure, prefix and SameSite rules from its successor draft):
+ * cookies are stored from the Set-Cookie headers in responses, and the
+ * Cookie header for each request is built from them.
+ *
+ * Cookies are kept in one array of records, and indexed by their domain:
+ * a hash table maps each domain to a list of its cookies.  To find the
+ * cookies for a host we look up the host and each of its parent domains
+ * ("www.example.com", "example.com", "com"); the hash of a domain is
+ * computed from its last character backwards, so the hashes for all those
+ * suffixes come out of a single pass over the host.  Public suffixes
+ * (see psl.h) are never looked up, since they cannot have cookies.
+ *
+ * Secure cookies are also indexed by their name and site (the domain just
+ * below its public suffix), so that a cookie coming over plain HTTP can be
+ * checked against the Secure cookies it might shadow without looking at
+ * the whole jar.
+ *
+ * Persistent cookies are also kept in a heap ordered by expiration date.
+ * Expired cookies are evicted lazily, whenever the jar is used, by popping
+ * the heap while its top has expired, so eviction costs O(expired) and
+ * live cookies are never looked at.
+ */
+
+#include "buffer.h"
+
+/*
+ * Longest host / domain we will handle.
+ */
+#define JAR_HOST_MAX 255
+
+/*
+ * Longest name plus value we will store.
+ */
+#define JAR_PAIR_MAX 4096
+
+/*
+ * Flags for a cookie.
+ */
+#define JAR_SECURE     0x01
+#define JAR_HTTP_ONLY  0x02
+#define JAR_HOST_ONLY  0x04
+#define JAR_PERSISTENT 0x08
+
+/*
+ * Values for the SameSite attribute of a cookie; a cookie without it is
+ * sent as if it was "None".
+ */
+#define JAR_SAME_SITE_UNSET  0
+#define JAR_SAME_SITE_NONE   1
+#define JAR_SAME_SITE_LAX    2
+#define JAR_SAME_SITE_STRICT 3
+
+/*
+ * Where a request comes from, which decides which SameSite cookies are
+ * sent with it: all of them for a same-site request, all but the Strict
+ * ones for a cross-site top-level navigation, and only the ones without
+ * restrictions for any other cross-site request.
+ */
+#define JAR_SITE_SAME       0
+#define JAR_SITE_NAVIGATION 1
+#define JAR_SITE_CROSS      2
+
+/*
+ * The parts of a request URL we care about.  The host is lowercased into
+ * our own array; the path points into the URL.
+ */
+typedef struct JarRequest {
+    char host[JAR_HOST_MAX + 1];
+    unsigned int hlen;
+    int is_ip;
+    int secure;
+    const char* path;
+    unsigned int plen;
+} JarRequest;
+
+/*
+ * A stored cookie.  Its name, value and path are kept together in data,
+ * one after the other.  A free record is linked to the next free one.
+ */
+typedef struct JarCookie {
+    char* data;
+    unsigned int nlen;
+    unsigned int vlen;
+    unsigned int plen;
+    unsigned int flags;
+    int same_site;
+    int domain;             /* position of its domain */
+    int prev;               /* previous cookie for the same domain */
+    int next;               /* next cookie for the same domain, or next free */
+    unsigned int serial;    /* changes every time the record is reused */
+    double expires;         /* only for persistent cookies */
+    unsigned long created;  /* creation order, kept when a cookie is replaced */
+    unsigned int shash;     /* hash of its name and site, if it is Secure */
+    int sprev;              /* previous Secure cookie in the same slot */
+    int snext;              /* next Secure cookie in the same slot */
+} JarCookie;
+
+typedef struct JarDomain {
+    char* name;
+    unsigned int len;
+    unsigned int hash;
+    int first;              /* first cookie for this domain */
+} JarDomain;
+
+/*
+ * An entry in the expiration heap; it is stale, and just skipped, when its
+ * serial does not match the one in the cookie record.
+ */
+typedef struct JarExpiry {
+    double expires;
+    int cookie;
+    unsigned int serial;
+} JarExpiry;
+
+typedef struct Jar {
+    JarCookie* cookies;
+    unsigned int csize;
+    unsigned int count;     /* live cookies */
+    int free;               /* first free cookie record */
+    JarDomain* domains;
+    unsigned int dcount;
+    unsigned int dsize;
+    int* slots;             /* hash table with the position of each domain */
+    unsigned int mask;      /* number of slots - 1 */
+    JarExpiry* heap;
+    unsigned int hcount;
+    unsigned int hsize;
+    unsigned int persistent; /* live persistent cookies */
+    int* secure_slots;      /* hash table with the first Secure cookie by name and site */
+    unsigned int secure_mask; /* number of secure slots - 1 */
+    unsigned int secure;    /* live Secure cookies */
+    unsigned long sequence; /* for the creation order of cookies */
+} Jar;
+
+void jar_init(Jar* jar);
+void jar_fini(Jar* jar);
+
+/*
+ * Remove all cookies from the jar.
+ */
+void jar_clear(Jar* jar);
+
+/*
+ * Get the scheme, host and path of a URL, as needed to store and send
+ * cookies.  Return zero if the URL has no scheme or no valid host.
+ */
+int jar_parse_url(const char* url, unsigned int len, JarRequest* req);
+
+/*
+ * Store the cookie in a Set-Cookie header, received in a response to the
+ * given request.  Return non-zero if the cookie was stored, zero if it was
+ * ignored (or if it was expired, in which case it removes any cookie it
+ * would have replaced).
+ */
+int jar_store(Jar* jar, const JarRequest* req,
+              const char* header, unsigned int len, double now);
+
+/*
+ * Append to a buffer the pairs to be sent in the Cookie header for the
+ * given request, with longer paths first, as in RFC 6265.
+ */
+Buffer* jar_header(Jar* jar, const JarRequest* req, int site,
+                   double now, Buffer* header);
+
+/*
+ * Remove all cookies that expired by now; return how many were removed.
+ */
+unsigned int jar_purge(Jar* jar, double now);
+
+#endif
@@ -6,10 +6,33 @@ use warnings;
 use XSLoader;
 use parent 'Exporter';
 
-our $VERSION = '0.000021';
+our $VERSION = '0.000022';
 XSLoader::load( 'HTTP::XSCookies', $VERSION );
 
-our @EXPORT_OK = qw[bake_cookie crush_cookie];
+our @EXPORT_OK = qw[
+    bake_cookie
+    bake_cookies
+    crush_cookie
+    crush_cookies
+    crush_cookie_lazy
+    crush_cookie_get
+    crush_cookie_pick
+    crush_set_cookie
+    bake_signed_cookie
+    verify_signed_cookie
+    bake_sealed_cookie
+    open_sealed_cookie
+    unpack_cookie_value
+    decompress_cookie_value
+    parse_http_date
+    public_suffix
+    uri_encode
+    uri_decode
+    uri_encode_inplace
+    uri_decode_inplace
+    uri_encode_append
+    uri_decode_append
+];
 
 1;
 
@@ -25,7 +48,7 @@ HTTP::XSCookies - Fast XS cookie mangling for Perl
 
 =head1 VERSION
 
-Version 0.000021
+Version 0.000022
 
 =head1 SYNOPSIS
 
@@ -85,6 +108,10 @@ following formats:
     Expires => '+8y'  # in 8 years
     Expires => 'now'  # right now
 
+A fixed time can be given in any of the formats allowed by HTTP (see
+C<parse_http_date>), and it will be rendered in the format shown above;
+any other string is used verbatim.
+
 =item * Secure: whether the cookie is secure (a boolean, default is false).
 
 =item * HttpOnly: whether the cookie is HTTP only (a boolean, default is
@@ -94,11 +121,59 @@ false).
 requests (a string, either strict or lax, default is unset). See:
 L<https://tools.ietf.org/html/draft-west-first-party-cookies-07>.
 
+=item * packed: whether to pack the value (a boolean, default is false);
+see C<unpack_cookie_value>.
+
+=item * compress: whether to compress the value (a boolean, default is
+false); see C<decompress_cookie_value>.
+
 =back
 
+=head2 bake_cookies
+
+    my $cookies = bake_cookies([
+        session => { value => $id, path => '/', httponly => 1 },
+        locale  => 'en_US',
+    ]);
+
+    my $cookies = bake_cookies({
+        session => { value => $id, path => '/', httponly => 1 },
+        locale  => 'en_US',
+    });
+
+Bake several cookies with a single call, exactly as C<bake_cookie> would,
+and return an arrayref with all of them.  The cookies can be given as an
+arrayref with name / value pairs, in which case they are returned in the
+same order, or as a hashref from names to values, in which case they are
+returned in the (random) order of the hash keys.
+
+=head2 HTTP::XSCookies::Template
+
+    my $template = HTTP::XSCookies::Template->new({
+        path     => '/',
+        domain   => '.example.com',
+        expires  => '+1d',
+        secure   => 1,
+        httponly => 1,
+    });
+
+    my $cookie = $template->bake('session' => $session_id);
+
+A template to bake many cookies with the same attributes, which are given
+in a hashref just like for C<bake_cookie> (any C<value> is ignored).  All
+attributes are rendered only once, when the template is created; baking a
+cookie with the template then just needs to URL-encode its name and value
+and append the rendered attributes.  An C<expires> attribute that is
+relative to the current time (such as C<now> or C<+1d>) is rendered every
+time a cookie is baked, and always comes last.
+
+Just like C<bake_cookie>, C<bake> returns an empty string when the name or
+the value is not a string (for example, undef, a number that was never
+used as a string, or a reference).
+
 =head2 crush_cookie
 
-    my $values = crush_cookie( $cookie [, $allow_no_value] );
+    my $values = crush_cookie( $cookie [, $allow_no_value [, $name_set [, $decompress]]] );
 
 Parse a (properly encoded) cookie string into a hashref with the individual
 values.
@@ -112,6 +187,377 @@ If any of the (URL-decoded) values contains an '&' character, that value is
 interpreted as multiple values, so an arrayref of each separate component is
 returned.
 
+If the third parameter is an C<HTTP::XSCookies::NameSet> object, only the
+names in that set are returned; the values for all other names are skipped
+without being copied or URL-decoded, and parsing stops as soon as all the
+names in the set have been found.
+
+If the fourth parameter is true, compressed values (see
+C<decompress_cookie_value>) are returned decompressed.
+
+=head2 crush_cookies
+
+    my $crushed = crush_cookies( \@cookies [, $allow_no_value [, $name_set [, $decompress]]] );
+
+Crush each of the cookie strings in an arrayref, exactly as C<crush_cookie>
+would, and return an arrayref with the resulting hashrefs, in the same order.
+Doing this with a single call is faster than calling C<crush_cookie> for each
+cookie, which is handy when processing lots of cookies (for example, when
+analyzing access logs).
+
+=head2 crush_cookie_lazy
+
+    my $values = crush_cookie_lazy( $cookie [, $allow_no_value] );
+
+Same as C<crush_cookie>, but the returned hashref is tied to an object that
+only indexes where each name and value are in the cookie string; a value is
+URL-decoded (and, if needed, split on '&') only when it is fetched for the
+first time.  This is faster when only a few of the values in a cookie are
+actually used.
+
+The returned hash is read-only; trying to store, delete or clear any values
+will die.
+
+=head2 crush_cookie_get
+
+    my $value = crush_cookie_get( $cookie, $name );
+
+Parse a (properly encoded) cookie string looking only for the given name, and
+return its value, as it would be found in the hashref returned by
+C<crush_cookie>; return undef if the name does not have a value in the
+cookie.  Parsing stops as soon as the name is found, and no hash is built, so
+this is the fastest way to get a single value from a cookie.
+
+=head2 crush_cookie_pick
+
+    my ($session, $csrf, $locale) =
+        crush_cookie_pick( $cookie, qw/session csrf locale/ );
+
+Parse a (properly encoded) cookie string looking only for the given names,
+and return their values in the same order as the names; the value for a name
+that does not have a value in the cookie is undef.  The cookie is parsed only
+once, stopping as soon as all names are found, and only the values for those
+names are decoded.
+
+The names can also be given as an C<HTTP::XSCookies::NameSet> object, in
+which case the values are returned in the same order as the names in the set.
+
+=head2 crush_set_cookie
+
+    my $cookie = crush_set_cookie( $set_cookie_header );
+    # {
+    #     name     => 'session',
+    #     value    => 'abc123',
+    #     Domain   => '.example.com',
+    #     Path     => '/',
+    #     Expires  => 1452449969,
+    #     'Max-Age' => 3600,
+    #     Secure   => 1,
+    #     HttpOnly => 1,
+    #     SameSite => 'Lax',
+    # }
+
+Parse the value of a C<Set-Cookie> response header, in a single pass, and
+return a hashref with the cookie name and value (URL-decoded and, if needed,
+split on '&', as in C<crush_cookie>) plus its attributes, using the same
+names that C<bake_cookie> accepts.  Attribute names are not case sensitive,
+and attributes are taken literally, as in RFC 6265: only the cookie value
+is URL-decoded.  C<Expires> is returned as an epoch (it can be in RFC 1123,
+RFC 850 or asctime format), C<Max-Age> as an integer, and C<Secure> and
+C<HttpOnly> as 1 when present.  Unknown attributes, and C<Expires> or C<Max-Age> values
+that are not valid, are ignored; if an attribute is repeated, the last one
+wins, as described in RFC 6265.
+
+If the header does not start with a name / value pair, return undef.
+
+=head2 bake_signed_cookie
+
+    my $cookie = bake_signed_cookie('session', {
+        value    => $session_id,
+        path     => '/',
+        httponly => 1,
+    }, $secret);
+
+Same as C<bake_cookie>, but sign the value with a secret key: the baked
+value is the original one, followed by a C<.> and the HMAC-SHA256 (computed
+with the key) of the cookie name, a zero byte and the value, in base64url.
+Anyone can read the value, but it cannot be changed without knowing the key,
+nor used as the value of a cookie with another name.  Dies if the key is
+undef or empty.
+
+=head2 verify_signed_cookie
+
+    my $values = crush_cookie($header);
+    my $session_id = verify_signed_cookie('session', $values->{session}, $secret);
+
+Given the name of a cookie and its value, signed with C<bake_signed_cookie>
+and as returned by C<crush_cookie>, check its signature with the secret
+key.  If it is valid, return the original value (an arrayref if it had
+several values, just as C<crush_cookie> would have returned it); otherwise
+return undef.  A value signed for a cookie with another name is not valid.
+The signatures are compared in constant time.  Dies if the key is undef or
+empty.
+
+HMAC-SHA256 and base64url are implemented in C, so signing or verifying a
+value is a single call and needs no other modules.
+
+=head2 bake_sealed_cookie
+
+    my $cookie = bake_sealed_cookie('prefs', {
+        value    => $prefs,
+        path     => '/',
+        httponly => 1,
+    }, $key);
+
+Same as C<bake_cookie>, but seal the value with a secret key: the value is
+encrypted and authenticated with ChaCha20-Poly1305 (RFC 8439), using a
+random nonce, and the baked value is the nonce, the encrypted value and the
+tag, in base64url.  Nobody without the key can read the value, or change it
+without opening it failing.  The cookie name is authenticated along with the
+value, so the value does not open as the value of a cookie with another
+name.  The key must be a string of exactly 32 bytes
+(for example, random bytes kept in a file); dies otherwise.
+
+Nonces are generated from a key read from the system's random source the
+first time a value is sealed, and again in each process forked after that;
+dies if those random bytes cannot be read.
+
+=head2 open_sealed_cookie
+
+    my $values = crush_cookie($header);
+    my $prefs = open_sealed_cookie('prefs', $values->{prefs}, $key);
+
+Given the name of a cookie and its value, sealed with C<bake_sealed_cookie>
+and as returned by C<crush_cookie>, open it with the secret key.  If it is
+valid, return the original value (an arrayref if it had several values,
+just as C<crush_cookie> would have returned it); otherwise return undef.  A
+value sealed for a cookie with another name is not valid.  Dies if the key
+is not a string of 32 bytes.
+
+ChaCha20-Poly1305 and base64url are implemented in C, so sealing or opening
+a value is a single call, with no intermediate strings, and needs no other
+modules.
+
+=head2 unpack_cookie_value
+
+    my $cookie = bake_cookie('prefs', {
+        value  => { theme => 'dark', lang => 'en', items => 3 },
+        packed => 1,
+        path   => '/',
+    });
+
+    my $values = crush_cookie($header);
+    my $prefs = unpack_cookie_value($values->{prefs});
+
+When baking a cookie with a hashref, a true C<packed> entry asks for the
+value to be packed: it can then be a string, or an arrayref or hashref of
+strings and numbers (but no other references), which is serialized into a
+compact binary form and put in the cookie in base64url.  This is much
+shorter than, for example, URL-encoded JSON, and it works the same with
+C<bake_cookies>, C<bake_signed_cookie> and C<bake_sealed_cookie>.
+
+Given a packed value, as returned by C<crush_cookie> (or by
+C<verify_signed_cookie> or C<open_sealed_cookie>), C<unpack_cookie_value>
+returns the original string, arrayref or hashref; it returns undef if the
+value is not valid.  Strings keep their UTF-8 flag, and integers are
+returned as numbers.
+
+=head2 decompress_cookie_value
+
+    my $cookie = bake_cookie('cart', {
+        value    => $cart,
+        compress => 1,
+        path     => '/',
+    });
+
+    my $values = crush_cookie($header, 0, undef, 1);
+    my $cart = $values->{cart};
+
+When baking a cookie with a hashref, a true C<compress> entry asks for the
+value to be compressed, with a small LZ compressor written in C (producing
+the LZ4 block format), and put in the cookie as a C<!> followed by the
+compressed value in base64url.  Values shorter than 128 bytes, or that
+would not end up shorter than they would otherwise be in the cookie, are
+left alone.  This works the same with C<bake_cookies> and
+C<bake_signed_cookie> (the value is compressed before being signed), and
+with packed values (the packed value is compressed).
+
+C<bake_sealed_cookie> dies when asked to compress a value.  The length of
+a compressed value depends on its contents, and encrypting it does not
+hide that length: when a secret is compressed together with data an
+attacker can influence, the attacker can find out the secret by watching
+how long the sealed value gets (as in the CRIME and BREACH attacks).  Keep
+in mind that a signed value is not encrypted at all.
+
+Since a plain value never has a verbatim C<!> in a baked cookie, crushing a
+cookie with the C<$decompress> parameter set returns compressed values
+decompressed, and everything else as usual.  For a value you got in some
+other way (for example, from C<verify_signed_cookie> or
+C<open_sealed_cookie>), C<decompress_cookie_value> returns the original
+value (an arrayref if it had several values, just as C<crush_cookie> would
+have returned it); a value that is not compressed is returned as it was.
+
+The benchmark in F<tools/bench.pl> shows how many bytes compression saves
+for a few typical values, and what it costs to bake and crush them.
+
+=head2 parse_http_date
+
+    my $epoch = parse_http_date('Sun, 06 Nov 1994 08:49:37 GMT');
+
+Parse a date in any of the formats allowed by HTTP (IMF-fixdate /
+RFC 1123, RFC 850 and asctime, plus the format used by C<bake_cookie>) and
+return it as an epoch; return undef if the date is not valid.  This is the
+parser used by C<crush_set_cookie>; it is written in C, and does not depend
+on the locale or the time zone.
+
+=head2 public_suffix
+
+    my $suffix = public_suffix('www.example.co.uk');    # 'co.uk'
+
+Return the public suffix of a host: the part of it under which anybody
+can register a name, as given by the L<Public Suffix
+List|https://publicsuffix.org/list/> (for example, C<com>, C<co.uk> or
+C<github.io>).  Hosts can be in their ASCII form (C<xn--...>) or in
+UTF-8; they are lowercased first.  A top level domain that is not in the
+list is its own public suffix; return undef if the host is empty or has
+empty labels.
+
+The list is compiled into a static table, F<psl_tables.h>, which comes
+with the distribution already generated, so building the module does not
+need the list or any network access.  This is the table that
+C<HTTP::XSCookies::Jar> uses to reject cookies for public suffixes.  To
+update it to the latest list, run this in F<tools/psl>, then copy the new
+F<psl_tables.h> to the top directory and rebuild the module:
+
+    make fetch      # download public_suffix_list.dat
+    make            # compile it into psl_tables.h
+
+=head2 uri_encode
+
+    my $str = uri_encode('fish & chips');   # fish%20%26%20chips
+
+URL-encode a string: all bytes except letters, digits, C<->, C<_>, C<.> and
+C<~> are turned into C<%xy>.  This is the encoder used by C<bake_cookie>, so
+it works on bytes: a string with characters above 0xff is encoded as UTF-8.
+Return undef if the string is undef.
+
+=head2 uri_decode
+
+    my $str = uri_decode('q=caf%C3%A9&page=2');
+
+URL-decode a string, turning each C<%XY> (with two hex digits) into the
+corresponding byte; a C<%> not followed by two hex digits is left alone, and
+so is C<+>.  It works on bytes and returns a byte string, as the values from
+C<crush_cookie>; if you need characters, decode the result from UTF-8.  This is
+the decoder used when crushing cookies, so it can also be used for query
+strings and form data.  Return undef if the string is undef.
+
+=head2 uri_encode_inplace / uri_decode_inplace
+
+    uri_encode_inplace($str);
+    uri_decode_inplace($str);
+
+Same as C<uri_encode> / C<uri_decode>, but change the string itself instead
+of returning a new one; this saves creating a temporary string.  Decoding
+never makes a string longer, so it never allocates memory; encoding does so
+only if there is something to encode.  Undef is left alone.
+
+=head2 uri_encode_append / uri_decode_append
+
+    my $query = 'q=';
+    uri_encode_append($query, $search);
+
+Same as C<uri_encode> / C<uri_decode>, but append the result to the string
+in the first argument, without creating a temporary string.  This is handy
+when building a query string, or decoding one coming in several pieces.
+
+=head2 HTTP::XSCookies::Parser
+
+    my $parser = HTTP::XSCookies::Parser->new( [$allow_no_value] );
+
+    while (my $chunk = read_some_more()) {
+        my %pairs = $parser->feed($chunk);
+        ...
+    }
+    my %last = $parser->finish();
+
+    my $values = $parser->crushed();
+    $parser->reset();
+
+An incremental parser, for cookie strings that arrive in chunks (for
+example, in an event-driven server): instead of concatenating all the
+chunks and calling C<crush_cookie>, each chunk can be fed to the parser as
+soon as it arrives, and it will be parsed right away; chunks can be split
+anywhere, even in the middle of a URL-encoded character.
+
+Both C<feed> and C<finish> (which must be called once the whole cookie
+string has been fed) return the name / value pairs completed with that
+call, following the same rules as C<crush_cookie> (so, for example, a
+repeated name is only returned the first time).  All the pairs parsed so
+far are available with C<crushed>, in a hashref which is exactly what
+C<crush_cookie> would return for the whole string.  Use C<reset> to parse
+another cookie string with the same parser.
+
+=head2 HTTP::XSCookies::NameSet
+
+    my $names = HTTP::XSCookies::NameSet->new( qw/session csrf locale/ );
+
+    my $values = crush_cookie( $cookie, 0, $names );
+    my ($session, $csrf, $locale) = crush_cookie_pick( $cookie, $names );
+
+    my @names = $names->names();
+    my $found = $names->contains('session');
+
+A set of cookie names, to be built once (for example, when your application
+starts) and used many times as a filter when crushing cookies.  When the set
+is created, a perfect hash is built for its names, so that checking whether
+a name in a cookie is one of the names in the set is very fast.  Repeated
+and undef names are ignored; the C<names> method returns the names in the
+set, in the order they were given.
+
+=head2 HTTP::XSCookies::Jar
+
+    my $jar = HTTP::XSCookies::Jar->new();
+
+    my $stored = $jar->add( $url, $set_cookie [, $now] );
+    my $stored = $jar->add( $url, \@set_cookies [, $now] );
+
+    my $header = $jar->cookie_header( $url [, $site [, $now]] );
+    $request->header( Cookie => $header ) if length $header;
+
+    my @cookies = $jar->cookies( [$now] );
+    my $count   = $jar->count( [$now] );
+    my $purged  = $jar->purge( [$now] );
+    $jar->clear();
+
+A cookie jar for HTTP clients (crawlers, API clients), written in C and
+following the storage model in RFC 6265.  C<add> stores the cookies from
+one or more C<Set-Cookie> headers, received in the response for C<$url>,
+and returns how many were stored; C<cookie_header> returns the value for
+the C<Cookie> header of a request for C<$url> (an empty string if no
+cookies apply), with the cookies for longer paths first.  URLs must have
+a scheme and a host; C<https> and C<wss> are the secure schemes.
+
+Cookies are rejected when their C<Domain> does not include the host, or is
+a public suffix (see C<public_suffix>); cookies with C<Secure> are only
+stored from, and sent to, secure URLs, and URLs that are not secure cannot
+set a cookie that would shadow one with C<Secure> (same name, matching
+path, and the same domain, a parent domain or a subdomain under the same
+registrable domain); the C<__Secure-> and C<__Host-> name prefixes
+are enforced; and a cookie expired on arrival deletes the cookie it would
+replace.  Values are stored and sent back exactly as received.
+
+C<$site> says which cookies with a C<SameSite> attribute can be sent:
+C<same-site> (the default) sends all of them, C<navigation> (a
+cross-site top-level navigation) does not send C<Strict> cookies, and
+C<cross-site> does not send C<Strict> or C<Lax> cookies.
+
+C<$now> is the current epoch, which defaults to the actual time.  Expired
+cookies are removed lazily, whenever the jar is used; C<purge> removes
+them right away, returning how many there were.  C<cookies> returns a
+hashref for each cookie, with the same keys as C<crush_set_cookie> plus
+C<host_only>, and with C<Expires> only for persistent cookies.
+
 =head1 SEE ALSO
 
 L<Cookie::Baker>.
@@ -0,0 +1,205 @@
+#include <memory.h>
+#include "lz.h"
+
+#define LZ_MIN_MATCH     4
+#define LZ_MAX_OFFSET    65535
+#define LZ_NIBBLE_MAX    15
+
+/*
+ * As required by the LZ4 block format: the last LZ_LAST_LITERALS bytes are
+ * always literals, and the last match starts at least LZ_MATCH_LIMIT bytes
+ * before the end.
+ */
+#define LZ_LAST_LITERALS 5
+#define LZ_MATCH_LIMIT   12
+
+#define LZ_HASH_BITS     12
+#define LZ_HASH_SIZE     (1 << LZ_HASH_BITS)
+
+#define LZ_GET_LE32(p) \
+    (((unsigned int) (p)[0]      ) | ((unsigned int) (p)[1] <<  8) | \
+     ((unsigned int) (p)[2] << 16) | ((unsigned int) (p)[3] << 24))
+
+#define LZ_HASH(v) (((v) * 2654435761U) >> (32 - LZ_HASH_BITS))
+
+/*
+ * Put the part of a length that does not fit in a nibble.
+ */
+static unsigned char* lz_put_length(unsigned char* t, unsigned int len)
+{
+    while (len >= 255) {
+        *t++ = 255;
+        len -= 255;
+    }
+    *t++ = (unsigned char) len;
+    return t;
+}
+
+/*
+ * Get the part of a length that did not fit in a nibble, adding it to len;
+ * return zero if we run out of data or the length goes over max.
+ */
+static int lz_get_length(const unsigned char* s, unsigned int slen, unsigned int* spos,
+                         unsigned int* len, unsigned int max)
+{
+    unsigned char byte = 0;
+    do {
+        if (*spos >= slen) {
+            return 0;
+        }
+        byte = s[(*spos)++];
+        *len += byte;
+        if (*len > max) {
+            return 0;
+        }
+    } while (byte == 255);
+    return 1;
+}
+
+/*
+ * Put a sequence: literals from anchor up to ip, plus a match (unless
+ * mlen is zero).
+ */
+static unsigned char* lz_put_sequence(unsigned char* t,
+                                      const unsigned char* anchor, unsigned int lit,
+                                      unsigned int offset, unsigned int mlen)
+{
+    unsigned char* token = t++;
+    unsigned int mextra = mlen ? mlen - LZ_MIN_MATCH : 0;
+
+    *token = (unsigned char) (((lit < LZ_NIBBLE_MAX ? lit : LZ_NIBBLE_MAX) << 4) |
+                              (mextra < LZ_NIBBLE_MAX ? mextra : LZ_NIBBLE_MAX));
+    if (lit >= LZ_NIBBLE_MAX) {
+        t = lz_put_length(t, lit - LZ_NIBBLE_MAX);
+    }
+    memcpy(t, anchor, lit);
+    t += lit;
+
+    if (mlen) {
+        *t++ = (unsigned char) (offset     );
+        *t++ = (unsigned char) (offset >> 8);
+        if (mextra >= LZ_NIBBLE_MAX) {
+            t = lz_put_length(t, mextra - LZ_NIBBLE_MAX);
+        }
+    }
+    return t;
+}
+
+unsigned int lz_compress(const char* src, unsigned int len, char* tgt)
+{
+    const unsigned char* s = (const unsigned char*) src;
+    unsigned char* t = (unsigned char*) tgt;
+    unsigned int table[LZ_HASH_SIZE];
+    unsigned int anchor = 0;
+    unsigned int ip = 0;
+
+    /* anything shorter than this is all literals */
+    if (len > LZ_MATCH_LIMIT) {
+        unsigned int limit = len - LZ_MATCH_LIMIT;
+        unsigned int mlimit = len - LZ_LAST_LITERALS;
+
+        /* stale entries are harmless: every candidate is checked */
+        memset(table, 0, sizeof(table));
+        while (ip <= limit) {
+            unsigned int v = LZ_GET_LE32(s + ip);
+            unsigned int h = LZ_HASH(v);
+            unsigned int ref = table[h];
+            unsigned int mlen = LZ_MIN_MATCH;
+            table[h] = ip;
+
+            if (ref >= ip || ip - ref > LZ_MAX_OFFSET || LZ_GET_LE32(s + ref) != v) {
+                ++ip;
+                continue;
+            }
+
+            /* extend the match backwards over pending literals, and then
+             * forwards as far as allowed */
+            while (ip > anchor && ref > 0 && s[ip - 1] == s[ref - 1]) {
+                --ip;
+                --ref;
+                ++mlen;
+            }
+            while (ip + mlen < mlimit && s[ip + mlen] == s[ref + mlen]) {
+                ++mlen;
+            }
+
+            t = lz_put_sequence(t, s + anchor, ip - anchor, ip - ref, mlen);
+            ip += mlen;
+            anchor = ip;
+
+            /* remember a position inside the match, for the next ones */
+            if (ip - 2 <= limit) {
+                v = LZ_GET_LE32(s + ip - 2);
+                table[LZ_HASH(v)] = ip - 2;
+            }
+        }
+    }
+
+    t = lz_put_sequence(t, s + anchor, len - anchor, 0, 0);
+    return (unsigned int) (t - (unsigned char*) tgt);
+}
+
+int lz_decompress(const char* src, unsigned int len, char* tgt, unsigned int tlen)
+{
+    const unsigned char* s = (const unsigned char*) src;
+    unsigned char* t = (unsigned char*) tgt;
+    unsigned int spos = 0;
+    unsigned int tpos = 0;
+
+    while (1) {
+        unsigned int token = 0;
+        unsigned int lit = 0;
+        unsigned int offset = 0;
+        unsigned int mlen = 0;
+
+        if (spos >= len) {
+            return 0;
+        }
+        token = s[spos++];
+
+        lit = token >> 4;
+        if (lit == LZ_NIBBLE_MAX && !lz_get_length(s, len, &spos, &lit, tlen)) {
+            return 0;
+        }
+        if (lit > len - spos || lit > tlen - tpos) {
+            return 0;
+        }
+        memcpy(t + tpos, s + spos, lit);
+        spos += lit;
+        tpos += lit;
+
+        /* the last sequence has no match */
+        if (spos == len) {
+            return tpos == tlen;
+        }
+
+        if (len - spos < 2) {
+            return 0;
+        }
+        offset = s[spos] | (s[spos + 1] << 8);
+        spos += 2;
+        if (!offset || offset > tpos) {
+            return 0;
+        }
+
+        mlen = token & LZ_NIBBLE_MAX;
+        if (mlen == LZ_NIBBLE_MAX && !lz_get_length(s, len, &spos, &mlen, tlen)) {
+            return 0;
+        }
+        mlen += LZ_MIN_MATCH;
+        if (mlen > tlen - tpos) {
+            return 0;
+        }
+
+        /* a match can overlap the bytes it produces */
+        if (offset >= mlen) {
+            memcpy(t + tpos, t + tpos - offset, mlen);
+            tpos += mlen;
+        } else {
+            while (mlen--) {
+                t[tpos] = t[tpos - offset];
+                ++tpos;
+            }
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef LZ_H_
+#define LZ_H_
+
+/*
+ * A small LZ77 block compressor, producing the LZ4 block format: a series
+ * of sequences, each one a token byte (number of literals in the high
+ * nibble, match length minus 4 in the low one), extra length bytes when a
+ * nibble is 15, the literals, and a two-byte little endian offset to copy
+ * the match from.  The last sequence only has literals.
+ *
+ * It is tuned for cookie-sized inputs: a single greedy pass with a small
+ * hash table, and a decompressor that checks every length and offset, so
+ * that it is safe to use with data coming from a client.
+ */
+
+/*
+ * Most bytes that compressing len bytes can produce.
+ */
+#define LZ_COMPRESS_BOUND(len) ((len) + (len) / 255 + 16)
+
+/*
+ * Compress len bytes from src into tgt, which must have room for
+ * LZ_COMPRESS_BOUND(len) bytes; return the number of bytes written.
+ */
+unsigned int lz_compress(const char* src, unsigned int len, char* tgt);
+
+/*
+ * Decompress len bytes from src into tgt, which must have room for the
+ * tlen bytes it should decompress to.  Return zero if src is not valid, or
+ * does not decompress to exactly tlen bytes; non-zero otherwise.
+ */
+int lz_decompress(const char* src, unsigned int len, char* tgt, unsigned int tlen);
+
+#endif
@@ -0,0 +1,328 @@
+#include <memory.h>
+#include "gmem.h"
+#include "names.h"
+
+#define NAMESET_BIT_SET(set, len) \
+    ((set)->lengths[(len) / 32] |= 1U << ((len) % 32))
+
+#define NAMESET_BIT_GET(set, len) \
+    ((set)->lengths[(len) / 32] & (1U << ((len) % 32)))
+
+#define NAMESET_SAME(e1, e2) \
+    ((e1)->nlen == (e2)->nlen && memcmp((e1)->name, (e2)->name, (e1)->nlen) == 0)
+
+/*
+ * When compiling a set, how many displacements we try for a bucket before
+ * giving up, and how many seeds we try before making the table larger.
+ */
+#define NAMESET_MAX_DISPLACE 4096
+#define NAMESET_MAX_SEEDS    8
+
+static unsigned int name_hash(const char* name, unsigned int nlen, unsigned int seed)
+{
+    /* FNV-1a */
+    unsigned int hash = 2166136261U ^ seed;
+    unsigned int j = 0;
+    for (j = 0; j < nlen; ++j) {
+        hash ^= (unsigned char) name[j];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static unsigned int name_slot(unsigned int hash, unsigned int displace)
+{
+    /* murmur3 finalizer, so that every displacement scatters the names */
+    hash ^= displace;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/*
+ * Try to find, for each bucket, a displacement that sends all the names
+ * in the bucket to free slots.  Buckets with more names are placed first,
+ * while there are more free slots.  Return non-zero if it worked.
+ *
+ * hashes has the hash for each name; order has the positions of all names
+ * sorted by bucket, and the names for bucket b start at order[start[b]].
+ */
+static int nameset_place(NameSet* set, const unsigned int* hashes,
+                         const unsigned int* order, const unsigned int* start,
+                         unsigned int largest)
+{
+    unsigned int nslots = set->mask + 1;
+    unsigned int nbuckets = set->bmask + 1;
+    unsigned int size = 0;
+    unsigned int b = 0;
+    unsigned int j = 0;
+
+    for (j = 0; j < nslots; ++j) {
+        set->slots[j] = -1;
+    }
+
+    for (size = largest; size > 0; --size) {
+        for (b = 0; b < nbuckets; ++b) {
+            unsigned int displace = 0;
+            if (start[b+1] - start[b] != size) {
+                continue;
+            }
+
+            for (displace = 0; displace < NAMESET_MAX_DISPLACE; ++displace) {
+                unsigned int k = 0;
+                for (j = start[b]; j < start[b+1]; ++j) {
+                    unsigned int slot = name_slot(hashes[order[j]], displace) & set->mask;
+                    if (set->slots[slot] >= 0) {
+                        break;
+                    }
+                    set->slots[slot] = order[j];
+                }
+                if (j >= start[b+1]) {
+                    break;
+                }
+
+                /* undo what we placed for this bucket and try again */
+                for (k = start[b]; k < j; ++k) {
+                    set->slots[name_slot(hashes[order[k]], displace) & set->mask] = -1;
+                }
+            }
+            if (displace >= NAMESET_MAX_DISPLACE) {
+                return 0;
+            }
+            set->displace[b] = displace;
+        }
+    }
+
+    return 1;
+}
+
+void nameset_init(NameSet* set)
+{
+    memset(set->lengths, 0, sizeof(set->lengths));
+    set->has_long = 0;
+    set->entries = set->fixed;
+    set->count = 0;
+    set->size = NAMESET_FIXED;
+    set->slots = 0;
+    set->displace = 0;
+    set->mask = set->bmask = set->seed = 0;
+    set->names = 0;
+    set->nsize = 0;
+    set->borrowed = 0;
+}
+
+void nameset_init_entries(NameSet* set, NameEntry* entries, unsigned int size)
+{
+    nameset_init(set);
+    set->entries = entries;
+    set->size = size;
+    set->borrowed = 1;
+}
+
+void nameset_fini(NameSet* set)
+{
+    if (set->entries && set->entries != set->fixed && !set->borrowed) {
+        GMEM_DEL(set->entries, NameEntry, set->size);
+    }
+    if (set->slots) {
+        GMEM_DEL(set->slots, int, set->mask + 1);
+        GMEM_DEL(set->displace, unsigned int, set->bmask + 1);
+    }
+    if (set->names) {
+        GMEM_DEL(set->names, char, set->nsize);
+    }
+    set->entries = 0;
+    set->count = set->size = 0;
+}
+
+void nameset_add(NameSet* set, const char* name, int nlen)
+{
+    NameEntry* entry = 0;
+
+    if (set->slots) {
+        return;
+    }
+
+    if (set->count >= set->size) {
+        unsigned int size = set->size * 2;
+        if (set->borrowed) {
+            return;
+        }
+        if (set->entries == set->fixed) {
+            GMEM_NEW(set->entries, NameEntry, size);
+            memcpy(set->entries, set->fixed, sizeof(set->fixed));
+        } else {
+            GMEM_REALLOC(set->entries, NameEntry, set->size, size);
+        }
+        set->size = size;
+    }
+
+    entry = &set->entries[set->count++];
+    entry->name = name;
+    entry->nlen = nlen;
+    entry->next = -1;
+
+    if (nlen < NAMESET_MAX_LENGTH) {
+        NAMESET_BIT_SET(set, nlen);
+    } else {
+        set->has_long = 1;
+    }
+}
+
+void nameset_compile(NameSet* set)
+{
+    unsigned int total = 0;
+    unsigned int nslots = 8;
+    unsigned int nbuckets = 2;
+    unsigned int largest = 0;
+    unsigned int j = 0;
+    char* repeat = 0;
+    unsigned int* hashes = 0;
+    unsigned int* order = 0;
+    unsigned int* start = 0;
+
+    if (set->slots) {
+        return;
+    }
+
+    /* keep our own copy of the names */
+    for (j = 0; j < set->count; ++j) {
+        total += set->entries[j].nlen;
+    }
+    set->nsize = total ? total : 1;
+    GMEM_NEW(set->names, char, set->nsize);
+    for (total = 0, j = 0; j < set->count; ++j) {
+        NameEntry* entry = &set->entries[j];
+        memcpy(set->names + total, entry->name, entry->nlen);
+        entry->name = set->names + total;
+        total += entry->nlen;
+    }
+
+    /* link each name to the next occurrence of the same name; only the
+     * first occurrence goes into the hash table */
+    GMEM_NEW(repeat, char, set->count + 1);
+    for (j = 0; j < set->count; ++j) {
+        int k = 0;
+        repeat[j] = 0;
+        for (k = (int) j - 1; k >= 0; --k) {
+            if (NAMESET_SAME(&set->entries[k], &set->entries[j])) {
+                set->entries[k].next = j;
+                repeat[j] = 1;
+                break;
+            }
+        }
+    }
+
+    /* about four names per bucket, at most half of the slots used */
+    while (nslots < 2 * set->count) {
+        nslots *= 2;
+    }
+    while (nbuckets * 4 < set->count) {
+        nbuckets *= 2;
+    }
+
+    GMEM_NEW(hashes, unsigned int, set->count + 1);
+    GMEM_NEW(order, unsigned int, set->count + 1);
+    GMEM_NEW(start, unsigned int, nbuckets + 1);
+    while (1) {
+        GMEM_NEW(set->slots, int, nslots);
+        GMEM_NEW(set->displace, unsigned int, nbuckets);
+        set->mask = nslots - 1;
+        set->bmask = nbuckets - 1;
+        for (set->seed = 0; set->seed < NAMESET_MAX_SEEDS; ++set->seed) {
+            unsigned int b = 0;
+
+            /* sort the names by bucket, and find the largest bucket */
+            memset(start, 0, (nbuckets + 1) * sizeof(unsigned int));
+            memset(set->displace, 0, nbuckets * sizeof(unsigned int));
+            for (j = 0; j < set->count; ++j) {
+                const NameEntry* entry = &set->entries[j];
+                hashes[j] = name_hash(entry->name, entry->nlen, set->seed);
+                if (!repeat[j]) {
+                    ++start[(hashes[j] & set->bmask) + 1];
+                }
+            }
+            for (largest = 0, b = 0; b < nbuckets; ++b) {
+                if (start[b+1] > largest) {
+                    largest = start[b+1];
+                }
+                start[b+1] += start[b];
+            }
+            for (j = 0; j < set->count; ++j) {
+                if (!repeat[j]) {
+                    b = hashes[j] & set->bmask;
+                    order[start[b] + set->displace[b]++] = j;
+                }
+            }
+
+            if (nameset_place(set, hashes, order, start, largest)) {
+                break;
+            }
+        }
+        if (set->seed < NAMESET_MAX_SEEDS) {
+            break;
+        }
+
+        /* could not do it, try again with more room */
+        GMEM_DEL(set->slots, int, nslots);
+        GMEM_DEL(set->displace, unsigned int, nbuckets);
+        nslots *= 2;
+    }
+
+    GMEM_DEL(start, unsigned int, nbuckets + 1);
+    GMEM_DEL(order, unsigned int, set->count + 1);
+    GMEM_DEL(hashes, unsigned int, set->count + 1);
+    GMEM_DEL(repeat, char, set->count + 1);
+}
+
+int nameset_find(const NameSet* set, const char* name, int nlen)
+{
+    unsigned int j = 0;
+
+    /* quickly discard names with a length we don't have */
+    if (nlen < NAMESET_MAX_LENGTH ? !NAMESET_BIT_GET(set, nlen) : !set->has_long) {
+        return -1;
+    }
+
+    if (set->slots) {
+        /* compiled: just one place where the name can be */
+        unsigned int hash = name_hash(name, nlen, set->seed);
+        unsigned int slot = name_slot(hash, set->displace[hash & set->bmask]) & set->mask;
+        int pos = set->slots[slot];
+        if (pos >= 0 &&
+            set->entries[pos].nlen == (unsigned int) nlen &&
+            memcmp(set->entries[pos].name, name, nlen) == 0) {
+            return pos;
+        }
+        return -1;
+    }
+
+    for (j = 0; j < set->count; ++j) {
+        const NameEntry* entry = &set->entries[j];
+        if (entry->nlen == (unsigned int) nlen &&
+            memcmp(entry->name, name, nlen) == 0) {
+            return j;
+        }
+    }
+    return -1;
+}
+
+int nameset_next(const NameSet* set, int pos)
+{
+    const NameEntry* entry = &set->entries[pos];
+    unsigned int j = 0;
+
+    if (set->slots) {
+        return entry->next;
+    }
+
+    for (j = pos + 1; j < set->count; ++j) {
+        if (NAMESET_SAME(&set->entries[j], entry)) {
+            return j;
+        }
+    }
+    return -1;
+}
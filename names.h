@@ -0,0 +1,89 @@
+#ifndef NAMES_H_
+#define NAMES_H_
+
+/*
+ * A small set of cookie names that we are interested in, used to pick just
+ * those names when parsing a cookie.
+ *
+ * The set only keeps pointers to the names, so the caller must make sure
+ * they are not modified or released while the set is in use.  To quickly
+ * discard most names in a cookie, the set also keeps a bitmap with the
+ * lengths of all its names; only names whose length is in the bitmap are
+ * compared with the names in the set.
+ *
+ * A set that will be used many times can be compiled: the set then keeps
+ * its own copy of the names, and builds a perfect hash for them (a hash
+ * table where no two different names fall in the same slot), so that
+ * looking up a name requires computing one hash and doing at most one
+ * comparison.  The hash table is built with "hash and displace": names are
+ * first hashed into buckets, and for each bucket we look for a value that,
+ * mixed with the hash, sends all names in the bucket into free slots.
+ */
+
+/*
+ * How many names we can hold without allocating any memory.
+ */
+#define NAMESET_FIXED 16
+
+/*
+ * Names at least this long are not tracked in the lengths bitmap.
+ */
+#define NAMESET_MAX_LENGTH 64
+
+typedef struct NameEntry {
+    const char* name;
+    unsigned int nlen;
+    int next;           /* compiled: next position with the same name */
+} NameEntry;
+
+typedef struct NameSet {
+    NameEntry* entries;
+    unsigned int count;
+    unsigned int size;
+    unsigned int lengths[NAMESET_MAX_LENGTH / 32];
+    int has_long;
+    int* slots;         /* compiled: first position for each hash slot */
+    unsigned int mask;  /* compiled: number of slots - 1 */
+    unsigned int* displace; /* compiled: displacement for each bucket */
+    unsigned int bmask; /* compiled: number of buckets - 1 */
+    unsigned int seed;  /* compiled: seed that gives no collisions */
+    char* names;        /* compiled: our own copy of all names */
+    unsigned int nsize;
+    int borrowed;       /* entries belong to the caller */
+    NameEntry fixed[NAMESET_FIXED];
+} NameSet;
+
+void nameset_init(NameSet* set);
+void nameset_fini(NameSet* set);
+
+/*
+ * Initialize a set that keeps its entries in an array given by the caller,
+ * with room for size names; the set never grows or releases that array,
+ * and names added beyond size are ignored.
+ */
+void nameset_init_entries(NameSet* set, NameEntry* entries, unsigned int size);
+
+/*
+ * Add a name to the set; names can be repeated.  Names cannot be added
+ * after the set has been compiled.
+ */
+void nameset_add(NameSet* set, const char* name, int nlen);
+
+/*
+ * Compile the set: copy all the names, and build a perfect hash for them.
+ */
+void nameset_compile(NameSet* set);
+
+/*
+ * Return the position of the first name in the set which is equal to the
+ * given name; return -1 if there is none.
+ */
+int nameset_find(const NameSet* set, const char* name, int nlen);
+
+/*
+ * Return the position of the next name in the set, after pos, which is
+ * equal to the name at pos; return -1 if there is none.
+ */
+int nameset_next(const NameSet* set, int pos);
+
+#endif
@@ -0,0 +1,201 @@
+#include <memory.h>
+#include "pack.h"
+
+/*
+ * Longest string / number that fits in a tag.
+ */
+#define PACK_SHORT_MAX 0x3f
+
+#define PACK_TAG_BYTES_SHORT 0x00
+#define PACK_TAG_UTF8_SHORT  0x40
+#define PACK_TAG_INT_SHORT   0x80
+
+/*
+ * Most bytes needed for a 64 bit number in LEB128.
+ */
+#define PACK_VARINT_MAX 10
+
+/*
+ * Longest integer we pack as a number, in digits; anything this long
+ * fits in 64 bits.
+ */
+#define PACK_DIGITS_MAX 18
+
+static void pack_put_tag(Buffer* packed, unsigned char tag)
+{
+    buffer_ensure_unused(packed, 1);
+    packed->data[packed->wpos++] = (char) tag;
+}
+
+static void pack_put_varint(Buffer* packed, unsigned long long num)
+{
+    buffer_ensure_unused(packed, PACK_VARINT_MAX);
+    while (num >= 0x80) {
+        packed->data[packed->wpos++] = (char) ((num & 0x7f) | 0x80);
+        num >>= 7;
+    }
+    packed->data[packed->wpos++] = (char) num;
+}
+
+static int pack_get_varint(Buffer* packed, unsigned long long* num)
+{
+    unsigned long long value = 0;
+    int shift = 0;
+
+    while (packed->rpos < packed->wpos) {
+        unsigned char byte = (unsigned char) packed->data[packed->rpos++];
+        if (shift == 63 && byte > 1) {
+            /* more than 64 bits */
+            return 0;
+        }
+        value |= (unsigned long long) (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *num = value;
+            return 1;
+        }
+        shift += 7;
+    }
+
+    /* ran out of bytes */
+    return 0;
+}
+
+int pack_scan_int(const char* str, unsigned int len,
+                  int* negative, unsigned long long* num)
+{
+    unsigned long long value = 0;
+    unsigned int j = 0;
+
+    *negative = len > 0 && str[0] == '-';
+    j = *negative;
+    if (j >= len || len - j > PACK_DIGITS_MAX) {
+        return 0;
+    }
+
+    /* no leading zeros, and no "-0" */
+    if (str[j] == '0' && (len - j > 1 || *negative)) {
+        return 0;
+    }
+
+    for (; j < len; ++j) {
+        if (str[j] < '0' || str[j] > '9') {
+            return 0;
+        }
+        value = value * 10 + (str[j] - '0');
+    }
+    *num = value;
+    return 1;
+}
+
+Buffer* pack_put_undef(Buffer* packed)
+{
+    pack_put_tag(packed, PACK_TAG_UNDEF);
+    return packed;
+}
+
+Buffer* pack_put_string(Buffer* packed, const char* str, unsigned int len, int utf8)
+{
+    if (len <= PACK_SHORT_MAX) {
+        pack_put_tag(packed, (unsigned char) ((utf8 ? PACK_TAG_UTF8_SHORT : PACK_TAG_BYTES_SHORT) | len));
+    } else {
+        pack_put_tag(packed, utf8 ? PACK_TAG_UTF8 : PACK_TAG_BYTES);
+        pack_put_varint(packed, len);
+    }
+    buffer_append_str(packed, str, len);
+    return packed;
+}
+
+Buffer* pack_put_int(Buffer* packed, int negative, unsigned long long num)
+{
+    if (negative) {
+        pack_put_tag(packed, PACK_TAG_NEG);
+        pack_put_varint(packed, num - 1);
+    } else if (num <= PACK_SHORT_MAX) {
+        pack_put_tag(packed, (unsigned char) (PACK_TAG_INT_SHORT | num));
+    } else {
+        pack_put_tag(packed, PACK_TAG_INT);
+        pack_put_varint(packed, num);
+    }
+    return packed;
+}
+
+Buffer* pack_put_list(Buffer* packed, int type, unsigned int count)
+{
+    pack_put_tag(packed, type == PACK_TYPE_HASH ? PACK_TAG_HASH : PACK_TAG_ARRAY);
+    pack_put_varint(packed, count);
+    return packed;
+}
+
+int pack_get_item(Buffer* packed, PackItem* item)
+{
+    unsigned char tag = 0;
+    unsigned long long len = 0;
+
+    if (packed->rpos >= packed->wpos) {
+        return 0;
+    }
+    tag = (unsigned char) packed->data[packed->rpos++];
+
+    item->negative = 0;
+    item->num = 0;
+    item->str = 0;
+    item->len = 0;
+
+    if (tag < PACK_TAG_INT_SHORT) {
+        /* short string */
+        item->type = tag & PACK_TAG_UTF8_SHORT ? PACK_TYPE_UTF8 : PACK_TYPE_BYTES;
+        len = tag & PACK_SHORT_MAX;
+    } else if (tag < PACK_TAG_UNDEF) {
+        /* small number */
+        item->type = PACK_TYPE_INT;
+        item->num = tag & PACK_SHORT_MAX;
+        return 1;
+    } else {
+        switch (tag) {
+        case PACK_TAG_UNDEF:
+            item->type = PACK_TYPE_UNDEF;
+            return 1;
+
+        case PACK_TAG_BYTES:
+        case PACK_TAG_UTF8:
+            item->type = tag == PACK_TAG_UTF8 ? PACK_TYPE_UTF8 : PACK_TYPE_BYTES;
+            if (!pack_get_varint(packed, &len)) {
+                return 0;
+            }
+            break;
+
+        case PACK_TAG_INT:
+        case PACK_TAG_NEG:
+            item->type = PACK_TYPE_INT;
+            item->negative = tag == PACK_TAG_NEG;
+            if (!pack_get_varint(packed, &item->num)) {
+                return 0;
+            }
+            if (item->negative) {
+                /* -1 - n is stored, so that there is no -0 */
+                if (item->num + 1 == 0) {
+                    return 0;
+                }
+                ++item->num;
+            }
+            return 1;
+
+        case PACK_TAG_ARRAY:
+        case PACK_TAG_HASH:
+            item->type = tag == PACK_TAG_HASH ? PACK_TYPE_HASH : PACK_TYPE_ARRAY;
+            return pack_get_varint(packed, &item->num);
+
+        default:
+            return 0;
+        }
+    }
+
+    /* strings: make sure all their bytes are there */
+    if (len > buffer_used(packed)) {
+        return 0;
+    }
+    item->str = packed->data + packed->rpos;
+    item->len = (unsigned int) len;
+    packed->rpos += item->len;
+    return 1;
+}
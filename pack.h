@@ -0,0 +1,82 @@
+#ifndef PACK_H_
+#define PACK_H_
+
+/*
+ * Packed cookie values: a string, or a flat array or hash of strings, in a
+ * compact binary form, which is put in the cookie in base64url (so it needs
+ * no URL-encoding).  Strings that are integers in their canonical form
+ * (such as "42" or "-7", but not "007") are packed as numbers.
+ *
+ * Each item starts with a tag byte:
+ *
+ * + 0x00 - 0x3f: a string of bytes, with its length in the tag
+ * + 0x40 - 0x7f: a UTF-8 string, with its length in the tag
+ * + 0x80 - 0xbf: a number from 0 to 63, in the tag
+ * + PACK_TAG_UNDEF: an undefined value
+ * + PACK_TAG_BYTES / PACK_TAG_UTF8: a string, with its length after the tag
+ * + PACK_TAG_INT: a number n >= 0, after the tag
+ * + PACK_TAG_NEG: a number n < 0, with -1 - n after the tag
+ * + PACK_TAG_ARRAY: the number of elements, followed by the elements
+ * + PACK_TAG_HASH: the number of pairs, followed by each key and value
+ *
+ * Lengths and numbers after a tag are unsigned LEB128 (7 bits per byte,
+ * lowest bits first, high bit set in all the bytes but the last one).
+ * Arrays and hashes only appear at the top; hash keys are always strings.
+ */
+
+#include "buffer.h"
+
+#define PACK_TAG_UNDEF  0xc0
+#define PACK_TAG_BYTES  0xc1
+#define PACK_TAG_UTF8   0xc2
+#define PACK_TAG_INT    0xc3
+#define PACK_TAG_NEG    0xc4
+#define PACK_TAG_ARRAY  0xc5
+#define PACK_TAG_HASH   0xc6
+
+/*
+ * Types of item, as read from a packed value.
+ */
+#define PACK_TYPE_UNDEF 0
+#define PACK_TYPE_BYTES 1
+#define PACK_TYPE_UTF8  2
+#define PACK_TYPE_INT   3
+#define PACK_TYPE_ARRAY 4
+#define PACK_TYPE_HASH  5
+
+/*
+ * An item read from a packed value.  A number is given as its absolute
+ * value plus a flag for negative numbers; for an array or a hash, num is
+ * the number of elements / pairs that follow it.
+ */
+typedef struct PackItem {
+    int type;
+    int negative;
+    unsigned long long num;
+    const char* str;
+    unsigned int len;
+} PackItem;
+
+/*
+ * Check whether a string is an integer in its canonical form that can be
+ * packed as a number; if so, return non-zero and get its absolute value
+ * and sign.
+ */
+int pack_scan_int(const char* str, unsigned int len,
+                  int* negative, unsigned long long* num);
+
+/*
+ * Append items to a packed value.
+ */
+Buffer* pack_put_undef(Buffer* packed);
+Buffer* pack_put_string(Buffer* packed, const char* str, unsigned int len, int utf8);
+Buffer* pack_put_int(Buffer* packed, int negative, unsigned long long num);
+Buffer* pack_put_list(Buffer* packed, int type, unsigned int count);
+
+/*
+ * Read the next item from a packed value, starting at its rpos and moving
+ * it past the item.  Return zero if there is no valid item there.
+ */
+int pack_get_item(Buffer* packed, PackItem* item);
+
+#endif
@@ -0,0 +1,164 @@
+#include <memory.h>
+#include "buffer.h"
+#include "cookie.h"
+#include "pairs.h"
+
+void pairs_init(PairIndex* index,
+                const char* cookie, int clen,
+                int allow_no_value)
+{
+    /* decoding never makes a name longer, so the names cannot take more
+     * room than the whole cookie: make room for them once */
+    buffer_wrap(&index->cookie, cookie, clen);
+    buffer_init(&index->names, clen > 0 ? clen : 0);
+    index->pairs = index->fixed;
+    index->count = 0;
+    index->size = PAIRS_FIXED;
+    index->marked = 0;
+
+    if (!cookie || clen <= 0) {
+        return;
+    }
+
+    while (1) {
+        unsigned int npos = index->names.wpos;
+        int equals = 0;
+        Pair* pair = 0;
+        CookieSpan span;
+
+        /* get the name, and just the position of the value */
+        equals = cookie_get_pair_span(&index->cookie, &index->names, 0, &span);
+
+        /* got an empty name => ran out of data */
+        if (index->names.wpos == npos) {
+            break;
+        }
+
+        /* name with no value, and we don't want those? forget it */
+        if (!equals && !allow_no_value) {
+            index->names.wpos = npos;
+            continue;
+        }
+
+        if (index->count >= index->size) {
+            unsigned int size = index->size * 2;
+            if (index->pairs == index->fixed) {
+                GMEM_NEW(index->pairs, Pair, size);
+                memcpy(index->pairs, index->fixed, sizeof(index->fixed));
+            } else {
+                GMEM_REALLOC(index->pairs, Pair, index->size, size);
+            }
+            index->size = size;
+        }
+
+        pair = &index->pairs[index->count++];
+        pair->npos = npos;
+        pair->nlen = index->names.wpos - npos;
+        pair->vpos = span.vpos;
+        pair->vlen = span.vlen;
+        pair->flags = ((equals ? PAIR_EQUALS : 0) |
+                       (span.escaped ? PAIR_ESCAPED : 0));
+    }
+}
+
+void pairs_fini(PairIndex* index)
+{
+    if (index->pairs && index->pairs != index->fixed) {
+        GMEM_DEL(index->pairs, Pair, index->size);
+    }
+    buffer_fini(&index->names);
+    index->pairs = 0;
+    index->count = index->size = 0;
+}
+
+int pairs_find(const PairIndex* index,
+               const char* name, int nlen)
+{
+    unsigned int j = 0;
+    for (j = 0; j < index->count; ++j) {
+        const Pair* pair = &index->pairs[j];
+        if (pair->nlen == (unsigned int) nlen &&
+            memcmp(index->names.data + pair->npos, name, nlen) == 0) {
+            return j;
+        }
+    }
+    return -1;
+}
+
+static unsigned int pairs_hash(const char* name, unsigned int nlen)
+{
+    unsigned int hash = 2166136261U;
+    unsigned int j = 0;
+    for (j = 0; j < nlen; ++j) {
+        hash ^= (unsigned char) name[j];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Flag all pairs whose name was already seen, with a hash table (kept at
+ * most half full) holding the first pair for each name.
+ */
+static void pairs_mark_repeated(PairIndex* index)
+{
+    int fixed[PAIRS_FIXED * 4];
+    int* slots = fixed;
+    unsigned int nslots = PAIRS_FIXED * 4;
+    unsigned int mask = 0;
+    unsigned int j = 0;
+
+    while (nslots < 2 * index->count) {
+        nslots *= 2;
+    }
+    if (nslots > PAIRS_FIXED * 4) {
+        GMEM_NEW(slots, int, nslots);
+    }
+    mask = nslots - 1;
+    for (j = 0; j < nslots; ++j) {
+        slots[j] = -1;
+    }
+
+    for (j = 0; j < index->count; ++j) {
+        Pair* pair = &index->pairs[j];
+        const char* name = index->names.data + pair->npos;
+        unsigned int slot = pairs_hash(name, pair->nlen) & mask;
+        for (; slots[slot] >= 0; slot = (slot + 1) & mask) {
+            const Pair* first = &index->pairs[slots[slot]];
+            if (first->nlen == pair->nlen &&
+                memcmp(index->names.data + first->npos, name, pair->nlen) == 0) {
+                pair->flags |= PAIR_REPEATED;
+                break;
+            }
+        }
+        if (slots[slot] < 0) {
+            slots[slot] = (int) j;
+        }
+    }
+
+    if (slots != fixed) {
+        GMEM_DEL(slots, int, nslots);
+    }
+    index->marked = 1;
+}
+
+int pairs_is_repeated(PairIndex* index, unsigned int pos)
+{
+    if (!index->marked) {
+        pairs_mark_repeated(index);
+    }
+    return index->pairs[pos].flags & PAIR_REPEATED;
+}
+
+Buffer* pairs_get_value(const PairIndex* index, unsigned int pos,
+                        Buffer* value)
+{
+    const Pair* pair = &index->pairs[pos];
+    CookieSpan span;
+
+    span.verbatim = 1;
+    span.escaped = pair->flags & PAIR_ESCAPED;
+    span.vpos = pair->vpos;
+    span.vlen = pair->vlen;
+    return cookie_get_span_value(&index->cookie, &span, value);
+}
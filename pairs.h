@@ -0,0 +1,77 @@
+#ifndef PAIRS_H_
+#define PAIRS_H_
+
+/*
+ * An index of all the name / value pairs in a cookie, built with a single
+ * pass over the cookie string.
+ *
+ * Names are URL-decoded and stored one after the other in a buffer.  Values
+ * are not touched at all: we just remember where each of them is within the
+ * cookie, and whether it needs URL-decoding, so that this can be done later,
+ * and only for the values that are actually needed.
+ *
+ * The index wraps the cookie string, so the caller must make sure the string
+ * is not modified or released while the index is in use.
+ */
+
+#include "buffer.h"
+
+/*
+ * How many pairs we can index without allocating any memory.
+ */
+#define PAIRS_FIXED 16
+
+/* Flags for a pair */
+#define PAIR_EQUALS  0x01   /* saw an '=' after the name */
+#define PAIR_ESCAPED 0x02   /* value must be URL-decoded */
+#define PAIR_REPEATED 0x04  /* an earlier pair has the same name */
+
+typedef struct Pair {
+    unsigned int npos;  /* position of name within names buffer */
+    unsigned int nlen;
+    unsigned int vpos;  /* position of value within cookie */
+    unsigned int vlen;
+    unsigned int flags;
+} Pair;
+
+typedef struct PairIndex {
+    Buffer cookie;
+    Buffer names;
+    Pair* pairs;
+    unsigned int count;
+    unsigned int size;
+    int marked;         /* PAIR_REPEATED has been set for all pairs */
+    Pair fixed[PAIRS_FIXED];
+} PairIndex;
+
+/*
+ * Build the index for a cookie string.  Names with no value are only
+ * indexed if allow_no_value is non-zero.
+ */
+void pairs_init(PairIndex* index,
+                const char* cookie, int clen,
+                int allow_no_value);
+void pairs_fini(PairIndex* index);
+
+/*
+ * Return the position of the first pair with the given name, or -1 if
+ * there is no such pair.
+ */
+int pairs_find(const PairIndex* index,
+               const char* name, int nlen);
+
+/*
+ * Return non-zero if the pair at a given position has the same name as
+ * another pair found earlier in the cookie.  The first call finds all the
+ * repeated names at once, with a hash table, and flags their pairs with
+ * PAIR_REPEATED; later calls just look at the flag.
+ */
+int pairs_is_repeated(PairIndex* index, unsigned int pos);
+
+/*
+ * Append the (URL-decoded) value for the pair at a given position.
+ */
+Buffer* pairs_get_value(const PairIndex* index, unsigned int pos,
+                        Buffer* value);
+
+#endif
@@ -0,0 +1,214 @@
+#include <ctype.h>
+#include <memory.h>
+#include "buffer.h"
+#include "scan.h"
+#include "parser.h"
+
+/*
+ * This file is generated automatically with program "encode".
+ * We include it because we will do our own URL decoding.
+ */
+#define URI_TABLES_SOME
+#define URI_TABLE_DECODE
+#define URI_TABLE_STATE
+#define URI_TABLE_PLAIN
+#include "uri_tables.h"
+
+#define HEX_VALUE(c) uri_decode_tbl[(unsigned char) (c)]
+
+/*
+ * Append a character (already decoded, if needed) to the name or the
+ * value, depending on the current state.
+ */
+static void parser_put(CookieParser* parser, unsigned char c, int decoded)
+{
+    if (parser->state == URI_STATE_NAME) {
+        buffer_ensure_unused(&parser->name, 1);
+        parser->name.data[parser->name.wpos++] = c;
+    } else {
+        buffer_ensure_unused(&parser->value, 1);
+        parser->value.data[parser->value.wpos++] = c;
+        if (decoded || !isspace(c)) {
+            parser->vend = parser->value.wpos;
+        }
+    }
+}
+
+/*
+ * Put a '%' escape that turned out not to be one, as plain characters.
+ */
+static void parser_put_escape(CookieParser* parser)
+{
+    unsigned int j = 0;
+    for (j = 0; j < parser->nescape; ++j) {
+        parser_put(parser, parser->escape[j], 0);
+    }
+    parser->nescape = 0;
+}
+
+/*
+ * Finish the current pair, leaving it ready to be returned.
+ */
+static int parser_end_pair(CookieParser* parser)
+{
+    parser->value.wpos = parser->vend;
+    parser->state = URI_STATE_START;
+    parser->ready = 1;
+    return 1;
+}
+
+/*
+ * Forget the pair that was returned last time.
+ */
+static void parser_clear_pair(CookieParser* parser)
+{
+    buffer_reset(&parser->name);
+    buffer_reset(&parser->value);
+    parser->equals = 0;
+    parser->vend = 0;
+    parser->ready = 0;
+}
+
+void parser_init(CookieParser* parser)
+{
+    buffer_init(&parser->name, 0);
+    buffer_init(&parser->value, 0);
+    parser_reset(parser);
+}
+
+void parser_fini(CookieParser* parser)
+{
+    buffer_fini(&parser->value);
+    buffer_fini(&parser->name);
+}
+
+void parser_reset(CookieParser* parser)
+{
+    parser_clear_pair(parser);
+    parser->state = URI_STATE_START;
+    parser->done = 0;
+    parser->nescape = 0;
+}
+
+int parser_feed(CookieParser* parser,
+                const char* data, unsigned int len,
+                unsigned int* used)
+{
+    unsigned int pos = 0;
+
+    if (parser->ready) {
+        parser_clear_pair(parser);
+    }
+
+    /* First finish any escape left pending from the previous chunk; we
+     * never consume a character that turns out not to be a hex digit. */
+    while (parser->nescape > 0 && pos < len && !parser->done) {
+        unsigned char c = data[pos];
+        if (!isxdigit(c)) {
+            parser_put_escape(parser);
+            break;
+        }
+        ++pos;
+        if (parser->nescape < 2) {
+            parser->escape[parser->nescape++] = c;
+            continue;
+        }
+        parser_put(parser, MAKE_BYTE(HEX_VALUE(parser->escape[1]), HEX_VALUE(c)), 1);
+        parser->nescape = 0;
+    }
+
+    while (pos < len && !parser->done) {
+        unsigned char current = data[pos];
+        parser->state = uri_state_tbl[current][parser->state];
+
+        switch (parser->state) {
+            /* If we are reading the name or value part, add the current
+             * character (possibly URL-decoded) */
+            case URI_STATE_NAME:
+            case URI_STATE_VALUE:
+                if (uri_plain_tbl[current]) {
+                    /* copy the whole run of plain characters */
+                    unsigned int run = scan_plain(data + pos, len - pos);
+                    Buffer* buf = parser->state == URI_STATE_NAME ? &parser->name : &parser->value;
+                    buffer_append_str(buf, data + pos, run);
+                    if (parser->state == URI_STATE_VALUE) {
+                        parser->vend = buf->wpos;
+                    }
+                    pos += run;
+                    break;
+                }
+                if (current != '%') {
+                    /* just copy current character */
+                    parser_put(parser, current, 0);
+                    ++pos;
+                    break;
+                }
+
+                /* an escape: if it does not fit in this chunk, keep what
+                 * we have of it and wait for the next chunk */
+                if (pos + 1 >= len ||
+                    (isxdigit((unsigned char) data[pos+1]) && pos + 2 >= len)) {
+                    parser->escape[0] = '%';
+                    parser->nescape = 1;
+                    if (pos + 1 < len) {
+                        parser->escape[parser->nescape++] = data[pos+1];
+                    }
+                    pos = len;
+                    break;
+                }
+                if (isxdigit((unsigned char) data[pos+1]) &&
+                    isxdigit((unsigned char) data[pos+2])) {
+                    /* put a byte together from the next two hex digits */
+                    parser_put(parser, MAKE_BYTE(HEX_VALUE(data[pos+1]), HEX_VALUE(data[pos+2])), 1);
+                    pos += 3;
+                } else {
+                    parser_put(parser, current, 0);
+                    ++pos;
+                }
+                break;
+
+            case URI_STATE_EQUALS:
+                parser->equals = 1;
+                ++pos;
+                break;
+
+            case URI_STATE_END:
+                /* a null byte ends the cookie, just like the end of data */
+                if (current == '\0') {
+                    parser->done = 1;
+                }
+                *used = pos + 1;
+                return parser_end_pair(parser);
+
+            case URI_STATE_ERROR:
+                parser->done = 1;
+                break;
+
+            /* Any other state, just move to the next position. */
+            default:
+                ++pos;
+                break;
+        }
+    }
+
+    *used = len;
+    return 0;
+}
+
+int parser_finish(CookieParser* parser)
+{
+    if (parser->ready) {
+        parser_clear_pair(parser);
+    }
+    if (parser->done) {
+        return 0;
+    }
+
+    parser->done = 1;
+    parser_put_escape(parser);
+    parser->state = uri_state_tbl[0][parser->state];
+    if (parser->state != URI_STATE_END) {
+        return 0;
+    }
+    return parser_end_pair(parser);
+}
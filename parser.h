@@ -0,0 +1,56 @@
+#ifndef PARSER_H_
+#define PARSER_H_
+
+/*
+ * An incremental cookie parser: it can be fed a cookie string in chunks
+ * of any size, as they arrive, and it returns each name / value pair as
+ * soon as it is complete.  The results are the same as when parsing the
+ * whole string with cookie_get_pair().
+ *
+ * The parser runs the same state machine as cookie_get_pair(), but keeps
+ * all its state (current state, partial name and value, and a '%' escape
+ * that was split between two chunks) in the CookieParser struct, so that
+ * parsing can be resumed with the next chunk.
+ */
+
+#include "buffer.h"
+
+typedef struct CookieParser {
+    int state;                  /* current URI_STATE_* */
+    int equals;                 /* saw an '=' in the current pair */
+    int ready;                  /* a pair was returned, must be cleared */
+    int done;                   /* no more pairs can come */
+    unsigned int vend;          /* value length, without trailing spaces */
+    unsigned int nescape;       /* bytes in a pending '%' escape */
+    char escape[2];             /* '%' and maybe a first hex digit */
+    Buffer name;
+    Buffer value;
+} CookieParser;
+
+void parser_init(CookieParser* parser);
+void parser_fini(CookieParser* parser);
+
+/*
+ * Get ready to parse a new cookie.
+ */
+void parser_reset(CookieParser* parser);
+
+/*
+ * Parse (part of) the next chunk of a cookie.  Return non-zero if a pair
+ * was completed; in that case, the pair is in the name and value buffers
+ * (until the next call), equals says whether we saw an '=' in the pair,
+ * and used is the number of bytes consumed from data, so that the caller
+ * can call again with the rest of the chunk.  Return zero once the whole
+ * chunk was consumed without completing another pair.
+ */
+int parser_feed(CookieParser* parser,
+                const char* data, unsigned int len,
+                unsigned int* used);
+
+/*
+ * Signal the end of the cookie.  Return non-zero if this completed a
+ * last pair, which can be found as in parser_feed().
+ */
+int parser_finish(CookieParser* parser);
+
+#endif
@@ -0,0 +1,77 @@
+#include <memory.h>
+#include "psl.h"
+
+/*
+ * This file is generated with program "trie", in tools/psl.
+ */
+#include "psl_tables.h"
+
+static const PslNode* psl_find_child(const PslNode* node, const char* label, unsigned int len)
+{
+    unsigned int lo = node->first;
+    unsigned int hi = node->first + node->count;
+
+    while (lo < hi) {
+        unsigned int mid = lo + (hi - lo) / 2;
+        const PslNode* child = &psl_nodes[mid];
+        int cmp = child->len != len ? (child->len < len ? -1 : 1)
+                                    : memcmp(psl_labels + child->label, label, len);
+        if (cmp == 0) {
+            return child;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+int psl_suffix(const char* host, unsigned int len)
+{
+    const PslNode* node = psl_nodes;
+    unsigned int end = len;
+    int suffix = -1;
+
+    if (!len) {
+        return -1;
+    }
+
+    /* walk the labels from the last one; once we fall off the trie, just
+     * check that the rest of the labels are not empty */
+    while (1) {
+        unsigned int beg = end;
+        while (beg > 0 && host[beg - 1] != '.') {
+            --beg;
+        }
+        if (beg == end) {
+            return -1;
+        }
+
+        if (suffix < 0) {
+            /* the implicit rule: a top level domain is a public suffix */
+            suffix = (int) beg;
+        }
+        if (node) {
+            const PslNode* child = psl_find_child(node, host + beg, end - beg);
+            if (child && (child->flags & PSL_EXCEPTION)) {
+                /* the suffix is the wildcard rule minus this label */
+                suffix = (int) end + 1;
+                node = 0;
+            } else {
+                if ((node->flags & PSL_WILDCARD) ||
+                    (child && (child->flags & PSL_RULE))) {
+                    suffix = (int) beg;
+                }
+                node = child;
+            }
+        }
+
+        if (beg == 0) {
+            break;
+        }
+        end = beg - 1;
+    }
+    return suffix;
+}
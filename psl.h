@@ -0,0 +1,39 @@
+#ifndef PSL_H_
+#define PSL_H_
+
+/*
+ * Public suffixes: domains under which anybody can register a name, such
+ * as "com", "co.uk" or "github.io", as given by the Public Suffix List.
+ * A cookie for a public suffix would be sent to every site under it (a
+ * "supercookie"), so a cookie jar must reject those.
+ *
+ * The list is compiled by tools/psl into a reversed-label trie, in
+ * psl_tables.h: one array of nodes, where the children of each node are
+ * contiguous and sorted, plus one string with all the labels, each one
+ * stored once.  Finding the public suffix of a host walks the trie from
+ * the last label of the host, with a binary search among the children of
+ * each node; it takes O(labels) steps and allocates no memory.
+ */
+
+#define PSL_RULE      0x01  /* the node is a rule */
+#define PSL_WILDCARD  0x02  /* all children of the node are rules */
+#define PSL_EXCEPTION 0x04  /* the node is an exception to a wildcard */
+
+typedef struct PslNode {
+    unsigned int first;     /* position of its first child */
+    unsigned int label;     /* offset of its label in psl_labels */
+    unsigned short count;   /* number of children */
+    unsigned char len;      /* length of its label */
+    unsigned char flags;
+} PslNode;
+
+/*
+ * Return the position in a lowercase host (or domain) where its public
+ * suffix starts, following the rules of the list: the longest matching
+ * rule wins, exceptions win over wildcards, and a top level domain that
+ * is not in the list is a public suffix.  So a host is itself a public
+ * suffix when this returns zero.  Return -1 if the host has empty labels.
+ */
+int psl_suffix(const char* host, unsigned int len);
+
+#endif
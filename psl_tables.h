@@ -0,0 +1,3368 @@
+/*
+ *  THIS FILE WAS GENERATED AUTOMATICALLY
+ *
+ *  DON'T EDIT IT BY HAND!
+ *  (unless you know what you are doing)
+ *
+ *  Built by tools/psl/trie from the Public Suffix List, which is
+ *  subject to the terms of the Mozilla Public License, v. 2.0;
+ *  see https://publicsuffix.org/list/
+ *
+ *  9506 rules, 10169 nodes, 46252 bytes of labels.
+ */
+
+static const char psl_labels[] =
+    "xn--correios-e-telecomunicaes-ghc29a\340\256\232\340\256\277\340\256"
+    "\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340"
+    "\257\202\340\256\260\340\257\215chirurgiens-dentistes-en-francecorr"
+    "eios-e-telecomunica\303\247\303\265esposts-and-telecommunicationsen"
+    "vironmentalconservations3-website-ap-northeast-1s3-website-ap-south"
+    "east-1s3-website-ap-southeast-2xn--trentino-sd-tirol-c3bprivatizehe"
+    "althinsurancexn--trentin-sd-tirol-rzbxn--trentino-sdtirol-szbxn--tr"
+    "entinosd-tirol-rzbxn--vermgensberatung-pwbxn--gnstigbestellen-zvbxn"
+    "--trentin-sdtirol-7vbxn--trentinosdtirol-7vbxn--trentinsd-tirol-6vb"
+    "xn--vermgensberater-ctbaccident-investigationindependent-commission"
+    "xn--balsan-sdtirol-nsbxn--bulsan-sdtirol-nsbxn--clchc0ea0b2g2a9gcdx"
+    "n--mre-og-romsdal-qqbxn--stjrdalshalsen-sqbxn--trentinsdtirol-nsban"
+    "dria-barletta-traniandria-trani-barlettabarletta-trani-andriafriuli"
+    "-venezia-giuliais-a-financialadvisormonza-e-della-brianzaobservable"
+    "usercontentpassenger-associations3-fips-us-gov-west-1trani-andria-b"
+    "arlettatrani-barletta-andriaxn--aurskog-hland-jnbxn--bozen-sdtirol-"
+    "2obxn--gnstigliefern-wobxn--nmesjevuemie-tcbaxn--valle-d-aoste-ehb\340"
+    "\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257"
+    "\340\256\276akamaiorigin-stagingawsglobalacceleratorbarrell-of-know"
+    "ledgecolonialwilliamsburgfriuli-veneziagiuliafriulivenezia-giuliais"
+    "-a-personaltrainernaturalhistorymuseums3-website-eu-west-1s3-websit"
+    "e-sa-east-1s3-website-us-east-1s3-website-us-west-1s3-website-us-we"
+    "st-2synology-diskstationxn--comunicaes-v6a2oxn--mtta-vrjjat-k7afxn-"
+    "-w4r85el8fhu5dnraxn--ystre-slidre-ujbaccident-preventionair-traffic"
+    "-controlandriabarlettatraniandriatranibarlettaappspaceusercontentba"
+    "rrel-of-knowledgefriuliveneziagiuliaindependent-inquestindependent-"
+    "inquirymedizinhistorischesnatuurwetenschappentraniandriabarlettatra"
+    "nibarlettaandriatrentino-alto-adigetrentino-sued-tiroltrentino-s\303"
+    "\274d-tirolxn--bhccavuotna-k7axn--cesena-forl-mcbxn--forl-cesena-fc"
+    "bxn--ggaviika-8ya47hxn--hcesuolo-7ya35bxn--hmmrfeasta-s4acxn--koluo"
+    "kta-7ya57hxn--krjohka-hwab49jxn--mgberp4a5d4a87gxn--mgbqly7c0a67fbc"
+    "xn--sandnessjen-ogbxn--sr-varanger-ggbxn--valle-aoste-ebbxn--valled"
+    "aoste-ebbakamaiedge-stagingboldlygoingnowheredigitaloceanspacesdisk"
+    "ussionsbereichexperts-comptablesharvestcelebrationhosted-by-previde"
+    "rindependent-reviewinterhostsolutionsis-a-cubicle-slavemonzaedellab"
+    "rianzanorthwesternmutualpagespeedmobilizerscienceandindustryscience"
+    "snaturellesservecounterstriketravelersinsurancetrentin-sued-tiroltr"
+    "entin-s\303\274d-tiroltrentino-altoadigetrentino-sud-tiroltrentino-"
+    "suedtiroltrentino-s\303\274dtiroltrentinoalto-adigetrentinosued-tir"
+    "oltrentinos\303\274d-tirolverm\303\266gensberatungxn--bearalvhki-y4"
+    "axn--bhcavuotna-s4axn--brnnysund-m8acxn--cesenaforl-i8axn--davvenjr"
+    "ga-y4axn--forlcesena-c8axn--leagaviika-52bxn--mgbai9a5eva00bxn--mla"
+    "tvuopmi-s4axn--rhkkervju-01afxn--sndre-land-0cbxn--stre-toten-zcbxn"
+    "--valleaoste-e7a\331\205\331\210\330\261\331\212\330\252\330\247\331"
+    "\206\331\212\330\247\340\244\255\340\244\276\340\244\260\340\244\244"
+    "\340\244\256\340\245\215\340\256\207\340\256\262\340\256\231\340\257"
+    "\215\340\256\225\340\257\210\340\270\230\340\270\270\340\270\243\340"
+    "\270\201\340\270\264\340\270\210\340\270\243\340\270\261\340\270\220"
+    "\340\270\232\340\270\262\340\270\245\340\270\255\340\270\207\340\270"
+    "\204\340\271\214\340\270\201\340\270\243\343\203\225\343\202\241\343"
+    "\203\203\343\202\267\343\203\247\343\203\263akamaized-stagingalpha-"
+    "myqnapcloudbolzano-altoadigebrowsersafetymarkcarbonia-iglesiasedges"
+    "uite-staginggithubusercontentg\303\274nstigbestellenhealth-carerefo"
+    "rmhigashimatsushimahistoricalsocietyiglesias-carboniaindependent-pa"
+    "nelis-a-conservativeis-a-photographeris-an-entertainerlinodeusercon"
+    "tentmyactivedirectorynaturhistorischesplaystation-clouds3-ap-northe"
+    "ast-1s3-ap-northeast-2s3-ap-southeast-1s3-ap-southeast-2scienceandh"
+    "istorystackhero-networktelekommunikationtrentin-sud-tiroltrentin-su"
+    "edtiroltrentin-s\303\274dtiroltrentino-sudtiroltrentinoaltoadigetre"
+    "ntinosud-tiroltrentinosuedtiroltrentinos\303\274dtiroltrentinsued-t"
+    "iroltrentins\303\274d-tirolverm\303\266gensberaterxn--5su34j936bgsg"
+    "xn--bck1b9a5dre4cxn--eveni-0qa01gaxn--hgebostad-g3axn--krdsherad-m8"
+    "axn--mgbah1a3hjkrdxn--mgbai9azgqp6jxn--mgberp4a5d4arxn--porsgu-sta2"
+    "6fxn--sr-aurdal-l8axn--vestvgy-ixa6oxn--vre-eiker-k8axn--xkc2dl3a5e"
+    "e0hair-surveillanceakamaihd-stagingamericanantiquesauthgear-staging"
+    "balsan-suedtirolbalsan-s\303\274dtirolbrandywinevalleybulsan-suedti"
+    "rolbulsan-s\303\274dtirolcarboniaiglesiascouchpotatofrieselasticbea"
+    "nstalkendoftheinternetest-mon-blogueurfastly-terrariumfedorainfracl"
+    "oudfirewall-gatewayfirewalledreplitfriuli-ve-giuliahigashihiroshima"
+    "higashimatsuyamahigashishirakawahigashisumiyoshihistoryofsciencehui"
+    "ssier-justiceiglesiascarboniais-a-hard-workeris-a-libertarianis-an-"
+    "accountantis-into-cartoonsis-not-certifiedissmarterthanyoumuseumver"
+    "enigingmysecuritycameram\303\270re-og-romsdalnationalfirearmsnation"
+    "alheritagenorth-kazakhstann\303\245\303\245mesjevuemiephiladelphiaa"
+    "rearoyal-commissions3-us-gov-west-1saves-the-whalesstj\303\270rdals"
+    "halsentownnews-stagingtrentin-sudtiroltrentino-a-adigetrentino-s-ti"
+    "roltrentinosudtiroltrentinsud-tiroltrentinsuedtiroltrentins\303\274"
+    "dtirolusdecorativeartsxn--12co0c3b4evaxn--btsfjord-9zaxn--fzys8d69u"
+    "vgmxn--gildeskl-g0axn--givuotna-8yaxn--hylandet-54axn--jrpeland-54a"
+    "xn--kranghke-b0axn--kvnangen-k0axn--laheadju-7yaxn--lrenskog-54axn-"
+    "-mgba7c0bbn0axn--mgbcpq6gpa1axn--mgbqly7cvafrxn--mjndalen-64axn--ve"
+    "grshei-c0axn--xkc2al3hye2a\330\247\331\204\330\263\330\271\331\210\330"
+    "\257\331\212\330\251\330\247\331\204\330\263\330\271\331\210\330\257"
+    "\331\212\331\207\330\247\331\204\330\263\330\271\331\210\330\257\333"
+    "\214\330\251\330\247\331\204\330\263\330\271\331\210\330\257\333\214"
+    "\333\203affinitylotteryamericanexpressaurskog-h\303\270landazuresta"
+    "ticappsbalsan-sudtirolbotanicalgardenbozen-suedtirolbozen-s\303\274"
+    "dtirolbritishcolumbiabulsan-sudtirolcampidano-mediochildrensgardenc"
+    "loudcontrolappcloudcontrolledcloudflare-ipfscoloradoplateaucomputer"
+    "historycontemporaryartdev-myqnapclouddynamisches-dnseast-kazakhstan"
+    "edgekey-stagingenterprisecloudest-a-la-maisonest-a-la-masionevje-og"
+    "-hornnesfriuli-v-giuliafriuli-vegiuliafriulive-giuliafuettertdasnet"
+    "zfujikawaguchikogeometre-expertg\303\274nstigliefernhembygdsforbund"
+    "higashiagatsumahigashichichibuhigashimurayamahigashiyodogawahomesec"
+    "uritymachosting-clusterhotelwithflightis-a-bookkeeperis-a-celticsfa"
+    "nis-a-landscaperis-a-linux-useris-a-republicanis-an-anarchistis-wit"
+    "h-thebandivano-frankivskkazimierz-dolnykerrypropertieskommunalforbu"
+    "ndmedio-campidanominamiyamashiromore-og-romsdalmusashimurayamam\303"
+    "\241tta-v\303\241rjjatnaturalsciencesoceanographiqueoutsystemscloud"
+    "reggio-calabrias3-ca-central-1s3-eu-central-1sandvikcoromantscience"
+    "-fictionsecuritytacticsstateofdelawarestjordalshalsentrentino-aadig"
+    "etrentino-stiroltrentinoa-adigetrentinos-tiroltrentinsudtiroltuleap"
+    "-partnersuscountryestateuslivinghistoryvall\303\251e-d-aostewatch-a"
+    "nd-clockwpenginepoweredxn--12cfi8ixb8lxn--aroport-byaxn--bdddj-mrab"
+    "dxn--berlevg-jxaxn--hkkinen-5waxn--hnefoss-q1axn--holtlen-hxaxn--hy"
+    "anger-q1axn--i1b6b1a6a2exn--kcrx77d1x4axn--krehamn-dxaxn--kvfjord-n"
+    "xaxn--langevg-jxaxn--ldingen-q1axn--lgbbat1ad8jxn--mgba3a4f16axn--m"
+    "gbaakc7dvfxn--mgbc0a9azcgxn--nqv7fs00emaxn--nttery-byaexn--nvuotna-"
+    "hwaxn--oppegrd-ixaxn--rennesy-v1axn--rlingen-mxaxn--sdtirol-n2axn--"
+    "skjervy-v1axn--sknland-fxaxn--sr-fron-q1axn--sr-odal-q1axn--srreisa"
+    "-q1axn--stjrdal-s1axn--tnsberg-q1axn--trgstad-r1axn--ygarden-p1ayok"
+    "oshibahikari\340\244\255\340\244\276\340\244\260\340\245\213\340\244"
+    "\244\340\244\270\340\244\202\340\244\227\340\244\240\340\244\250\340"
+    "\246\254\340\246\276\340\246\202\340\246\262\340\246\276\340\260\255"
+    "\340\260\276\340\260\260\340\260\244\340\261\215\340\264\255\340\264"
+    "\276\340\264\260\340\264\244\340\264\202\340\270\250\340\270\266\340"
+    "\270\201\340\270\251\340\270\262\345\230\211\351\207\214\345\244\247"
+    "\351\205\222\345\272\227adobeio-staticadobeioruntimeakamai-staginga"
+    "mericanfamilyap-northeast-3appspacehostedarchaeologicalaurskog-hola"
+    "ndazurecontainerbalena-devicesbananarepublicbmoattachmentsbozen-sud"
+    "tirolcampidanomediocasadelamonedachihayaakasakachristiansburgcloudf"
+    "unctionscn-northwest-1coastaldefencecookingchannelculturalcenterdel"
+    "l-ogliastradnepropetrovskdnipropetrovskdyndns-at-homedyndns-at-work"
+    "eating-organicecommerce-shopemilia-romagnafastvps-serverfriuli-vgiu"
+    "liafriuliv-giuliafriulivegiuliagroundhandlingheimatunduhrenhigashiy"
+    "oshinohistorichouseshome-webserverhomesecuritypch\303\241mm\303\241"
+    "rfeastaichikawamisatois-a-anarchistis-a-bruinsfanis-a-bulls-fanis-a"
+    "-candidateis-a-nascarfanis-a-socialistis-a-therapistis-an-engineerj"
+    "cloud-ver-jpckerrylogisticskitanakagusukukunstunddesignlinkyard-clo"
+    "udmediocampidanomidtre-gauldalminamiashigaranaamesjevuemienativeame"
+    "ricannaturbruksgymnondigitaloceanpublic-inquirypythonanywherereggio"
+    "calabriareserve-onlineschulplattformsciencecenterssciencehistorysel"
+    "ls-for-lessserveminecraftsoundandvisiontrentinoaadigetrentinostirol"
+    "vallee-d-aosteweatherchannelwebview-assetswritesthisblogxn--54b7fta"
+    "0ccxn--6qq986b3xlxn--80aaa0cvacxn--80aqecdr1axn--9dbhblg6dixn--b4w6"
+    "05ferdxn--bjarky-fyaxn--bjddar-ptaxn--brnny-wuacxn--d5qv7z876cxn--d"
+    "jrs72d6uyxn--fiq228c5hsxn--h2breg3evexn--indery-fyaxn--jlq480n2rgxn"
+    "--jlster-byaxn--kfjord-iuaxn--krager-gyaxn--kvitsy-fyaxn--lesund-hu"
+    "axn--merker-kuaxn--mgba3a3ejtxn--mgba3a4fraxn--mgbaam7a8hxn--mgbayh"
+    "7gpaxn--mgbbh1a71exn--mgbca7dzdoxn--mgbi4ecexpxn--mgbx4cd0abxn--mls"
+    "elv-iuaxn--moreke-juaxn--mosjen-eyaxn--ntso0iqx3axn--ostery-fyaxn--"
+    "rmskog-byaxn--rvc1e0am3exn--ryrvik-byaxn--skierv-utaxn--srfold-byax"
+    "n--stfold-9xaxn--unjrga-rtaxn--vgsy-qoa0jxn--vrggt-xqadyamatokoriya"
+    "ma\303\270ystre-slidre\320\272\320\260\321\202\320\276\320\273\320\270"
+    "\320\272\327\231\327\250\327\225\327\251\327\234\327\231\327\235\330"
+    "\247\330\252\330\265\330\247\331\204\330\247\330\252\330\247\331\204"
+    "\330\250\330\255\330\261\331\212\331\206\330\247\331\204\330\254\330"
+    "\262\330\247\330\246\330\261\330\247\331\204\330\271\331\204\331\212"
+    "\330\247\331\206\331\203\330\247\330\253\331\210\331\204\331\212\331"
+    "\203\331\276\330\247\331\203\330\263\330\252\330\247\331\206\331\276"
+    "\330\247\332\251\330\263\330\252\330\247\331\206123hjemmesideadobea"
+    "emcloudairkitapps-auaizuwakamatsuartsandcraftsascoli-picenoassassin"
+    "ationatlassian-devazurewebsitesbeeldengeluidbotanicgardenbr\303\270"
+    "nn\303\270ysundbuiltwithdarkb\303\241hccavuotnacaltanissettacampina"
+    "grandecarrara-massacertificationcesena-forl\303\254chesapeakebayciv"
+    "ilaviationcloudplatformcloudyclustercommunity-prodellogliastradevcd"
+    "naccessodielddanuorridivttasvuotnadyndns-officedyndns-remotedyndns-"
+    "serveremiliaromagnaendofinternetentertainmentest-le-patronfantasyle"
+    "aguefarmequipmentfedoraprojectforl\303\254-cesenafriulivgiuliafutur"
+    "ehostingfuturemailinggiehtavuoatnagithubpreviewguovdageaidnuhere-fo"
+    "r-morehigashikagawahigashikagurahigashikurumehigashinarusehigashiya"
+    "matoimageandsoundinternationalis-a-democratis-a-designeris-a-musici"
+    "anis-a-rockstaris-an-actressis-into-animeis-into-gamesis-very-sweet"
+    "isa-hockeynutkawachinaganokisofukushimakitahiroshimakunstsammlungk\303"
+    "\241r\303\241\305\241johkalifeinsurancelinodeobjectslpusercontentma"
+    "ssa-carraramatta-varjjatminamiechizenminamisanrikumonza-brianzamonz"
+    "aebrianzamyhome-servermythic-beastsnachikatsuuranieruchomoscinore-o"
+    "g-uvdaloamishirasatooceanographicoffice-on-theosakikamijimaoystre-s"
+    "lidrepesaro-urbinoplurinacionalreggio-emiliarikuzentakatar\303\241h"
+    "kker\303\241vjus3-ap-south-1s3-external-1sandnessj\303\270ensatsuma"
+    "sendaiscrapper-sitesellsyourhomeserveexchangeservehalflifeshichikas"
+    "hukushimokitayamashinyoshitomiskedsmokorsetsmartlabelingsouthcaroli"
+    "naspace-to-rentstatic-accesss\303\270r-varangerthingdustdatatraeumt"
+    "geradetravelchanneltrycloudflareunusualpersonurbino-pesarovalle-d-a"
+    "ostavall\303\251e-aostevall\303\251edaostevestre-slidrevibo-valenti"
+    "avirtualserverwatchandclockweeklylotterywellbeingzonewolterskluwerx"
+    "n--0trq7p7nnxn--12c1fe0brxn--4dbgdty6cxn--avery-yuaxn--bidr-5nacxn-"
+    "-bievt-0qaxn--cckwcxetdxn--drbak-wuaxn--eckvdtc9dxn--finny-yuaxn--f"
+    "jord-lraxn--fpcrj9c3dxn--fzc2c9e2cxn--gjvik-wuaxn--h2brj9c8cxn--h3c"
+    "uzk1dixn--hbmer-xqaxn--hpmir-xqaxn--karmy-yuaxn--ksnes-uuaxn--lgrd-"
+    "poacxn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn--msy-ula"
+    "0hxn--muost-0qaxn--nry-yla5gxn--osyro-wuaxn--rholt-mraxn--rland-uua"
+    "xn--rskog-uuaxn--ryken-vuaxn--sandy-yuaxn--seral-lraxn--sknit-yqaxn"
+    "--snase-nraxn--tiq49xqyjxn--trany-yuaxn--troms-zuaxn--tysvr-vraxn--"
+    "vry-yla5gxn--yfro4i67oxn--ygbi2ammx123paginawebanthropologyaosta-va"
+    "lleyarchitectureartanddesignarteducationascolipicenoat-band-campaut"
+    "hgearappsazure-mobilebackplaneappbahccavuotnabearalv\303\241hkiblac"
+    "kbaudcdnb\303\241hcavuotnacarraramassacdn77-securecesena-forlicesen"
+    "aforl\303\254championshipchiropracticcivilisationcivilizationclicke"
+    "tcloudconstructioncustomer-ocidavvenj\303\241rgadeno-stagingdivtasv"
+    "uodnadreamhostersencyclopedicfashionstorefedorapeopleflynnhostingfo"
+    "lionetworkforli-cesenaforl\303\254cesenafortmissoulaframercanvasfra"
+    "nziskanergentlentapisg\303\241\305\213gaviikaham-radio-ophamatonbet"
+    "suhammarfeastahattfjelldalhigashiizumohigashiosakahigashitsunohitac"
+    "hiomiyahostyhostinghs-heilbronnillustrationilovecollegeimpertrixcdn"
+    "indianapolisindianmarketinstantcloudintelligenceinternet-dnsis-a-bl"
+    "oggeris-a-catereris-a-liberalis-a-painteris-a-patsfanis-a-studentis"
+    "-a-teacheris-an-artistis-certifiedis-into-carsis-very-evilis-very-g"
+    "oodis-very-niceitcouldbeworjelenia-gorajinsekikogenkakamigaharakami"
+    "kitayamakamisunagawakhmelnitskiykhmelnytskyikitashiobarakomatsushim"
+    "akristiansandkristiansundkrokstadelvakuromatsunailaakesvuemielcube-"
+    "serverlea\305\213gaviikalocalhistorylplfinancialmassacarraraminamif"
+    "uranominamiminowaminamiuonumamonzabrianzamuseumcentermyshopblocksmy"
+    "spreadshopm\303\241latvuopminakasatsunainakatombetsunasushiobaranes"
+    "oddtangennewhampshirenishiawakuranishikatsuranishinoomotenishinoshi"
+    "manodebalancernordeste-idcolbia-tempioonflashdrivepagefrontapppanth"
+    "eonsitepesarourbinopostman-echoprequalifymepreservationpublishproxy"
+    "quickconnectquipelementsrag-cloud-chreggioemiliaregruhostingresinst"
+    "agingriodejaneiros3-eu-west-1s3-eu-west-2s3-eu-west-3s3-sa-east-1s3"
+    "-us-east-2s3-us-west-1s3-us-west-2salvadordalisandnessjoensanfranci"
+    "scosantabarbarasaskatchewanschlesischesscholarshipsservesarcasmshin"
+    "anomachishinkamigotoshinshinotsusor-varangerspeedpartnerstalowa-wol"
+    "astarachowicestpetersburgstreamlitappstuff-4-salesurgeonshalls\303\270"
+    "ndre-landteaches-yogatempio-olbiatondabayashitrendhostingtry-snowpl"
+    "owtsurugashimaurbinopesarovalle-daostavalled-aostavallee-aostevalle"
+    "edaostevall\303\251eaosteversicherungvestre-totenvibovalentiavirtua"
+    "l-uservirtualcloudvultrobjectswashingtondcwoltlab-demoworkinggroupw"
+    "orkisboringwphostedmailxn--3e0b707exn--45br5cylxn--4dbrk0cexn--7t0a"
+    "264cxn--80adxhksxn--80asehdbxn--8y0a063axn--andy-iraxn--asky-iraxn-"
+    "-blt-elabxn--bmlo-graxn--brum-voaxn--dnna-graxn--dyry-iraxn--flor-j"
+    "raxn--frde-graxn--frna-woaxn--frya-hraxn--gckr3f0fxn--gls-elacxn--h"
+    "ery-iraxn--hobl-iraxn--klbu-woaxn--lten-graxn--lury-iraxn--m3ch0j3a"
+    "xn--mely-iraxn--mgb2ddesxn--mgb9awbfxn--mgbab2bdxn--mgbgu82axn--mgb"
+    "pl2fhxn--mgbt3dhdxn--mgbtf8flxn--mk1bu44cxn--mori-qsaxn--ngbc5azdxn"
+    "--ngbe9e0axn--ogbpf8flxn--qcka1pmcxn--rady-iraxn--rdal-poaxn--rdy-0"
+    "nabxn--risa-5naxn--risr-iraxn--rros-graxn--rsta-fraxn--sgne-graxn--"
+    "skjk-soaxn--slat-5naxn--slt-elabxn--smla-hraxn--smna-graxn--snes-po"
+    "axn--snsa-roaxn--srum-graxn--tjme-hraxn--trna-woaxn--vads-jraxn--va"
+    "rd-jraxn--vgan-qoaxn--vler-qoaxn--zf0ao64ayamatotakadazaporizhzhia\303"
+    "\241k\305\213oluokta\303\270stre-toten\304\215\303\241hcesuolo\320\274"
+    "\320\276\321\201\320\272\320\262\320\260\320\276\320\275\320\273\320"
+    "\260\320\271\320\275\321\201\320\260\320\274\320\260\321\200\320\260"
+    "\327\220\327\247\327\223\327\236\327\231\327\224\330\247\330\250\331"
+    "\210\330\270\330\250\331\212\330\247\330\261\330\247\331\205\331\203"
+    "\331\210\330\247\331\204\330\247\330\261\330\257\331\206\330\247\331"
+    "\204\331\205\330\272\330\261\330\250\330\247\331\205\330\247\330\261"
+    "\330\247\330\252\331\201\331\204\330\263\330\267\331\212\331\206\331"
+    "\205\331\204\331\212\330\263\331\212\330\247\340\246\255\340\246\276"
+    "\340\246\260\340\246\244\340\246\255\340\246\276\340\247\260\340\246"
+    "\244\340\250\255\340\250\276\340\250\260\340\250\244\340\252\255\340"
+    "\252\276\340\252\260\340\252\244\340\254\255\340\254\276\340\254\260"
+    "\340\254\244\340\262\255\340\262\276\340\262\260\340\262\244\340\266"
+    "\275\340\266\202\340\266\232\340\267\217\340\270\227\340\270\253\340"
+    "\270\262\340\270\243\340\271\200\340\270\231\340\271\207\340\270\225"
+    "\343\202\242\343\203\236\343\202\276\343\203\263\343\202\257\343\203"
+    "\251\343\202\246\343\203\211\343\202\260\343\203\274\343\202\260\343"
+    "\203\253\343\203\235\343\202\244\343\203\263\343\203\210\347\273\204"
+    "\347\273\207\346\234\272\346\236\204\351\233\273\350\250\212\347\233"
+    "\210\347\247\221\351\246\231\346\240\274\351\207\214\346\213\211123"
+    "homepage123kotisivu123webseiteaccountantsactivetrailagricultureales"
+    "sandriaamericanartaostavalleyarchaeologyarchitectesarkhangelskbahca"
+    "vuotnabanzaicloudbarclaycardbarsycenterbarsyonlinebasicserverbeagle"
+    "boardbearalvahkibetter-thanblackfridayblockbusterboleslawiecbounty-"
+    "fullbridgestonebronnoysundbungotakadab\303\245d\303\245ddj\303\245c"
+    "able-modemcalvinkleincesenaforlichannelsdvrchattanoogachippubetsucl"
+    "ickrisingcloudaccesscontractorscooperativacorporationcreditunioncry"
+    "ptonomicdavvenjargadelmenhorstdev-builderdevelopmentdiscordsaysditc"
+    "hyouripdoesntexistdynamic-dnsdyndns-blogdyndns-freedyndns-homedyndn"
+    "s-maildyndns-picsdyndns-wikidyndns-workedgecomputeeducationalengine"
+    "eringenterpriseseven\303\241\305\241\305\241ifastly-edgefh-muenster"
+    "filegear-aufilegear-defilegear-gbfilegear-iefilegear-jpfilegear-sgf"
+    "irebaseappflekkefjordfoodnetworkforgeblocksfredrikstadfreedesktopfr"
+    "eemasonryfujiyoshidafukuchiyamagame-servergemologicalgotpantheongra"
+    "ndrapidshachirogatahandcraftedhangglidinghatsukaichihigashikawahita"
+    "chinakaholmestrandh\303\246gebostadin-the-bandinteractiveinvestment"
+    "sis-a-doctoris-a-hunteris-a-knightis-a-lawyeris-a-playeris-a-soxfan"
+    "is-a-techieis-an-actoris-uberleetis-very-badiservschulejudygarlandk"
+    "amiamakusakamishihorokashiwazakikasumigaurakazteleportkerryhotelskn"
+    "ightpointkongsvingerkr\303\270dsheradlamborghiniland-4-saleleangavi"
+    "ikalewismillerlillehammermagentositemaintenancemalatvuopmimassivegr"
+    "idmesswithdnsmetacentrummidatlanticminami-alpsminamiawajiminamidait"
+    "ominamiogunimisconfusedmotorcyclesmozilla-iotmy-firewallnakaniikawa"
+    "nakatsugawanedre-eikernishinomiyanishiokoppenoboribetsunord-aurdaln"
+    "ordre-landnospamproxynozawaonsenolayangroupolbiatempioomihachimanor"
+    "angecloudoregontrailosakasayamaostre-totenownproviderpalmspringspar"
+    "achutingparaglidingpharmaciensphotographyplanetariumplatter-apppriv"
+    "atelinkproductionsprofesionalprogressivequalifioappraffleentryrahkk"
+    "eravjureadthedocsredumbrellaresindevicerishirifujisakaiminatosaober"
+    "nardosaveincloudschoenbrunnschokoladenschulserversells-for-uservehu"
+    "mourshiftcryptoshijonawateshikokuchuoshimonosekishizukuishisondre-l"
+    "andstg-builderstor-elvdalstufftoreadsweetpepperswinoujsciesynology-"
+    "dss\303\270r-aurdaltamatsukuritatebayashitempioolbiatimekeepingtosa"
+    "shimizutrafficplextselinogradtvedestrandval-d-aostavalle-aostavalle"
+    "daostavalleeaostevestv\303\245g\303\270yveterinairevirtualuservladi"
+    "kavkazvolkenkundevossevangenwebredirectwilliamhillwithyoutubexn--11"
+    "b4c3dxn--1ck2e1bxn--1lqs03nxn--1lqs71dxn--1qqw23axn--2m4a15exn--2sc"
+    "rj9cxn--32vp30hxn--3bst00mxn--3ds443gxn--3hcrj9cxn--42c2d9axn--45br"
+    "j9cxn--4it168dxn--4it797kxn--55qw42gxn--5dbhl8dxn--5js045dxn--5rtp4"
+    "9cxn--5rtq34kxn--6frz82gxn--80ao21axn--8ltr62kxn--9krt00axn--bod-2n"
+    "axn--cck2b3bxn--czr694bxn--czrw28bxn--d1acj3bxn--efvy88hxn--ehqz56n"
+    "xn--elqq16hxn--f6qx53axn--fct429kxn--fjq720axn--flw351exn--g2xx48cx"
+    "n--gecrj9cxn--gk3at1exn--gmq050ixn--hebda8bxn--hxt814exn--imr513nxn"
+    "--j1ael8bxn--j6w193gxn--jvr189mxn--k7yn95exn--klt787dxn--kprw13dxn-"
+    "-kpry57dxn--lcvr32dxn--lns-qlaxn--lt-liacxn--mgbtx2bxn--mix082fxn--"
+    "mix891fxn--mkru45ixn--mli-tlaxn--mot-tlaxn--nit225kxn--nnx388axn--n"
+    "tsq17gxn--nyqy26axn--o3cyx2axn--od0aq3bxn--otu796dxn--pgbs0dhxn--ps"
+    "su33lxn--q9jyb4cxn--qqqt11mxn--rde-ulaxn--rhqv96gxn--rovu88bxn--rst"
+    "-0naxn--s9brj9cxn--ses554gxn--t60b56axn--tor131oxn--uc0ay4axn--uist"
+    "22hxn--uuwu58axn--vg-yiabxn--vgu402cxn--vuq861bxn--w4rs40lxn--wcvs2"
+    "2dxn--xhq521bxn--yer-znaxn--zbx025dxn--zfr164byandexcloudyoshinogar"
+    "izaporizhzhe\303\270vre-eiker123minsida123siteweb123website3utiliti"
+    "esaf-south-1airtrafficaivencloudaizumisatoaknoluoktaaktyubinskalter"
+    "vistaalwaysdataamscomputeapartmentsartgalleryassociatesautomotiveaz"
+    "erbaijanbabia-gorabalestrandballooningbasilicatabasketballbeebyteap"
+    "pbetainaboxbialowiezabieszczadybirthplacebnpparibasboehringerbookon"
+    "linebrumunddalbuyshousesb\303\245tsfjordcahcesuolocaliforniacampoba"
+    "ssocanva-appscapebretoncapitalonecartoonartcheltenhamchernivtsicher"
+    "novtsychikushinocincinnaticiscofreakclerkstagecleverappscloudfrontc"
+    "loudjiffycn-north-1collectioncollegefanconferenceconsultantconsulti"
+    "ngcopenhagencreditcardcuisinelladamnserverdatacenterdatadetectdatto"
+    "localdattorelaydavvesiidademocraciadiscordsezdnsiskinkydnsupdaterdy"
+    "n-berlindyn-o-saurdyndns-webeastafricaeero-stageelvendrellembroider"
+    "yentomologyeu-north-1eu-south-1eurovisionexhibitionextraspacefastst"
+    "acksfederationfor-betterfoundationfreebox-osfrenchkissfujinomiyafyl"
+    "kesbiblgangaviikageekgalaxygildesk\303\245lgirlfriendgoogleapisgoog"
+    "lecodegovernmentgroks-thisg\303\241ivuotnahagebostadhalloffamehamme"
+    "rfesthanamigawahasura-apphealthcarehigashiomihigashiurahitachiotahj"
+    "elmelandhobby-sitehomeofficehumanitiesh\303\270ylandetichinomiyaich"
+    "inosekiiliadboxosimmobilieninawashiroindustriesis-a-greenis-a-llama"
+    "is-a-nurseishinomakiisteingeekjenv-arubajournalismjournalistjuedisc"
+    "hesj\303\270rpelandkagamiishikamifuranokaminokawakaminoyamakanegasa"
+    "kikarasjohkakarasuyamakatsushikakautokeinokawaiishopkawaminamikeyma"
+    "chinekirovogradkitakyushuknowsitallknx-serverkobierzycekoebenhavnko"
+    "nskowolakouzushimakrodsheradkr\303\245anghkekuchinotsukvinnheradkv\303"
+    "\246nangenlancashirelayershiftlebtimnetzleitungsenlikescandylittles"
+    "tarlolitapunklosangelesloseyouripluxembourgl\303\270renskogmakinoha"
+    "ramakurazakimalopolskamamurogawamanagementmanchestermangyshlakmaryl"
+    "hurstmasfjordenmatsubushimatsushigeme-south-1mein-iservmein-vigormi"
+    "crolightminamiaikiminamibosominamimakiminamitaneminiservermitsubish"
+    "imiyakonojomj\303\270ndalenmo-siemensmonticellomovimientomy-gateway"
+    "myfirewallnaganoharanagaokakyonagareyamanakadomarinamdalseidnamerik"
+    "awanamsskogannavigationnet-freaksnextdirectnishiaritaniyodogawanort"
+    "hflanknoticeablen\303\270tter\303\270yokinoshimaomasvuotnaon-aptibl"
+    "eon-rancheron-the-webopensocialoperauniteostrowwlkpovre-eikerowaria"
+    "sahiparliamentpittsburghplantationplatformshpoint2thispors\303\241\305"
+    "\213guportlligatprochowiceprotectionprudentialpyatigorskquicksytesr"
+    "ead-booksreadmyblogrealestaterecreationredirectmeresistancerestaura"
+    "ntrotorcraftsagamiharasaintlouissakuragawasandefjordsantamariasanto"
+    "andresavannahgascaleforceschaefflerschokokekssebastopolsekigaharase"
+    "nseeringsensiositeservequakesettlementsevastopolsherbrookeshichinoh"
+    "eshimotsukeshimotsumashopitsiteshopselectsimple-urlsimplesiteskygea"
+    "rappsnillfjordsor-aurdalspjelkaviksteiermarkswiebodzintabitordertai"
+    "fun-dnstakanezawatakarazukatarnobrzegtatamotorstawaramototb-hosting"
+    "technologytecnologiatelevisiontest-iservtokorozawatomigusukutorproj"
+    "ecttranslatedtransporteullensakerullensvanguniversityusantiquesutsu"
+    "nomiyaval-daostavald-aostavalleaostavaporcloudveg\303\245rsheiversa"
+    "illesvindafjordvipsinaappvlaanderenvolkswagenwafaicloudwafflecellwe"
+    "bhostingwesteuropewithgoogleworse-thanwpdevcloudxn--30rr7yxn--3pxu8"
+    "kxn--45q11cxn--4gbrimxn--55qx5dxn--5tzm5gxn--6btw5axn--6orx2rxn--80"
+    "aswgxn--8dbq2axn--8pvr4uxn--90a1afxn--90a3acxn--9dbq2axn--9et52uxn-"
+    "-c2br7gxn--c3s14mxn--cg4bkixn--czrs0txn--czru2dxn--djty4kxn--efvn9s"
+    "xn--fiq64bxn--fiqs8sxn--fiqz9sxn--fl-ziaxn--gmqw5axn--h1aeghxn--h1a"
+    "lizxn--io0a7ixn--kbrq7oxn--kltp7dxn--kltx9axn--klty5xxn--kput3ixn--"
+    "mk0axixn--mxtq1mxn--o3cw4hxn--od0algxn--pssy2uxn--q7ce6axn--rht27zx"
+    "n--rht61exn--rny31hxn--uc0atvxn--uisz3gxn--unup4yxn--wgbh1cxn--wgbl"
+    "6axn--y9a3aqxn--zf0avxyamanakakoyamanouchiyatsushiroyawatahamayokai"
+    "chibayotsukaidozoological\303\241laheadju\327\231\327\251\327\250\327"
+    "\220\327\234\330\247\331\204\331\212\331\205\331\206\330\247\331\212"
+    "\330\261\330\247\331\206\330\247\333\214\330\261\330\247\331\206\330"
+    "\250\330\247\330\262\330\247\330\261\330\250\332\276\330\247\330\261"
+    "\330\252\330\263\331\210\330\257\330\247\331\206\330\263\331\210\330"
+    "\261\331\212\330\247\330\263\331\210\330\261\331\212\330\251\331\207"
+    "\331\205\330\261\330\247\331\207accentureaccesscamaerobaticaerodrom"
+    "eagrigentoaizubangealaheadjualfaromeoallfinanzalstahaugamagasakiama"
+    "zonawsambulanceamsterdamamusementanalyticsandasuoloann-arborannefra"
+    "nkaogashimaap-east-1aparecidaappengineaquarellearboretumaridagawaar"
+    "tcenterasahikawaasaminamiashibetsuastronomyaudnedalnaustevollaustra"
+    "liaaustrheima\303\251roportbackyardsballangenbalsfjordbaltimorebarc"
+    "elonabaremetalbashkiriabatsfjordbeauxartsbeneventoberlev\303\245gbi"
+    "alystokbitbridgebitbucketbjerkreimbloombergboyfriendbremangerbroadc"
+    "astbruxellesbydgoszczcambridgecatanzarocdn-edgescdn77-sslcentralusc"
+    "hambagricherkassychernigovchernihivchigasakichikuhokuchocolatechris"
+    "tmascloud-fr1cloudappscloudletscloudsitecompute-1consuladocranbrook"
+    "developerdiscoursediscoverydlugolekadontexistdrangedaldualstackdyna"
+    "thomedyndns-ipeastcoasteasypaneledgestackeigersundeisenbahnelemento"
+    "rembaixadaemergencyencoreapiethnologyfairwindsfarmsteadfilateliafir"
+    "estoneflatangerfolkebiblforgerockfortworthfrancaisefrankfurtfreebox"
+    "osfreseniusfrontdoorfrosinoneftpaccessfujiiderafujishirofukumitsufu"
+    "nabashifunahashifunkfeuerfurniturefuturecmsgaivuotnagame-hostgeelvi"
+    "nckgildeskalgit-pagesgit-reposgoldpointgratangengroks-thegushikamig"
+    "yeongbukgyeongnamhachinohehamamatsuhashikamihashimotohaugesundhayas"
+    "himaherokuappherokusslhigashinehimeshimahiraizumihiratsukahisamitsu"
+    "holt\303\245lenhomebuilthomedepothomegoodshomelinuxhomesensehomeskl"
+    "ephordalandhornindalhorokanaihoylandethyllestadh\303\244kkinenh\303"
+    "\270nefossh\303\270yangeriamallamaik-serverin-berlinin-butterindust"
+    "riainstancesinstituteis-a-chefis-a-geekis-a-guruisleofmanitayanagii"
+    "wamizawaizumiotsuizumisanoizumizakiizumozakiizunokunijan-mayenjdevc"
+    "loudjeffersonjellybeanjerusalemjewishartjoinvillejorpelandkagoshima"
+    "kamiizumikamikoanikamitondakaragandakarikaturkaruizawakasamatsukash"
+    "iharakashiwarakasserverkatashinakatsuragikatsuyamakawanehonkawanish"
+    "ikhakassiakicks-asskilatironkimobetsukishiwadakitaakitakitadaitokob"
+    "ayashikokubunjikolobrzegkongsbergkoshigayakoshimizukraanghkekrasnod"
+    "arkudamatsukumakogenkunitachikuokgroupkurashikikushimotokvanangenkv"
+    "inesdalkviteseidkv\303\246fjordkyotanabel-o-g-i-nla-spezialancaster"
+    "landroverlangev\303\245gleadpagesleikangerleirfjordlifestylelikes-p"
+    "ielillesandlima-citylindesneslocalcertlocalhostlocalzoneloginlinelo"
+    "lipopmclombardialorenskogl\303\270dingenmarketingmarnardalmarshalls"
+    "matsubaramatsukawamatsumotomatsusakamatsuzakimediatechmeinforummelb"
+    "ournemesaverdemeteorappmicrosoftmigrationminamiiseminamiizuminnesot"
+    "amiyashiromjondalenmo-i-ranamochizukimodellingmongolianmoonscalemor"
+    "iguchimorimachimoriyoshimorotsukamusashinomutsuzawamy-routermyasust"
+    "ormydissentmymediapcmyshopifynakamichinannestadnarashinonewjerseyne"
+    "wmexiconewspapernishiaizunishiazainishiharanishikatanishikawanishim"
+    "eranishitosanishiwakinord-fronnord-odalnordreisan\303\241vuotnaoban"
+    "azawaogasawaraonavstackonfabricaonthewifiopencraftoppeg\303\245rdos"
+    "trolekaostrowiecotoineppuoverhallaoyamazakipaderbornpanasonicpassag"
+    "ensperspectaphilatelyplatform0polkowicepomorskieponiatowapordenonep"
+    "orsangerporsgrunnpramericaprzeworskrakkestadrandabergreadymaderenne"
+    "s\303\270yretrosnubrichardlirikubetsuringerikeringsakerriobrancoroc"
+    "hesterryugasakir\303\246lingensamnangersanagochisantacruzsarpsborgs"
+    "arufutsuscalebookschoolbusscientistscrappingseranishiservebeerserve"
+    "blogservegameservehttpservepicsshangrilashibukawashifteditshimabara"
+    "shimamakishimamotoshimodateshimofusashimoichishimokawashimonitashim"
+    "osuwashinagawashinonsenshinshiroshirahamashiranukashiratakashiriuch"
+    "ishiroishishirosatoshishikuishoparenaskjerv\303\270yskydivingsk\303"
+    "\245nlandsmall-websnowflakesodegaurasongdalensosnowiecsoundcastsout"
+    "hwestspydebergstarnbergstarostwostatebankstatefarmstathellestavange"
+    "rsteinkjerstockholmstorebasestorfjordstuttgartsupersalesvn-repossyk"
+    "kylvens\303\270r-frons\303\270r-odals\303\270rreisatachiaraitachika"
+    "watailscaletakahashitakamatsutakashimatakatsukitateshinateshikagath"
+    "eworkpctjeldsundtobishimatogakushitogliattitokamachitokashikitokush"
+    "imatomakomaitoolforgetoyohashitrondheimtr\303\270gstadtsuchiuratsuk"
+    "igatatsukiyonoturystykatuxfamilytypedreamt\303\270nsberguberspaceuj"
+    "itawarauscultureushistoryutashinaivacationsvaldaostavegarsheivestva"
+    "goyvevelstadvinnytsiavoorloperv\303\241rgg\303\241twalbrzychwashten"
+    "awwebthingswestfalenwhitesnowwloclawekwodzislawxn--1ctwoxn--4pvxsxn"
+    "--90aisxn--90amcxn--90azhxn--b-5gaxn--c1avgxn--ciqpnxn--d1alfxn--e1"
+    "a4cxn--fhbeixn--h-2faxn--h1ahnxn--j1adpxn--j1aefxn--j1amhxn--l-1fax"
+    "n--l1accxn--ngbrxxn--o1achxn--p1acfxn--qxa6axn--rht3dxn--s-1faxn--t"
+    "ckwexn--tn0agxn--vhquvyachimatayamaguchiyamanashiyamashinayamatsuri"
+    "yodobashiyokkaichiyorkshireyoshikawayukuhashiyurihonjozachpomorzgor"
+    "zelec\303\245krehamn\303\270ygarden\340\244\225\340\245\211\340\244"
+    "\256\340\244\250\340\245\207\340\244\237\340\270\204\340\270\255\340"
+    "\270\241\340\271\204\340\270\227\340\270\242\340\272\245\340\272\262"
+    "\340\272\247\343\201\277\343\202\223\343\201\252\343\202\271\343\203"
+    "\210\343\202\242\343\202\273\343\203\274\343\203\253\344\270\255\346"
+    "\226\207\347\275\221\344\272\232\351\251\254\351\200\212\345\214\227"
+    "\346\265\267\351\201\223\345\222\214\346\255\214\345\261\261\345\244"
+    "\251\344\270\273\346\225\231\346\210\221\347\210\261\344\275\240\346"
+    "\226\260\345\212\240\345\235\241\346\267\241\351\251\254\351\224\241"
+    "\347\245\236\345\245\210\345\267\235\351\243\236\345\210\251\346\265"
+    "\246\351\271\277\345\205\220\345\263\266123miwebaarborteabashiriabk"
+    "haziaabudhabiacademiaaeroclubaeroportagematsuaircraftairforceairgua"
+    "rdakershusakrehamnallstateappchiziapplinziaquariumasakuchiashgabada"
+    "smatartattorneyaugustowautocodeavellinobabybluebabymilkbackdropbada"
+    "ddjabalashovbarclaysbarefootbargainsbaseballbellevueberkeleyberleva"
+    "gbiratoribirkenesbjark\303\270yblogsiteblogspotblogsytebluebiteboav"
+    "istabouncemeboutiquebradescobrasiliabrindisibroadwaybroke-itbrussel"
+    "sbuildingbungoonobusinessbuskerudbytemarkb\303\241id\303\241rb\303\241"
+    "jddarcadaquescagliaricampaigncampaniacampinascandypopcapetowncateri"
+    "ngcatholiccherkasychicappachikuseichikuzenchilloutchimkentchungbukc"
+    "hungnamciprianicityeatscivilwarcleaningcliniqueclothingclouderacode"
+    "bergcodespotcolumbuscommbankcontagemcoolblogcorvettecraftingcuritib"
+    "acutegirldagestandappnodedatabasedattowebddnsfreeddnsgeekddnskingdd"
+    "nslivedefinimadeliverydeloittediamondsdinosaurdiscountdnsaliasdnstr"
+    "acedonostiadownloaddray-dnsdrayddnsdyn-ip24dynaliaseastasiaecologia"
+    "economiaeducatoregersundegyptianeidfjordeidsbergeidsvollengerdalens"
+    "caledepilepsyericssonetisalatevenassievennodefamilydsfastlylbfeedba"
+    "ckfentigerfeste-ipfidelityfigueresfineartsfirmdaleflakstadflandersf"
+    "lesbergflorencefootballfor-somefr-par-1fr-par-2freemyipfreesitefrei"
+    "burgfribourgfrontierfujiminofujisatofujisawafukagawafukudomifukusak"
+    "ifukuyamafunagatafundaciofurubirafurudonofurukawafyresdalgamagorige"
+    "ntappsgjerdrumgjerstadgoodyeargraingergraphicsgrimstadgrossetoguard"
+    "ianguernseygyeonggihabikinohachiojihakodatehamatamahanamakihashbang"
+    "hatogayahatoyamahayakawahdfcbankhelsinkihemsedalhepforgehinoharahir"
+    "akatahirogawahirokawahirosakihisayamahistoirehjartdalhokkaidohokksu"
+    "ndholdingsholtalenhomelinkhomeunixhonbetsuhonefosshorologyhoronobeh"
+    "ospitalhostedpihoyangerichiharainashikiinatsukiinder\303\270yindige"
+    "nainfinitiingatlanipirangais-a-cpais-foundis-savedis-slickisa-geeki"
+    "shigakiishikariistanbulitabashiitoigawaiwaizumiiwatsukijaworznojela"
+    "sticjessheimjevnakerjls-sto1jls-sto2jls-sto3jotelulujpmorganj\303\270"
+    "lsterkadogawakagaminokakegawakakinokikakogawakalmykiakamagayakamais"
+    "hikamakurakameyamakamigorikamiichikamikawakamiminekamisatokamitsuek"
+    "amoenaikamogawakanagawakanazawakaneyamakarasjokkasaharakasukabekata"
+    "gamikatowicekawaharakawajimakawakitakawamatakawanabekawasakikawatan"
+    "akembuchikibichuokikirarakikugawakinghostkinokawakirkeneskisarazuki"
+    "sosakikitaaikikitagatakitagawakitahatakitakamikitakatakitamotokiyok"
+    "awakiyosatokomaganekonsulatkonyvelokopervikkotohirakozagawakrager\303"
+    "\270krellianktistorykudoyamakujukurikuleuvenkumagayakumamotokumator"
+    "ikumejimakumiyamakunigamikunisakikunitomikunneppukuriyamakuroishiku"
+    "rotakikustanaikuzumakikvafjordkvalsundkvits\303\270ykyotambakyotang"
+    "ok\303\245fjordlangevaglaspezialavangenlclstagelevangerlightinglima"
+    "nowalodingenlombardylondrinalovesickloyalistlubartowlundbeckmacerat"
+    "amaebashimagazinemallorcamansionsmaritimemaritimomarriottmarugamema"
+    "rumorimarylandmaseratimatsumaematsuuramayfirstmazeplaymazowszemckin"
+    "seymedicinamemorialmerckmsdmerseinemer\303\245kermesserlimichiganmi"
+    "litaryminakamiminamataminisiteminokamomircloudmiyawakamiyazakimizum"
+    "akimizunamimizusawamombetsumonmouthmontrealmordoviamoriyamamoroyama"
+    "mortgagemoseushimosj\303\270enmoskenesmotoyamamo\303\245rekemuenche"
+    "nmulhousemunakatamurakamimurmanskmy-vigormydobissmyeffectmyiphostmy"
+    "kolaivmymailermyphotosmytuleapm\303\245lselvnagahamanagasakinagator"
+    "onakagawanakamuranakanojonakanotonakatanenakayamanamegatanamegawana"
+    "mikatanaoshimanarusawanarviikanaumburgnaustdalnavuotnaneat-urlnebra"
+    "skanesoddenneyagawanichinanniikappunikolaevninomiyanirasakinishiizu"
+    "nissedalnittedalnl-ams-1nonoichinordkappnordlandnosegawanotairesnot"
+    "iciasnotoddennotogawanotteroynovecorenowarudaobserverofficialohtawa"
+    "raokuizumoomaezakion-acornonomichionporteronrenderoppegardoristanoo"
+    "rkangerortsinfooster\303\270yoygardenparallelparasitepasadenapaywhi"
+    "rlpharmacypiacenzapicturespiedmontpiemontepimientapixolinoplatterpp"
+    "lumbingpodlasiepokrovskpoliticaporsanguportlandpresidioprimetelprin"
+    "cipepropertyprotonetpruszkowpussycatrackmazerailroadraindropralinge"
+    "nrankoshirawa-mazredstonerelianceremotewdrendalenrennesoyresearchri"
+    "beiraoriopretorokunoher\303\270mskogr\303\270yrviksaarlandsakahogis"
+    "akegawasalangensalzburgsamegawasamsclubsamukawasandcatssandiegosaog"
+    "oncasardegnasardiniasasagurisasayamasauheradscotlandsdscloudsekikaw"
+    "asells-itservebbsserveftpserveircservemp3servep2pservicessetagayase"
+    "touchisettlersshacknetshakotanshibechashinichishinjukushintokushint"
+    "omishiogamashiojirishiraokashizuokashoppingshopwareshowtimesiracusa"
+    "siteleafskanlandskierv\303\241skiptvetskjervoysmushcdnsoftbanksoftw"
+    "aresor-fronsor-odalsorocabasorreisasortlandspacekitspectrumstalbans"
+    "stargardstcgroupstgstagestrippersuginamisukagawasunnydaysupabasesup"
+    "pliessurnadalsvalbardsvizzeraswidnicasyncloudszczecinszczytnos\303\270"
+    "rfoldt3l3p0rttabayamatakahagitakahamatakaharutakahatatakaishitakamo"
+    "ritakanabetakasagotakasakitakatoritakayamatakazakitakeharataketomit"
+    "akikawatakinouetamakawatamamuratanaguratanangertanohatatarumizutash"
+    "kenttateyamatelemarktemp-dnsternopilthruheretingvolltohnoshotokigaw"
+    "atokonametokuyamatomisatotonkotsutonsbergtopologytorahimetoyokawato"
+    "yonakatoyosatotoyotomitrainingtransurltroandintrogstadtsubetsutsuka"
+    "erutsumagoitsuruokatypeformtysfjordu2-localuchiharauchinadauchinomi"
+    "uenoharaunderseaunicloudunispaceunj\303\241rgaureshinousgardenuzhgo"
+    "rodvanguardvanylvenvbrplsbxvenneslaventuresverbaniavercelliverisign"
+    "vestfoldvirginiavladimirvps-hostv\303\245gs\303\270ywakayamawakkana"
+    "iwalloniewanouchiwarszawawebspacewedeploywest1-uswiardwebwildlifewi"
+    "ndmillwoodsideworkshopxn--80auxn--90aexn--d1atxn--nodexn--p1aixn--q"
+    "xamyamagatayamakitayamamotoyamanobeyanagawayokohamayokosukayolasite"
+    "yonabaruyonaguniyonezawayosemiteyoshiokayugawarayusuharazakopanezen"
+    "tsujizhitomirzhytomyr\303\245lesund\303\245lg\303\245rd\303\270stfo"
+    "ld\320\264\320\265\321\202\320\270\320\270\320\272\320\276\320\274\320"
+    "\272\321\200\321\213\320\274\321\201\320\260\320\271\321\202\321\201"
+    "\320\276\321\207\320\270\327\231\327\251\327\225\327\221\327\236\327"
+    "\236\327\251\327\234\330\250\330\247\330\261\330\252\330\250\331\212"
+    "\330\252\331\203\330\252\331\210\331\206\330\263\330\264\330\250\331"
+    "\203\330\251\330\271\330\261\330\247\331\202\330\271\331\205\330\247"
+    "\331\206\331\205\331\210\331\202\330\271\332\200\330\247\330\261\330"
+    "\252123saitabogadoabruzzoacademyadygeyaagakhanagdenesaibetsuairline"
+    "airportakabiraakirunoakkeshialabamaalesundalibabaanamizuandroidanpa"
+    "chiappspotaremarkarendalarmeniaartdecoasakawaaseinetaskvollathletaa"
+    "tlantaauctionaudibleaurlandauspostaver\303\270yaviancaavocatsawsmpp"
+    "laxarnetayagawaazimuthazuminobadajozbaghdadbajddarbambinabanamexbar"
+    "ueribauhausbellunobentleybergamobergbaubeskidybestbuybielawabiev\303"
+    "\241tbirdartbjarkoyblogdnsbloxcmsboliviabolognabookingboxfusebplace"
+    "dbrendlybresciabristolbrotherbryanskbudejjubukharaburghofbuyshopbyg"
+    "landb\303\241l\303\241tcaracalcaravancareerscarriercasacamcasertaca"
+    "strescataniacatfoodcechirecertmgrcf-ipfscharitycharterchicagochijiw"
+    "achikugochikujochikumachintaichitosechiyodachowdercienciacieszyncis"
+    "troncitadelcldmailclintoncloud66cloudnsclubmedcocottecoldwarcologne"
+    "comcastcommunecompanycomparecontactconventcorsicacosenzacosidnscost"
+    "umecouncilcouponscoursescremonacricketcrotonecruisescupcakeczeladzd"
+    "aejeondazaifudediboxdenmarkdeportedetroitdnsdojodnshomedoes-itdomai"
+    "nsdonetskdoomdnsdrammendraydnsdr\303\270bakdsmynasduckdnsdyn-vpndyn"
+    "dns1dynserveastus2edgeappeditorxedogawaeidskogeiheijieklogeselverum"
+    "embetsuempresaen-rootencowayenebakkenglanderoticaerotikaetajimaetne"
+    "daleurodirexposedezproxyfakefurfarmersfarsundferraraferrariferrerof"
+    "etsundfinancefinlandfinn\303\270yfirenetfirenzefirewebfishingfitnes"
+    "sflightsfloridafloripafloristflowersfolldalfor-ourfor-theforsalefor"
+    "sandfra1-defreetlsfrogansfrolandfrom-akfrom-alfrom-arfrom-azfrom-ca"
+    "from-cofrom-ctfrom-dcfrom-defrom-flfrom-gafrom-hifrom-iafrom-idfrom"
+    "-ilfrom-infrom-ksfrom-kyfrom-lafrom-mafrom-mdfrom-mefrom-mifrom-mnf"
+    "rom-mofrom-msfrom-mtfrom-ncfrom-ndfrom-nefrom-nhfrom-njfrom-nmfrom-"
+    "nvfrom-nyfrom-ohfrom-okfrom-orfrom-pafrom-prfrom-rifrom-scfrom-sdfr"
+    "om-tnfrom-txfrom-utfrom-vafrom-vtfrom-wafrom-wifrom-wvfrom-wyfuefuk"
+    "ifujiedafujiokafujitsufukuokafukuroifuoiskufuosskogangwongausdalgen"
+    "tinggeologygeorgiagetmyipgets-itgiessenginowangitpagegjemnesgjesdal"
+    "gj\303\270vikgliwicegloppengnieznogodaddygoianiagolffangoriziagorli"
+    "cegoshikigotembagoupilegrajewogranvingraphoxgreatergrocerygrondargu"
+    "itarsgujaratgwangjugyokutog\303\241ls\303\241hachijohaebaruhaibarah"
+    "akusanhamaroyhamburghandsonhangoutharstadhashimahedmarkhekinanhichi"
+    "sohiranaihokuryuholidayhomednshomeftphosteurhoteleshotmailhttpbinhy"
+    "undaih\303\241bmerh\303\241pmiribarakiibestadibigawaichikaiikarugai"
+    "kusakaimabariimakaneimperiain-addrinazawaincheoninderoyinuyamaipifo"
+    "nyis-goneis-leetis-lostisahayaiseharaiserniaisesakiismailiisshikiis"
+    "tmeinitakuraivanovoivelandiwafuneiwakuniiwakuraiwanumajamisonjeonbu"
+    "kjeonnamjewelryjolsterjudaicajuniperkafjordkaizukakameokakamiokakan"
+    "makikannamikanonjikanzakikaracolkaratsukareliakarlsoykarm\303\270yk"
+    "arpaczkartuzykarumaikasaokakashibakasugaikaszubykawagoekeliwebketrz"
+    "ynkharkivkharkovkhersonkikonaikikuchikimitsukitaurakitchenklodzkoko"
+    "dairakoganeikokonoekomforbkommunekotourakouhokukounosukouyamakrager"
+    "okrasnikkumenankuroisokusatsukushirokutchankvitsoykyuragilacaixalaj"
+    "ollalandinglanxesslaquilalarssonlasallelatrobelavagisleasinglebesby"
+    "leclerclegnicaleirvikleksviklezajskligurialimitedlincolnlind\303\245"
+    "slivornoloab\303\241tlogintoloisirslovepoplucanialucernelugansklyng"
+    "dall\303\241hppil\303\246rdalmachidamaibaramaizurumalborkmalselvman"
+    "tovamarburgmaringamarketsmashikemashikimashikomatsudamatsudomatsuno"
+    "medecinmedicalmembersmerakermessinamidsundminteremishimamissilemits"
+    "ukemoarekemodalenmonstermoriokamosjoenmragowomuos\303\241tmuroranmy"
+    "amazemycloudmydattomydrobomyforummyfritzmytabitm\303\245s\303\270yn"
+    "akagyonakijinnalchiknamastenankokunanmokunanporonerdpolnessebynetba"
+    "nknetflixnetlifyneustarnewportnewyorknfshostnh-servniigataniihamani"
+    "shigonisshinniteroinobeokanobushinodeartnorddalnorfolknoshironow-dn"
+    "sn\303\246r\303\270yobihiroobninskodawaraofunatoogawaraoishidaokaga"
+    "kiokayamaokazakiokegawaokinawaokutamaoldnavyolsztynomigawaomitamaom"
+    "otegoonagawaoncillaontarioooshikaopenairopocznooriginsorsitesostero"
+    "yostfoldostrodaos\303\270yrootofukeotsuchipacificpalermoperugiapesc"
+    "araphilipsphoenixpigboatpioneerpistoiaplesknspodhalepodzonepointtop"
+    "oivronpolitiepoltavapomorzepotagerpotenzarailwayravendbravennaravpa"
+    "gerealtorrecipesreclaimrenneburentalsrepbodyreservdreviewsrevistare"
+    "xrothrhcloudringeburockartromskogroyrvikryokamirzeszowr\303\245holt"
+    "r\303\270d\303\270yr\303\270ykensaigawasaitamasakuraisalernosaltdal"
+    "samsungsand\303\270ysannohesantafesaotomesapporosassarisatoshoschmi"
+    "dtschoolsschwarzschweizscrysecseaportseljordsembokushibatashibuyash"
+    "ikabeshikaoishikshashimadashimaneshimogoshimojishirakoshiraoishitar"
+    "ashobarasibeniksiciliasiellaksiiitessinglesskiervaskoczowsk\303\241"
+    "nitslattumsn\303\245asesobetsusogndalsokndalsolognesondriosorfoldsq"
+    "uare7staplesstaticsstavernsteigenstoragestordalstrandasunndalsuppor"
+    "tsurgerysuwalkisvelvikswidniksyno-dss\303\241l\303\241ttadaokatadot"
+    "sutaishintakaokatarantotatsunoteckidstelebittemasektempurltenkawate"
+    "stingtextiletheatertheatretheshopticketstiffanytobetsutochigitogits"
+    "utomiokatonoshotorskentoscanatoshibatoshimatottoritourismtoyoaketoy"
+    "ookatoyotsutoyouratradingtransiptran\303\270ytrapanitrevisotriestet"
+    "roitsktrolleytroms\303\270trusteetsubametsubatatsugarutsukubatsukum"
+    "itsurugitsurutatsuwanotuscanytysv\303\246runazukiunjargaurakawauray"
+    "asuushuaiautwenteuwajimavaapstevaksdalvarggatvestnesvicenzavillagev"
+    "innicavirtuelviterbovologdavpnplusv\303\246r\303\270ywalmartwanggou"
+    "wassamuwataraiwatcheswebhareweblikewebpaasweddingwestus2whalingwhos"
+    "whowindowswinnerswixsitewmcloudwmflabswolominworkerswpmucdnwpmudevw"
+    "roclawxfinityxn--41ayachiyoyamaxunyamazoeyanaizuyasuokayatsukayomit"
+    "anyoshimizoologyzuerich\303\245seral\303\270ksnes\303\270rland\303\270"
+    "rskog001www9guacuabarthabbottabbvieadachiaejrieagencyagentsaikawaai"
+    "rbusairtelakadnsakaiwaalaskaalipayalsacealstomalvdalanconaandebuann"
+    "akaanquanaogakiaomoriapigeeappudoaramcoarezzoariakeaseralashoroask\303"
+    "\270yassabuassisiatsugiaustinauthoraveroyavouesb-databaidarbambleba"
+    "ndaibauernbayernbeardubeautybedzinbeiarnbergenbhartibiellabievatbif"
+    "ukabihorobilbaobindalbitterboomlabostikbostonbotanyboutirbrokerbrun"
+    "elbunkyobusheyb\303\246rumb\303\270mlocamdvrcanadacasinocastlecaxia"
+    "schanelchietichiryuchonanchoseichoshichromechurchcinemacirclecircus"
+    "claimscliniccloud9coffeecomseccondoscountycrankycrimeacuiabadaemond"
+    "aisendallasdapliedatingdatsundd-dnsdealerdeatnudebiandegreedentaldi"
+    "ademdigickdisrecdnsfordogadodopaasdrobakdunlopdupontdurbandurhamdvr"
+    "camdvrdnsdynvpndyr\303\270yd\303\270nnaebetsuedugitegoismelastxelbl"
+    "agelburgemerckenergyesashieveneseventsexeterfauskefbx-osfinnoyfitja"
+    "rfjalerflickrfloppyflor\303\270foggiaforgotfortalforumzfosnesfrosta"
+    "fruskyfr\303\246nafr\303\270yafukayafutabafutbolfuttsuf\303\270rdeg"
+    "allupgamvikgaulargdanskgdyniagehirngeiseigenkaigenovageorgeginozagi"
+    "tappgitlabgivinggjovikgleezeglitchglogowgloomygojomegokasegonohegot"
+    "dnsgratisgroznyhabmerhaborohadanohadselhakatahakonehakubahaldenhama"
+    "dahamurahanawahannanhapmirhappouhareidharimahasamahasamihasudahasvi"
+    "khawaiihegurihellashemneshermesher\303\270yhetemlhidakahidorahikone"
+    "himejihiphophiradohirarahirayahob\303\270lhokutohomeiphonjyohoplixh"
+    "ortenhugheshungryhurdalhvalericurusidrettiijimaiitateiiyamaiizukaii"
+    "zunaimamatin-brbin-dslin-vpninsureintuitiopsysitomaniwanaijaguarjam"
+    "byljobojijoburgjoetsujogaszjohanajoyentjuegoskadenakahokukainankais"
+    "eikakudakaliszkalugakanoyakanumakaratekariwakariyakarmoykasuyakatan"
+    "okaufenkawabakawarakawauekawazukayabekazunokeisenkhplaykihokukimino"
+    "kinderkindlekitamikiyamakiyosekiyosukl\303\246bukomakikomonokomorok"
+    "omvuxkoobinkosakakosherkosugekozakikrakowkumanokundenkunimikurateku"
+    "rgankurobekurogikuwanakyonanlabourlahppilanbiblancialandeslardallar"
+    "viklatinalatinoleborklecznalefraklenviklerdalliernelindasloabatlock"
+    "erlogoiplohmuslondonlouvrelowiczlublinlunnerlur\303\270yluxuryluzer"
+    "nlyngenl\303\270tenmacapamaceiomadridmagnetmakeupmalvikmanausmandal"
+    "marchemarinemarkermasakimasudamateramatsuemattelmazurymeeresmegurom"
+    "eldalmelhusmel\303\270ymemsetmiastamidorimielecmielnomifunemihamami"
+    "harumikasamilanomimataminanomincomminersminingminobumisakimisasamis"
+    "awamisugimitakamitakemitoyomiyadamiyagimiyakemiyazumiyotamizuhomlbf"
+    "anmmafanmobaramodenamodernmolisemonashmorenamormonmoscowmosvikmoteg"
+    "imotobumotosumunciemuosatmurotomuseetmusicamy-wanmyddnsmyfastmyjino"
+    "mypetsmywirem\304\201orinabarinagaranagasunagisonagoyanaharinakaman"
+    "amsosnantannaplesnaritanarutonarviknatorinayoronemuronerimanessetnf"
+    "lfannhlfanniepcenikahonikitaninohenissannissaynogatanohejinohostnom"
+    "brenortonnovaranowruznumatanumazunyuzenocelotodessaoguchiohkuraoira"
+    "seoksnesoleckoolkuszomniweon-k3son-rioon-webonjukuookuwaoppdaloracl"
+    "eorkdalorlandorskogosascoosoyrootsukioxfordpadovapagexlpalacepalmas"
+    "panamaparochpatriapecoripeeweepfizerpgafanphysiopictetpilotspinokop"
+    "l-wawplantspoliceponpesportalpowiatpoznanpressepubtlspueblopugliapu"
+    "lawyqbuserquebecracingrad\303\270yragusaraholtranzanrealtyreciferei"
+    "senreklamrepairreportriminirindalris\303\270rrocherrogersrollagrovi"
+    "goroykenruovatrussiarybnikryukyur\303\241isar\303\270rossadistsaika"
+    "isakadosakakisakatasakuhosandoysannansanofisanukisaromasasebosavona"
+    "secaassecretseidatseirouselfipsellfyseminesenasasennansettsushiibas"
+    "hingoshingushinjoshioyashisuishonaishoujishunansicilysigdalsiljansi"
+    "rdalskanitskj\303\245kskodjeslupsksm\303\270lasnaasesnoasasn\303\245"
+    "sasoccersolundsphinxstangestdlibstjohnstokkestolosstudiosugitosuiss"
+    "esukumosuldalsumidasumitasupplysurreysusakisusonosuzakasuzukasuzuki"
+    "swatchswedensydneyszkolas\303\241lats\303\270gnes\303\270mnas\303\270"
+    "rumtabusetagajotaharatainaitaipeitajimitajiritakagitakasutaketatama"
+    "kitamanotamayutaobaotaramatargettattootennisteramotermeztiendatjmax"
+    "xtj\303\270metkmaxxtochiotoganetoguratomaritomikatomiyatomobetonaki"
+    "tonamitoridetorinotowadatoyakotoyonetoyonotoyotatozawatozsdetradert"
+    "ranbytranoytrentotritontromsatromsotrysiltr\303\246natsuikitsukuits"
+    "unantwmailtynsettysnestysvarufcfanumbriaunicomurasoeurausuusartsush"
+    "ikuutazasutsirav-infovads\303\270vagsoyvantaavard\303\270varesevelv"
+    "etvenetoveniceverdalveronaverranversusvestbyviajesvikingvillasvivia"
+    "nvoagatvotingvoyagevpndnsvuelosv\303\245ganv\303\245g\303\245v\303\245"
+    "lerwajikiwakuyawalterwarabiwarmiawatariwatsonwebcamwebhopwegrowwiel"
+    "unwzmiuwxihuanxs4allyabukiyachtsyahabayahikoyakageyakumoyamadayaots"
+    "uyasakayashioyasudayasugiyatomiyawarayoichiyokoteyokozeyonagoyuzawa"
+    "zamamizapposzombie\303\241lt\303\241\303\245rdal\303\245snes\303\270"
+    "rsta\320\261\320\265\320\273\320\261\320\270\320\267\320\274\320\270"
+    "\321\200\320\274\320\272\320\264\320\274\320\276\320\275\320\274\321"
+    "\201\320\272\320\276\320\261\321\200\320\276\321\200\320\263\321\200"
+    "\321\203\321\201\321\201\320\277\320\261\321\201\321\200\320\261\321"
+    "\203\320\272\321\200\321\203\320\277\321\200\322\233\320\260\320\267"
+    "\325\260\325\241\325\265\327\246\327\224\327\234\327\247\327\225\327"
+    "\235\330\271\330\261\330\250\331\202\330\267\330\261\331\203\331\210"
+    "\331\205\331\205\330\265\330\261\341\203\222\341\203\224\343\202\263"
+    "\343\203\240\344\270\211\351\207\215\344\270\226\347\225\214\344\270"
+    "\252\344\272\272\344\270\255\344\277\241\344\270\255\345\233\275\344"
+    "\270\255\345\234\213\344\272\254\351\203\275\344\274\201\344\270\232"
+    "\344\275\220\350\263\200\344\275\233\345\261\261\344\277\241\346\201"
+    "\257\345\200\213\344\272\272\345\201\245\345\272\267\345\205\253\345"
+    "\215\246\345\205\254\345\217\270\345\205\254\347\233\212\345\205\265"
+    "\345\272\253\345\215\203\350\221\211\345\217\260\346\271\276\345\217"
+    "\260\347\201\243\345\225\206\345\237\216\345\225\206\345\272\227\345"
+    "\225\206\346\240\207\345\225\206\346\245\255\345\234\250\347\272\277"
+    "\345\237\274\347\216\211\345\244\247\345\210\206\345\244\247\346\213"
+    "\277\345\244\247\351\230\252\345\245\210\350\211\257\345\250\261\344"
+    "\271\220\345\256\256\345\237\216\345\256\256\345\264\216\345\256\266"
+    "\351\233\273\345\257\214\345\261\261\345\261\261\345\217\243\345\261"
+    "\261\345\275\242\345\261\261\346\242\250\345\262\220\351\230\234\345"
+    "\262\241\345\261\261\345\262\251\346\211\213\345\263\266\346\240\271"
+    "\345\271\277\344\270\234\345\272\203\345\263\266\345\276\256\345\215"
+    "\232\345\276\263\345\263\266\346\204\233\345\252\233\346\204\233\347"
+    "\237\245\346\205\210\345\226\204\346\211\213\346\234\272\346\213\233"
+    "\350\201\230\346\224\277\345\212\241\346\224\277\345\272\234\346\225"
+    "\216\350\202\262\346\225\231\350\202\262\346\226\260\346\275\237\346"
+    "\226\260\351\227\273\346\227\266\345\260\232\346\233\270\347\261\215"
+    "\346\235\261\344\272\254\346\240\203\346\234\250\346\262\226\347\270"
+    "\204\346\270\270\346\210\217\346\273\213\350\263\200\346\276\263\351"
+    "\226\200\346\276\263\351\227\250\347\202\271\347\234\213\347\206\212"
+    "\346\234\254\347\237\263\345\267\235\347\246\217\344\272\225\347\246"
+    "\217\345\262\241\347\246\217\345\263\266\347\247\213\347\224\260\347"
+    "\247\273\345\212\250\347\256\207\344\272\272\347\265\204\347\271\224"
+    "\347\265\204\347\273\207\347\266\262\347\265\241\347\266\262\347\273"
+    "\234\347\266\262\350\267\257\347\273\204\347\271\224\347\275\221\345"
+    "\235\200\347\275\221\345\272\227\347\275\221\347\253\231\347\275\221"
+    "\347\265\241\347\275\221\347\273\234\347\276\244\351\246\254\350\201"
+    "\224\351\200\232\350\207\272\347\201\243\350\214\250\345\237\216\350"
+    "\260\267\346\255\214\350\264\255\347\211\251\351\200\232\350\262\251"
+    "\351\225\267\345\264\216\351\225\267\351\207\216\351\233\206\345\233"
+    "\242\351\235\222\346\243\256\351\235\231\345\262\241\351\243\237\345"
+    "\223\201\351\244\220\345\216\205\351\246\231\345\267\235\351\246\231"
+    "\346\270\257\351\253\230\347\237\245\351\263\245\345\217\226\353\213"
+    "\267\353\204\267\353\213\267\354\273\264\354\202\274\354\204\261\355"
+    "\225\234\352\265\2551kapp4limaabenoabikoadimoadultaetnaagraraisaiak"
+    "unealcesamberamfamamicaamuneananiangryappleaskeraskimaskoyasnesassu"
+    "rasukeaudioaukraautosawdevbaidubalatbandobardubarumbaselbathsbeatsb"
+    "egetbelaubelembeppubibaibiblebiharbingobizenbjugnblushboatsbod\303\270"
+    "bomloboschbrynebusanbuzenbyklebytomcafjscanoncapoocardscargocarrdch"
+    "asecheapchipschitachofuchoyociticcoachcoprocrowncuneocybercymruczes"
+    "tdaburdaegudaigodaiwadanceddns5ddnssdealsdedyndelhideltademondiherd"
+    "ollsdonnadoshidovredubaidyn53dynnsdynv6dyroyeartheatonebinaebinoede"
+    "kaeniwaepsonerimoessexexnetfaithfbsbxfbxosfedexfedjefeirafermofield"
+    "finalfldrvflierfloraflorofordeforexfortefranafrognfroyafuchufudaifu"
+    "kuifussagallogalsagenoagiftsgiizeginangirlygiskegivesglassglobogmai"
+    "lgminagonnagorgegosengotsugranegretagripegronggucciguidegulengunmah"
+    "accahakuihalsahandahannohanyuheavyheroyhicamhiokihippyhitrahobolhon"
+    "dahongohoptohorsehurumhyatthyogohyugaibxosiheyaikedailawaimariinabe"
+    "inagiindieinzaiirumais-byitakoitanoitigoiwadeiwamaiwataiwateizenaja"
+    "mpajetztjgorakaitakanankaniekanrakapsikasaikepnokinkokiryuklabuklep"
+    "pkmpspkochikoelnkomaekonankoninkoorikoryokosaikoseikoshukozowkppspk"
+    "uronkutnokwpspkyotokyowalaborlakaslamerlazioleaselecceleccolegallel"
+    "uxlenuglesjalexuslillylipsyloanslocuslomzalon-1lon-2loppalotenlotto"
+    "lubinluccalukowluroylutskl\303\244nsmacysmangomannomaorimasoymcdirm"
+    "cpremeiwameloymiamimiasaminohmitoumiuramodummoldemoneymoviemuikamyf"
+    "tpmyokomypepmypsxmytismyvncnagainakainaklonanaenanaonanbunangonanjo"
+    "nantonanyonaroynatalnavalnavoinesnaneuesnexusniiminiizanikkonikonni"
+    "njano-ipnodesnokianowtvntdllnuorooaraiobamaobiraobuseodesaoganoogim"
+    "iogoriogoseoharuojiyaoketoolawaomahaomegaomutaonionooguyopoleosetoo"
+    "tagootakeotariotaruotobeowaniownipoyabeoyodoozorapaduapaleoparispar"
+    "mapartipartspartypaviapennepenzapermapgfogphonepippupizzaplazapoker"
+    "pratopraxiprgmrpromoprvcypstmnpubolpunyupymntradomradoyraumarebunre"
+    "chtrehabricohrietirisorrissarittorivnerockyrodeorodoyrorosrovnorugb"
+    "yryggeryuohr\303\245der\303\270stsabaesagaesaijosaikisaitosakaesaky"
+    "osalonsaludsampasangosanjosanoksattesaudaseihiseiyosejnysekd1selbus"
+    "eljesenerseoulsharisharpshellshoesshowasienaskaunskienskjakskolesky"
+    "peslaskslingsmilesmolasnasasochisoedasognesolarsomnasopotsorumspawn"
+    "spdnsstabastadasteamstorjstrynstudysuckssuifusuitasveioswisstaijita"
+    "ikitairataitotakkotargitaruitendoteneitenriternitexastgorythicktire"
+    "stjometksattmalltodaytohmatokaitolgatoolstoraytotaltourstranatunest"
+    "urekturintushutychytydalubankudineujiieukihaulvikumajiunnanunzenupa"
+    "asupperurawaurownusersustkausukiutazuvadsovaganvardovaroyvefsnvegas"
+    "videovodkavoldavolvovolynwalesweberweibownextworldxeroxxnbayyaeseya"
+    "hooyaitayaizuyaltayoitayomboyoriiyouthyuasayusuizaganzaptozarowzgor"
+    "a\303\245mli\303\245mot\303\270yer0emm12hp133716-b2000203832-b64-ba"
+    "arpacctaioiakdnalp1arvoassnaxisbar0bar1bar2bbvabeepbieibigvbikebill"
+    "bodobofaboknboltbondbonnbuzzbyencafecallcbreciaoclancnpycoalcodycom"
+    "ocrewcurvcyoncyoudclkdetadgcadietdishdruddvagdynue164ebizes-1eu-1eu"
+    "-2eu-3eu-4fagefailfansfhskfiatfidofilmflapflirflogfl\303\245fnwkfoo"
+    "lfr-1fuelfusogbizggeegifugluggmbhgobogodogouvgovtgrazgriwgrueguamgu"
+    "gegujohagahelphgtvhlx3holeholyhsbci234icbcieeeimdbiobbiraqivgujavaj"
+    "eepjejujobsjosojoyojozijprsjuifkaaskazokddikievkijokillkilokiwikizu"
+    "kobekofukokakpmgkredkrymkujikurekusukvamkyivlairlanslapylegolgbtlid"
+    "llimolmpmlugslvivlynxmaifmanxmcpemeetmememenumibumihomockmodsmossmu"
+    "gimukomycdmydsmypina4unabunaieneennikenoginoipnoopny-1ny-2nyaanyann"
+    "ynynysaoddaohdaoirmollooopsoslootapoyerparspccwpinbpinkpisapiszpohl"
+    "pornpupuqotoqponreitriikroomrsvpruhrrzgwsadosarlsatxsaxosayoseatsee"
+    "ksexysg-1shawshoosilksncfsohusojasokasomasonysowasrcfsrhtsulisumysu"
+    "rfszextanktaxitcp4tiaatinntipstlontobatoeitogotoystreetulatunktuvau"
+    "edauni5uozuupliupowus-1us-2us-3us-4utahuvicvisavivavivovlogvotevoto"
+    "wakeweirwienwiihwinbwioswitdwskrwuozx443xboxyufuyukizero\316\265\316"
+    "\273\316\265\317\205\320\260\320\272\320\261\320\263\320\265\321\216"
+    "\320\276\320\264\321\200\321\2042ix611abcarqbbcbbtbcgbcnbhzbipbmdbm"
+    "sbmwbnrbzhbzzc66cbgcbncbsceocfdcimcngcnscntcogcozcrdcrscsxddsdhldiy"
+    "dnpdrremrenfesqfemfhvfltfncfndfotfoxfozfrlfstftrfvgfyig12gapggfgopg"
+    "rpgsjhkthzcibmidvip6itvjcbjdfjedjfkjlljmpjnjjpnk12k8skfhkpnlk3llpmt"
+    "nmupn4tnhknhsnidnjsnrwnswocpomgovhoxaphdphxpiwplcpmnpncprdpvhpvtpwc"
+    "q-aqa2qcxqldqsls5ysbsscbscwsewshwsjcsldslgslzsoospbsrlsrvsvctcitcmt"
+    "dktjxtmptrdtrvtvsuk0ulmusrvaovfsvixvp4vxlwhmwiwwowwtcwtfxenxinxxxxy"
+    "zynhyuuzipzlgkzqhxjxzzw\321\217"
+;
+
+/*
+ * The trie: first child, label offset, number of children, label
+ * length and flags.  The root is the first node; its children are
+ * the top level domains.
+ */
+static const PslNode psl_nodes[10169] = {
+    {1,0,1651,0,0}, {1652,517,7,2,1}, {1659,791,1,2,1}, {1660,26,8,2,1},
+    {1668,755,5,2,1}, {1673,1065,5,2,1}, {1678,776,5,2,1}, {1683,168,7,2,1},
+    {1690,1052,9,2,1}, {1699,818,6,2,1}, {0,7832,0,2,1}, {1705,701,14,2,1},
+    {1719,202,1,2,1}, {1720,151,18,2,1}, {1738,928,18,2,1}, {1756,1070,1,2,1},
+    {1757,923,8,2,1}, {1765,3584,12,2,1}, {1777,516,8,2,1}, {1785,1959,10,2,1},
+    {0,6096,0,2,2}, {1795,390,8,2,1}, {1803,13206,1,2,1}, {1804,3485,38,2,1},
+    {1842,1718,5,2,1}, {1847,2149,5,2,1}, {1852,7872,21,2,1}, {1873,6846,5,2,1},
+    {1878,4729,6,2,1}, {1884,949,41,2,1}, {1925,812,141,2,1}, {2066,187,6,2,1},
+    {2072,4561,5,2,1}, {0,7758,0,2,1}, {2077,31137,2,2,1}, {2079,2095,6,2,1},
+    {2085,45832,7,2,1}, {2092,25,21,2,1}, {2113,518,9,2,1}, {2122,625,1,2,1},
+    {2123,6068,1,2,1}, {0,6330,0,2,1}, {2124,69,13,2,1}, {2137,519,18,2,1},
+    {2155,3254,1,2,2}, {2156,609,5,2,1}, {2161,15396,4,2,1}, {2165,6944,50,2,1},
+    {2215,4,23,2,1}, {2238,6202,7,2,1}, {2245,2147,6,2,1}, {2251,4760,6,2,1},
+    {2257,12811,4,2,1}, {2261,1827,3,2,1}, {2264,11086,12,2,1}, {2276,16633,6,2,1},
+    {2282,81,73,2,1}, {0,4694,0,2,1}, {2355,11731,8,2,1}, {2363,2204,5,2,1},
+    {2368,3887,10,2,1}, {2378,8158,10,2,1}, {2388,18,14,2,1}, {2402,2202,10,2,1},
+    {2412,4786,9,2,1}, {0,174,0,2,2}, {2421,27,7,2,1}, {2428,704,8,2,1},
+    {2436,828,9,2,1}, {2445,782,11,2,1}, {2456,4564,10,2,1}, {0,45133,0,2,2},
+    {2466,22683,6,2,1}, {0,1744,0,2,1}, {2472,94,34,2,1}, {0,533,0,2,1},
+    {0,411,0,2,1}, {2506,5377,2,2,1}, {2508,386,7,2,1}, {0,1129,0,2,1},
+    {2515,1775,6,2,1}, {2521,30,5,2,1}, {2526,75,6,2,1}, {2532,975,7,2,1},
+    {0,4220,0,2,1}, {2539,406,6,2,1}, {2545,4744,7,2,1}, {0,3586,0,2,1},
+    {2552,3074,7,2,1}, {0,3486,0,2,1}, {2559,4412,10,2,1}, {2569,3616,8,2,1},
+    {0,12847,0,2,1}, {2577,1316,7,2,1}, {2584,1855,40,2,1}, {0,1813,0,2,1},
+    {2624,6141,7,2,1}, {2631,6917,6,2,1}, {2637,5490,17,2,1}, {2654,1383,32,2,1},
+    {2686,520,14,2,1}, {2700,76,3,2,1}, {2703,1119,8,2,1}, {2711,2985,8,2,1},
+    {2719,266,46,2,1}, {2765,9,72,2,1}, {2837,3736,6,2,1}, {2843,71,11,2,1},
+    {2854,85,8,2,1}, {2862,189,437,2,1}, {3299,995,4,2,1}, {0,13537,0,2,2},
+    {3303,1853,8,2,1}, {3311,7403,270,2,1}, {3581,2266,9,2,1}, {3590,18300,12,2,1},
+    {0,3255,0,2,2}, {3602,2478,7,2,1}, {3609,19106,17,2,1}, {3626,1101,4,2,1},
+    {3630,10847,6,2,1}, {3636,1851,30,2,1}, {3666,6046,7,2,1}, {3673,7451,4,2,1},
+    {3677,46240,8,2,1}, {3685,790,10,2,1}, {3695,3772,5,2,1}, {3700,169,7,2,1},
+    {3707,760,2,2,1}, {3709,3883,15,2,1}, {3724,4705,5,2,1}, {3729,567,10,2,1},
+    {3739,294,2,2,1}, {3741,1834,2,2,1}, {3743,2447,9,2,1}, {3752,1893,9,2,1},
+    {3761,1053,6,2,1}, {3767,1749,2,2,1}, {3769,19359,5,2,1}, {3774,164,43,2,1},
+    {3817,385,9,2,1}, {0,2978,0,2,1}, {3826,13272,8,2,1}, {3834,2614,7,2,1},
+    {0,145,0,2,2}, {3841,6221,4,2,1}, {3845,798,5,2,1}, {3850,2062,1,2,1},
+    {0,16777,0,2,1}, {3851,631,2,2,1}, {3853,640,7,2,1}, {3860,1354,4,2,1},
+    {3864,21,7,2,1}, {3871,4210,14,2,1}, {3885,41040,11,2,1}, {3896,4588,6,2,1},
+    {3902,2849,9,2,1}, {3911,37727,8,2,1}, {3919,784,17,2,1}, {3936,97,2,2,1},
+    {0,765,0,2,1}, {3938,3940,10,2,1}, {3948,396,15,2,1}, {3963,23,14,2,1},
+    {3977,6458,10,2,1}, {3987,196,896,2,1}, {0,7559,0,2,2}, {4883,1387,7,2,1},
+    {4890,5544,4,2,1}, {4894,800,17,2,1}, {4911,20,9,2,1}, {4920,840,11,2,1},
+    {4931,543,8,2,1}, {4939,5099,3,2,1}, {0,17073,0,2,2}, {4942,2845,8,2,1},
+    {4950,18776,14,2,1}, {4964,3149,179,2,1}, {5143,2621,2,2,1}, {5145,25331,5,2,1},
+    {5150,282,13,2,1}, {5163,866,7,2,1}, {5170,2063,10,2,1}, {5180,399,8,2,1},
+    {5188,7574,7,2,1}, {5195,3517,9,2,1}, {5204,7,4,2,1}, {5208,161,15,2,1},
+    {5223,930,10,2,1}, {5233,72,40,2,1}, {5273,1605,7,2,1}, {5280,568,8,2,1},
+    {5288,389,5,2,1}, {5293,1595,5,2,1}, {5298,270,8,2,1}, {5306,156,47,2,1},
+    {5353,1072,8,2,1}, {5361,660,11,2,1}, {5372,188,3,2,1}, {0,994,0,2,1},
+    {5375,931,1,2,1}, {5376,1400,5,2,1}, {0,4191,0,2,1}, {5381,1599,8,2,1},
+    {5389,221,7,2,1}, {0,1927,0,2,1}, {5396,556,8,2,1}, {5404,86,12,2,1},
+    {5416,299,52,2,1}, {5468,8897,5,2,1}, {5473,4540,1,2,1}, {5474,1310,6,2,1},
+    {5480,351,3,2,1}, {5483,1004,3,2,1}, {5486,5146,1,2,1}, {5487,3980,1,2,1},
+    {0,2944,0,2,1}, {5488,199,9,2,1}, {5497,654,15,2,1}, {0,9345,0,2,1},
+    {5512,3920,1,2,1}, {5513,3114,8,2,1}, {5521,1726,14,2,1}, {5535,1087,12,2,1},
+    {5547,261,22,2,1}, {5569,705,17,2,1}, {5586,2617,4,2,1}, {5590,3263,18,2,1},
+    {5608,5325,12,2,1}, {5620,2193,83,2,1}, {5703,12648,9,2,1}, {5712,7431,23,2,1},
+    {5735,829,73,2,1}, {5808,4024,6,2,1}, {5814,9700,4,2,1}, {0,176,0,2,1},
+    {5818,8279,8,2,1}, {5826,382,20,2,1}, {5846,3650,1,2,1}, {5847,159,5,2,1},
+    {5852,4674,13,2,1}, {5865,997,8,2,1}, {5873,24607,2,2,1}, {5875,1071,9,2,1},
+    {5884,4809,6,2,1}, {5890,5859,1,2,1}, {5891,801,18,2,0}, {5909,20523,11,2,1},
+    {5920,46248,5,2,1}, {0,7818,0,3,1}, {0,36859,0,3,1}, {0,45796,0,3,1},
+    {0,14428,0,3,1}, {0,11918,0,3,1}, {0,20743,0,3,1}, {0,32829,0,3,1},
+    {0,3844,0,3,1}, {0,815,0,3,1}, {0,35174,0,3,1}, {5925,1486,28,3,1},
+    {0,4166,0,3,1}, {0,1070,0,3,1}, {0,31773,0,3,1}, {0,700,0,3,1},
+    {0,45802,0,3,1}, {0,45805,0,3,1}, {0,45808,0,3,1}, {0,45811,0,3,1},
+    {0,11247,0,3,1}, {0,10208,0,3,1}, {0,45085,0,3,1}, {5953,42239,15,3,1},
+    {0,45823,0,3,1}, {0,45826,0,3,1}, {0,34851,0,3,1}, {0,5497,0,3,1},
+    {0,4952,0,3,1}, {0,17624,0,3,1}, {0,17697,0,3,1}, {0,45832,0,3,1},
+    {0,14319,0,3,1}, {0,3003,0,3,1}, {0,4231,0,3,1}, {0,2894,0,3,1},
+    {0,150,0,3,1}, {0,1005,0,3,1}, {0,45844,0,3,1}, {0,45847,0,3,1},
+    {0,45850,0,3,1}, {0,11095,0,3,1}, {0,45853,0,3,1}, {5968,19,399,3,1},
+    {0,24000,0,3,1}, {0,45877,0,3,1}, {0,18035,0,3,1}, {0,14239,0,3,1},
+    {0,45883,0,3,1}, {6367,5147,23,3,1}, {0,45886,0,3,1}, {0,45889,0,3,1},
+    {0,45892,0,3,1}, {0,5441,0,3,1}, {0,36080,0,3,1}, {0,16188,0,3,1},
+    {0,14360,0,3,1}, {0,7070,0,3,1}, {0,18,0,3,1}, {6390,10787,1,3,1},
+    {0,45904,0,3,1}, {6391,828,1,3,1}, {0,5519,0,3,1}, {0,32809,0,3,1},
+    {0,11120,0,3,1}, {0,14792,0,3,1}, {0,45925,0,3,1}, {0,45931,0,3,1},
+    {0,45937,0,3,1}, {0,6935,0,3,1}, {0,45943,0,3,1}, {0,2842,0,3,1},
+    {0,45949,0,3,1}, {0,23070,0,3,1}, {6392,31923,1,3,1}, {0,3745,0,3,1},
+    {0,2904,0,3,1}, {0,23595,0,3,1}, {0,4587,0,3,1}, {0,11584,0,3,1},
+    {0,45955,0,3,1}, {0,12460,0,3,1}, {0,872,0,3,1}, {0,42253,0,3,1},
+    {0,21748,0,3,1}, {0,45964,0,3,1}, {0,3070,0,3,1}, {0,12518,0,3,1},
+    {0,45970,0,3,1}, {0,4090,0,3,1}, {0,14058,0,3,1}, {0,45260,0,3,1},
+    {0,14339,0,3,1}, {0,1067,0,3,1}, {0,7449,0,3,1}, {6393,2124,1,3,1},
+    {0,85,0,3,1}, {0,45979,0,3,1}, {0,45982,0,3,1}, {0,33294,0,3,1},
+    {0,45994,0,3,1}, {0,45997,0,3,1}, {0,46000,0,3,1}, {0,27730,0,3,1},
+    {0,38347,0,3,1}, {0,46012,0,3,1}, {0,21254,0,3,1}, {0,19055,0,3,1},
+    {0,46015,0,3,1}, {6394,3544,2,3,1}, {0,2615,0,3,1}, {0,5876,0,3,1},
+    {0,24913,0,3,1}, {0,44812,0,3,1}, {0,46021,0,3,1}, {6396,18987,1,3,1},
+    {0,7620,0,3,1}, {0,35639,0,3,1}, {0,5833,0,3,1}, {0,39695,0,3,1},
+    {0,21718,0,3,1}, {0,1581,0,3,1}, {0,164,0,3,1}, {0,6744,0,3,1},
+    {0,19221,0,3,1}, {0,39157,0,3,1}, {0,8194,0,3,1}, {0,11254,0,3,1},
+    {0,27884,0,3,1}, {0,24436,0,3,1}, {0,28584,0,3,1}, {0,19287,0,3,1},
+    {0,640,0,3,1}, {0,46024,0,3,1}, {0,25008,0,3,1}, {0,10866,0,3,1},
+    {0,17556,0,3,1}, {0,7679,0,3,1}, {6397,3261,165,3,1}, {0,4401,0,3,1},
+    {0,12081,0,3,1}, {0,14299,0,3,1}, {0,46033,0,3,1}, {0,1102,0,3,1},
+    {0,1387,0,3,1}, {0,46045,0,3,1}, {0,6351,0,3,1}, {0,32310,0,3,1},
+    {0,2206,0,3,1}, {6562,5235,3,3,1}, {0,14900,0,3,1}, {0,7610,0,3,1},
+    {0,35230,0,3,1}, {6565,7077,114,3,1}, {0,4886,0,3,1}, {6679,46057,1,3,1},
+    {0,29506,0,3,1}, {0,7020,0,3,1}, {0,46063,0,3,1}, {0,5030,0,3,1},
+    {0,8738,0,3,1}, {0,46078,0,3,1}, {6680,5632,14,3,1}, {0,19657,0,3,1},
+    {6694,5559,1,3,1}, {0,46090,0,3,1}, {0,2014,0,3,1}, {0,262,0,3,1},
+    {0,24366,0,3,1}, {0,12248,0,3,1}, {6695,14525,1,3,1}, {6696,6713,10,3,1},
+    {0,1605,0,3,1}, {0,8790,0,3,1}, {0,5704,0,3,1}, {0,18282,0,3,1},
+    {0,46111,0,3,1}, {0,4100,0,3,1}, {0,46114,0,3,1}, {0,46120,0,3,1},
+    {0,37650,0,3,1}, {0,5266,0,3,1}, {0,7419,0,3,1}, {0,11692,0,3,1},
+    {0,29767,0,3,1}, {0,1489,0,3,1}, {0,46144,0,3,1}, {0,2075,0,3,1},
+    {0,733,0,3,1}, {0,7894,0,3,1}, {0,46153,0,3,1}, {0,46159,0,3,1},
+    {0,15,0,3,1}, {0,8703,0,3,1}, {0,46162,0,3,1}, {6706,14833,2,3,1},
+    {0,46171,0,3,1}, {0,38283,0,3,1}, {0,46174,0,3,1}, {0,29872,0,3,1},
+    {0,11309,0,3,1}, {0,1798,0,3,1}, {0,30312,0,3,1}, {0,14048,0,3,1},
+    {0,19172,0,3,1}, {0,6006,0,3,1}, {0,20367,0,3,1}, {0,2123,0,3,1},
+    {0,23751,0,3,1}, {0,46207,0,3,1}, {0,46210,0,3,1}, {0,46213,0,3,1},
+    {0,46219,0,3,1}, {0,46222,0,3,1}, {6708,46225,5,3,1}, {0,4202,0,3,1},
+    {0,33734,0,3,1}, {0,46234,0,3,1}, {0,44706,0,4,1}, {0,825,0,4,1},
+    {6713,21175,86,4,1}, {0,44718,0,4,1}, {0,41074,0,4,1}, {0,31832,0,4,1},
+    {0,32015,0,4,1}, {0,10391,0,4,1}, {6799,34119,6,4,1}, {0,4193,0,4,1},
+    {0,37433,0,4,1}, {6805,26742,1,4,1}, {0,31724,0,4,1}, {0,17537,0,4,1},
+    {0,26010,0,4,1}, {0,692,0,4,1}, {0,24690,0,4,1}, {0,44750,0,4,1},
+    {0,24321,0,4,1}, {0,412,0,4,1}, {0,44766,0,4,1}, {0,29582,0,4,1},
+    {0,3909,0,4,1}, {0,26014,0,4,1}, {0,44778,0,4,1}, {0,44790,0,4,1},
+    {0,5497,0,4,1}, {0,44798,0,4,1}, {0,44806,0,4,1}, {0,44810,0,4,1},
+    {0,5027,0,4,1}, {0,2969,0,4,1}, {0,11560,0,4,1}, {6806,6888,1,4,1},
+    {0,32081,0,4,1}, {0,18930,0,4,1}, {0,44814,0,4,1}, {0,12053,0,4,1},
+    {0,14363,0,4,1}, {0,42359,0,4,1}, {0,23304,0,4,1}, {6807,25862,3,4,1},
+    {6810,26522,2,4,1}, {0,14418,0,4,1}, {0,44854,0,4,1}, {0,9953,0,4,1},
+    {0,7332,0,4,1}, {0,44858,0,4,1}, {0,37459,0,4,1}, {0,806,0,4,1},
+    {0,7442,0,4,1}, {0,44870,0,4,1}, {0,44874,0,4,1}, {0,15844,0,4,1},
+    {0,44882,0,4,1}, {0,15516,0,4,1}, {0,44918,0,4,1}, {0,44922,0,4,1},
+    {0,44926,0,4,1}, {6812,9008,1,4,1}, {0,3917,0,4,1}, {0,44934,0,4,1},
+    {0,44938,0,4,1}, {0,44942,0,4,1}, {0,3949,0,4,1}, {0,32802,0,4,1},
+    {0,44950,0,4,1}, {0,14792,0,4,1}, {0,37510,0,4,1}, {0,14568,0,4,1},
+    {0,27106,0,4,1}, {0,3724,0,4,1}, {0,44982,0,4,1}, {0,5206,0,4,1},
+    {0,44986,0,4,1}, {0,42689,0,4,1}, {0,44998,0,4,1}, {0,22282,0,4,1},
+    {0,33460,0,4,1}, {6813,18327,3,4,1}, {0,45034,0,4,1}, {0,22674,0,4,1},
+    {0,3692,0,4,1}, {0,31846,0,4,1}, {0,27314,0,4,1}, {0,45046,0,4,1},
+    {0,2012,0,4,1}, {0,45050,0,4,1}, {6816,2088,11,4,1}, {0,45066,0,4,1},
+    {0,45074,0,4,1}, {0,45078,0,4,1}, {0,45082,0,4,1}, {0,18547,0,4,1},
+    {6827,23472,21,4,1}, {0,34231,0,4,1}, {0,45098,0,4,1}, {0,45102,0,4,1},
+    {0,45110,0,4,1}, {0,45126,0,4,1}, {0,45142,0,4,1}, {0,36116,0,4,1},
+    {0,45162,0,4,1}, {0,45182,0,4,1}, {0,45186,0,4,1}, {6848,937,1,4,1},
+    {0,45226,0,4,1}, {0,45230,0,4,1}, {0,45234,0,4,1}, {0,9411,0,4,1},
+    {0,18967,0,4,1}, {0,45238,0,4,1}, {6849,7448,3,4,1}, {6852,1154,1,4,1},
+    {0,21308,0,4,1}, {0,11361,0,4,1}, {0,35639,0,4,1}, {0,19017,0,4,1},
+    {0,45258,0,4,1}, {0,45270,0,4,1}, {0,45274,0,4,1}, {6853,45278,1,4,1},
+    {0,19227,0,4,1}, {0,34741,0,4,1}, {6854,2205,2,4,1}, {0,24418,0,4,1},
+    {0,15452,0,4,1}, {6856,19367,2,4,1}, {0,35178,0,4,1}, {6858,4401,1,4,1},
+    {0,18196,0,4,1}, {0,40796,0,4,1}, {0,45338,0,4,1}, {0,45390,0,4,1},
+    {0,17948,0,4,1}, {6859,2196,9,4,1}, {0,45410,0,4,1}, {0,45414,0,4,1},
+    {0,14601,0,4,1}, {0,16152,0,4,1}, {0,45422,0,4,1}, {0,3149,0,4,1},
+    {0,36564,0,4,1}, {0,45434,0,4,1}, {6868,45438,1,4,1}, {0,129,0,4,1},
+    {0,8849,0,4,1}, {0,15782,0,4,1}, {0,45450,0,4,1}, {0,11916,0,4,1},
+    {0,45454,0,4,1}, {0,262,0,4,1}, {0,4925,0,4,1}, {0,7215,0,4,1},
+    {0,45462,0,4,1}, {0,45466,0,4,1}, {0,45470,0,4,1}, {0,2884,0,4,1},
+    {0,12556,0,4,1}, {0,45482,0,4,1}, {0,4365,0,4,1}, {0,45490,0,4,1},
+    {6869,29946,2,4,1}, {0,45498,0,4,1}, {0,45502,0,4,1}, {0,45506,0,4,1},
+    {0,45514,0,4,1}, {0,5391,0,4,1}, {6871,7094,3,4,1}, {0,30154,0,4,1},
+    {0,45522,0,4,1}, {0,8623,0,4,1}, {6874,188,17,4,1}, {0,18061,0,4,1},
+    {0,45526,0,4,1}, {0,45530,0,4,1}, {0,24622,0,4,1}, {0,45546,0,4,1},
+    {0,26142,0,4,1}, {0,9277,0,4,1}, {0,45570,0,4,1}, {0,3881,0,4,1},
+    {0,45582,0,4,1}, {6891,44205,2,4,1}, {0,15105,0,4,1}, {0,10046,0,4,1},
+    {0,45590,0,4,1}, {0,45598,0,4,1}, {0,4397,0,4,1}, {0,45618,0,4,1},
+    {0,16339,0,4,1}, {0,23156,0,4,1}, {0,45682,0,4,1}, {0,45686,0,4,1},
+    {0,45690,0,4,1}, {0,45698,0,4,1}, {0,45702,0,4,1}, {0,33394,0,4,1},
+    {0,45710,0,4,1}, {0,45714,0,4,1}, {6893,14612,1,4,1}, {0,3795,0,4,1},
+    {0,3264,0,4,1}, {0,45746,0,4,1}, {0,12592,0,4,1}, {0,35439,0,4,1},
+    {0,45758,0,4,1}, {6894,10135,4,4,1}, {0,45762,0,4,1}, {0,45766,0,4,1},
+    {0,45774,0,4,1}, {0,45778,0,4,1}, {0,45786,0,4,1}, {0,14412,0,5,1},
+    {0,42044,0,5,1}, {0,42049,0,5,1}, {0,42079,0,5,1}, {0,42084,0,5,1},
+    {0,42104,0,5,1}, {0,5575,0,5,1}, {0,42139,0,5,1}, {0,42149,0,5,1},
+    {0,4922,0,5,1}, {0,42159,0,5,1}, {0,42194,0,5,1}, {0,42224,0,5,1},
+    {0,42234,0,5,1}, {0,10880,0,5,1}, {0,42254,0,5,1}, {0,42269,0,5,1},
+    {0,14488,0,5,1}, {0,42304,0,5,1}, {0,42314,0,5,1}, {0,42329,0,5,1},
+    {0,42334,0,5,1}, {0,12375,0,5,1}, {0,42359,0,5,1}, {0,11000,0,5,1},
+    {6898,2855,27,5,1}, {0,42364,0,5,1}, {6925,26490,1,5,1}, {0,42374,0,5,1},
+    {0,42389,0,5,1}, {0,42399,0,5,1}, {0,42419,0,5,1}, {0,42434,0,5,1},
+    {0,42449,0,5,1}, {0,12087,0,5,1}, {0,42484,0,5,1}, {6926,42509,1,5,1},
+    {0,42529,0,5,1}, {0,9078,0,5,1}, {0,42539,0,5,1}, {6927,42559,1,5,1},
+    {0,42574,0,5,1}, {0,42599,0,5,1}, {0,42629,0,5,1}, {0,23474,0,5,1},
+    {0,42674,0,5,1}, {0,9315,0,5,1}, {0,42689,0,5,1}, {0,42714,0,5,1},
+    {0,42719,0,5,1}, {0,42724,0,5,1}, {0,42729,0,5,1}, {0,18582,0,5,1},
+    {0,42769,0,5,1}, {6928,12831,1,5,1}, {0,42779,0,5,1}, {0,42784,0,5,1},
+    {0,5447,0,5,1}, {0,42864,0,5,1}, {0,42879,0,5,1}, {0,7218,0,5,1},
+    {0,42889,0,5,1}, {0,34068,0,5,1}, {0,30119,0,5,1}, {0,43004,0,5,1},
+    {0,43079,0,5,1}, {0,43149,0,5,1}, {0,43169,0,5,1}, {0,43179,0,5,1},
+    {0,43194,0,5,1}, {0,43214,0,5,1}, {0,43219,0,5,1}, {0,23308,0,5,1},
+    {0,43224,0,5,1}, {0,43229,0,5,1}, {0,43234,0,5,1}, {0,4885,0,5,1},
+    {0,43264,0,5,1}, {0,43299,0,5,1}, {0,43304,0,5,1}, {6929,23461,1,5,1},
+    {0,43344,0,5,1}, {0,43379,0,5,1}, {0,43384,0,5,1}, {0,9260,0,5,1},
+    {0,43504,0,5,1}, {0,43524,0,5,1}, {0,43529,0,5,1}, {0,43544,0,5,1},
+    {0,43549,0,5,1}, {0,43634,0,5,1}, {0,43644,0,5,1}, {0,11295,0,5,1},
+    {0,43724,0,5,1}, {0,43739,0,5,1}, {6930,43744,1,5,1}, {0,43774,0,5,1},
+    {0,3069,0,5,1}, {0,43784,0,5,1}, {6931,17652,1,5,1}, {0,43794,0,5,1},
+    {0,43804,0,5,1}, {0,4902,0,5,1}, {0,29634,0,5,1}, {0,43814,0,5,1},
+    {0,1557,0,5,1}, {0,11232,0,5,1}, {0,43869,0,5,1}, {0,39883,0,5,1},
+    {0,43874,0,5,1}, {6932,9273,3,5,1}, {0,43909,0,5,1}, {0,43929,0,5,1},
+    {0,43989,0,5,1}, {0,44059,0,5,1}, {0,14670,0,5,1}, {0,44074,0,5,1},
+    {0,44079,0,5,1}, {0,44084,0,5,1}, {0,44119,0,5,1}, {0,44129,0,5,1},
+    {0,4191,0,5,1}, {0,44134,0,5,1}, {0,44164,0,5,1}, {6935,1489,3,5,1},
+    {0,20241,0,5,1}, {0,44199,0,5,1}, {6938,11103,3,5,1}, {0,44219,0,5,1},
+    {0,23276,0,5,1}, {0,44224,0,5,1}, {0,44244,0,5,1}, {0,30616,0,5,1},
+    {0,44319,0,5,1}, {0,273,0,5,1}, {0,44334,0,5,1}, {6941,44339,1,5,1},
+    {0,43152,0,5,1}, {0,44359,0,5,1}, {0,44364,0,5,1}, {0,44369,0,5,1},
+    {0,44374,0,5,1}, {6942,8862,1,5,1}, {0,36365,0,5,1}, {0,44384,0,5,1},
+    {0,44399,0,5,1}, {0,44414,0,5,1}, {0,44519,0,5,1}, {0,44524,0,5,1},
+    {0,44529,0,5,1}, {0,44539,0,5,1}, {0,44549,0,5,1}, {0,6032,0,5,1},
+    {0,44554,0,5,1}, {0,44559,0,5,1}, {0,31162,0,5,1}, {0,44569,0,5,1},
+    {0,44574,0,5,1}, {0,44589,0,5,1}, {0,36853,0,6,1}, {0,36859,0,6,1},
+    {0,36865,0,6,1}, {0,18111,0,6,1}, {0,36883,0,6,1}, {0,36901,0,6,1},
+    {0,36907,0,6,1}, {0,36931,0,6,1}, {0,36937,0,6,1}, {0,36943,0,6,1},
+    {0,21256,0,6,1}, {0,36973,0,6,1}, {0,37003,0,6,1}, {0,37063,0,6,1},
+    {0,37111,0,6,1}, {0,37123,0,6,1}, {0,18081,0,6,1}, {0,37147,0,6,1},
+    {0,37201,0,6,1}, {0,37207,0,6,1}, {0,37225,0,6,1}, {0,4231,0,6,1},
+    {0,32060,0,6,1}, {0,37273,0,6,1}, {0,6994,0,6,1}, {0,37291,0,6,1},
+    {0,37327,0,6,1}, {0,37333,0,6,1}, {0,37345,0,6,1}, {0,37357,0,6,1},
+    {0,37363,0,6,1}, {0,37375,0,6,1}, {0,37381,0,6,1}, {0,37387,0,6,1},
+    {0,32368,0,6,1}, {0,14440,0,6,1}, {0,32403,0,6,1}, {0,37441,0,6,1},
+    {0,37447,0,6,1}, {0,37459,0,6,1}, {0,37477,0,6,1}, {0,37483,0,6,1},
+    {6943,7442,1,6,1}, {0,3123,0,6,1}, {0,15039,0,6,1}, {0,37531,0,6,1},
+    {0,37537,0,6,1}, {0,37543,0,6,1}, {0,37621,0,6,1}, {0,37627,0,6,1},
+    {6944,5996,1,6,1}, {6945,37645,2,6,1}, {0,2052,0,6,1}, {0,6742,0,6,1},
+    {0,37687,0,6,1}, {0,37771,0,6,1}, {0,37789,0,6,1}, {0,4961,0,6,1},
+    {0,37843,0,6,1}, {0,37867,0,6,1}, {0,1073,0,6,1}, {0,18327,0,6,1},
+    {0,37927,0,6,1}, {6947,291,1,6,1}, {0,38083,0,6,1}, {0,38125,0,6,1},
+    {0,9337,0,6,1}, {0,15226,0,6,1}, {0,38185,0,6,1}, {0,38251,0,6,1},
+    {0,38275,0,6,1}, {0,38281,0,6,1}, {0,38305,0,6,1}, {0,38323,0,6,1},
+    {0,38353,0,6,1}, {0,38449,0,6,1}, {0,38515,0,6,1}, {0,38521,0,6,1},
+    {0,38593,0,6,1}, {0,38689,0,6,1}, {0,38719,0,6,1}, {0,15072,0,6,1},
+    {0,38737,0,6,1}, {0,6004,0,6,1}, {0,38773,0,6,1}, {0,38791,0,6,1},
+    {0,38827,0,6,1}, {0,38863,0,6,1}, {0,5231,0,6,1}, {0,38875,0,6,1},
+    {0,11402,0,6,1}, {0,38941,0,6,1}, {0,10838,0,6,1}, {0,39193,0,6,1},
+    {0,39205,0,6,1}, {0,39211,0,6,1}, {6948,1204,551,6,1}, {0,2190,0,6,1},
+    {0,39337,0,6,1}, {0,1190,0,6,1}, {0,39457,0,6,1}, {0,39463,0,6,1},
+    {0,39493,0,6,1}, {0,39505,0,6,1}, {0,8911,0,6,1}, {0,15595,0,6,1},
+    {7499,7610,3,6,1}, {0,39619,0,6,1}, {7502,15628,1,6,1}, {0,21028,0,6,1},
+    {0,39721,0,6,1}, {7503,29004,1,6,1}, {0,39733,0,6,1}, {0,39739,0,6,1},
+    {0,39835,0,6,1}, {0,39841,0,6,1}, {0,39871,0,6,1}, {0,39883,0,6,1},
+    {0,39895,0,6,1}, {0,39901,0,6,1}, {7504,2118,1,6,1}, {0,39925,0,6,1},
+    {0,39931,0,6,1}, {0,39973,0,6,1}, {0,2884,0,6,1}, {0,19787,0,6,1},
+    {0,40039,0,6,1}, {0,24280,0,6,1}, {0,15149,0,6,1}, {0,29772,0,6,1},
+    {0,10922,0,6,1}, {0,19991,0,6,1}, {0,40171,0,6,1}, {0,40255,0,6,1},
+    {0,7355,0,6,1}, {0,12536,0,6,1}, {0,40303,0,6,1}, {0,40345,0,6,1},
+    {0,40381,0,6,1}, {0,40387,0,6,1}, {0,40399,0,6,1}, {0,40459,0,6,1},
+    {0,40513,0,6,1}, {0,40525,0,6,1}, {0,40531,0,6,1}, {0,40537,0,6,1},
+    {0,40555,0,6,1}, {0,40561,0,6,1}, {0,40573,0,6,1}, {0,40669,0,6,1},
+    {0,2268,0,6,1}, {0,40795,0,6,1}, {0,40921,0,6,1}, {0,40927,0,6,1},
+    {0,40933,0,6,1}, {0,31034,0,6,1}, {0,7694,0,6,1}, {0,40951,0,6,1},
+    {0,40957,0,6,1}, {0,40969,0,6,1}, {0,41005,0,6,1}, {0,41035,0,6,1},
+    {0,41065,0,6,1}, {0,41083,0,6,1}, {0,17333,0,6,1}, {0,41197,0,6,1},
+    {0,41233,0,6,1}, {0,31404,0,6,1}, {0,41251,0,6,1}, {0,41257,0,6,1},
+    {0,41275,0,6,1}, {7505,41281,10,6,1}, {7515,41293,6,6,1}, {0,41299,0,6,1},
+    {0,41311,0,6,1}, {0,41317,0,6,1}, {0,41329,0,6,1}, {0,41335,0,6,1},
+    {0,41341,0,6,1}, {0,41347,0,6,1}, {0,41353,0,6,1}, {0,41359,0,6,1},
+    {0,41365,0,6,1}, {0,41377,0,6,1}, {0,41389,0,6,1}, {0,41395,0,6,1},
+    {0,41401,0,6,1}, {0,41413,0,6,1}, {0,41425,0,6,1}, {0,41431,0,6,1},
+    {0,41443,0,6,1}, {0,41449,0,6,1}, {0,41455,0,6,1}, {0,41461,0,6,1},
+    {0,41479,0,6,1}, {0,41485,0,6,1}, {0,41491,0,6,1}, {0,41497,0,6,1},
+    {0,41503,0,6,1}, {0,6677,0,6,1}, {0,41515,0,6,1}, {0,41533,0,6,1},
+    {0,41551,0,6,1}, {0,41569,0,6,1}, {0,41623,0,6,1}, {0,41635,0,6,1},
+    {0,41659,0,6,1}, {0,41665,0,6,1}, {0,41671,0,6,1}, {0,41677,0,6,1},
+    {0,41683,0,6,1}, {0,41707,0,6,1}, {0,41713,0,6,1}, {0,41719,0,6,1},
+    {0,13970,0,6,1}, {0,41743,0,6,1}, {0,41755,0,6,1}, {0,41761,0,6,1},
+    {0,41767,0,6,1}, {0,41809,0,6,1}, {0,41857,0,6,1}, {0,41863,0,6,1},
+    {0,41869,0,6,1}, {0,41881,0,6,1}, {0,41893,0,6,1}, {0,41899,0,6,1},
+    {0,41911,0,6,1}, {0,41917,0,6,1}, {0,41923,0,6,1}, {0,41941,0,6,1},
+    {0,41959,0,6,1}, {0,41965,0,6,1}, {7521,41977,6,6,1}, {0,41995,0,6,1},
+    {0,42001,0,6,1}, {0,42007,0,6,1}, {0,42013,0,6,1}, {0,31521,0,7,1},
+    {7527,31535,1,7,1}, {0,31549,0,7,1}, {0,31619,0,7,1}, {0,31633,0,7,1},
+    {0,31703,0,7,1}, {0,31717,0,7,1}, {0,31724,0,7,1}, {0,31738,0,7,1},
+    {0,31752,0,7,1}, {0,31829,0,7,1}, {0,31843,0,7,1}, {0,31857,0,7,1},
+    {0,31885,0,7,1}, {0,31948,0,7,1}, {0,31990,0,7,1}, {0,17767,0,7,1},
+    {0,32053,0,7,1}, {0,32060,0,7,1}, {0,6979,0,7,1}, {0,32130,0,7,1},
+    {0,32179,0,7,1}, {0,32228,0,7,1}, {0,32263,0,7,1}, {0,11365,0,7,1},
+    {0,32284,0,7,1}, {0,32291,0,7,1}, {0,32305,0,7,1}, {0,32312,0,7,1},
+    {0,32319,0,7,1}, {0,6972,0,7,1}, {0,32333,0,7,1}, {0,5989,0,7,1},
+    {0,32368,0,7,1}, {0,32375,0,7,1}, {0,32389,0,7,1}, {0,32403,0,7,1},
+    {0,81,0,7,1}, {7528,2016,1,7,1}, {0,32487,0,7,1}, {0,32697,0,7,1},
+    {0,4900,0,7,1}, {0,32718,0,7,1}, {0,11096,0,7,1}, {0,32739,0,7,1},
+    {0,32746,0,7,1}, {0,32760,0,7,1}, {0,32802,0,7,1}, {0,32809,0,7,1},
+    {0,32816,0,7,1}, {0,32837,0,7,1}, {0,32844,0,7,1}, {0,32872,0,7,1},
+    {0,32900,0,7,1}, {0,33299,0,7,1}, {0,17520,0,7,1}, {0,33348,0,7,1},
+    {0,33446,0,7,1}, {0,33530,0,7,1}, {0,33544,0,7,1}, {0,33614,0,7,1},
+    {0,33628,0,7,1}, {0,11312,0,7,1}, {0,33684,0,7,1}, {7529,5462,1,7,1},
+    {0,33712,0,7,1}, {0,33719,0,7,1}, {0,33733,0,7,1}, {0,33908,0,7,1},
+    {0,33999,0,7,1}, {0,34020,0,7,1}, {0,34237,0,7,1}, {0,11708,0,7,1},
+    {0,34377,0,7,1}, {0,34398,0,7,1}, {0,34419,0,7,1}, {0,34426,0,7,1},
+    {0,34454,0,7,1}, {0,34496,0,7,1}, {0,34503,0,7,1}, {0,34650,0,7,1},
+    {0,34783,0,7,1}, {0,34944,0,7,1}, {0,34951,0,7,1}, {7530,3261,5,7,1},
+    {0,34965,0,7,1}, {0,35161,0,7,1}, {0,35175,0,7,1}, {0,7077,0,7,1},
+    {0,35252,0,7,1}, {0,35336,0,7,1}, {0,35357,0,7,1}, {0,35406,0,7,1},
+    {0,35469,0,7,1}, {0,35476,0,7,1}, {0,35497,0,7,1}, {0,35518,0,7,1},
+    {0,35532,0,7,1}, {0,35644,0,7,1}, {0,5822,0,7,1}, {0,35700,0,7,1},
+    {0,35714,0,7,1}, {7535,2214,1,7,1}, {0,35784,0,7,1}, {0,35875,0,7,1},
+    {0,35966,0,7,1}, {0,35994,0,7,1}, {7536,36022,1,7,1}, {0,36029,0,7,1},
+    {7537,5765,1,7,1}, {0,36127,0,7,1}, {0,36162,0,7,1}, {0,36169,0,7,1},
+    {0,36183,0,7,1}, {0,36190,0,7,1}, {0,36246,0,7,1}, {0,36302,0,7,1},
+    {0,36575,0,7,1}, {0,36582,0,7,1}, {0,36603,0,7,1}, {0,7742,0,7,1},
+    {7538,185,1,7,1}, {0,36631,0,7,1}, {0,36652,0,7,1}, {0,36659,0,7,1},
+    {0,36666,0,7,1}, {0,36729,0,7,1}, {0,36750,0,7,1}, {0,16336,0,7,1},
+    {0,36806,0,7,1}, {0,25842,0,8,1}, {0,25890,0,8,1}, {0,25922,0,8,1},
+    {0,25978,0,8,1}, {0,26050,0,8,1}, {0,26058,0,8,1}, {0,26066,0,8,1},
+    {0,26074,0,8,1}, {0,26178,0,8,1}, {0,26186,0,8,1}, {0,26210,0,8,1},
+    {0,26226,0,8,1}, {7539,16039,1,8,1}, {7540,26250,1,8,1}, {0,26338,0,8,1},
+    {0,26346,0,8,1}, {0,26354,0,8,1}, {0,26426,0,8,1}, {0,26434,0,8,1},
+    {0,26450,0,8,1}, {0,26458,0,8,1}, {0,26466,0,8,1}, {0,26506,0,8,1},
+    {0,5117,0,8,1}, {0,26634,0,8,1}, {0,26642,0,8,1}, {0,9234,0,8,1},
+    {0,26650,0,8,1}, {0,26666,0,8,1}, {0,21868,0,8,1}, {0,26698,0,8,1},
+    {0,7384,0,8,1}, {0,26834,0,8,1}, {0,26842,0,8,1}, {0,9806,0,8,1},
+    {0,26882,0,8,1}, {0,26906,0,8,1}, {0,26930,0,8,1}, {0,26970,0,8,1},
+    {0,27034,0,8,1}, {0,27178,0,8,1}, {0,27186,0,8,1}, {0,27194,0,8,1},
+    {0,27218,0,8,1}, {0,27314,0,8,1}, {0,27322,0,8,1}, {0,27426,0,8,1},
+    {0,27490,0,8,1}, {0,27554,0,8,1}, {0,27570,0,8,1}, {0,27634,0,8,1},
+    {0,27738,0,8,1}, {0,28458,0,8,1}, {0,28522,0,8,1}, {0,28586,0,8,1},
+    {0,28618,0,8,1}, {0,28666,0,8,1}, {0,28682,0,8,1}, {0,28690,0,8,1},
+    {0,28866,0,8,1}, {0,29362,0,8,1}, {0,5979,0,8,1}, {0,29514,0,8,1},
+    {7541,29530,1,8,1}, {0,29578,0,8,1}, {0,29650,0,8,1}, {0,29730,0,8,1},
+    {0,29738,0,8,1}, {0,29818,0,8,1}, {0,29866,0,8,1}, {0,4223,0,8,1},
+    {7542,30018,1,8,1}, {0,30138,0,8,1}, {0,30154,0,8,1}, {0,30218,0,8,1},
+    {0,30226,0,8,1}, {0,30306,0,8,1}, {0,30362,0,8,1}, {0,30786,0,8,1},
+    {0,30962,0,8,1}, {0,30994,0,8,1}, {0,31018,0,8,1}, {0,31154,0,8,1},
+    {0,31178,0,8,1}, {0,31194,0,8,1}, {0,31202,0,8,1}, {0,31210,0,8,1},
+    {0,31258,0,8,1}, {0,31394,0,8,1}, {0,31418,0,8,1}, {0,31450,0,8,1},
+    {0,31458,0,8,1}, {0,31466,0,8,1}, {0,31474,0,8,1}, {0,31482,0,8,1},
+    {0,31490,0,8,1}, {0,31498,0,8,1}, {0,31506,0,8,1}, {0,21157,0,9,1},
+    {0,21220,0,9,1}, {0,21229,0,9,1}, {0,21274,0,9,1}, {0,21292,0,9,1},
+    {0,21364,0,9,1}, {0,21517,0,9,1}, {0,21616,0,9,1}, {0,21778,0,9,1},
+    {7543,8839,3,9,1}, {0,3123,0,9,1}, {7546,10787,1,9,1}, {0,9012,0,9,1},
+    {0,22021,0,9,1}, {7547,782,1,9,1}, {0,22048,0,9,1}, {0,22120,0,9,1},
+    {0,22129,0,9,1}, {0,22210,0,9,1}, {0,22282,0,9,1}, {0,22444,0,9,1},
+    {0,22471,0,9,1}, {0,22480,0,9,1}, {0,22498,0,9,1}, {0,22642,0,9,1},
+    {0,297,0,9,1}, {0,23128,0,9,1}, {0,23218,0,9,1}, {0,23227,0,9,1},
+    {0,23272,0,9,1}, {0,23389,0,9,1}, {0,23407,0,9,1}, {0,23479,0,9,1},
+    {0,23506,0,9,1}, {0,23992,0,9,1}, {0,24001,0,9,1}, {0,24091,0,9,1},
+    {0,24154,0,9,1}, {0,24361,0,9,1}, {7548,2133,1,9,1}, {0,24685,0,9,1},
+    {0,24694,0,9,1}, {0,24730,0,9,1}, {0,2268,0,9,1}, {0,25126,0,9,1},
+    {0,25279,0,9,1}, {0,25315,0,9,1}, {0,25333,0,9,1}, {0,25342,0,9,1},
+    {0,25351,0,9,1}, {0,25387,0,9,1}, {0,25396,0,9,1}, {0,25414,0,9,1},
+    {0,25423,0,9,1}, {0,6332,0,9,1}, {7549,25441,10,9,1}, {0,25450,0,9,1},
+    {0,25477,0,9,1}, {0,25495,0,9,1}, {0,25549,0,9,1}, {0,25639,0,9,1},
+    {0,25648,0,9,1}, {0,25657,0,9,1}, {7559,25666,6,9,1}, {0,25675,0,9,1},
+    {0,25684,0,9,1}, {0,25693,0,9,1}, {0,25702,0,9,1}, {0,25711,0,9,1},
+    {0,25720,0,9,1}, {0,25747,0,9,1}, {0,25756,0,9,1}, {0,25765,0,9,1},
+    {0,25774,0,9,1}, {0,25792,0,9,1}, {0,4147,0,10,1}, {0,17507,0,10,1},
+    {0,17527,0,10,1}, {7565,17597,2,10,1}, {0,17657,0,10,1}, {0,17667,0,10,1},
+    {0,17767,0,10,1}, {0,17937,0,10,1}, {0,17957,0,10,1}, {0,17967,0,10,1},
+    {0,18177,0,10,1}, {0,18197,0,10,1}, {0,18237,0,10,1}, {0,18427,0,10,1},
+    {0,18547,0,10,1}, {0,18567,0,10,1}, {7567,19077,1,10,1}, {0,19237,0,10,1},
+    {0,19407,0,10,1}, {0,5632,0,10,1}, {0,19647,0,10,1}, {0,19657,0,10,1},
+    {0,19707,0,10,1}, {0,5557,0,10,1}, {0,19747,0,10,1}, {0,19847,0,10,1},
+    {0,20127,0,10,1}, {7568,20157,1,10,1}, {0,20267,0,10,1}, {0,20377,0,10,1},
+    {0,20387,0,10,1}, {0,20467,0,10,1}, {0,20477,0,10,1}, {0,20487,0,10,1},
+    {0,20497,0,10,1}, {0,20507,0,10,1}, {0,20517,0,10,1}, {0,20547,0,10,1},
+    {7569,20587,6,10,1}, {0,20597,0,10,1}, {0,20607,0,10,1}, {0,20617,0,10,1},
+    {0,20637,0,10,1}, {0,20647,0,10,1}, {0,20657,0,10,1}, {0,20687,0,10,1},
+    {0,20697,0,10,1}, {0,20707,0,10,1}, {0,20757,0,10,1}, {0,20807,0,10,1},
+    {0,20827,0,10,1}, {7575,20837,6,10,1}, {0,20857,0,10,1}, {0,20867,0,10,1},
+    {0,20927,0,10,1}, {0,20937,0,10,1}, {0,20947,0,10,1}, {0,20957,0,10,1},
+    {7581,21057,4,10,1}, {0,21067,0,10,1}, {0,21077,0,10,1}, {0,21087,0,10,1},
+    {0,21097,0,10,1}, {0,21107,0,10,1}, {0,21117,0,10,1}, {0,21127,0,10,1},
+    {0,21137,0,10,1}, {0,21147,0,10,1}, {0,14033,0,11,1}, {0,14154,0,11,1},
+    {0,14231,0,11,1}, {0,14242,0,11,1}, {0,14275,0,11,1}, {0,14330,0,11,1},
+    {0,14407,0,11,1}, {0,14440,0,11,1}, {0,14649,0,11,1}, {0,14660,0,11,1},
+    {0,14792,0,11,1}, {0,15023,0,11,1}, {0,15221,0,11,1}, {0,15265,0,11,1},
+    {0,15452,0,11,1}, {0,15595,0,11,1}, {0,15727,0,11,1}, {0,3149,0,11,1},
+    {0,15771,0,11,1}, {0,15793,0,11,1}, {0,15848,0,11,1}, {0,16321,0,11,1},
+    {0,16343,0,11,1}, {0,16354,0,11,1}, {0,16387,0,11,1}, {0,16409,0,11,1},
+    {0,16431,0,11,1}, {0,16442,0,11,1}, {0,16453,0,11,1}, {0,16464,0,11,1},
+    {0,16475,0,11,1}, {0,16508,0,11,1}, {0,16563,0,11,1}, {0,16574,0,11,1},
+    {0,16596,0,11,1}, {0,16618,0,11,1}, {0,16629,0,11,1}, {0,16651,0,11,1},
+    {0,16662,0,11,1}, {0,16706,0,11,1}, {0,16717,0,11,1}, {0,16728,0,11,1},
+    {0,16739,0,11,1}, {0,16750,0,11,1}, {0,16761,0,11,1}, {0,10334,0,11,1},
+    {0,16794,0,11,1}, {0,16805,0,11,1}, {7585,16827,6,11,1}, {0,16838,0,11,1},
+    {0,16871,0,11,1}, {0,16882,0,11,1}, {0,8134,0,11,1}, {0,16926,0,11,1},
+    {0,16937,0,11,1}, {0,16948,0,11,1}, {0,17003,0,11,1}, {0,17025,0,11,1},
+    {0,17058,0,11,1}, {0,17069,0,11,1}, {0,17091,0,11,1}, {0,17124,0,11,1},
+    {0,17135,0,11,1}, {0,17157,0,11,1}, {0,17168,0,11,1}, {0,17179,0,11,1},
+    {0,17256,0,11,1}, {0,17267,0,11,1}, {0,17289,0,11,1}, {0,17322,0,11,1},
+    {0,11012,0,12,1}, {0,11816,0,12,1}, {0,12416,0,12,1}, {0,12728,0,12,1},
+    {0,12860,0,12,1}, {0,12872,0,12,1}, {7591,12884,4,12,1}, {0,12908,0,12,1},
+    {0,12920,0,12,1}, {0,12932,0,12,1}, {0,13076,0,12,1}, {0,13184,0,12,1},
+    {0,13196,0,12,1}, {0,13208,0,12,1}, {0,13220,0,12,1}, {0,13232,0,12,1},
+    {0,13244,0,12,1}, {0,13256,0,12,1}, {0,13268,0,12,1}, {0,13292,0,12,1},
+    {0,13304,0,12,1}, {0,13316,0,12,1}, {0,13328,0,12,1}, {0,13676,0,12,1},
+    {0,13688,0,12,1}, {0,13724,0,12,1}, {0,13736,0,12,1}, {0,13748,0,12,1},
+    {0,13760,0,12,1}, {0,13772,0,12,1}, {0,13784,0,12,1}, {0,13796,0,12,1},
+    {0,2718,0,12,1}, {0,13808,0,12,1}, {0,13820,0,12,1}, {0,13832,0,12,1},
+    {0,13844,0,12,1}, {0,13856,0,12,1}, {0,13868,0,12,1}, {0,13880,0,12,1},
+    {0,13916,0,12,1}, {0,13928,0,12,1}, {0,13940,0,12,1}, {0,13952,0,12,1},
+    {0,13964,0,12,1}, {0,13976,0,12,1}, {0,13988,0,12,1}, {0,9216,0,13,1},
+    {0,9411,0,13,1}, {0,9970,0,13,1}, {0,10139,0,13,1}, {0,10230,0,13,1},
+    {0,10256,0,13,1}, {0,10295,0,13,1}, {0,10308,0,13,1}, {0,10334,0,13,1},
+    {0,10633,0,13,1}, {0,10698,0,13,1}, {0,10711,0,13,1}, {0,6734,0,14,1},
+    {0,6832,0,14,1}, {0,6972,0,14,1}, {0,7406,0,14,1}, {0,7742,0,14,1},
+    {0,7784,0,14,1}, {0,7798,0,14,1}, {0,7826,0,14,1}, {0,7854,0,14,1},
+    {0,7938,0,14,1}, {0,7952,0,14,1}, {0,7980,0,14,1}, {0,8078,0,14,1},
+    {0,8092,0,14,1}, {0,8106,0,14,1}, {0,8120,0,14,1}, {0,8134,0,14,1},
+    {0,8148,0,14,1}, {0,8162,0,14,1}, {0,8176,0,14,1}, {0,8274,0,14,1},
+    {0,8414,0,14,1}, {0,8442,0,14,1}, {0,8456,0,14,1}, {0,8470,0,14,1},
+    {0,8484,0,14,1}, {0,8498,0,14,1}, {0,8512,0,14,1}, {0,8526,0,14,1},
+    {0,4892,0,15,1}, {0,5627,0,15,1}, {0,5822,0,15,1}, {0,6182,0,15,1},
+    {0,6197,0,15,1}, {0,6272,0,15,1}, {0,6287,0,15,1}, {0,6302,0,15,1},
+    {0,6317,0,15,1}, {0,6332,0,15,1}, {0,6587,0,15,1}, {0,6602,0,15,1},
+    {0,6617,0,15,1}, {0,6632,0,15,1}, {0,6647,0,15,1}, {0,6677,0,15,1},
+    {0,4573,0,16,1}, {0,4717,0,16,1}, {0,4733,0,16,1}, {0,4749,0,16,1},
+    {0,4797,0,16,1}, {0,4813,0,16,1}, {0,4829,0,16,1}, {0,4845,0,16,1},
+    {0,4861,0,16,1}, {0,3455,0,17,1}, {0,3472,0,17,1}, {0,3489,0,17,1},
+    {0,3557,0,17,1}, {0,3574,0,17,1}, {0,3591,0,17,1}, {0,3676,0,17,1},
+    {0,2178,0,18,1}, {0,2268,0,18,1}, {0,2448,0,18,1}, {0,2592,0,18,1},
+    {0,2700,0,18,1}, {0,2718,0,18,1}, {0,2736,0,18,1}, {0,2808,0,18,1},
+    {0,1866,0,19,1}, {0,1885,0,19,1}, {0,1370,0,20,1}, {0,1029,0,21,1},
+    {0,605,0,22,1}, {0,494,0,23,1}, {0,378,0,24,1}, {0,36,0,33,1},
+    {0,19,0,3,1}, {0,45895,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5670,0,3,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1}, {0,26138,0,8,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,4,0,2,1}, {0,19,0,3,1}, {0,3261,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,19,0,3,1}, {0,3261,0,3,1},
+    {0,8911,0,3,1}, {0,7077,0,3,1}, {0,17228,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,26138,0,8,1}, {0,4,0,2,1}, {0,19,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,28168,0,4,1}, {0,45362,0,4,1},
+    {0,11232,0,5,1}, {0,32298,0,7,1}, {0,26138,0,8,1}, {0,4,0,2,1},
+    {0,1106,0,2,1}, {0,12739,0,2,1}, {0,189,0,2,1}, {0,635,0,2,1},
+    {0,10855,0,2,1}, {0,11247,0,3,1}, {7595,19,1,3,1}, {0,10787,0,3,1},
+    {0,42237,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1192,0,3,1}, {0,14418,0,4,1},
+    {0,39265,0,6,1}, {0,2190,0,6,1}, {0,40111,0,6,1}, {0,872,0,3,1},
+    {7596,517,1,2,1}, {7597,4,1,2,1}, {0,12739,0,2,1}, {0,5,0,2,1},
+    {0,45790,0,3,1}, {0,42239,0,3,1}, {0,44678,0,4,1}, {0,23472,0,4,1},
+    {0,282,0,4,1}, {0,42024,0,5,1}, {7598,29458,2,8,0}, {7600,22201,1,9,0},
+    {7601,22219,2,9,2}, {0,23299,0,9,1}, {0,14022,0,11,1}, {0,11912,0,12,1},
+    {0,9060,0,13,1}, {0,9073,0,13,1}, {0,520,0,2,1}, {0,83,0,2,1},
+    {0,950,0,2,1}, {0,568,0,2,1}, {0,1860,0,2,1}, {0,3117,0,3,1},
+    {0,5321,0,3,1}, {7603,19,3,3,1}, {7606,10787,9,3,1}, {7615,872,5,3,1},
+    {0,3261,0,3,1}, {0,46048,0,3,1}, {0,7077,0,3,1}, {0,46102,0,3,1},
+    {0,8895,0,3,1}, {0,6827,0,3,1}, {0,15444,0,4,1}, {0,23472,0,4,1},
+    {0,19,0,3,1}, {0,390,0,2,1}, {0,27,0,2,1}, {0,828,0,2,1},
+    {0,1775,0,2,1}, {0,1749,0,2,1}, {0,829,0,2,1}, {0,12174,0,2,1},
+    {0,150,0,3,1}, {0,1487,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1}, {0,23472,0,4,1},
+    {0,19367,0,4,1}, {0,930,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,26138,0,8,1}, {0,4,0,2,1}, {0,2617,0,2,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,23472,0,4,1}, {0,11103,0,5,1}, {0,517,0,2,1},
+    {0,26138,0,8,1}, {7620,28250,1,8,0}, {0,30794,0,8,2}, {0,17397,0,10,1},
+    {0,20417,0,10,1}, {0,11912,0,12,1}, {7621,2124,1,18,0}, {0,872,0,3,1},
+    {0,614,0,1,1}, {0,206,0,1,1}, {0,33,0,1,1}, {0,183,0,1,1},
+    {0,1375,0,1,1}, {0,1378,0,1,1}, {0,491,0,1,1}, {0,445,0,1,1},
+    {0,1377,0,1,1}, {0,34,0,1,1}, {0,26,0,1,1}, {0,187,0,1,1},
+    {0,4,0,1,1}, {0,81,0,1,1}, {0,8,0,1,1}, {0,94,0,1,1},
+    {0,30,0,1,1}, {0,31,0,1,1}, {0,9,0,1,1}, {0,655,0,1,1},
+    {0,932,0,1,1}, {0,17,0,1,1}, {0,21,0,1,1}, {0,1,0,1,1},
+    {0,5,0,1,1}, {0,129,0,1,1}, {0,646,0,1,1}, {0,6,0,1,1},
+    {0,11,0,1,1}, {0,15,0,1,1}, {0,22,0,1,1}, {0,159,0,1,1},
+    {0,185,0,1,1}, {0,0,0,1,1}, {0,1203,0,1,1}, {0,289,0,1,1},
+    {0,14165,0,5,1}, {0,26138,0,8,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4,0,2,1},
+    {0,5,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,7077,0,3,1},
+    {0,4,0,2,1}, {0,19,0,3,1}, {0,18,0,3,1}, {0,10787,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,2674,0,3,1}, {0,7167,0,4,1},
+    {0,23472,0,4,1}, {0,20267,0,4,1}, {0,42129,0,5,1}, {0,26754,0,5,1},
+    {0,43379,0,5,1}, {0,22050,0,5,1}, {0,18111,0,6,1}, {0,31759,0,7,1},
+    {0,34538,0,7,1}, {0,36267,0,7,1}, {0,26138,0,8,1}, {0,19747,0,10,1},
+    {0,14110,0,11,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,2617,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,2124,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,185,0,3,1}, {0,7167,0,4,1}, {0,4193,0,4,1}, {0,3909,0,4,1},
+    {0,23472,0,4,1}, {0,14612,0,4,1}, {0,43994,0,5,1}, {0,44329,0,5,1},
+    {0,39265,0,6,1}, {0,39487,0,6,1}, {0,39703,0,6,1}, {0,39811,0,6,1},
+    {0,31934,0,7,1}, {0,32207,0,7,1}, {0,32452,0,7,1}, {0,32627,0,7,1},
+    {0,1190,0,7,1}, {0,35525,0,7,1}, {0,25850,0,8,1}, {0,26746,0,8,1},
+    {0,26754,0,8,1}, {0,27546,0,8,1}, {0,28674,0,8,1}, {0,29314,0,8,1},
+    {0,29602,0,8,1}, {0,22624,0,9,1}, {0,18037,0,10,1}, {0,19287,0,10,1},
+    {0,20167,0,10,1}, {0,20237,0,10,1}, {0,14418,0,11,1}, {0,15782,0,11,1},
+    {0,9671,0,13,1}, {0,187,0,1,1}, {0,1052,0,2,1}, {0,22683,0,2,1},
+    {0,2062,0,2,1}, {0,1004,0,2,1}, {0,2617,0,2,1}, {0,45796,0,3,1},
+    {0,19699,0,3,1}, {0,791,0,3,1}, {0,7167,0,3,1}, {0,34019,0,3,1},
+    {0,1486,0,3,1}, {0,45799,0,3,1}, {0,4166,0,3,1}, {0,1086,0,3,1},
+    {0,45814,0,3,1}, {0,18283,0,3,1}, {0,45085,0,3,1}, {0,45820,0,3,1},
+    {0,42565,0,3,1}, {0,45856,0,3,1}, {0,45859,0,3,1}, {0,45865,0,3,1},
+    {7622,19,3,3,1}, {0,45871,0,3,1}, {0,32389,0,3,1}, {0,6965,0,3,1},
+    {0,4596,0,3,1}, {0,4630,0,3,1}, {0,5147,0,3,1}, {0,20168,0,3,1},
+    {0,18,0,3,1}, {0,10787,0,3,1}, {0,5136,0,3,1}, {0,45901,0,3,1},
+    {0,844,0,3,1}, {0,127,0,3,1}, {0,11005,0,3,1}, {0,9331,0,3,1},
+    {0,9008,0,3,1}, {0,45919,0,3,1}, {0,45922,0,3,1}, {0,45928,0,3,1},
+    {0,45934,0,3,1}, {0,45946,0,3,1}, {0,5342,0,3,1}, {0,45952,0,3,1},
+    {7625,872,27,3,1}, {0,12226,0,3,1}, {0,21614,0,3,1}, {0,539,0,3,1},
+    {0,3939,0,3,1}, {0,26040,0,3,1}, {0,45985,0,3,1}, {0,4565,0,3,1},
+    {0,4086,0,3,1}, {7652,11368,27,3,1}, {0,15285,0,3,1}, {0,1314,0,3,1},
+    {0,2986,0,3,1}, {0,1581,0,3,1}, {0,6744,0,3,1}, {0,1204,0,3,1},
+    {0,3261,0,3,1}, {0,5670,0,3,2}, {0,4176,0,3,1}, {0,1443,0,3,1},
+    {0,5440,0,3,1}, {0,14900,0,3,1}, {0,7077,0,3,1}, {0,10421,0,3,1},
+    {0,37859,0,3,1}, {0,5632,0,3,1}, {0,17755,0,3,1}, {0,20369,0,3,1},
+    {0,46084,0,3,1}, {0,46105,0,3,1}, {0,3125,0,3,1}, {0,3975,0,3,1},
+    {0,12248,0,3,1}, {0,29300,0,3,1}, {0,46126,0,3,1}, {0,46132,0,3,1},
+    {0,46135,0,3,1}, {0,46147,0,3,1}, {0,10765,0,3,1}, {0,5870,0,3,1},
+    {0,199,0,3,1}, {0,46165,0,3,1}, {0,46168,0,3,1}, {0,1192,0,3,1},
+    {0,11418,0,3,1}, {0,14048,0,3,1}, {0,46192,0,3,1}, {0,46237,0,3,1},
+    {0,3909,0,4,1}, {0,14418,0,4,1}, {0,44954,0,4,1}, {0,45582,0,4,1},
+    {0,45694,0,4,1}, {0,14612,0,4,1}, {0,42094,0,5,1}, {0,42209,0,5,1},
+    {0,42584,0,5,1}, {0,42999,0,5,1}, {0,43479,0,5,1}, {0,11232,0,5,1},
+    {0,43999,0,5,1}, {0,36847,0,6,1}, {0,37285,0,6,1}, {0,37411,0,6,1},
+    {0,37717,0,6,1}, {0,38851,0,6,1}, {0,38857,0,6,1}, {0,38887,0,6,1},
+    {0,39199,0,6,1}, {0,39643,0,6,1}, {0,39685,0,6,1}, {0,39877,0,6,1},
+    {0,31836,0,7,1}, {0,32830,0,7,1}, {0,33453,0,7,1}, {0,34643,0,7,1},
+    {0,35028,0,7,1}, {0,26162,0,8,1}, {0,26322,0,8,1}, {0,26514,0,8,1},
+    {0,26546,0,8,1}, {0,28490,0,8,1}, {0,29778,0,8,1}, {0,29786,0,8,1},
+    {0,12344,0,8,1}, {0,29898,0,8,1}, {0,30250,0,8,1}, {0,21346,0,9,1},
+    {0,22804,0,9,1}, {0,24190,0,9,1}, {0,19807,0,10,1}, {0,19817,0,10,1},
+    {0,15892,0,11,1}, {0,8735,0,13,1}, {0,185,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,4,0,2,1}, {0,7077,0,3,1}, {0,1098,0,2,1},
+    {7679,19,1,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,34832,0,7,1},
+    {0,23461,0,9,1}, {0,801,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,45961,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,734,0,2,1}, {0,1902,0,2,1}, {0,4,0,2,1}, {0,624,0,2,1},
+    {0,5008,0,2,1}, {0,943,0,2,1}, {0,3940,0,2,1}, {0,6458,0,2,1},
+    {0,78,0,2,1}, {0,83,0,2,1}, {0,5544,0,2,1}, {0,154,0,2,1},
+    {0,543,0,2,1}, {0,13332,0,2,1}, {0,931,0,2,1}, {0,5626,0,2,1},
+    {0,42154,0,5,2}, {0,14165,0,5,1}, {0,43534,0,5,1}, {0,26138,0,8,1},
+    {0,11912,0,12,1}, {0,45880,0,3,1}, {7680,44184,1,5,0}, {0,40759,0,6,1},
+    {0,32256,0,7,1}, {0,29002,0,8,1}, {0,22147,0,9,1}, {0,24298,0,9,1},
+    {0,14869,0,11,1}, {0,8995,0,13,1}, {0,872,0,3,1}, {0,26138,0,8,1},
+    {0,45790,0,3,1}, {0,44678,0,4,1}, {7681,32844,2,4,0}, {0,42024,0,5,1},
+    {0,37921,0,6,1}, {0,26611,0,7,1}, {7683,32781,1,7,2}, {0,35959,0,7,1},
+    {0,26138,0,8,1}, {0,23299,0,9,1}, {0,17397,0,10,1}, {0,11912,0,12,1},
+    {0,7448,0,14,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,1106,0,2,1},
+    {0,872,0,2,1}, {0,19359,0,2,1}, {0,6458,0,2,1}, {0,5,0,2,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,782,0,3,1}, {0,2124,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,850,0,4,1}, {0,45010,0,4,1},
+    {0,39799,0,6,1}, {0,21472,0,9,1}, {0,6077,0,15,1}, {0,36844,0,3,4},
+    {0,4,0,2,1}, {0,42237,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,26138,0,8,1}, {0,4,0,2,1}, {0,19,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,517,0,2,1}, {0,2995,0,2,1}, {0,7872,0,2,1},
+    {0,46092,0,2,1}, {0,4564,0,2,1}, {0,5377,0,2,1}, {0,3486,0,2,1},
+    {0,1884,0,2,1}, {0,10134,0,2,1}, {0,661,0,2,1}, {0,1027,0,2,1},
+    {0,200,0,2,1}, {0,70,0,2,1}, {0,1855,0,2,1}, {0,936,0,2,1},
+    {0,6141,0,2,1}, {0,7984,0,2,1}, {0,16085,0,2,1}, {0,1865,0,2,1},
+    {0,4252,0,2,1}, {0,798,0,2,1}, {0,163,0,2,1}, {0,560,0,2,1},
+    {0,46242,0,2,1}, {0,1595,0,2,1}, {0,270,0,2,1}, {0,660,0,2,1},
+    {0,1599,0,2,1}, {0,4540,0,2,1}, {0,654,0,2,1}, {0,3263,0,2,1},
+    {0,46244,0,2,1}, {0,46246,0,2,1}, {0,1311,0,2,1}, {0,38340,0,2,1},
+    {7684,19,1,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,41455,0,6,1}, {0,41833,0,6,1},
+    {0,41881,0,6,1}, {0,17747,0,10,1}, {0,20507,0,10,1}, {0,20757,0,10,1},
+    {0,20847,0,10,1}, {0,11408,0,12,1}, {7685,12176,1,12,0}, {7686,19,1,3,1},
+    {0,45874,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1},
+    {0,6744,0,3,1}, {0,46030,0,3,1}, {0,3261,0,3,1}, {0,5670,0,3,1},
+    {0,7077,0,3,1}, {0,3125,0,3,1}, {0,185,0,3,1}, {0,4537,0,4,1},
+    {0,26930,0,4,1}, {0,23472,0,4,1}, {0,45318,0,4,1}, {0,45402,0,4,2},
+    {7687,3975,1,4,1}, {0,42324,0,5,1}, {0,2195,0,6,1}, {0,30354,0,8,1},
+    {0,23245,0,9,1}, {7688,3965,1,16,1}, {0,517,0,2,1}, {0,4,0,2,1},
+    {0,1106,0,2,1}, {0,782,0,2,1}, {0,872,0,2,1}, {0,5,0,2,1},
+    {0,568,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3939,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,2124,0,3,1}, {0,7077,0,3,1}, {0,6881,0,4,1},
+    {0,26138,0,8,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,7744,0,3,1}, {0,872,0,3,1}, {0,23472,0,4,1},
+    {0,517,0,2,1}, {0,3114,0,2,1}, {0,42239,0,3,1}, {7689,19,2,3,1},
+    {0,872,0,3,1}, {0,35639,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,5632,0,3,1}, {0,4902,0,5,1}, {0,32606,0,7,1},
+    {0,4,0,2,1}, {0,3503,0,2,1}, {7691,21,1,4,0}, {0,28838,0,5,1},
+    {0,26138,0,8,1}, {7692,15375,2,11,0}, {0,45790,0,3,1}, {0,19,0,3,1},
+    {0,44678,0,4,1}, {0,38781,0,4,1}, {0,42024,0,5,1}, {0,14165,0,5,1},
+    {7694,42429,2,5,1}, {0,44189,0,5,1}, {0,37453,0,6,1}, {0,37567,0,6,1},
+    {0,37741,0,6,2}, {0,38257,0,6,1}, {0,38263,0,6,1}, {0,38269,0,6,1},
+    {0,38779,0,6,1}, {0,39271,0,6,1}, {0,31962,0,7,1}, {7696,32347,1,7,0},
+    {0,32473,0,7,1}, {0,32515,0,7,1}, {0,32543,0,7,1}, {0,32550,0,7,1},
+    {0,33922,0,7,1}, {0,35959,0,7,1}, {0,36057,0,7,1}, {0,26138,0,8,1},
+    {0,26706,0,8,1}, {0,26722,0,8,1}, {0,28954,0,8,1}, {0,22273,0,9,1},
+    {0,22606,0,9,1}, {0,22615,0,9,1}, {0,23200,0,9,1}, {0,23299,0,9,1},
+    {0,23668,0,9,1}, {0,24775,0,9,1}, {0,25081,0,9,2}, {0,18067,0,10,1},
+    {0,18077,0,10,1}, {0,18617,0,10,1}, {0,18787,0,10,1}, {0,18947,0,10,1},
+    {0,18957,0,10,1}, {0,19157,0,10,1}, {0,19167,0,10,1}, {0,19297,0,10,1},
+    {0,20087,0,10,1}, {0,20187,0,10,1}, {0,14022,0,11,1}, {0,15144,0,11,1},
+    {0,15936,0,11,1}, {0,16090,0,11,1}, {0,16266,0,11,1}, {7697,11336,1,12,0},
+    {0,11432,0,12,1}, {0,11780,0,12,1}, {0,11912,0,12,1}, {7698,12488,1,12,0},
+    {0,12764,0,12,1}, {0,8839,0,13,1}, {0,9528,0,13,1}, {0,9957,0,13,1},
+    {7699,7224,1,14,1}, {0,7616,0,14,1}, {0,5162,0,15,1}, {0,5312,0,15,1},
+    {0,5357,0,15,1}, {0,3949,0,16,1}, {0,2945,0,17,1}, {0,2034,0,18,1},
+    {0,1310,0,20,1}, {0,966,0,21,1}, {0,402,0,23,1}, {0,4,0,2,1},
+    {0,42239,0,3,1}, {0,5777,0,3,1}, {0,26930,0,4,1}, {0,11103,0,5,1},
+    {0,26138,0,8,1}, {0,11912,0,12,1}, {0,8540,0,13,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,4166,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,46129,0,3,1}, {0,185,0,3,1}, {0,3114,0,2,1}, {0,4166,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,10742,0,3,1}, {0,852,0,3,1}, {0,850,0,4,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,782,0,3,1}, {0,42237,0,3,1},
+    {0,872,0,3,1}, {0,46006,0,3,1}, {0,1581,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1}, {0,14774,0,4,1},
+    {0,23472,0,4,1}, {0,29370,0,8,1}, {0,33851,0,3,1}, {7700,19,1,3,1},
+    {0,10787,0,3,1}, {0,4185,0,3,1}, {0,872,0,3,1}, {0,4130,0,3,1},
+    {0,1581,0,3,1}, {0,7077,0,3,1}, {0,282,0,3,1}, {0,45458,0,4,1},
+    {7701,19,1,3,1}, {0,10787,0,3,1}, {0,9995,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,2214,0,3,1},
+    {0,19367,0,4,1}, {7702,19,1,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,25810,0,8,1}, {0,11912,0,12,1},
+    {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,23472,0,4,1}, {0,19367,0,4,1},
+    {0,45310,0,4,1}, {0,14165,0,5,1}, {0,44189,0,5,1}, {7703,37513,1,6,0},
+    {0,32256,0,7,1}, {0,30794,0,8,2}, {0,8566,0,10,1}, {0,1319,0,11,1},
+    {0,10126,0,13,1}, {0,3793,0,2,1}, {0,11651,0,3,1}, {0,22520,0,5,1},
+    {0,43034,0,5,1}, {0,26138,0,8,1}, {0,22561,0,9,1}, {7704,17987,2,10,0},
+    {0,14011,0,11,1}, {0,11912,0,12,1}, {7706,8813,1,13,0}, {0,6122,0,15,1},
+    {0,517,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1},
+    {0,23472,0,4,1}, {0,19367,0,4,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,829,0,4,2}, {0,11232,0,5,1},
+    {0,3114,0,2,1}, {0,518,0,3,1}, {0,19,0,3,1}, {0,5670,0,3,1},
+    {0,46081,0,3,1}, {0,46228,0,3,1}, {0,850,0,4,1}, {0,45010,0,4,1},
+    {0,6084,0,4,1}, {0,42569,0,5,1}, {0,42764,0,5,1}, {0,31759,0,6,1},
+    {0,37075,0,6,1}, {0,37663,0,6,1}, {0,39595,0,6,1}, {0,32438,0,7,1},
+    {0,32634,0,7,1}, {0,33495,0,7,1}, {0,34699,0,7,1}, {0,25866,0,8,1},
+    {0,26138,0,8,1}, {0,29306,0,8,1}, {0,21715,0,9,1}, {0,22111,0,9,1},
+    {0,17387,0,10,1}, {0,18247,0,10,1}, {0,15716,0,10,1}, {0,16255,0,11,1},
+    {0,11912,0,12,1}, {0,5342,0,15,1}, {0,4077,0,16,1}, {0,2052,0,18,1},
+    {0,69,0,21,1}, {0,69,0,31,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,46087,0,3,1}, {0,4,0,2,1},
+    {0,36887,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,45134,0,4,1},
+    {7707,3042,1,5,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,35639,0,3,1}, {0,14325,0,3,1}, {0,7077,0,3,1},
+    {0,4,0,2,1}, {0,16745,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,517,0,2,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,1486,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,850,0,4,1}, {0,2205,0,4,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,26138,0,8,1}, {0,20007,0,10,1}, {0,81,0,2,1},
+    {0,1087,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,539,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,3909,0,4,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,185,0,3,1}, {0,45030,0,4,1},
+    {0,23472,0,4,1}, {0,390,0,2,1}, {0,4,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,45973,0,3,1},
+    {0,14339,0,3,1}, {0,35639,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,40069,0,6,1}, {0,41383,0,6,1}, {0,41437,0,6,1}, {0,41455,0,6,1},
+    {0,41683,0,6,1}, {0,41689,0,6,1}, {0,41695,0,6,1}, {0,41815,0,6,1},
+    {0,41821,0,6,1}, {0,41827,0,6,1}, {0,41833,0,6,1}, {0,41839,0,6,1},
+    {0,41851,0,6,1}, {0,13964,0,6,1}, {0,41875,0,6,1}, {0,41881,0,6,1},
+    {0,26138,0,8,1}, {0,25324,0,9,1}, {0,25486,0,9,1}, {0,20507,0,10,1},
+    {0,20727,0,10,1}, {0,20757,0,10,1}, {0,20817,0,10,1}, {0,20827,0,10,1},
+    {0,20847,0,10,1}, {0,20907,0,10,1}, {0,20967,0,10,1}, {0,16772,0,11,1},
+    {0,16893,0,11,1}, {0,17047,0,11,1}, {0,17201,0,11,1}, {0,17278,0,11,1},
+    {0,518,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,288,0,2,1},
+    {0,19,0,3,1}, {0,14568,0,4,1}, {0,32914,0,4,1}, {0,19367,0,4,1},
+    {0,26138,0,8,1}, {0,4166,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,1581,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,10742,0,3,1},
+    {0,5632,0,3,1}, {0,1093,0,3,1}, {0,850,0,4,1}, {0,14418,0,4,1},
+    {0,26930,0,4,1}, {0,45010,0,4,1}, {0,23472,0,4,1}, {0,7094,0,4,1},
+    {0,42044,0,5,1}, {0,1175,0,5,1}, {0,4,0,2,1}, {0,3114,0,2,1},
+    {0,7077,0,3,1}, {0,37650,0,3,1}, {0,44690,0,4,1}, {0,44786,0,4,1},
+    {0,23304,0,4,1}, {0,44942,0,4,1}, {0,23472,0,4,1}, {0,4401,0,4,1},
+    {0,282,0,4,1}, {0,7094,0,4,1}, {0,45562,0,4,1}, {0,45574,0,4,1},
+    {0,42054,0,5,1}, {0,23474,0,5,1}, {0,9315,0,5,1}, {0,5477,0,5,1},
+    {0,43164,0,5,1}, {0,23461,0,5,1}, {0,20241,0,5,1}, {0,44524,0,5,1},
+    {0,37273,0,6,1}, {0,38335,0,6,1}, {0,39889,0,6,1}, {0,40681,0,6,1},
+    {0,40825,0,6,1}, {0,32662,0,7,1}, {0,32669,0,7,1}, {0,26138,0,8,1},
+    {0,27562,0,8,1}, {0,28178,0,8,1}, {0,517,0,2,1}, {7708,4,1,2,1},
+    {0,872,0,2,1}, {7709,2849,1,2,1}, {0,5,0,2,1}, {0,42239,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,1595,0,3,1}, {0,185,0,3,1},
+    {0,43585,0,4,1}, {0,44946,0,4,1}, {0,42634,0,5,1}, {0,39775,0,6,1},
+    {0,872,0,3,1}, {0,26138,0,8,1}, {0,11912,0,12,1}, {0,517,0,2,1},
+    {7710,4,4,2,1}, {0,872,0,3,1}, {0,26787,0,3,1}, {0,46006,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,21,0,4,1}, {0,517,0,2,1},
+    {7714,4,2,2,1}, {0,161,0,2,1}, {0,705,0,2,1}, {0,2617,0,2,1},
+    {0,19,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,10514,0,2,1},
+    {0,4743,0,2,1}, {0,517,0,2,1}, {0,776,0,2,1}, {0,1052,0,2,1},
+    {0,25,0,2,1}, {0,6944,0,2,1}, {0,4,0,2,1}, {0,5517,0,2,1},
+    {0,695,0,2,1}, {0,174,0,2,1}, {0,9,0,2,1}, {0,164,0,2,1},
+    {0,17073,0,2,1}, {0,2617,0,2,1}, {0,7431,0,2,1}, {0,12834,0,2,1},
+    {0,829,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,386,0,3,1}, {0,872,0,3,1}, {0,539,0,3,1}, {0,2124,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,23,0,3,1}, {0,7077,0,3,1},
+    {0,5632,0,3,1}, {0,4903,0,3,1}, {0,185,0,3,1}, {0,14418,0,4,1},
+    {0,26930,0,4,1}, {0,23472,0,4,1}, {0,129,0,4,1}, {0,14165,0,5,1},
+    {0,42229,0,5,1}, {0,42444,0,5,1}, {0,2268,0,6,1}, {0,32256,0,7,1},
+    {0,33551,0,7,1}, {0,26138,0,8,1}, {0,26250,0,8,1}, {0,3893,0,8,1},
+    {0,30354,0,8,1}, {0,19,0,3,1}, {0,45967,0,3,1}, {0,46039,0,3,1},
+    {7716,46099,1,3,1}, {0,46108,0,3,2}, {0,46123,0,3,1}, {0,44694,0,4,1},
+    {7717,44762,1,4,0}, {0,44878,0,4,1}, {0,11612,0,4,1}, {7718,45214,1,4,0},
+    {0,45446,0,4,1}, {0,45650,0,4,1}, {0,14165,0,5,1}, {0,42439,0,5,1},
+    {0,42489,0,5,1}, {0,28053,0,5,1}, {0,22299,0,5,1}, {7719,43824,1,5,1},
+    {0,36991,0,6,1}, {0,37081,0,6,1}, {0,37591,0,6,1}, {0,2928,0,6,1},
+    {0,37861,0,6,1}, {0,39583,0,6,2}, {0,39589,0,6,2}, {0,40297,0,6,2},
+    {7720,17607,1,7,0}, {0,31955,0,7,1}, {0,32578,0,7,1}, {0,23353,0,7,1},
+    {7721,35049,1,7,0}, {0,36120,0,7,1}, {0,36183,0,7,1}, {0,36477,0,7,1},
+    {0,26154,0,8,1}, {7722,26570,1,8,0}, {0,26626,0,8,1}, {0,9260,0,8,1},
+    {0,29402,0,8,2}, {0,29658,0,8,1}, {0,29882,0,8,1}, {0,30274,0,8,1},
+    {7723,30922,1,8,0}, {7724,30978,1,8,0}, {0,31114,0,8,1}, {0,21598,0,9,1},
+    {7725,22075,1,9,0}, {0,23344,0,9,1}, {0,23605,0,9,2}, {0,24379,0,9,1},
+    {7726,9944,4,9,0}, {0,25216,0,9,1}, {7730,17607,1,10,0}, {0,17857,0,10,1},
+    {0,18417,0,10,1}, {0,19267,0,10,1}, {0,20327,0,10,1}, {7731,14143,2,11,0},
+    {0,14187,0,11,1}, {0,14198,0,11,1}, {0,14693,0,11,1}, {0,15837,0,11,1},
+    {0,15859,0,11,1}, {0,15969,0,11,1}, {0,10844,0,12,1}, {0,11324,0,12,1},
+    {0,12104,0,12,1}, {7733,12236,1,12,0}, {0,10087,0,13,1}, {0,6804,0,14,2},
+    {0,2877,0,17,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,517,0,2,1},
+    {0,4,0,2,1}, {0,520,0,2,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,1595,0,3,1}, {0,21077,0,10,1}, {0,21087,0,10,1},
+    {0,8092,0,14,1}, {0,6287,0,15,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,32410,0,7,1}, {0,26138,0,8,1}, {0,1065,0,2,1}, {0,168,0,2,1},
+    {0,96,0,2,1}, {0,818,0,2,1}, {0,193,0,2,1}, {0,7832,0,2,1},
+    {0,701,0,2,1}, {0,151,0,2,1}, {0,1722,0,2,1}, {0,516,0,2,1},
+    {0,3485,0,2,1}, {0,2149,0,2,1}, {0,826,0,2,1}, {0,4729,0,2,1},
+    {0,949,0,2,1}, {0,812,0,2,1}, {0,187,0,2,1}, {0,4561,0,2,1},
+    {0,45832,0,2,1}, {0,25,0,2,1}, {0,1005,0,2,1}, {0,98,0,2,1},
+    {0,69,0,2,1}, {0,519,0,2,1}, {0,609,0,2,1}, {0,6944,0,2,1},
+    {0,4,0,2,1}, {0,6202,0,2,1}, {0,5517,0,2,1}, {0,514,0,2,1},
+    {0,16633,0,2,1}, {0,77,0,2,1}, {0,1768,0,2,1}, {0,979,0,2,1},
+    {0,45954,0,2,1}, {0,782,0,2,1}, {0,22683,0,2,1}, {0,94,0,2,1},
+    {0,386,0,2,1}, {0,872,0,2,1}, {0,3074,0,2,1}, {0,2985,0,2,1},
+    {0,85,0,2,1}, {0,1851,0,2,1}, {0,169,0,2,1}, {0,17,0,2,1},
+    {0,760,0,2,1}, {0,1074,0,2,1}, {0,294,0,2,1}, {0,1834,0,2,1},
+    {0,5008,0,2,1}, {0,1749,0,2,1}, {0,164,0,2,1}, {0,554,0,2,1},
+    {0,6221,0,2,1}, {0,798,0,2,1}, {0,640,0,2,1}, {0,1354,0,2,1},
+    {0,784,0,2,1}, {0,196,0,2,1}, {0,5544,0,2,1}, {0,635,0,2,1},
+    {0,5,0,2,1}, {0,1725,0,2,1}, {0,840,0,2,1}, {0,2854,0,2,1},
+    {0,14527,0,2,1}, {0,543,0,2,1}, {0,17073,0,2,1}, {0,5030,0,2,1},
+    {0,25331,0,2,1}, {0,129,0,2,1}, {0,282,0,2,1}, {0,2063,0,2,1},
+    {0,5120,0,2,1}, {0,20376,0,2,1}, {0,46236,0,2,1}, {0,95,0,2,1},
+    {0,832,0,2,1}, {0,7,0,2,1}, {0,74,0,2,1}, {0,283,0,2,1},
+    {0,384,0,2,1}, {0,981,0,2,1}, {0,161,0,2,1}, {0,568,0,2,1},
+    {0,188,0,2,1}, {0,221,0,2,1}, {0,128,0,2,1}, {0,1927,0,2,1},
+    {0,556,0,2,1}, {0,8897,0,2,1}, {0,167,0,2,1}, {0,15,0,2,1},
+    {0,1726,0,2,1}, {0,1087,0,2,1}, {0,839,0,2,1}, {0,261,0,2,1},
+    {0,132,0,2,1}, {0,2617,0,2,1}, {0,2350,0,2,1}, {0,176,0,2,1},
+    {0,423,0,2,1}, {0,8279,0,2,1}, {0,382,0,2,1}, {0,159,0,2,1},
+    {0,1359,0,2,1}, {0,5609,0,2,1}, {0,8893,0,2,1}, {0,2544,0,2,1},
+    {0,2170,0,3,1}, {0,14187,0,3,1}, {0,3003,0,3,1}, {0,4231,0,3,1},
+    {0,10787,0,3,1}, {0,45898,0,3,1}, {0,45940,0,3,1}, {0,872,0,3,1},
+    {0,43174,0,3,1}, {0,5487,0,3,1}, {0,19285,0,3,1}, {0,2890,0,3,1},
+    {0,14882,0,3,1}, {0,46075,0,3,1}, {0,39817,0,3,1}, {0,9660,0,3,1},
+    {0,9262,0,3,1}, {0,1484,0,3,1}, {7734,6716,1,3,0}, {0,12462,0,3,1},
+    {0,5007,0,3,1}, {0,46186,0,3,1}, {0,9115,0,3,1}, {0,763,0,3,1},
+    {0,44686,0,4,1}, {0,44698,0,4,1}, {0,44702,0,4,1}, {0,3871,0,4,1},
+    {0,33799,0,4,1}, {0,44838,0,4,1}, {0,35458,0,4,1}, {0,28474,0,4,1},
+    {7735,45334,1,4,0}, {0,45426,0,4,1}, {0,5831,0,4,1}, {0,21189,0,4,1},
+    {0,10030,0,5,1}, {0,1020,0,5,1}, {0,949,0,5,1}, {0,42379,0,5,1},
+    {0,42589,0,5,1}, {0,42684,0,5,1}, {0,42904,0,5,1}, {0,43174,0,5,1},
+    {0,43184,0,5,1}, {0,43189,0,5,1}, {0,43274,0,5,1}, {0,39037,0,5,1},
+    {0,798,0,5,1}, {0,43559,0,5,1}, {0,43714,0,5,1}, {0,43729,0,5,1},
+    {0,43749,0,5,1}, {0,43799,0,5,1}, {0,43879,0,5,1}, {0,44094,0,5,1},
+    {0,44299,0,5,1}, {0,44394,0,5,1}, {0,44419,0,5,1}, {0,36955,0,6,1},
+    {0,34406,0,6,1}, {0,37009,0,6,1}, {0,565,0,6,1}, {0,37153,0,6,1},
+    {0,587,0,6,1}, {0,37297,0,6,1}, {0,37705,0,6,1}, {0,37837,0,6,1},
+    {0,38713,0,6,1}, {0,38899,0,6,1}, {0,38929,0,6,1}, {0,39037,0,6,1},
+    {0,39175,0,6,1}, {0,39187,0,6,1}, {0,39367,0,6,1}, {0,11389,0,6,1},
+    {0,39499,0,6,1}, {0,39667,0,6,1}, {0,39817,0,6,1}, {0,39853,0,6,1},
+    {0,39907,0,6,1}, {0,39943,0,6,1}, {0,40063,0,6,1}, {0,40183,0,6,1},
+    {0,40543,0,6,1}, {0,40639,0,6,1}, {0,40705,0,6,1}, {0,40789,0,6,1},
+    {0,40867,0,6,1}, {0,40879,0,6,1}, {0,40885,0,6,1}, {0,40897,0,6,1},
+    {0,31528,0,7,1}, {0,31850,0,7,1}, {0,31864,0,7,1}, {0,31941,0,7,1},
+    {0,2860,0,7,1}, {0,31976,0,7,1}, {0,32081,0,7,1}, {0,32095,0,7,1},
+    {0,32340,0,7,1}, {0,32382,0,7,1}, {0,32396,0,7,1}, {0,32732,0,7,1},
+    {0,32788,0,7,1}, {0,33467,0,7,1}, {0,33810,0,7,1}, {0,33894,0,7,1},
+    {0,34405,0,7,1}, {0,34489,0,7,1}, {0,34517,0,7,1}, {0,34552,0,7,1},
+    {0,34629,0,7,1}, {0,34727,0,7,1}, {0,35315,0,7,1}, {0,35322,0,7,1},
+    {0,35329,0,7,1}, {0,35364,0,7,1}, {0,35434,0,7,1}, {0,35455,0,7,1},
+    {0,35630,0,7,1}, {0,35686,0,7,1}, {0,35854,0,7,1}, {0,35945,0,7,1},
+    {0,36099,0,7,1}, {0,36239,0,7,1}, {0,36323,0,7,1}, {0,36330,0,7,1},
+    {0,36337,0,7,1}, {0,36428,0,7,1}, {0,763,0,7,1}, {0,36519,0,7,1},
+    {0,36547,0,7,1}, {0,26002,0,8,1}, {0,26138,0,8,1}, {0,26202,0,8,1},
+    {0,26298,0,8,1}, {0,5784,0,8,1}, {0,26314,0,8,1}, {0,26962,0,8,1},
+    {0,27210,0,8,1}, {0,28426,0,8,1}, {0,28482,0,8,1}, {0,28530,0,8,1},
+    {0,29442,0,8,1}, {0,29522,0,8,1}, {0,29538,0,8,1}, {0,29546,0,8,1},
+    {0,29906,0,8,1}, {0,29914,0,8,1}, {0,30162,0,8,1}, {0,30402,0,8,1},
+    {0,261,0,8,1}, {0,31002,0,8,1}, {0,31010,0,8,1}, {0,21193,0,9,1},
+    {0,2331,0,9,1}, {0,21562,0,9,1}, {0,21679,0,9,1}, {0,22138,0,9,1},
+    {0,23209,0,9,1}, {0,23362,0,9,1}, {0,7005,0,9,1}, {0,24064,0,9,1},
+    {0,2367,0,9,1}, {0,2385,0,9,1}, {0,25135,0,9,1}, {0,1666,0,10,1},
+    {0,17587,0,10,1}, {0,17737,0,10,1}, {0,18537,0,10,1}, {0,20297,0,10,1},
+    {0,20307,0,10,1}, {0,20317,0,10,1}, {0,14000,0,11,1}, {0,14066,0,11,1},
+    {0,14088,0,11,1}, {0,14341,0,11,1}, {0,10935,0,11,1}, {0,15606,0,11,1},
+    {0,16134,0,11,1}, {0,16200,0,11,1}, {0,16211,0,11,1}, {0,16222,0,11,1},
+    {0,16233,0,11,1}, {0,10748,0,12,1}, {0,10796,0,12,1}, {0,10904,0,12,1},
+    {0,10928,0,12,1}, {0,10940,0,12,1}, {0,11144,0,12,1}, {0,11156,0,12,1},
+    {0,11828,0,12,1}, {0,11876,0,12,1}, {0,11912,0,12,1}, {0,12068,0,12,1},
+    {0,12116,0,12,1}, {0,12212,0,12,1}, {0,12596,0,12,1}, {0,12656,0,12,1},
+    {0,12668,0,12,1}, {0,12680,0,12,1}, {0,12692,0,12,1}, {0,12704,0,12,1},
+    {0,12716,0,12,1}, {0,12752,0,12,1}, {0,8605,0,13,1}, {0,8722,0,13,1},
+    {0,8748,0,13,1}, {0,8774,0,13,1}, {0,8852,0,13,1}, {0,8943,0,13,1},
+    {0,9034,0,13,1}, {0,9047,0,13,1}, {0,9450,0,13,1}, {0,9502,0,13,1},
+    {0,9515,0,13,1}, {0,9658,0,13,1}, {0,9684,0,13,1}, {0,10009,0,13,1},
+    {0,10022,0,13,1}, {0,10035,0,13,1}, {0,10048,0,13,1}, {0,10074,0,13,1},
+    {0,6860,0,14,1}, {0,6874,0,14,1}, {0,7000,0,14,1}, {0,7098,0,14,1},
+    {0,7126,0,14,1}, {0,7140,0,14,1}, {0,7154,0,14,1}, {0,7462,0,14,1},
+    {0,7588,0,14,1}, {0,7700,0,14,1}, {0,7714,0,14,1}, {0,7728,0,14,1},
+    {0,4937,0,15,1}, {0,4967,0,15,1}, {0,4982,0,15,1}, {0,5012,0,15,1},
+    {0,5027,0,15,1}, {0,5267,0,15,1}, {0,5282,0,15,1}, {0,5297,0,15,1},
+    {0,5657,0,15,1}, {0,5777,0,15,1}, {0,5897,0,15,1}, {0,5912,0,15,1},
+    {0,5927,0,15,1}, {0,5942,0,15,1}, {0,5957,0,15,1}, {0,6017,0,15,1},
+    {0,6422,0,15,1}, {0,3757,0,16,1}, {0,3773,0,16,1}, {0,3805,0,16,1},
+    {0,3821,0,16,1}, {0,3837,0,16,1}, {0,3981,0,16,1}, {0,4093,0,16,1},
+    {0,4413,0,16,1}, {0,4429,0,16,1}, {0,4445,0,16,1}, {0,4461,0,16,1},
+    {0,4477,0,16,1}, {0,4493,0,16,1}, {0,4509,0,16,1}, {0,2860,0,17,1},
+    {0,2894,0,17,1}, {0,3013,0,17,1}, {0,3285,0,17,1}, {0,3302,0,17,1},
+    {0,3319,0,17,1}, {0,3336,0,17,1}, {0,3353,0,17,1}, {0,3370,0,17,1},
+    {0,3387,0,17,1}, {0,3404,0,17,1}, {0,3421,0,17,1}, {0,3438,0,17,1},
+    {0,2160,0,18,1}, {0,2286,0,18,1}, {0,2304,0,18,1}, {0,2322,0,18,1},
+    {0,2340,0,18,1}, {0,2358,0,18,1}, {0,2376,0,18,1}, {0,2394,0,18,1},
+    {0,2412,0,18,1}, {0,2430,0,18,1}, {0,2520,0,18,1}, {0,2556,0,18,1},
+    {0,2682,0,18,1}, {0,1448,0,19,1}, {0,1467,0,19,1}, {0,1454,0,19,1},
+    {0,1524,0,19,1}, {0,1619,0,19,1}, {0,1638,0,19,1}, {0,1657,0,19,1},
+    {0,1676,0,19,1}, {0,1695,0,19,1}, {0,1733,0,19,1}, {0,1752,0,19,1},
+    {0,1942,0,19,1}, {0,1961,0,19,1}, {0,1130,0,20,1}, {0,1150,0,20,1},
+    {0,693,0,21,1}, {0,714,0,21,1}, {0,735,0,21,1}, {0,756,0,21,1},
+    {0,798,0,21,1}, {0,882,0,21,1}, {0,903,0,21,1}, {0,945,0,21,1},
+    {0,1008,0,21,1}, {0,561,0,22,1}, {0,583,0,22,1}, {0,671,0,22,1},
+    {0,425,0,23,1}, {0,448,0,23,1}, {0,471,0,23,1}, {0,306,0,24,1},
+    {0,330,0,24,1}, {0,354,0,24,1}, {0,257,0,25,1}, {0,4,0,2,1},
+    {0,1098,0,2,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,1595,0,3,1}, {0,19367,0,4,1}, {0,517,0,2,1},
+    {0,791,0,2,1}, {0,4,0,2,1}, {0,1106,0,2,1}, {0,872,0,2,1},
+    {0,3074,0,2,1}, {0,4960,0,2,1}, {7736,765,2,2,1}, {0,5,0,2,1},
+    {0,5497,0,3,1}, {0,21625,0,3,1}, {0,22618,0,3,1}, {0,7617,0,3,1},
+    {0,21353,0,3,1}, {0,45907,0,3,1}, {0,2012,0,3,1}, {7738,1000,30,3,1},
+    {0,23605,0,3,1}, {0,19667,0,3,1}, {0,19130,0,3,1}, {0,44818,0,4,1},
+    {0,8746,0,4,1}, {0,34701,0,4,1}, {0,44966,0,4,1}, {7768,44990,38,4,1},
+    {0,15182,0,4,1}, {0,45062,0,4,1}, {0,45154,0,4,1}, {0,45158,0,4,1},
+    {7806,45170,1,4,2}, {0,19285,0,4,1}, {0,15331,0,4,1}, {0,45294,0,4,1},
+    {0,26653,0,4,1}, {7807,23731,38,4,1}, {0,29448,0,4,1}, {7845,42963,19,4,1},
+    {0,45394,0,4,1}, {0,45442,0,4,1}, {7864,19767,26,4,1}, {7890,7265,52,5,1},
+    {7942,9371,28,5,1}, {0,42099,0,5,1}, {0,42249,0,5,1}, {0,42309,0,5,1},
+    {0,42334,0,5,1}, {7970,21022,58,5,1}, {0,42339,0,5,1}, {8028,22416,22,5,1},
+    {0,42609,0,5,1}, {8050,42664,15,5,1}, {0,42704,0,5,1}, {0,42739,0,5,1},
+    {8065,42794,36,5,1}, {0,42799,0,5,1}, {0,42829,0,5,1}, {0,42849,0,5,1},
+    {8101,42894,46,5,1}, {0,42969,0,5,1}, {8147,42989,34,5,1}, {8181,43074,31,5,1},
+    {0,43134,0,5,1}, {8212,43149,31,5,1}, {8243,11295,50,5,1}, {0,43754,0,5,1},
+    {0,43764,0,5,1}, {0,43834,0,5,1}, {8293,7497,23,5,1}, {0,44194,0,5,1},
+    {0,44314,0,5,1}, {8316,43152,57,5,1}, {0,30906,0,5,1}, {0,44459,0,5,1},
+    {0,15944,0,5,1}, {8373,36985,22,6,1}, {0,37189,0,6,1}, {0,37399,0,6,1},
+    {0,37495,0,6,1}, {0,37597,0,6,1}, {0,37693,0,6,1}, {0,37897,0,6,1},
+    {0,38191,0,6,1}, {0,38209,0,6,1}, {8395,9145,15,6,1}, {8410,39127,32,6,1},
+    {8442,9353,75,6,1}, {8517,39337,1,6,2}, {0,39445,0,6,1}, {0,39709,0,6,1},
+    {0,39715,0,6,1}, {0,16073,0,6,1}, {0,39751,0,6,1}, {0,39991,0,6,1},
+    {0,40075,0,6,1}, {8518,9769,1,6,2}, {8519,27300,24,6,1}, {0,40873,0,6,1},
+    {0,40909,0,6,1}, {0,40939,0,6,1}, {0,41029,0,6,1}, {0,41203,0,6,1},
+    {0,41371,0,6,1}, {0,41407,0,6,1}, {0,41419,0,6,1}, {0,41467,0,6,1},
+    {0,41473,0,6,1}, {0,41521,0,6,1}, {0,41527,0,6,1}, {0,41539,0,6,1},
+    {0,41545,0,6,1}, {0,41557,0,6,1}, {0,41563,0,6,1}, {0,41575,0,6,1},
+    {0,41581,0,6,1}, {0,41587,0,6,1}, {0,41593,0,6,1}, {0,41599,0,6,1},
+    {0,41605,0,6,1}, {0,41611,0,6,1}, {0,41617,0,6,1}, {0,41629,0,6,1},
+    {0,41641,0,6,1}, {0,41647,0,6,1}, {0,41653,0,6,1}, {0,41701,0,6,1},
+    {0,41725,0,6,1}, {0,41731,0,6,1}, {0,41737,0,6,1}, {0,41749,0,6,1},
+    {0,41773,0,6,1}, {0,41779,0,6,1}, {0,41785,0,6,1}, {0,41791,0,6,1},
+    {0,41797,0,6,1}, {0,41803,0,6,1}, {0,41887,0,6,1}, {0,41905,0,6,1},
+    {0,41929,0,6,1}, {0,41935,0,6,1}, {0,41947,0,6,1}, {0,41953,0,6,1},
+    {0,41971,0,6,1}, {0,41983,0,6,1}, {0,41989,0,6,1}, {0,31822,0,7,1},
+    {0,32025,0,7,1}, {0,32102,0,7,1}, {0,32200,0,7,1}, {0,32270,0,7,1},
+    {0,32711,0,7,1}, {8543,33306,63,7,1}, {0,33523,0,7,1}, {8606,33754,51,7,1},
+    {0,34545,0,7,1}, {0,34902,0,7,1}, {8657,35000,34,7,1}, {0,35042,0,7,1},
+    {8691,35140,26,7,1}, {8717,35161,42,7,1}, {0,35350,0,7,1}, {8759,35616,69,7,1},
+    {8828,35679,1,7,2}, {8829,35798,23,7,1}, {0,36176,0,7,1}, {8852,36204,31,7,1},
+    {8883,36260,13,7,1}, {0,36617,0,7,1}, {0,26010,0,8,1}, {0,26018,0,8,1},
+    {0,26026,0,8,1}, {0,26138,0,8,1}, {0,26330,0,8,1}, {0,26370,0,8,1},
+    {0,26394,0,8,1}, {0,26522,0,8,1}, {0,26554,0,8,1}, {8896,27410,142,8,1},
+    {9038,23804,19,8,1}, {9057,27898,30,8,1}, {9087,28002,1,8,2}, {0,28034,0,8,1},
+    {9088,28266,23,8,1}, {0,28498,0,8,1}, {9111,28786,27,8,1}, {9138,29034,22,8,1},
+    {0,29482,0,8,1}, {0,29490,0,8,1}, {0,29674,0,8,1}, {0,29698,0,8,1},
+    {9160,30130,36,8,1}, {0,30322,0,8,1}, {0,30346,0,8,1}, {0,30722,0,8,1},
+    {9196,31066,29,8,1}, {9225,31218,34,8,1}, {9259,31258,1,8,2}, {0,21625,0,9,1},
+    {9260,9363,51,9,1}, {9311,4004,25,9,1}, {0,22777,0,9,1}, {9336,22822,20,9,1},
+    {0,23353,0,9,1}, {0,23596,0,9,1}, {0,24127,0,9,1}, {0,24280,0,9,1},
+    {0,24766,0,9,1}, {9356,24964,17,9,1}, {0,25234,0,9,1}, {0,25261,0,9,1},
+    {0,25270,0,9,1}, {0,25459,0,9,1}, {9373,25513,16,9,1}, {9389,25522,28,9,1},
+    {0,25729,0,9,1}, {0,25738,0,9,1}, {0,25783,0,9,1}, {0,25801,0,9,1},
+    {0,18257,0,10,1}, {0,18317,0,10,1}, {0,18767,0,10,1}, {9417,18807,1,10,2},
+    {0,18977,0,10,1}, {0,18987,0,10,1}, {0,20527,0,10,1}, {0,20537,0,10,1},
+    {0,20567,0,10,1}, {0,20627,0,10,1}, {0,20667,0,10,1}, {0,20677,0,10,1},
+    {0,20767,0,10,1}, {0,20777,0,10,1}, {0,20787,0,10,1}, {0,20797,0,10,1},
+    {0,20877,0,10,1}, {0,20887,0,10,1}, {0,20897,0,10,1}, {0,20917,0,10,1},
+    {0,14924,0,11,1}, {0,829,0,11,1}, {0,16365,0,11,1}, {0,16376,0,11,1},
+    {0,16398,0,11,1}, {0,16420,0,11,1}, {0,16486,0,11,1}, {0,16497,0,11,1},
+    {0,16530,0,11,1}, {0,16541,0,11,1}, {0,16552,0,11,1}, {0,16585,0,11,1},
+    {0,16673,0,11,1}, {0,16684,0,11,1}, {0,16695,0,11,1}, {0,16849,0,11,1},
+    {0,16860,0,11,1}, {0,16959,0,11,1}, {0,16992,0,11,1}, {0,17014,0,11,1},
+    {0,17080,0,11,1}, {0,17102,0,11,1}, {0,17190,0,11,1}, {0,17212,0,11,1},
+    {0,17223,0,11,1}, {0,17245,0,11,1}, {0,17311,0,11,1}, {0,11096,0,12,1},
+    {0,12896,0,12,1}, {0,10152,0,13,1}, {0,7910,0,14,1}, {0,7924,0,14,1},
+    {0,8232,0,14,1}, {0,517,0,2,1}, {9418,4,1,2,1}, {0,872,0,2,1},
+    {0,164,0,2,1}, {0,765,0,2,1}, {0,5,0,2,1}, {0,1595,0,2,1},
+    {0,23472,0,4,1}, {0,2205,0,4,1}, {0,9,0,2,1}, {0,7403,0,2,1},
+    {0,2617,0,2,1}, {0,7431,0,2,1}, {0,829,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,3909,0,4,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,23472,0,4,1}, {0,3114,0,2,1}, {0,841,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,5670,0,3,1},
+    {0,7077,0,3,1}, {0,46081,0,3,1}, {0,850,0,4,1}, {0,14418,0,4,1},
+    {0,45010,0,4,1}, {0,39799,0,6,1}, {0,34699,0,7,1}, {0,29306,0,8,1},
+    {0,15716,0,11,1}, {0,16255,0,11,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,7077,0,3,1}, {0,3975,0,3,1}, {0,709,0,3,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,27,0,2,1}, {0,872,0,2,1},
+    {0,4296,0,2,1}, {0,18300,0,2,1}, {0,640,0,2,1}, {0,765,0,2,1},
+    {0,5,0,2,1}, {0,543,0,2,1}, {0,7,0,2,1}, {0,1595,0,2,1},
+    {0,6744,0,3,1}, {0,45106,0,4,1}, {0,42279,0,5,1}, {0,42404,0,5,1},
+    {0,44064,0,5,1}, {0,588,0,5,1}, {0,32424,0,7,1}, {0,33334,0,7,1},
+    {0,33558,0,7,1}, {0,33831,0,7,1}, {0,33985,0,7,1}, {0,33992,0,7,1},
+    {0,26138,0,8,1}, {0,26410,0,8,1}, {0,26418,0,8,1}, {0,27234,0,8,1},
+    {0,22318,0,9,1}, {0,22327,0,9,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,5373,0,3,1}, {0,872,0,3,1}, {0,539,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,7392,0,6,1},
+    {9419,15210,1,11,0}, {0,4,0,1,1}, {0,45829,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,1175,0,3,1}, {0,23472,0,4,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,4,0,2,1}, {0,4334,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,31757,0,3,1},
+    {0,26138,0,8,1}, {0,517,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,45958,0,3,1}, {0,2124,0,3,1}, {0,35639,0,3,1},
+    {0,3261,0,3,1}, {0,14299,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1},
+    {0,852,0,3,1}, {0,185,0,3,1}, {0,44730,0,4,1}, {0,5477,0,5,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,81,0,2,1},
+    {0,1595,0,2,1}, {0,42239,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,23472,0,4,1}, {0,872,0,3,1},
+    {0,26138,0,8,1}, {0,26138,0,8,1}, {0,17397,0,10,1}, {0,520,0,2,1},
+    {0,5321,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,15444,0,4,1},
+    {0,520,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,1581,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,46072,0,3,1},
+    {0,1595,0,3,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4902,0,5,1}, {0,3114,0,2,1},
+    {0,850,0,4,1}, {0,151,0,2,1}, {0,81,0,2,1}, {0,7403,0,2,1},
+    {0,1087,0,2,1}, {0,26138,0,8,1}, {0,517,0,2,1}, {0,4,0,2,1},
+    {0,45838,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,8042,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,46195,0,3,1}, {0,26594,0,4,1},
+    {0,45070,0,4,1}, {0,45266,0,4,1}, {0,45314,0,4,1}, {0,45346,0,4,1},
+    {0,282,0,4,1}, {0,45586,0,4,1}, {0,14165,0,5,1}, {0,42874,0,5,1},
+    {0,43324,0,5,1}, {0,44614,0,5,1}, {9420,37435,1,6,1}, {0,37507,0,6,1},
+    {0,37885,0,6,1}, {0,38785,0,6,1}, {0,39481,0,6,1}, {0,41041,0,6,1},
+    {0,29955,0,7,1}, {0,34531,0,7,1}, {0,35448,0,7,1}, {9421,36309,1,7,0},
+    {0,26194,0,8,1}, {0,14704,0,8,1}, {0,1310,0,8,1}, {0,31114,0,8,1},
+    {0,21949,0,9,1}, {0,24640,0,9,1}, {0,1319,0,11,1}, {0,14704,0,11,1},
+    {0,14715,0,11,1}, {0,14726,0,11,1}, {0,14737,0,11,1}, {0,14748,0,11,1},
+    {0,14759,0,11,1}, {0,4,0,2,1}, {0,3114,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,5670,0,3,1},
+    {0,7077,0,3,1}, {0,46081,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3939,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,19367,0,4,1}, {0,26138,0,8,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,45010,0,4,1},
+    {0,39799,0,6,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,32310,0,3,1},
+    {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,2639,0,2,1}, {0,872,0,3,1},
+    {0,26138,0,8,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,2169,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,28754,0,8,1},
+    {9422,19,1,3,1}, {0,10787,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,5,0,2,1}, {0,19,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1},
+    {0,21175,0,4,1}, {0,14418,0,4,1}, {0,23472,0,4,1}, {0,19367,0,4,1},
+    {0,1204,0,6,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,14418,0,4,1}, {0,1204,0,6,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,26138,0,8,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,19367,0,4,1}, {0,26138,0,8,1}, {0,517,0,2,1},
+    {0,4,0,2,1}, {0,791,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,25,0,2,1},
+    {0,518,0,2,1}, {0,4,0,2,1}, {0,695,0,2,1}, {0,266,0,2,1},
+    {0,4588,0,2,1}, {0,5,0,2,1}, {0,2617,0,2,1}, {0,829,0,2,1},
+    {0,1071,0,2,1}, {0,19,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1},
+    {0,23472,0,4,1}, {0,2205,0,4,1}, {0,19367,0,4,1}, {0,24280,0,6,1},
+    {0,5670,0,3,1}, {0,850,0,4,1}, {0,19,0,3,1}, {0,3261,0,3,1},
+    {0,1175,0,3,1}, {0,3125,0,3,1}, {0,185,0,3,1}, {0,4537,0,4,1},
+    {0,26930,0,4,1}, {0,23472,0,4,1}, {0,31992,0,5,1}, {0,11103,0,5,1},
+    {0,9,0,1,1}, {0,1110,0,3,1}, {9423,19,1,3,1}, {0,10787,0,3,1},
+    {0,386,0,3,1}, {0,872,0,3,1}, {0,35639,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,14299,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1},
+    {0,26930,0,4,1}, {0,2205,0,4,1}, {0,19367,0,4,1}, {0,517,0,2,1},
+    {0,4,0,2,1}, {0,266,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,42237,0,3,1}, {0,2124,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,5670,0,3,1}, {0,7077,0,3,1}, {0,185,0,3,1},
+    {0,23472,0,4,1}, {0,4,0,2,1}, {0,872,0,3,1}, {0,42454,0,5,1},
+    {0,38497,0,6,1}, {0,32221,0,7,1}, {0,26138,0,8,1}, {0,30794,0,8,2},
+    {0,17397,0,10,1}, {0,11912,0,12,1}, {0,5462,0,15,1}, {9424,1485,1,2,1},
+    {9425,2995,1,2,1}, {0,168,0,2,1}, {9426,587,1,2,1}, {0,4,0,2,1},
+    {9427,22683,1,2,1}, {0,661,0,2,1}, {9428,936,1,2,1}, {9429,1813,1,2,1},
+    {9430,631,1,2,1}, {9431,6458,1,2,1}, {9432,83,1,2,1}, {9433,1098,1,2,1},
+    {9434,276,1,2,1}, {9435,702,1,2,1}, {9436,4563,1,2,1}, {9437,86,1,2,1},
+    {9438,3114,1,2,1}, {9439,261,1,2,1}, {9440,176,1,2,1}, {9441,6232,1,2,1},
+    {0,541,0,3,1}, {0,19364,0,3,1}, {0,2886,0,3,1}, {0,44930,0,3,1},
+    {0,5092,0,3,1}, {0,21880,0,3,1}, {0,32022,0,3,1}, {0,6156,0,3,1},
+    {0,36812,0,3,1}, {0,19285,0,3,1}, {0,6744,0,3,1}, {0,3868,0,3,1},
+    {0,7419,0,3,1}, {0,8362,0,3,1}, {0,5826,0,3,1}, {0,18314,0,3,1},
+    {0,34514,0,3,1}, {0,8723,0,4,1}, {0,12540,0,4,1}, {0,20130,0,4,1},
+    {0,23399,0,4,1}, {0,30937,0,4,1}, {0,6534,0,4,1}, {0,44774,0,4,1},
+    {0,44782,0,4,1}, {0,32683,0,4,1}, {0,44958,0,4,1}, {0,27018,0,4,1},
+    {0,24429,0,4,1}, {0,8742,0,4,1}, {0,45026,0,4,1}, {0,45058,0,4,1},
+    {0,45094,0,4,1}, {0,45206,0,4,1}, {0,21882,0,4,1}, {0,38755,0,4,1},
+    {0,28522,0,4,1}, {0,45298,0,4,1}, {0,45378,0,4,1}, {0,32341,0,4,1},
+    {9442,45398,1,4,1}, {0,45406,0,4,1}, {0,282,0,4,1}, {0,8863,0,4,1},
+    {0,7502,0,4,1}, {0,30803,0,4,1}, {0,24679,0,4,1}, {0,44164,0,4,1},
+    {0,1323,0,4,1}, {0,21835,0,4,1}, {0,2511,0,4,1}, {0,7422,0,4,1},
+    {0,6716,0,4,1}, {0,45594,0,4,1}, {0,44499,0,4,1}, {0,16304,0,4,1},
+    {0,24337,0,4,1}, {0,16299,0,4,1}, {0,40028,0,5,1}, {0,23402,0,5,1},
+    {0,42109,0,5,1}, {0,42114,0,5,1}, {0,42119,0,5,1}, {0,42124,0,5,1},
+    {0,42144,0,5,1}, {0,42164,0,5,1}, {0,42174,0,5,1}, {0,42179,0,5,1},
+    {0,42244,0,5,1}, {0,42259,0,5,1}, {0,42264,0,5,1}, {0,42274,0,5,1},
+    {0,42289,0,5,1}, {0,42469,0,5,1}, {0,42479,0,5,1}, {0,42504,0,5,1},
+    {0,42579,0,5,1}, {0,11268,0,5,1}, {0,42614,0,5,1}, {0,42619,0,5,1},
+    {0,42624,0,5,1}, {0,42639,0,5,1}, {0,42644,0,5,1}, {0,42649,0,5,1},
+    {0,42679,0,5,1}, {0,42709,0,5,1}, {0,42759,0,5,1}, {0,42774,0,5,1},
+    {0,42789,0,5,1}, {0,42809,0,5,1}, {0,33607,0,5,1}, {0,19043,0,5,1},
+    {0,38077,0,5,1}, {0,3548,0,5,1}, {0,42854,0,5,1}, {0,42859,0,5,1},
+    {0,42884,0,5,1}, {0,43059,0,5,1}, {0,43064,0,5,1}, {0,43209,0,5,1},
+    {0,43254,0,5,1}, {0,43259,0,5,1}, {0,43284,0,5,1}, {0,43319,0,5,1},
+    {0,43339,0,5,1}, {0,43369,0,5,1}, {0,43374,0,5,1}, {0,43474,0,5,1},
+    {0,43494,0,5,1}, {0,20134,0,5,1}, {0,43849,0,5,1}, {0,35627,0,5,1},
+    {0,43854,0,5,1}, {0,43884,0,5,1}, {0,43889,0,5,1}, {0,43914,0,5,1},
+    {0,40718,0,5,1}, {0,43919,0,5,1}, {0,43934,0,5,1}, {0,43944,0,5,1},
+    {0,43949,0,5,1}, {0,26845,0,5,1}, {0,44024,0,5,1}, {0,44049,0,5,1},
+    {0,44054,0,5,1}, {0,44099,0,5,1}, {0,44104,0,5,1}, {0,44109,0,5,1},
+    {0,44139,0,5,1}, {0,44144,0,5,1}, {0,44159,0,5,1}, {0,44169,0,5,1},
+    {0,44179,0,5,1}, {0,36001,0,5,1}, {0,44214,0,5,1}, {0,44239,0,5,1},
+    {0,44324,0,5,1}, {0,40292,0,5,1}, {0,44354,0,5,1}, {0,44379,0,5,1},
+    {0,44409,0,5,1}, {0,44434,0,5,1}, {0,44494,0,5,1}, {0,44499,0,5,1},
+    {0,1012,0,5,1}, {0,44504,0,5,1}, {0,44509,0,5,1}, {0,44514,0,5,1},
+    {0,39388,0,5,1}, {0,44534,0,5,1}, {0,44659,0,5,1}, {0,44664,0,5,1},
+    {0,44669,0,5,1}, {0,36877,0,6,1}, {0,20361,0,6,1}, {0,4959,0,6,1},
+    {0,36949,0,6,1}, {0,36961,0,6,1}, {0,35652,0,6,1}, {0,37021,0,6,1},
+    {0,37033,0,6,1}, {0,37069,0,6,1}, {0,37087,0,6,1}, {0,37093,0,6,1},
+    {0,37117,0,6,1}, {0,37135,0,6,1}, {0,37141,0,6,1}, {0,37159,0,6,1},
+    {0,37183,0,6,1}, {0,37249,0,6,1}, {0,37255,0,6,1}, {0,37465,0,6,1},
+    {0,37525,0,6,1}, {0,37573,0,6,1}, {0,37579,0,6,1}, {0,37639,0,6,1},
+    {0,37657,0,6,1}, {0,37669,0,6,1}, {0,37675,0,6,1}, {0,37681,0,6,1},
+    {0,37699,0,6,1}, {0,37729,0,6,1}, {0,37735,0,6,1}, {0,37747,0,6,1},
+    {0,37753,0,6,1}, {0,37783,0,6,1}, {0,37795,0,6,1}, {0,37801,0,6,1},
+    {0,37873,0,6,1}, {0,37939,0,6,1}, {0,37957,0,6,1}, {0,37981,0,6,1},
+    {0,38011,0,6,1}, {0,38023,0,6,1}, {0,38053,0,6,1}, {0,38077,0,6,1},
+    {0,38149,0,6,1}, {0,38179,0,6,1}, {0,38197,0,6,1}, {0,38203,0,6,1},
+    {0,38215,0,6,1}, {0,23561,0,6,1}, {0,38431,0,6,1}, {0,38551,0,6,1},
+    {0,38677,0,6,1}, {0,38701,0,6,1}, {0,38707,0,6,1}, {0,38743,0,6,1},
+    {0,38749,0,6,1}, {0,38755,0,6,1}, {0,38761,0,6,1}, {0,38767,0,6,1},
+    {0,38815,0,6,1}, {0,38821,0,6,1}, {0,5471,0,6,1}, {0,38839,0,6,1},
+    {0,38845,0,6,1}, {0,38881,0,6,1}, {0,38893,0,6,1}, {0,38911,0,6,1},
+    {0,18471,0,6,1}, {0,38965,0,6,1}, {0,38971,0,6,1}, {0,38977,0,6,1},
+    {0,39217,0,6,1}, {0,39247,0,6,1}, {0,1204,0,6,1}, {0,39355,0,6,1},
+    {0,39385,0,6,1}, {0,39415,0,6,1}, {0,39559,0,6,1}, {0,39613,0,6,1},
+    {0,39625,0,6,1}, {0,39631,0,6,1}, {0,39637,0,6,1}, {0,39649,0,6,1},
+    {0,39847,0,6,1}, {0,39859,0,6,1}, {0,39913,0,6,1}, {0,39919,0,6,1},
+    {0,39937,0,6,1}, {0,39949,0,6,1}, {0,39955,0,6,1}, {0,39979,0,6,1},
+    {0,39985,0,6,1}, {0,40027,0,6,1}, {0,40189,0,6,1}, {0,40195,0,6,1},
+    {0,40201,0,6,1}, {0,40207,0,6,1}, {0,40213,0,6,1}, {0,40219,0,6,1},
+    {0,40231,0,6,1}, {0,40237,0,6,1}, {0,40243,0,6,1}, {0,40249,0,6,1},
+    {0,40261,0,6,1}, {0,40273,0,6,1}, {0,40291,0,6,1}, {0,14984,0,6,1},
+    {0,40327,0,6,1}, {0,40411,0,6,1}, {0,40417,0,6,1}, {0,40423,0,6,1},
+    {0,40429,0,6,1}, {0,40567,0,6,1}, {0,40693,0,6,1}, {0,40699,0,6,1},
+    {0,40717,0,6,1}, {0,40723,0,6,1}, {0,40729,0,6,1}, {0,40735,0,6,1},
+    {0,40765,0,6,1}, {0,40771,0,6,1}, {0,40777,0,6,1}, {0,40831,0,6,1},
+    {0,40843,0,6,1}, {0,40849,0,6,1}, {0,40861,0,6,1}, {0,40891,0,6,1},
+    {0,40903,0,6,1}, {0,40915,0,6,1}, {0,40945,0,6,1}, {0,40975,0,6,1},
+    {0,40981,0,6,1}, {0,41209,0,6,1}, {0,41215,0,6,1}, {0,41221,0,6,1},
+    {0,41227,0,6,1}, {0,31556,0,7,1}, {0,31612,0,7,1}, {0,31654,0,7,1},
+    {0,31661,0,7,1}, {0,31696,0,7,1}, {0,31731,0,7,1}, {0,31745,0,7,1},
+    {0,31815,0,7,1}, {0,31899,0,7,1}, {0,31913,0,7,1}, {0,14286,0,7,1},
+    {0,32004,0,7,1}, {0,32032,0,7,1}, {0,32039,0,7,1}, {0,32508,0,7,1},
+    {0,32522,0,7,1}, {0,32592,0,7,1}, {0,32613,0,7,1}, {0,32648,0,7,1},
+    {0,32683,0,7,1}, {0,32725,0,7,1}, {0,32753,0,7,1}, {0,32774,0,7,1},
+    {0,32851,0,7,1}, {0,32879,0,7,1}, {0,32907,0,7,1}, {0,33320,0,7,1},
+    {0,33327,0,7,1}, {0,33341,0,7,1}, {0,33404,0,7,1}, {0,33411,0,7,1},
+    {0,33418,0,7,1}, {0,33432,0,7,1}, {0,33509,0,7,1}, {0,33572,0,7,1},
+    {0,33607,0,7,1}, {0,33635,0,7,1}, {9443,33649,4,7,0}, {0,33740,0,7,1},
+    {0,33747,0,7,1}, {0,33761,0,7,1}, {0,33838,0,7,1}, {0,33943,0,7,1},
+    {0,34006,0,7,1}, {0,34027,0,7,1}, {0,34104,0,7,1}, {0,34111,0,7,1},
+    {0,34279,0,7,1}, {0,34314,0,7,1}, {0,34363,0,7,1}, {0,34433,0,7,1},
+    {0,34447,0,7,1}, {0,34468,0,7,1}, {0,34475,0,7,1}, {0,34510,0,7,1},
+    {0,34524,0,7,1}, {0,34573,0,7,1}, {0,34580,0,7,1}, {0,34587,0,7,1},
+    {0,34622,0,7,1}, {0,34720,0,7,1}, {0,34734,0,7,1}, {0,34769,0,7,1},
+    {0,34776,0,7,1}, {0,34797,0,7,1}, {0,34811,0,7,1}, {0,34874,0,7,1},
+    {0,34937,0,7,1}, {0,35056,0,7,1}, {0,35084,0,7,1}, {0,35266,0,7,1},
+    {9447,35273,1,7,0}, {0,35287,0,7,1}, {0,35490,0,7,1}, {0,35546,0,7,1},
+    {0,35560,0,7,1}, {0,35567,0,7,1}, {0,35588,0,7,1}, {0,35595,0,7,1},
+    {0,35602,0,7,1}, {0,35637,0,7,1}, {0,1908,0,7,1}, {0,35651,0,7,1},
+    {0,35742,0,7,1}, {0,35861,0,7,1}, {0,9866,0,7,1}, {0,35882,0,7,1},
+    {0,35896,0,7,1}, {0,35903,0,7,1}, {0,35910,0,7,1}, {0,35924,0,7,1},
+    {0,35931,0,7,1}, {0,35952,0,7,1}, {0,35980,0,7,1}, {0,35987,0,7,1},
+    {0,36001,0,7,1}, {0,36008,0,7,1}, {0,36015,0,7,1}, {0,36043,0,7,1},
+    {0,36064,0,7,1}, {0,36232,0,7,1}, {0,36316,0,7,1}, {0,36358,0,7,1},
+    {0,36435,0,7,1}, {0,36449,0,7,1}, {0,36491,0,7,1}, {0,36498,0,7,1},
+    {0,36505,0,7,1}, {0,36512,0,7,1}, {0,36568,0,7,1}, {0,28411,0,7,1},
+    {0,36813,0,7,1}, {0,36820,0,7,1}, {0,36827,0,7,1}, {0,36834,0,7,1},
+    {0,25818,0,8,1}, {9448,25906,1,8,0}, {0,25914,0,8,1}, {0,26034,0,8,1},
+    {0,26098,0,8,1}, {0,26114,0,8,1}, {0,26122,0,8,1}, {0,26138,0,8,1},
+    {9449,26258,1,8,0}, {0,26274,0,8,1}, {0,26282,0,8,1}, {0,26770,0,8,1},
+    {0,26786,0,8,1}, {0,26794,0,8,1}, {0,26802,0,8,1}, {0,26810,0,8,1},
+    {0,26850,0,8,1}, {0,26938,0,8,1}, {0,26954,0,8,1}, {0,27138,0,8,1},
+    {0,27162,0,8,1}, {0,27170,0,8,1}, {0,27202,0,8,1}, {0,27330,0,8,1},
+    {0,27402,0,8,1}, {0,27418,0,8,1}, {0,27434,0,8,1}, {0,27466,0,8,1},
+    {0,27506,0,8,1}, {0,27538,0,8,1}, {0,27690,0,8,1}, {0,27698,0,8,1},
+    {0,27746,0,8,1}, {0,27922,0,8,1}, {0,28066,0,8,1}, {0,28186,0,8,1},
+    {0,28210,0,8,1}, {0,28370,0,8,1}, {0,28378,0,8,1}, {0,28386,0,8,1},
+    {0,28410,0,8,1}, {0,28418,0,8,1}, {0,28434,0,8,1}, {0,28450,0,8,1},
+    {0,28474,0,8,1}, {0,28706,0,8,1}, {0,28882,0,8,1}, {0,28890,0,8,1},
+    {0,28906,0,8,1}, {0,29018,0,8,1}, {0,29138,0,8,1}, {0,29154,0,8,1},
+    {0,29162,0,8,1}, {0,29186,0,8,1}, {0,29250,0,8,1}, {0,29258,0,8,1},
+    {0,29282,0,8,1}, {9450,29290,6,8,0}, {0,29322,0,8,1}, {0,29338,0,8,1},
+    {0,29434,0,8,1}, {0,29450,0,8,1}, {0,29466,0,8,1}, {0,29474,0,8,1},
+    {0,29610,0,8,1}, {0,29706,0,8,1}, {0,29754,0,8,1}, {0,29762,0,8,1},
+    {0,29802,0,8,1}, {0,29810,0,8,1}, {0,29842,0,8,1}, {0,29938,0,8,1},
+    {0,30178,0,8,1}, {0,30186,0,8,1}, {0,30194,0,8,1}, {0,30202,0,8,1},
+    {0,30234,0,8,1}, {0,30242,0,8,1}, {0,30258,0,8,1}, {0,30266,0,8,1},
+    {0,5882,0,8,1}, {0,30370,0,8,1}, {9456,30378,1,8,1}, {0,30426,0,8,1},
+    {0,30602,0,8,1}, {9457,30642,3,8,0}, {0,30674,0,8,1}, {0,30730,0,8,1},
+    {0,30802,0,8,1}, {0,30810,0,8,1}, {0,30858,0,8,1}, {0,30930,0,8,1},
+    {0,30970,0,8,1}, {0,30986,0,8,1}, {9460,31026,1,8,0}, {0,31058,0,8,1},
+    {0,31370,0,8,1}, {0,31378,0,8,1}, {9461,31386,1,8,0}, {0,21211,0,9,1},
+    {0,21238,0,9,1}, {0,21301,0,9,1}, {0,21436,0,9,1}, {0,21445,0,9,1},
+    {0,21463,0,9,1}, {0,21490,0,9,1}, {0,21499,0,9,1}, {0,21544,0,9,1},
+    {0,21571,0,9,1}, {0,21607,0,9,1}, {0,21634,0,9,1}, {0,8683,0,9,1},
+    {0,21895,0,9,1}, {0,21958,0,9,1}, {0,22057,0,9,1}, {0,22066,0,9,1},
+    {0,22228,0,9,1}, {0,22255,0,9,1}, {0,22291,0,9,1}, {0,22372,0,9,1},
+    {0,22453,0,9,1}, {9462,22516,1,9,0}, {0,22525,0,9,1}, {0,22543,0,9,1},
+    {0,22552,0,9,1}, {0,22570,0,9,1}, {0,22579,0,9,1}, {9463,22750,1,9,1},
+    {0,22813,0,9,1}, {0,23056,0,9,1}, {0,23083,0,9,1}, {0,23155,0,9,1},
+    {0,23164,0,9,1}, {0,23173,0,9,1}, {0,23182,0,9,1}, {0,23236,0,9,1},
+    {0,23254,0,9,1}, {0,23263,0,9,1}, {0,23290,0,9,1}, {0,23308,0,9,1},
+    {0,23371,0,9,1}, {0,23380,0,9,1}, {0,23398,0,9,1}, {0,23560,0,9,1},
+    {0,23569,0,9,1}, {0,23722,0,9,1}, {0,23839,0,9,1}, {0,23848,0,9,1},
+    {0,23857,0,9,1}, {0,23866,0,9,1}, {0,23929,0,9,1}, {0,23965,0,9,1},
+    {0,24073,0,9,1}, {0,24082,0,9,1}, {0,24109,0,9,1}, {0,24118,0,9,1},
+    {0,24136,0,9,1}, {0,24172,0,9,1}, {0,24181,0,9,1}, {0,24217,0,9,1},
+    {0,24226,0,9,1}, {0,24253,0,9,1}, {0,24568,0,9,1}, {0,24586,0,9,1},
+    {0,24622,0,9,1}, {0,24658,0,9,1}, {0,24703,0,9,1}, {0,24712,0,9,1},
+    {0,24721,0,9,1}, {0,4381,0,9,1}, {0,24748,0,9,1}, {0,24784,0,9,1},
+    {0,24793,0,9,1}, {0,24802,0,9,1}, {0,24811,0,9,1}, {0,24910,0,9,1},
+    {0,25000,0,9,1}, {0,25009,0,9,1}, {0,25072,0,9,1}, {0,25144,0,9,1},
+    {0,25153,0,9,1}, {0,25162,0,9,1}, {0,25189,0,9,1}, {0,25360,0,9,1},
+    {0,25405,0,9,1}, {0,25468,0,9,1}, {0,25621,0,9,1}, {0,25630,0,9,1},
+    {0,17457,0,10,1}, {0,17567,0,10,1}, {0,17687,0,10,1}, {0,17707,0,10,1},
+    {0,17717,0,10,1}, {0,18027,0,10,1}, {0,18277,0,10,1}, {0,18287,0,10,1},
+    {0,18307,0,10,1}, {0,18367,0,10,1}, {0,18377,0,10,1}, {0,18397,0,10,1},
+    {0,18467,0,10,1}, {0,18507,0,10,1}, {0,18667,0,10,1}, {0,18727,0,10,1},
+    {0,18757,0,10,1}, {0,18877,0,10,1}, {0,18887,0,10,1}, {0,18907,0,10,1},
+    {0,18917,0,10,1}, {0,19027,0,10,1}, {0,19117,0,10,1}, {0,19257,0,10,1},
+    {0,19357,0,10,1}, {0,19377,0,10,1}, {0,19457,0,10,1}, {0,19477,0,10,1},
+    {0,19547,0,10,1}, {0,19617,0,10,1}, {0,19797,0,10,1}, {0,20027,0,10,1},
+    {0,20037,0,10,1}, {0,20047,0,10,1}, {0,20247,0,10,1}, {0,20257,0,10,1},
+    {0,20337,0,10,1}, {0,20357,0,10,1}, {0,20717,0,10,1}, {0,21047,0,10,1},
+    {0,14132,0,11,1}, {0,14209,0,11,1}, {0,14286,0,11,1}, {0,14308,0,11,1},
+    {0,14462,0,11,1}, {0,14671,0,11,1}, {0,14781,0,11,1}, {0,14814,0,11,1},
+    {0,14979,0,11,1}, {0,14990,0,11,1}, {0,15243,0,11,1}, {0,15254,0,11,1},
+    {0,15287,0,11,1}, {0,15309,0,11,1}, {0,15342,0,11,1}, {0,15507,0,11,1},
+    {0,15551,0,11,1}, {0,15562,0,11,1}, {0,15661,0,11,1}, {0,15826,0,11,1},
+    {0,16024,0,11,1}, {0,16046,0,11,1}, {0,16101,0,11,1}, {0,16189,0,11,1},
+    {0,16244,0,11,1}, {0,16299,0,11,1}, {0,16607,0,11,1}, {0,16915,0,11,1},
+    {0,16970,0,11,1}, {0,16981,0,11,1}, {0,17113,0,11,1}, {0,17146,0,11,1},
+    {0,17234,0,11,1}, {0,17300,0,11,1}, {0,17366,0,11,1}, {0,10856,0,12,1},
+    {0,10868,0,12,1}, {0,10892,0,12,1}, {0,11036,0,12,1}, {0,11060,0,12,1},
+    {0,11216,0,12,1}, {0,11252,0,12,1}, {0,11264,0,12,1}, {0,11720,0,12,1},
+    {0,11732,0,12,1}, {0,11744,0,12,1}, {0,11768,0,12,1}, {0,11792,0,12,1},
+    {0,11912,0,12,1}, {0,11924,0,12,1}, {0,11972,0,12,1}, {0,12356,0,12,1},
+    {0,12476,0,12,1}, {0,12572,0,12,1}, {0,12740,0,12,1}, {0,12944,0,12,1},
+    {0,12956,0,12,1}, {0,12968,0,12,1}, {0,12980,0,12,1}, {0,12992,0,12,1},
+    {0,13004,0,12,1}, {0,13016,0,12,1}, {0,13028,0,12,1}, {0,13040,0,12,1},
+    {0,13052,0,12,1}, {0,13064,0,12,1}, {0,13088,0,12,1}, {0,13112,0,12,1},
+    {0,13124,0,12,1}, {0,13136,0,12,1}, {0,13148,0,12,1}, {0,13172,0,12,1},
+    {0,13340,0,12,1}, {0,13352,0,12,1}, {0,13364,0,12,1}, {0,13376,0,12,1},
+    {0,13388,0,12,1}, {0,13400,0,12,1}, {0,13412,0,12,1}, {0,13424,0,12,1},
+    {0,13436,0,12,1}, {0,13448,0,12,1}, {0,13460,0,12,1}, {0,13472,0,12,1},
+    {0,13484,0,12,1}, {0,13496,0,12,1}, {0,13508,0,12,1}, {0,13520,0,12,1},
+    {0,13532,0,12,1}, {0,13544,0,12,1}, {0,13556,0,12,1}, {0,13568,0,12,1},
+    {0,13580,0,12,1}, {0,13640,0,12,1}, {0,13652,0,12,1}, {0,13664,0,12,1},
+    {0,8540,0,13,1}, {0,8683,0,13,1}, {0,8709,0,13,1}, {0,8878,0,13,1},
+    {0,8891,0,13,1}, {0,9086,0,13,1}, {0,9112,0,13,1}, {0,9398,0,13,1},
+    {0,9463,0,13,1}, {0,9580,0,13,1}, {0,9645,0,13,1}, {0,9710,0,13,1},
+    {0,9749,0,13,1}, {0,9866,0,13,1}, {0,9931,0,13,1}, {0,10061,0,13,1},
+    {0,10191,0,13,1}, {0,10204,0,13,1}, {0,10217,0,13,1}, {0,10243,0,13,1},
+    {0,10269,0,13,1}, {0,10282,0,13,1}, {0,10321,0,13,1}, {0,10360,0,13,1},
+    {0,10373,0,13,1}, {0,10386,0,13,1}, {0,10399,0,13,1}, {0,10412,0,13,1},
+    {0,10425,0,13,1}, {0,10438,0,13,1}, {0,10451,0,13,1}, {0,10464,0,13,1},
+    {0,10477,0,13,1}, {0,10490,0,13,1}, {0,10503,0,13,1}, {0,10516,0,13,1},
+    {0,10529,0,13,1}, {0,10542,0,13,1}, {0,10555,0,13,1}, {0,10568,0,13,1},
+    {0,10581,0,13,1}, {0,10594,0,13,1}, {0,10607,0,13,1}, {0,10620,0,13,1},
+    {0,10646,0,13,1}, {0,10659,0,13,1}, {0,10672,0,13,1}, {0,10685,0,13,1},
+    {0,6790,0,14,1}, {0,7252,0,14,1}, {0,7476,0,14,1}, {0,7504,0,14,1},
+    {0,7868,0,14,1}, {0,7882,0,14,1}, {0,7896,0,14,1}, {0,7966,0,14,1},
+    {0,7994,0,14,1}, {0,8008,0,14,1}, {0,8022,0,14,1}, {0,8036,0,14,1},
+    {0,8050,0,14,1}, {0,8064,0,14,1}, {0,8190,0,14,1}, {0,8204,0,14,1},
+    {0,8218,0,14,1}, {0,8246,0,14,1}, {0,8260,0,14,1}, {0,8288,0,14,1},
+    {0,8302,0,14,1}, {0,8316,0,14,1}, {9464,8330,1,14,0}, {0,8344,0,14,1},
+    {0,8358,0,14,1}, {0,8372,0,14,1}, {0,8400,0,14,1}, {0,4907,0,15,1},
+    {0,5252,0,15,1}, {9465,5687,2,15,0}, {0,5717,0,15,1}, {0,5882,0,15,1},
+    {0,6092,0,15,1}, {0,6107,0,15,1}, {0,6137,0,15,1}, {0,6152,0,15,1},
+    {0,6167,0,15,1}, {0,6212,0,15,1}, {0,6227,0,15,1}, {0,6242,0,15,1},
+    {0,6257,0,15,1}, {0,6347,0,15,1}, {0,6362,0,15,1}, {0,6377,0,15,1},
+    {0,6392,0,15,1}, {0,6407,0,15,1}, {0,6437,0,15,1}, {0,6452,0,15,1},
+    {0,6467,0,15,1}, {0,6482,0,15,1}, {0,6497,0,15,1}, {0,6512,0,15,1},
+    {0,6527,0,15,1}, {0,6542,0,15,1}, {0,6557,0,15,1}, {9467,4237,2,16,0},
+    {0,4301,0,16,1}, {0,4381,0,16,1}, {0,4557,0,16,1}, {0,4589,0,16,1},
+    {0,4605,0,16,1}, {0,4621,0,16,1}, {0,4637,0,16,1}, {0,4653,0,16,1},
+    {0,4669,0,16,1}, {0,4685,0,16,1}, {0,4701,0,16,1}, {0,4765,0,16,1},
+    {0,4781,0,16,1}, {0,3506,0,17,1}, {0,3523,0,17,1}, {0,3540,0,17,1},
+    {0,3608,0,17,1}, {0,3625,0,17,1}, {0,3642,0,17,1}, {0,3659,0,17,1},
+    {0,2466,0,18,1}, {0,2484,0,18,1}, {0,2502,0,18,1}, {0,2538,0,18,1},
+    {0,2574,0,18,1}, {0,2610,0,18,1}, {0,2628,0,18,1}, {0,2646,0,18,1},
+    {0,2664,0,18,1}, {0,1714,0,19,1}, {0,1771,0,19,1}, {0,1790,0,19,1},
+    {0,1809,0,19,1}, {0,1828,0,19,1}, {0,1847,0,19,1}, {0,1904,0,19,1},
+    {0,1923,0,19,1}, {0,1350,0,20,1}, {0,1390,0,20,1}, {0,924,0,21,1},
+    {0,987,0,21,1}, {9469,627,2,22,0}, {0,649,0,22,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,23472,0,4,1}, {0,7677,0,4,1}, {0,28698,0,8,1},
+    {0,30050,0,8,1}, {0,5207,0,15,1}, {0,517,0,2,1}, {9471,4,1,2,1},
+    {0,32389,0,3,1}, {0,386,0,3,1}, {0,33427,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,18297,0,4,1}, {0,45014,0,4,1},
+    {0,45162,0,4,1}, {0,43314,0,5,1}, {0,291,0,6,1}, {0,39307,0,6,1},
+    {0,24280,0,6,1}, {0,19567,0,10,1}, {0,13280,0,12,1}, {0,4,0,2,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,1581,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1}, {0,1204,0,6,1},
+    {0,517,0,2,1}, {0,17623,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,42237,0,3,1}, {0,1067,0,3,1}, {0,1581,0,3,1}, {0,3261,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,46129,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,42237,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,26138,0,8,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,7077,0,3,1}, {0,9,0,1,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,14299,0,3,1}, {0,7077,0,3,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,6742,0,3,1}, {0,42237,0,3,1}, {0,28408,0,3,1},
+    {0,15642,0,3,1}, {0,45955,0,3,1}, {0,21664,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,185,0,3,1}, {0,23472,0,4,1},
+    {0,4,0,2,1}, {0,2854,0,2,1}, {0,3114,0,2,1}, {0,9120,0,3,1},
+    {0,4166,0,3,1}, {0,9474,0,3,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,20050,0,3,1}, {0,24625,0,3,1}, {9472,872,47,3,1},
+    {0,44133,0,3,1}, {0,1581,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,1093,0,3,1}, {0,37650,0,3,1},
+    {0,24631,0,3,1}, {0,31104,0,3,1}, {0,7167,0,4,1}, {0,17537,0,4,1},
+    {0,44754,0,4,1}, {0,23472,0,4,1}, {0,45222,0,4,1}, {0,9079,0,4,1},
+    {0,45374,0,4,1}, {0,38681,0,4,1}, {0,45430,0,4,1}, {0,282,0,4,1},
+    {0,7094,0,4,1}, {0,36722,0,4,1}, {0,42294,0,5,1}, {0,42394,0,5,1},
+    {0,42734,0,5,1}, {0,42919,0,5,1}, {0,43009,0,5,1}, {0,43044,0,5,1},
+    {0,43094,0,5,1}, {0,43139,0,5,1}, {0,43239,0,5,1}, {0,43269,0,5,1},
+    {0,43279,0,5,1}, {0,23461,0,5,1}, {0,43434,0,5,1}, {0,43624,0,5,1},
+    {0,43654,0,5,1}, {0,43844,0,5,1}, {0,44014,0,5,1}, {0,44039,0,5,1},
+    {0,22511,0,5,1}, {0,44124,0,5,1}, {0,44174,0,5,1}, {0,44274,0,5,1},
+    {0,44309,0,5,1}, {0,44389,0,5,1}, {0,44404,0,5,1}, {0,44479,0,5,1},
+    {0,25243,0,5,1}, {0,44639,0,5,1}, {0,44649,0,5,1}, {0,44654,0,5,1},
+    {0,37129,0,6,1}, {0,37609,0,6,1}, {0,37807,0,6,1}, {0,37813,0,6,1},
+    {0,37891,0,6,1}, {0,38389,0,6,1}, {0,38611,0,6,1}, {0,38725,0,6,1},
+    {0,38731,0,6,1}, {0,38803,0,6,1}, {0,38809,0,6,1}, {0,38947,0,6,1},
+    {0,38989,0,6,1}, {0,39001,0,6,1}, {0,39007,0,6,1}, {0,39565,0,6,1},
+    {0,39571,0,6,1}, {0,39787,0,6,1}, {0,39793,0,6,1}, {0,39823,0,6,1},
+    {0,39967,0,6,1}, {0,40225,0,6,1}, {0,40405,0,6,1}, {0,2268,0,6,1},
+    {0,41017,0,6,1}, {0,41047,0,6,1}, {0,41053,0,6,1}, {0,31878,0,7,1},
+    {0,31892,0,7,1}, {0,32214,0,7,1}, {0,32417,0,7,1}, {0,33425,0,7,1},
+    {0,33439,0,7,1}, {0,33474,0,7,1}, {0,33502,0,7,1}, {0,34118,0,7,1},
+    {0,34125,0,7,1}, {0,34160,0,7,1}, {0,34181,0,7,1}, {0,34244,0,7,1},
+    {0,34321,0,7,1}, {0,34461,0,7,1}, {0,34482,0,7,1}, {0,34615,0,7,1},
+    {0,34804,0,7,1}, {0,35182,0,7,1}, {0,35245,0,7,1}, {0,35280,0,7,1},
+    {0,35378,0,7,1}, {0,35420,0,7,1}, {0,35581,0,7,1}, {0,35889,0,7,1},
+    {0,36036,0,7,1}, {0,36050,0,7,1}, {0,36267,0,7,1}, {0,36694,0,7,1},
+    {0,36722,0,7,1}, {0,25986,0,8,1}, {0,27674,0,8,1}, {0,27954,0,8,1},
+    {0,28466,0,8,1}, {0,28514,0,8,1}, {0,28658,0,8,1}, {0,29354,0,8,1},
+    {0,29586,0,8,1}, {0,29666,0,8,1}, {0,29722,0,8,1}, {0,29954,0,8,1},
+    {0,30298,0,8,1}, {0,30394,0,8,1}, {0,30410,0,8,1}, {0,30418,0,8,1},
+    {0,30914,0,8,1}, {0,31098,0,8,1}, {0,31338,0,8,1}, {0,21580,0,9,1},
+    {0,21661,0,9,1}, {0,21877,0,9,1}, {0,22507,0,9,1}, {0,23047,0,9,1},
+    {0,23938,0,9,1}, {0,23947,0,9,1}, {0,24037,0,9,1}, {0,24046,0,9,1},
+    {0,24055,0,9,1}, {0,24100,0,9,1}, {0,24559,0,9,1}, {0,24631,0,9,1},
+    {0,25045,0,9,1}, {0,25198,0,9,1}, {0,25243,0,9,1}, {0,25252,0,9,1},
+    {0,25603,0,9,1}, {0,25612,0,9,1}, {0,17557,0,10,1}, {0,17627,0,10,1},
+    {0,17637,0,10,1}, {0,18837,0,10,1}, {0,18857,0,10,1}, {0,19057,0,10,1},
+    {0,19537,0,10,1}, {0,19637,0,10,1}, {0,19707,0,10,1}, {0,20007,0,10,1},
+    {0,20067,0,10,1}, {0,20117,0,10,1}, {0,14253,0,11,1}, {0,16079,0,11,1},
+    {0,11612,0,12,1}, {0,11912,0,12,1}, {0,12500,0,12,1}, {0,12512,0,12,1},
+    {0,9567,0,13,1}, {0,7084,0,14,1}, {0,5612,0,15,1}, {0,4398,0,3,1},
+    {0,19367,0,4,1}, {0,4,0,2,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,517,0,2,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,413,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5632,0,3,1}, {0,23472,0,4,1},
+    {0,25256,0,4,1}, {0,19367,0,4,1}, {0,15782,0,4,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,12640,0,3,1}, {0,4223,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,6881,0,4,1}, {0,5559,0,4,1}, {0,26138,0,8,1}, {0,10724,0,12,1},
+    {0,4,0,2,1}, {0,1106,0,2,1}, {0,872,0,2,1}, {0,765,0,2,1},
+    {0,5,0,2,1}, {0,45742,0,4,1}, {0,42204,0,5,1}, {0,32256,0,7,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,14418,0,4,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,1595,0,3,1}, {0,19367,0,4,1}, {0,26138,0,8,1},
+    {0,19,0,3,1}, {0,5670,0,3,1}, {0,850,0,4,1}, {0,26138,0,8,1},
+    {0,4,0,2,1}, {0,83,0,2,1}, {0,3114,0,2,1}, {0,19,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,3125,0,3,1}, {0,36844,0,3,1},
+    {0,4537,0,4,1}, {0,26930,0,4,1}, {0,23472,0,4,1}, {0,7094,0,4,1},
+    {0,14165,0,5,1}, {0,11103,0,5,1}, {0,26138,0,8,1}, {0,517,0,2,1},
+    {0,4,0,2,1}, {0,266,0,2,1}, {0,1349,0,2,1}, {0,2193,0,2,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,7077,0,3,1}, {9519,31969,1,7,0},
+    {0,26138,0,8,1}, {0,517,0,2,1}, {0,1487,0,2,1}, {0,17647,0,3,1},
+    {0,45841,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,2124,0,3,1}, {0,46018,0,3,1}, {0,6744,0,3,1}, {0,8265,0,3,1},
+    {0,3261,0,3,1}, {0,17811,0,3,1}, {0,7077,0,3,1}, {0,9600,0,3,1},
+    {0,46141,0,3,1}, {0,45322,0,4,1}, {0,3900,0,4,1}, {9520,43324,1,5,1},
+    {0,43329,0,5,1}, {0,43414,0,5,1}, {0,37933,0,6,1}, {0,38905,0,6,1},
+    {9521,39289,4,6,1}, {0,31514,0,7,1}, {0,31542,0,7,1}, {9525,32235,1,7,0},
+    {0,32690,0,7,1}, {0,34895,0,7,1}, {0,26138,0,8,1}, {0,26562,0,8,1},
+    {0,27794,0,8,1}, {0,28354,0,8,1}, {0,28770,0,8,1}, {0,28842,0,8,1},
+    {0,31042,0,8,1}, {0,21535,0,9,1}, {0,19667,0,10,1}, {0,16277,0,11,1},
+    {9526,12224,1,12,0}, {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,14418,0,4,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,1581,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,5559,0,3,1}, {0,1595,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,2617,0,2,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,1581,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,23472,0,4,1}, {0,26,0,1,1}, {0,187,0,1,1},
+    {0,4,0,1,1}, {0,81,0,1,1}, {0,8,0,1,1}, {0,94,0,1,1},
+    {0,30,0,1,1}, {0,31,0,1,1}, {0,9,0,1,1}, {0,932,0,1,1},
+    {0,17,0,1,1}, {0,21,0,1,1}, {0,1,0,1,1}, {0,5,0,1,1},
+    {0,129,0,1,1}, {0,6,0,1,1}, {0,11,0,1,1}, {0,15,0,1,1},
+    {0,22,0,1,1}, {0,185,0,1,1}, {0,0,0,1,1}, {0,1203,0,1,1},
+    {0,289,0,1,1}, {0,517,0,2,1}, {0,6096,0,2,1}, {0,1382,0,2,1},
+    {0,1487,0,2,1}, {0,3114,0,2,1}, {0,19,0,3,1}, {0,45910,0,3,1},
+    {0,7077,0,3,1}, {0,15444,0,4,1}, {0,44930,0,4,1}, {9527,30356,1,4,0},
+    {0,3789,0,5,1}, {0,43734,0,5,1}, {0,4902,0,5,1}, {0,38287,0,6,1},
+    {0,38575,0,6,1}, {0,38683,0,6,1}, {0,34272,0,7,1}, {0,26138,0,8,1},
+    {0,17377,0,10,1}, {0,11600,0,12,1}, {0,11912,0,12,1}, {0,7532,0,14,1},
+    {0,5642,0,15,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1175,0,3,1}, {0,26138,0,8,1},
+    {0,26818,0,8,1}, {0,45817,0,3,1}, {0,19,0,3,1}, {0,872,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,1102,0,3,1}, {0,7077,0,3,1},
+    {0,46198,0,3,1}, {0,27282,0,8,1}, {9528,8818,4,8,0}, {0,31114,0,8,1},
+    {0,37855,0,6,1}, {0,33397,0,7,1}, {0,26138,0,8,1}, {0,26138,0,8,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,4166,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,7077,0,3,1}, {0,45010,0,4,1}, {0,20267,0,4,1}, {0,1175,0,5,1},
+    {0,26138,0,8,1}, {0,164,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1},
+    {0,164,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1},
+    {0,4,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,39481,0,4,1}, {0,11103,0,5,1},
+    {0,35672,0,7,1}, {0,29642,0,8,1}, {0,21832,0,9,1}, {0,21985,0,9,1},
+    {0,8265,0,3,1}, {0,17811,0,3,1}, {0,46141,0,3,1}, {0,45626,0,4,1},
+    {0,45634,0,4,1}, {0,42554,0,5,1}, {0,43204,0,5,1}, {0,43489,0,5,1},
+    {0,43759,0,5,1}, {0,44149,0,5,1}, {0,37933,0,6,1}, {0,38311,0,6,1},
+    {0,38395,0,6,1}, {0,38641,0,6,1}, {0,40549,0,6,1}, {0,31542,0,7,1},
+    {0,31668,0,7,1}, {0,31997,0,7,1}, {0,32011,0,7,1}, {0,33362,0,7,1},
+    {0,33936,0,7,1}, {0,34083,0,7,1}, {0,34097,0,7,1}, {0,34895,0,7,1},
+    {0,35098,0,7,1}, {0,36344,0,7,1}, {0,36554,0,7,1}, {0,25834,0,8,1},
+    {0,25962,0,8,1}, {0,26042,0,8,1}, {0,26402,0,8,1}, {0,26562,0,8,1},
+    {0,27794,0,8,1}, {0,28354,0,8,1}, {0,28842,0,8,1}, {0,28946,0,8,1},
+    {0,29594,0,8,1}, {0,30626,0,8,1}, {0,31042,0,8,1}, {0,21535,0,9,1},
+    {0,22858,0,9,1}, {0,22966,0,9,1}, {0,23092,0,9,1}, {0,24937,0,9,1},
+    {0,17467,0,10,1}, {0,17547,0,10,1}, {0,19097,0,10,1}, {0,14121,0,11,1},
+    {0,16178,0,11,1}, {0,16277,0,11,1}, {0,5177,0,15,1}, {0,4285,0,16,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1}, {0,7077,0,3,1},
+    {0,2014,0,3,1}, {0,872,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,7077,0,3,1}, {0,69,0,2,1},
+    {0,164,0,2,1}, {0,185,0,2,1}, {0,26138,0,8,1}, {0,1595,0,3,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,2,1}, {0,266,0,2,1},
+    {0,554,0,2,1}, {0,5,0,2,1}, {0,3261,0,3,1}, {0,7094,0,4,1},
+    {0,7610,0,6,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,2,1},
+    {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,2124,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,23,0,3,1},
+    {0,7077,0,3,1}, {0,185,0,3,1}, {0,19367,0,4,1}, {0,3900,0,4,1},
+    {0,872,0,3,1}, {0,4,0,2,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1}, {0,5670,0,3,1},
+    {0,7077,0,3,1}, {0,19,0,3,1}, {0,77,0,3,1}, {0,782,0,3,1},
+    {0,872,0,3,1}, {0,539,0,3,1}, {0,1190,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,23472,0,4,1}, {0,19779,0,4,1}, {0,1175,0,5,1},
+    {0,39055,0,6,1}, {0,36267,0,7,1}, {0,15628,0,11,1}, {0,45793,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4334,0,3,1}, {0,20365,0,3,1},
+    {0,45366,0,4,1}, {0,36561,0,7,1}, {9532,12176,1,12,0}, {0,1722,0,2,1},
+    {0,695,0,2,1}, {9533,97,1,2,1}, {0,2617,0,2,1}, {0,29983,0,3,1},
+    {0,9886,0,3,1}, {0,42239,0,3,1}, {9534,19,1,3,1}, {0,10787,0,3,1},
+    {0,386,0,3,1}, {0,872,0,3,1}, {0,46006,0,3,1}, {0,43044,0,3,1},
+    {0,6744,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1}, {0,10742,0,3,1},
+    {0,15,0,3,1}, {0,11679,0,3,1}, {0,185,0,3,1}, {0,23472,0,4,1},
+    {0,19367,0,4,1}, {0,4,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,5632,0,3,1}, {0,21175,0,4,1}, {0,14418,0,4,1},
+    {0,23472,0,4,1}, {0,45110,0,4,1}, {0,2205,0,4,1}, {0,19367,0,4,1},
+    {0,1204,0,6,1}, {0,2268,0,6,1}, {0,7042,0,6,1}, {0,19507,0,10,1},
+    {0,20447,0,10,1}, {0,14220,0,11,1}, {9535,19,1,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,45973,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,7077,0,3,1}, {0,20004,0,3,1}, {0,25862,0,4,1}, {0,44894,0,4,1},
+    {0,3724,0,4,1}, {0,41509,0,6,1}, {0,41821,0,6,1}, {0,41845,0,6,1},
+    {0,26138,0,8,1}, {0,20907,0,10,1}, {0,16640,0,11,1}, {0,13604,0,12,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,2,1}, {0,164,0,2,1},
+    {0,765,0,2,1}, {0,5,0,2,1}, {0,1595,0,2,1}, {0,2617,0,2,1},
+    {0,6744,0,3,1}, {0,23472,0,4,1}, {0,2205,0,4,1}, {0,5477,0,5,1},
+    {0,159,0,1,1}, {0,518,0,2,1}, {0,3254,0,2,1}, {0,6944,0,2,1},
+    {0,4,0,2,1}, {0,6202,0,2,1}, {0,4760,0,2,1}, {0,1827,0,2,1},
+    {0,1386,0,2,1}, {0,8817,0,2,1}, {0,4184,0,2,1}, {0,266,0,2,1},
+    {0,3255,0,2,1}, {0,19106,0,2,1}, {0,1851,0,2,1}, {0,1322,0,2,1},
+    {0,4673,0,2,1}, {0,4960,0,2,1}, {0,294,0,2,1}, {0,2447,0,2,1},
+    {0,13272,0,2,1}, {0,3101,0,2,1}, {0,3149,0,2,1}, {0,1487,0,2,1},
+    {0,175,0,2,1}, {0,389,0,2,1}, {0,4191,0,2,1}, {0,15,0,2,1},
+    {0,9700,0,2,1}, {0,4674,0,2,1}, {0,32705,0,2,1}, {0,15212,0,2,1},
+    {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1},
+    {0,3939,0,3,1}, {0,35639,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,45146,0,4,1}, {0,45190,0,4,1}, {0,45210,0,4,1}, {0,45250,0,4,1},
+    {0,45566,0,4,1}, {0,43289,0,5,1}, {0,43584,0,5,1}, {0,43899,0,5,1},
+    {0,43924,0,5,1}, {0,44544,0,5,1}, {0,44604,0,5,1}, {0,37405,0,6,1},
+    {0,39535,0,6,1}, {0,32494,0,7,1}, {0,34188,0,7,1}, {0,34195,0,7,1},
+    {0,34202,0,7,1}, {0,34566,0,7,1}, {0,35413,0,7,1}, {0,36533,0,7,1},
+    {0,26362,0,8,1}, {0,28986,0,8,1}, {0,29218,0,8,1}, {0,30658,0,8,1},
+    {0,30954,0,8,1}, {0,31354,0,8,1}, {0,31362,0,8,1}, {0,21724,0,9,1},
+    {0,21733,0,9,1}, {0,21742,0,9,1}, {0,25171,0,9,1}, {0,17797,0,10,1},
+    {0,17807,0,10,1}, {0,18797,0,10,1}, {0,19867,0,10,1}, {0,19927,0,10,1},
+    {0,17355,0,11,1}, {0,11672,0,12,1}, {0,11684,0,12,1}, {0,13628,0,12,1},
+    {0,7014,0,14,1}, {0,7028,0,14,1}, {0,5597,0,15,1}, {0,517,0,2,1},
+    {0,4,0,2,1}, {0,872,0,2,1}, {0,765,0,2,1}, {0,5,0,2,1},
+    {0,1595,0,2,1}, {0,19,0,3,1}, {0,7077,0,3,1}, {0,26138,0,8,1},
+    {0,517,0,2,1}, {9536,4,11,2,1}, {0,164,0,2,1}, {9547,872,4,3,1},
+    {0,35639,0,3,1}, {0,3261,0,3,1}, {0,46036,0,3,1}, {9551,7077,6,3,1},
+    {0,46072,0,3,1}, {0,1595,0,3,2}, {0,12181,0,4,1}, {0,27490,0,4,1},
+    {0,14165,0,5,1}, {0,42369,0,5,1}, {0,43839,0,5,1}, {0,39769,0,6,1},
+    {0,7560,0,14,1}, {0,4333,0,16,1}, {0,3030,0,17,1}, {0,2106,0,18,1},
+    {0,1543,0,19,1}, {0,1562,0,19,1}, {0,539,0,22,1}, {9557,1050,3,2,1},
+    {9560,168,3,2,1}, {9563,701,3,2,1}, {9566,202,3,2,1}, {9569,3584,3,2,1},
+    {9572,25,3,2,1}, {9575,4,3,2,1}, {9578,514,3,2,1}, {9581,5061,3,2,1},
+    {9584,81,3,2,1}, {9587,5092,3,2,1}, {9590,533,3,2,1}, {9593,3616,3,2,1},
+    {9596,70,2,2,1}, {9598,697,3,2,1}, {9601,520,3,2,1}, {9604,1119,3,2,1},
+    {9607,266,3,2,1}, {9610,1322,3,2,1}, {9613,7451,3,2,1}, {9616,790,3,2,1},
+    {9619,1053,3,2,1}, {9622,19359,3,2,1}, {9625,164,3,2,1}, {9628,554,11,2,1},
+    {9639,6221,3,2,1}, {9642,798,3,2,1}, {9645,640,3,2,1}, {9648,1354,3,2,1},
+    {9651,97,3,2,1}, {9654,136,2,2,1}, {9656,765,3,2,1}, {9659,1587,3,2,1},
+    {9662,2547,3,2,1}, {9665,163,3,2,1}, {9668,158,3,2,1}, {9671,2509,3,2,1},
+    {9674,1854,3,2,1}, {9677,1836,3,2,1}, {9680,5,3,2,1}, {9683,840,3,2,1},
+    {9686,282,3,2,1}, {9689,283,2,2,1}, {9691,1595,3,2,1}, {9694,270,2,2,1},
+    {9696,1726,3,2,1}, {9699,8091,3,2,1}, {9702,223,3,2,1}, {9705,176,3,2,1},
+    {9708,159,3,2,1}, {9711,8893,3,2,1}, {9714,1860,3,2,1}, {9717,1118,3,2,1},
+    {9720,33269,1,2,1}, {9721,15074,3,2,1}, {0,7028,0,3,1}, {0,3933,0,3,1},
+    {0,6505,0,3,1}, {0,35082,0,3,1}, {0,44878,0,4,1}, {0,36116,0,4,1},
+    {0,45346,0,4,1}, {0,42954,0,5,1}, {0,32256,0,7,1}, {0,33460,0,7,1},
+    {0,33516,0,7,1}, {0,35392,0,7,1}, {9724,26818,1,8,0}, {0,26598,0,8,1},
+    {0,28770,0,8,1}, {0,29570,0,8,1}, {0,15276,0,11,1}, {0,12548,0,12,1},
+    {9725,19,1,3,1}, {0,10787,0,3,1}, {0,25080,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4,0,2,1}, {0,19,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,614,0,2,1}, {9726,12739,1,2,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,4,0,2,1}, {0,18283,0,3,1},
+    {0,19,0,3,1}, {0,14010,0,3,1}, {0,10787,0,3,1}, {0,42237,0,3,1},
+    {0,872,0,3,1}, {0,2124,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,5670,0,3,1}, {0,7077,0,3,1}, {0,3927,0,3,1}, {0,3125,0,3,1},
+    {0,10765,0,3,1}, {0,185,0,3,1}, {0,4537,0,4,1}, {0,26930,0,4,1},
+    {0,23472,0,4,1}, {0,11103,0,5,1}, {0,151,0,2,1}, {0,4,0,2,1},
+    {0,19,0,3,1}, {0,46006,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,517,0,2,1}, {0,42239,0,3,1}, {0,19,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,5632,0,3,1}, {0,23472,0,4,1}, {0,19367,0,4,1}, {0,291,0,6,1},
+    {0,26138,0,8,1}, {0,6944,0,2,1}, {0,164,0,2,1}, {0,19,0,3,1},
+    {0,5147,0,3,1}, {0,10787,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,3909,0,4,1}, {0,42239,0,3,1}, {0,1595,0,3,1}, {0,19,0,3,1},
+    {0,10787,0,3,1}, {0,872,0,3,1}, {0,3261,0,3,1}, {0,7077,0,3,1},
+    {0,7042,0,6,1}, {0,39295,0,6,1}, {0,791,0,7,2}, {0,32249,0,7,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,7077,0,3,1}, {0,517,0,2,1},
+    {9727,4,1,2,1}, {0,3114,0,2,1}, {0,293,0,3,1}, {0,10787,0,3,1},
+    {0,872,0,3,1}, {0,5876,0,3,1}, {0,6744,0,3,1}, {0,3261,0,3,1},
+    {0,14299,0,3,1}, {0,23,0,3,1}, {0,4140,0,3,1}, {0,5670,0,3,1},
+    {0,7077,0,3,1}, {0,185,0,3,1}, {0,14055,0,5,1}, {0,24280,0,6,1},
+    {0,33537,0,7,1}, {0,517,0,2,1}, {0,4,0,2,1}, {0,42239,0,3,1},
+    {0,19,0,3,1}, {0,10787,0,3,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,3261,0,3,1}, {0,7077,0,3,1}, {0,1595,0,3,1}, {0,23472,0,4,1},
+    {0,517,0,2,1}, {0,4,0,2,1}, {0,872,0,3,1}, {0,6744,0,3,1},
+    {0,7077,0,3,1}, {9728,6713,1,3,1}, {0,185,0,3,1}, {0,44862,0,4,1},
+    {0,17955,0,4,1}, {0,45350,0,4,1}, {0,42199,0,5,2}, {0,17847,0,5,1},
+    {0,44564,0,5,1}, {0,11180,0,6,1}, {0,18417,0,6,1}, {0,31010,0,6,1},
+    {0,32795,0,7,1}, {0,34958,0,7,1}, {0,36120,0,7,1}, {0,28714,0,8,1},
+    {0,21850,0,9,2}, {0,21940,0,9,1}, {0,23344,0,9,1}, {0,24028,0,9,1},
+    {9729,24604,1,9,1}, {0,12536,0,9,1}, {0,25063,0,9,1}, {0,17677,0,10,1},
+    {0,17847,0,10,1}, {0,19437,0,10,2}, {0,14627,0,11,1}, {0,12080,0,12,1},
+    {0,7546,0,14,1}, {0,20542,0,3,1}, {0,45122,0,4,1}, {0,43394,0,5,1},
+    {0,43534,0,5,1}, {0,7042,0,6,1}, {0,39163,0,6,1}, {0,40093,0,6,1},
+    {0,41041,0,6,1}, {0,32256,0,7,1}, {0,29955,0,7,1}, {0,32865,0,7,1},
+    {0,9130,0,8,1}, {0,26978,0,8,1}, {0,18227,0,10,1}, {0,14044,0,11,1},
+    {0,20575,0,2,1}, {0,701,0,2,1}, {0,812,0,2,1}, {0,6944,0,2,1},
+    {0,4,0,2,1}, {0,81,0,2,1}, {0,828,0,2,1}, {0,3074,0,2,1},
+    {0,1855,0,2,1}, {0,1383,0,2,1}, {0,189,0,2,1}, {0,1851,0,2,1},
+    {0,196,0,2,1}, {0,13332,0,2,1}, {0,72,0,2,1}, {0,568,0,2,1},
+    {0,7431,0,2,1}, {0,829,0,2,1}, {0,4024,0,2,1}, {0,801,0,2,1},
+    {0,46003,0,3,1}, {0,23752,0,3,1}, {0,46096,0,3,1}, {0,44674,0,4,2},
+    {9730,18343,3,4,0}, {9733,45242,1,4,0}, {0,42019,0,5,1}, {0,42299,0,5,1},
+    {0,42424,0,5,1}, {0,42494,0,5,1}, {9734,42564,1,5,0}, {0,42604,0,5,1},
+    {0,42694,0,5,1}, {0,43124,0,5,1}, {0,43419,0,5,1}, {0,43649,0,5,1},
+    {0,43769,0,5,1}, {9735,43809,1,5,0}, {9736,44579,2,5,1}, {0,36841,0,6,1},
+    {0,18111,0,6,1}, {0,37219,0,6,1}, {0,37519,0,6,1}, {0,37879,0,6,1},
+    {0,37921,0,6,1}, {0,38107,0,6,1}, {9738,38347,1,6,0}, {9739,3098,2,6,0},
+    {0,38779,0,6,1}, {0,39673,0,6,1}, {0,39829,0,6,1}, {9741,29428,1,6,0},
+    {0,40093,0,6,1}, {9742,40279,1,6,0}, {9743,31647,1,7,1}, {0,31766,0,7,1},
+    {0,31920,0,7,1}, {0,31927,0,7,1}, {0,31962,0,7,1}, {0,32109,0,7,1},
+    {0,32123,0,7,1}, {0,32466,0,7,1}, {0,32501,0,7,1}, {0,32529,0,7,1},
+    {0,32914,0,7,1}, {0,32921,0,7,1}, {0,32928,0,7,1}, {0,32942,0,7,1},
+    {0,32956,0,7,1}, {0,32963,0,7,1}, {0,32970,0,7,1}, {0,32977,0,7,1},
+    {0,32984,0,7,1}, {0,32991,0,7,1}, {0,32998,0,7,1}, {0,33005,0,7,1},
+    {0,33012,0,7,1}, {0,33019,0,7,1}, {0,33026,0,7,1}, {0,33033,0,7,1},
+    {0,33047,0,7,1}, {0,33054,0,7,1}, {0,33068,0,7,1}, {0,33075,0,7,1},
+    {0,33082,0,7,1}, {0,33089,0,7,1}, {0,33096,0,7,1}, {0,33103,0,7,1},
+    {0,33110,0,7,1}, {0,33117,0,7,1}, {0,33124,0,7,1}, {0,33131,0,7,1},
+    {0,33138,0,7,1}, {0,33145,0,7,1}, {0,33159,0,7,1}, {0,33166,0,7,1},
+    {0,33173,0,7,1}, {0,33180,0,7,1}, {0,33187,0,7,1}, {0,33194,0,7,1},
+    {0,33201,0,7,1}, {0,33208,0,7,1}, {0,33215,0,7,1}, {0,33222,0,7,1},
+    {0,33229,0,7,1}, {0,33236,0,7,1}, {0,33243,0,7,1}, {0,33250,0,7,1},
+    {0,33257,0,7,1}, {0,33264,0,7,1}, {0,33271,0,7,1}, {0,33369,0,7,1},
+    {9744,33705,2,7,0}, {0,33859,0,7,1}, {0,33866,0,7,1}, {0,34839,0,7,1},
+    {0,34846,0,7,1}, {0,34867,0,7,1}, {0,34986,0,7,1}, {0,35259,0,7,1},
+    {0,35371,0,7,1}, {0,35511,0,7,1}, {0,35539,0,7,1}, {0,35728,0,7,1},
+    {0,35868,0,7,1}, {0,20370,0,7,1}, {0,36673,0,7,1}, {0,36708,0,7,1},
+    {0,25930,0,8,1}, {0,25938,0,8,1}, {0,26138,0,8,1}, {0,26146,0,8,1},
+    {0,26490,0,8,1}, {0,26586,0,8,1}, {0,26594,0,8,1}, {0,26602,0,8,1},
+    {0,26610,0,8,1}, {0,26618,0,8,1}, {0,26674,0,8,1}, {0,26714,0,8,1},
+    {0,26730,0,8,1}, {9746,26858,8,8,0}, {0,26866,0,8,1}, {0,27002,0,8,1},
+    {0,27154,0,8,1}, {0,27450,0,8,1}, {0,27498,0,8,1}, {0,27578,0,8,1},
+    {0,27602,0,8,1}, {0,27610,0,8,1}, {9754,27682,1,8,0}, {0,28226,0,8,1},
+    {0,28650,0,8,1}, {0,28962,0,8,1}, {0,28978,0,8,1}, {0,29010,0,8,1},
+    {0,29170,0,8,1}, {0,29426,0,8,1}, {0,29506,0,8,2}, {0,29562,0,8,1},
+    {0,29682,0,8,1}, {0,29746,0,8,1}, {0,29978,0,8,1}, {0,29986,0,8,1},
+    {0,29994,0,8,1}, {0,30002,0,8,1}, {0,30010,0,8,1}, {0,30210,0,8,1},
+    {0,30650,0,8,1}, {9755,30850,1,8,0}, {9756,31130,1,8,0}, {0,31274,0,8,1},
+    {9757,21256,50,9,0}, {0,21886,0,9,1}, {0,21922,0,9,1}, {0,22003,0,9,1},
+    {0,22111,0,9,1}, {0,22390,0,9,1}, {0,22399,0,9,1}, {0,22489,0,9,1},
+    {0,22588,0,9,1}, {9807,22597,2,9,0}, {0,11372,0,9,1}, {0,22651,0,9,1},
+    {0,22660,0,9,1}, {0,22669,0,9,1}, {0,22759,0,9,1}, {0,22912,0,9,1},
+    {0,22984,0,9,1}, {0,23281,0,9,1}, {9809,23497,1,9,1}, {0,23677,0,9,1},
+    {0,23704,0,9,1}, {0,23902,0,9,1}, {0,23911,0,9,1}, {0,24316,0,9,1},
+    {0,24334,0,9,1}, {0,24343,0,9,1}, {0,24352,0,9,1}, {0,24901,0,9,1},
+    {0,17407,0,10,1}, {0,8566,0,10,1}, {0,17437,0,10,1}, {0,17497,0,10,1},
+    {0,17617,0,10,1}, {0,17747,0,10,1}, {0,17837,0,10,1}, {0,17977,0,10,1},
+    {9810,17997,2,10,0}, {0,18007,0,10,1}, {0,18017,0,10,1}, {0,18047,0,10,1},
+    {0,18057,0,10,1}, {0,18087,0,10,1}, {0,18097,0,10,1}, {0,18247,0,10,1},
+    {0,18297,0,10,1}, {0,18327,0,10,1}, {0,18337,0,10,1}, {0,18477,0,10,1},
+    {0,18577,0,10,1}, {0,18587,0,10,1}, {0,18597,0,10,1}, {0,18967,0,10,1},
+    {0,19007,0,10,1}, {0,19227,0,10,1}, {0,19397,0,10,1}, {0,19487,0,10,1},
+    {0,19527,0,10,1}, {0,19607,0,10,1}, {0,19677,0,10,1}, {0,19907,0,10,1},
+    {0,19977,0,10,1}, {0,19997,0,10,1}, {0,20007,0,10,1}, {0,20017,0,10,1},
+    {9812,20147,1,10,0}, {0,20367,0,10,1}, {9813,20397,3,10,0}, {0,20407,0,10,1},
+    {0,20437,0,10,1}, {0,20457,0,10,1}, {0,14165,0,11,1}, {0,14176,0,11,1},
+    {9816,14264,2,11,1}, {0,14506,0,11,1}, {0,14517,0,11,1}, {0,14528,0,11,1},
+    {0,14550,0,11,1}, {0,14561,0,11,1}, {0,14572,0,11,1}, {0,14583,0,11,1},
+    {0,14594,0,11,1}, {0,14605,0,11,1}, {0,14616,0,11,1}, {0,14682,0,11,1},
+    {0,14770,0,11,1}, {0,14803,0,11,1}, {0,14891,0,11,1}, {0,15034,0,11,1},
+    {0,15045,0,11,1}, {0,15067,0,11,1}, {0,15078,0,11,1}, {0,15100,0,11,1},
+    {0,15111,0,11,1}, {0,15122,0,11,1}, {9818,15353,1,11,0}, {0,15364,0,11,1},
+    {0,2849,0,11,1}, {9819,15573,1,11,0}, {0,15672,0,11,1}, {0,15749,0,11,1},
+    {0,15804,0,11,1}, {0,15947,0,11,1}, {0,15958,0,11,1}, {0,16057,0,11,1},
+    {0,16332,0,11,1}, {0,10820,0,12,1}, {0,11000,0,12,1}, {9820,11024,3,12,2},
+    {0,11072,0,12,1}, {0,11180,0,12,1}, {0,11204,0,12,1}, {0,11372,0,12,1},
+    {0,11444,0,12,1}, {0,11456,0,12,1}, {0,11468,0,12,1}, {0,11480,0,12,1},
+    {0,11504,0,12,1}, {0,11516,0,12,1}, {0,11528,0,12,1}, {0,11540,0,12,1},
+    {0,11552,0,12,1}, {0,11900,0,12,1}, {0,11912,0,12,1}, {0,12092,0,12,1},
+    {0,12128,0,12,1}, {0,12164,0,12,1}, {0,12188,0,12,2}, {0,12428,0,12,1},
+    {0,12536,0,12,1}, {0,12584,0,12,1}, {0,12632,0,12,1}, {0,12788,0,12,2},
+    {0,12812,0,12,1}, {0,12836,0,12,1}, {0,12848,0,12,1}, {9823,8553,1,13,1},
+    {0,8566,0,13,1}, {0,8696,0,13,1}, {0,8865,0,13,2}, {0,8904,0,13,1},
+    {0,8917,0,13,1}, {0,8930,0,13,1}, {0,8982,0,13,1}, {0,9229,0,13,1},
+    {0,9242,0,13,1}, {0,9255,0,13,1}, {0,9268,0,13,1}, {0,9281,0,13,1},
+    {0,9294,0,13,1}, {0,9307,0,13,1}, {0,9333,0,13,1}, {0,9424,0,13,2},
+    {0,9437,0,13,1}, {9824,9541,11,13,0}, {0,9801,0,13,1}, {0,9814,0,13,1},
+    {0,9905,0,13,1}, {0,9944,0,13,1}, {0,9983,0,13,1}, {0,9996,0,13,1},
+    {0,6762,0,14,1}, {0,6818,0,14,1}, {0,7042,0,14,1}, {0,7056,0,14,1},
+    {0,7112,0,14,1}, {0,7238,0,14,1}, {0,7280,0,14,1}, {0,7308,0,14,1},
+    {0,7336,0,14,1}, {0,7350,0,14,1}, {0,7364,0,14,1}, {0,7378,0,14,1},
+    {9835,7574,1,14,1}, {0,7602,0,14,1}, {0,7658,0,14,1}, {0,7770,0,14,1},
+    {0,5057,0,15,1}, {0,5072,0,15,1}, {0,5087,0,15,1}, {0,5147,0,15,1},
+    {0,5222,0,15,1}, {0,5237,0,15,1}, {0,5447,0,15,1}, {0,5477,0,15,1},
+    {0,5492,0,15,1}, {0,5522,0,15,1}, {0,5552,0,15,1}, {0,5567,0,15,1},
+    {0,5582,0,15,1}, {0,5762,0,15,1}, {0,5852,0,15,1}, {0,5972,0,15,1},
+    {9836,6047,1,15,1}, {0,3741,0,16,1}, {9837,3869,17,16,1}, {0,3901,0,16,1},
+    {0,3917,0,16,1}, {0,3949,0,16,1}, {0,4109,0,16,1}, {0,4125,0,16,1},
+    {0,4141,0,16,1}, {0,4157,0,16,1}, {0,4173,0,16,1}, {0,4189,0,16,1},
+    {0,4221,0,16,1}, {0,4365,0,16,1}, {0,4397,0,16,1}, {0,2843,0,17,1},
+    {0,2928,0,17,1}, {0,2962,0,17,1}, {0,3047,0,17,1}, {0,3064,0,17,1},
+    {0,3081,0,17,1}, {9854,3098,1,17,0}, {0,3115,0,17,1}, {0,3149,0,17,1},
+    {0,3251,0,17,1}, {0,2016,0,18,2}, {9855,2088,1,18,0}, {0,2142,0,18,1},
+    {0,2196,0,18,1}, {0,2250,0,18,1}, {0,1486,0,19,1}, {0,1070,0,20,1},
+    {0,1170,0,20,1}, {0,777,0,21,1}, {9856,819,1,21,0}, {0,44748,0,2,1},
+    {0,11120,0,3,1}, {0,12782,0,3,2}, {0,16035,0,3,2}, {0,44846,0,4,1},
+    {0,11048,0,4,1}, {0,44862,0,4,1}, {0,15144,0,5,1}, {0,2196,0,5,1},
+    {0,31010,0,6,1}, {0,3958,0,7,2}, {0,36610,0,7,2}, {0,36701,0,7,1},
+    {0,25994,0,8,1}, {0,28442,0,8,2}, {0,30314,0,8,2}, {9857,23317,1,9,0},
+    {0,23344,0,9,1}, {0,23461,0,9,1}, {0,15749,0,11,1}, {0,15969,0,11,1},
+    {0,11048,0,12,1}, {0,9099,0,13,1}, {9858,4227,1,3,0}, {9859,43744,1,5,0},
+    {0,44826,0,4,1}, {0,828,0,2,1}, {0,4,0,2,1}, {0,10787,0,3,1},
+    {0,46054,0,3,1}, {0,411,0,2,1}, {0,1383,0,2,1}, {0,266,0,2,1},
+    {0,7403,0,2,1}, {0,72,0,2,1}, {0,156,0,2,1}, {0,132,0,2,1},
+    {0,7431,0,2,1}, {0,801,0,2,1}, {9860,46057,2,3,0}, {0,44738,0,4,1},
+    {0,44742,0,4,1}, {0,44746,0,4,1}, {0,26594,0,4,1}, {0,44886,0,4,1},
+    {0,45086,0,4,1}, {9862,45554,2,4,0}, {0,45642,0,4,1}, {0,14165,0,5,1},
+    {9864,10916,1,5,0}, {0,18067,0,5,1}, {0,42499,0,5,1}, {0,42839,0,5,1},
+    {0,43409,0,5,1}, {0,43534,0,5,1}, {0,43694,0,5,1}, {0,19682,0,5,1},
+    {0,36913,0,6,1}, {0,1050,0,6,1}, {0,36997,0,6,1}, {0,37195,0,6,1},
+    {0,37471,0,6,1}, {9865,37603,3,6,0}, {9868,3917,4,6,0}, {0,38095,0,6,1},
+    {0,38161,0,6,1}, {0,38263,0,6,1}, {0,38269,0,6,1}, {0,38983,0,6,1},
+    {0,39427,0,6,1}, {0,39727,0,6,1}, {0,40081,0,6,1}, {0,40093,0,6,1},
+    {0,40759,0,6,1}, {0,40963,0,6,1}, {0,41041,0,6,1}, {0,31920,0,7,1},
+    {0,31962,0,7,1}, {0,32074,0,7,1}, {0,32466,0,7,1}, {0,32480,0,7,1},
+    {0,32529,0,7,1}, {0,32571,0,7,1}, {0,5192,0,7,1}, {0,32935,0,7,1},
+    {0,32949,0,7,1}, {0,33040,0,7,1}, {0,33152,0,7,1}, {0,33376,0,7,1},
+    {0,33698,0,7,1}, {0,33852,0,7,1}, {0,34825,0,7,1}, {0,34839,0,7,1},
+    {0,34860,0,7,1}, {0,35077,0,7,1}, {0,35385,0,7,1}, {0,35959,0,7,1},
+    {0,3709,0,8,1}, {0,26170,0,8,1}, {0,26218,0,8,1}, {0,21796,0,8,1},
+    {0,26626,0,8,1}, {0,26674,0,8,1}, {0,26730,0,8,1}, {0,26866,0,8,1},
+    {9872,26874,1,8,1}, {0,26898,0,8,1}, {0,27450,0,8,1}, {0,27610,0,8,1},
+    {0,28050,0,8,1}, {0,28218,0,8,1}, {0,28970,0,8,1}, {0,29682,0,8,1},
+    {0,29970,0,8,1}, {0,29978,0,8,1}, {0,29986,0,8,1}, {0,30170,0,8,1},
+    {0,30354,0,8,1}, {0,30434,0,8,1}, {0,30666,0,8,1}, {9873,30826,1,8,0},
+    {9874,31050,1,8,1}, {0,2826,0,9,1}, {0,21589,0,9,1}, {0,21688,0,9,1},
+    {0,21697,0,9,1}, {0,21886,0,9,1}, {0,21913,0,9,1}, {0,2911,0,9,1},
+    {0,22489,0,9,1}, {0,22651,0,9,1}, {0,22660,0,9,1}, {0,22975,0,9,1},
+    {0,23470,0,9,1}, {0,23605,0,9,1}, {0,23686,0,9,1}, {0,23695,0,9,1},
+    {0,23893,0,9,1}, {0,24325,0,9,1}, {9875,24838,1,9,0}, {0,1980,0,10,1},
+    {0,17487,0,10,1}, {0,17697,0,10,1}, {0,17867,0,10,1}, {9876,17877,2,10,1},
+    {0,18007,0,10,1}, {0,18207,0,10,1}, {0,18827,0,10,1}, {0,19727,0,10,1},
+    {9878,19837,1,10,0}, {0,19857,0,10,1}, {0,19887,0,10,1}, {0,19987,0,10,1},
+    {9879,20217,1,10,1}, {9880,14352,1,11,1}, {0,14385,0,11,1}, {0,14396,0,11,1},
+    {0,14451,0,11,2}, {0,15001,0,11,1}, {9881,15353,1,11,0}, {9882,15903,2,11,0},
+    {9884,17333,2,11,1}, {0,1050,0,12,1}, {0,10808,0,12,1}, {0,10832,0,12,1},
+    {0,10880,0,12,1}, {0,11120,0,12,1}, {0,11228,0,12,1}, {0,11912,0,12,1},
+    {0,8553,0,13,1}, {9886,8631,1,13,0}, {0,8644,0,13,1}, {0,8826,0,13,1},
+    {0,8839,0,13,1}, {0,8956,0,13,1}, {0,9619,0,13,1}, {0,9775,0,13,1},
+    {0,9918,0,13,1}, {0,6692,0,14,1}, {0,6706,0,14,1}, {0,6720,0,14,1},
+    {0,6930,0,14,1}, {0,7070,0,14,1}, {0,7602,0,14,1}, {0,7672,0,14,1},
+    {9887,4922,7,15,1}, {0,5192,0,15,1}, {0,3709,0,16,1}, {0,3949,0,16,1},
+    {0,4221,0,16,1}, {0,2826,0,17,1}, {0,2911,0,17,1}, {0,1980,0,18,1},
+    {0,1050,0,20,1}, {0,282,0,24,1}, {9894,19725,1,5,1}, {0,30018,0,7,1},
+    {0,27442,0,8,1}, {0,26,0,2,1}, {9895,828,55,2,1}, {0,1855,0,2,1},
+    {0,16085,0,2,1}, {0,829,0,2,1}, {0,801,0,2,1}, {0,45630,0,4,1},
+    {9950,42089,1,5,0}, {0,14165,0,5,1}, {9951,10916,2,5,0}, {0,42429,0,5,1},
+    {0,42874,0,5,1}, {0,43394,0,5,1}, {0,43534,0,5,1}, {0,44189,0,5,1},
+    {0,44644,0,5,1}, {0,37261,0,6,1}, {0,37561,0,6,1}, {9953,7042,2,6,1},
+    {0,37921,0,6,1}, {0,38263,0,6,1}, {0,38269,0,6,1}, {0,39157,0,6,1},
+    {0,39301,0,6,1}, {0,39421,0,6,1}, {0,39805,0,6,1}, {0,40093,0,6,1},
+    {0,40759,0,6,1}, {0,40783,0,6,1}, {0,41041,0,6,1}, {0,31920,0,7,1},
+    {0,32116,0,7,1}, {0,32256,0,7,1}, {0,32466,0,7,1}, {0,32501,0,7,1},
+    {0,32529,0,7,1}, {0,32536,0,7,1}, {0,32557,0,7,1}, {0,33061,0,7,1},
+    {0,33691,0,7,1}, {0,33698,0,7,1}, {0,33726,0,7,1}, {0,33873,0,7,1},
+    {0,35077,0,7,1}, {0,35385,0,7,1}, {0,35399,0,7,1}, {0,35427,0,7,1},
+    {9955,36113,1,7,0}, {0,36680,0,7,1}, {0,36687,0,7,1}, {0,26130,0,8,1},
+    {0,26674,0,8,1}, {0,26730,0,8,1}, {0,26866,0,8,1}, {0,26598,0,8,1},
+    {0,27338,0,8,1}, {0,27450,0,8,1}, {0,27586,0,8,1}, {0,27594,0,8,1},
+    {0,27610,0,8,1}, {0,28642,0,8,1}, {0,29554,0,8,1}, {0,29978,0,8,1},
+    {0,29986,0,8,1}, {0,21166,0,9,1}, {0,21886,0,9,1}, {0,22237,0,9,1},
+    {0,22489,0,9,1}, {0,22651,0,9,1}, {0,22660,0,9,1}, {0,22975,0,9,1},
+    {0,24334,0,9,1}, {0,24595,0,9,1}, {0,24982,0,9,1}, {0,25054,0,9,1},
+    {0,17477,0,10,1}, {0,17907,0,10,1}, {0,18477,0,10,1}, {0,19307,0,10,1},
+    {0,19687,0,10,1}, {0,19697,0,10,1}, {0,14319,0,11,1}, {0,1319,0,11,1},
+    {0,14528,0,11,1}, {0,14825,0,11,1}, {0,15056,0,11,1}, {0,15089,0,11,1},
+    {0,15133,0,11,1}, {0,15441,0,11,1}, {0,15463,0,11,1}, {0,15474,0,11,1},
+    {0,16068,0,11,1}, {0,16310,0,11,1}, {9956,10916,1,12,0}, {0,11108,0,12,1},
+    {0,11492,0,12,1}, {0,11564,0,12,1}, {0,11576,0,12,1}, {0,11588,0,12,1},
+    {0,12548,0,12,1}, {0,8956,0,13,1}, {9957,9021,3,13,0}, {0,9320,0,13,1},
+    {0,9788,0,13,1}, {0,6846,0,14,1}, {0,7294,0,14,1}, {0,7322,0,14,1},
+    {0,5507,0,15,1}, {0,5537,0,15,1}, {0,3853,0,16,1}, {0,3885,0,16,1},
+    {0,3933,0,16,1}, {0,4221,0,16,1}, {0,1998,0,18,1}, {0,34930,0,7,1},
+    {0,7818,0,3,1}, {0,8721,0,3,1}, {0,700,0,3,1}, {0,24000,0,3,1},
+    {0,844,0,3,1}, {0,15835,0,3,1}, {0,5876,0,3,1}, {0,1581,0,3,1},
+    {0,44710,0,4,1}, {0,14165,0,5,1}, {0,43864,0,5,1}, {0,31759,0,6,1},
+    {0,32256,0,7,1}, {9960,26682,1,8,0}, {0,14165,0,5,1}, {0,44822,0,4,1},
+    {0,4296,0,2,1}, {0,18343,0,4,2}, {0,3975,0,4,1}, {0,14488,0,5,2},
+    {0,35448,0,7,1}, {0,15941,0,7,1}, {0,26578,0,8,2}, {0,29418,0,8,1},
+    {0,23515,0,9,2}, {0,14495,0,11,1}, {0,43554,0,5,1}, {0,35077,0,7,1},
+    {0,44644,0,5,1}, {0,36120,0,7,2}, {0,26130,0,8,1}, {0,26538,0,8,1},
+    {0,23335,0,9,1}, {0,31757,0,3,1}, {0,4903,0,3,1}, {0,25862,0,4,1},
+    {0,44842,0,4,1}, {0,44866,0,4,1}, {0,44974,0,4,1}, {0,30154,0,4,1},
+    {0,42319,0,5,1}, {0,12831,0,5,1}, {0,23461,0,5,1}, {0,39745,0,5,1},
+    {0,4902,0,5,1}, {0,14446,0,5,1}, {0,31162,0,5,1}, {0,36889,0,6,1},
+    {0,37063,0,6,1}, {0,37225,0,6,1}, {0,7442,0,6,1}, {0,6049,0,6,1},
+    {0,5486,0,6,1}, {0,2884,0,6,1}, {0,40687,0,6,1}, {0,31570,0,7,1},
+    {0,31577,0,7,1}, {0,32137,0,7,1}, {0,1441,0,7,1}, {0,32361,0,7,1},
+    {0,4900,0,7,1}, {0,14939,0,7,1}, {0,18637,0,7,1}, {0,34440,0,7,1},
+    {0,35504,0,7,1}, {0,11509,0,7,1}, {0,36302,0,7,1}, {0,1183,0,7,1},
+    {0,25858,0,8,1}, {0,25882,0,8,1}, {0,26346,0,8,1}, {0,26762,0,8,1},
+    {0,7384,0,8,1}, {0,9806,0,8,1}, {0,28546,0,8,1}, {0,29770,0,8,1},
+    {0,30018,0,8,1}, {0,30226,0,8,1}, {0,21175,0,9,1}, {0,21184,0,9,1},
+    {0,21265,0,9,1}, {0,21283,0,9,1}, {0,21994,0,9,1}, {0,9012,0,9,1},
+    {0,22462,0,9,1}, {0,297,0,9,1}, {0,7411,0,9,1}, {0,23587,0,9,1},
+    {0,24289,0,9,1}, {0,24577,0,9,1}, {0,17427,0,10,1}, {0,17577,0,10,1},
+    {0,17917,0,10,1}, {0,17927,0,10,1}, {0,17937,0,10,1}, {0,18217,0,10,1},
+    {0,18347,0,10,1}, {0,18647,0,10,1}, {0,19177,0,10,1}, {0,19387,0,10,1},
+    {0,15771,0,10,1}, {0,19717,0,10,1}, {0,19757,0,10,1}, {0,850,0,11,1},
+    {0,14935,0,11,1}, {0,15331,0,11,1}, {0,15694,0,11,1}, {0,15705,0,11,1},
+    {0,10952,0,12,1}, {0,12824,0,12,1}, {0,8761,0,13,1}, {0,8800,0,13,1},
+    {0,8969,0,13,1}, {0,7168,0,14,1}, {0,3693,0,16,1}, {0,1410,0,19,1},
+    {0,1429,0,19,1}, {0,840,0,21,1}, {0,517,0,22,1}, {0,45976,0,3,1},
+    {0,4226,0,3,1}, {0,18639,0,3,1}, {0,44890,0,4,1}, {0,30119,0,4,1},
+    {0,33817,0,7,1}, {0,32256,0,7,1}, {9961,45326,1,4,0}, {0,11612,0,4,1},
+    {0,14165,0,5,1}, {0,32256,0,7,1}, {0,81,0,2,1}, {0,21976,0,9,1},
+    {0,44209,0,5,1}, {0,2855,0,5,1}, {0,20227,0,9,1}, {0,829,0,11,2},
+    {0,9819,0,4,1}, {0,11612,0,4,1}, {0,39283,0,6,1}, {0,2854,0,6,1},
+    {0,7112,0,7,1}, {0,36134,0,7,1}, {0,36715,0,7,1}, {0,27010,0,8,1},
+    {0,28770,0,8,1}, {0,21940,0,9,1}, {0,14396,0,11,1}, {0,14165,0,5,1},
+    {0,43534,0,5,1}, {0,37555,0,6,1}, {0,7042,0,6,1}, {0,37723,0,6,1},
+    {0,40093,0,6,1}, {0,40837,0,6,1}, {0,41041,0,6,1}, {0,32256,0,7,1},
+    {0,32858,0,7,1}, {0,28642,0,8,1}, {0,18068,0,8,1}, {0,18067,0,9,1},
+    {0,22300,0,9,1}, {0,18357,0,10,1}, {0,18817,0,10,1}, {0,14539,0,11,1},
+    {0,11360,0,12,1}, {0,9125,0,13,1}, {0,1505,0,19,1}, {0,1090,0,20,1},
+    {9962,4927,2,6,1}, {0,44850,0,4,1}, {0,31134,0,4,2}, {0,43404,0,5,1},
+    {0,45054,0,3,1}, {0,14165,0,5,1}, {0,14165,0,5,1}, {0,29955,0,7,1},
+    {9964,2012,1,3,0}, {9965,1197,1,3,0}, {0,19447,0,10,1}, {0,45054,0,3,1},
+    {0,45054,0,4,1}, {0,44190,0,4,1}, {0,35371,0,5,1}, {0,43819,0,5,1},
+    {0,43904,0,5,1}, {0,38869,0,6,1}, {0,26482,0,8,1}, {0,20227,0,10,1},
+    {0,42939,0,5,1}, {0,10787,0,3,1}, {9966,872,1,3,1}, {0,14774,0,4,1},
+    {0,14165,0,5,1}, {0,38173,0,6,1}, {0,9917,0,3,2}, {0,44802,0,4,1},
+    {0,44850,0,4,1}, {0,44962,0,4,1}, {0,11612,0,4,1}, {0,45558,0,4,1},
+    {0,14165,0,5,1}, {0,43199,0,5,1}, {0,39577,0,6,1}, {0,7112,0,7,1},
+    {0,34741,0,7,1}, {0,26474,0,8,2}, {0,29346,0,8,1}, {0,23344,0,9,1},
+    {0,19517,0,10,1}, {0,19597,0,10,2}, {0,11132,0,12,1}, {0,27682,0,8,1},
+    {0,21859,0,9,1}, {0,11180,0,6,1}, {0,4296,0,2,1}, {0,23299,0,4,1},
+    {0,40711,0,6,2}, {0,32249,0,7,1}, {9967,46060,2,3,1}, {9969,46117,8,3,0},
+    {0,11612,0,4,1}, {0,44469,0,5,1}, {0,20327,0,5,1}, {0,14143,0,6,2},
+    {0,37489,0,6,1}, {9977,31773,1,7,0}, {9978,32641,1,7,0}, {9979,34174,1,7,1},
+    {0,35448,0,7,1}, {9980,35483,3,7,0}, {0,35973,0,7,2}, {9983,27682,1,8,0},
+    {0,27730,0,8,1}, {0,28250,0,8,1}, {0,7448,0,8,1}, {9984,29634,1,8,1},
+    {0,21976,0,9,1}, {0,24010,0,9,1}, {0,25180,0,9,1}, {9985,18627,2,10,0},
+    {0,19497,0,10,2}, {0,19897,0,10,2}, {0,15320,0,11,2}, {0,16167,0,11,1},
+    {9987,12620,2,12,0}, {0,12823,0,3,2}, {9989,21800,1,5,2}, {0,37218,0,3,1},
+    {0,21859,0,9,1}, {0,11180,0,6,1}, {0,37218,0,3,1}, {0,4,0,2,1},
+    {0,39277,0,6,1}, {0,31106,0,8,1}, {0,23299,0,9,1}, {0,15125,0,4,1},
+    {0,39283,0,6,1}, {0,41071,0,6,1}, {0,40099,0,6,1}, {0,30146,0,8,1},
+    {0,24739,0,9,1}, {0,12140,0,12,1}, {0,37218,0,3,1}, {0,29984,0,3,1},
+    {0,5117,0,7,2}, {0,4,0,2,1}, {0,38581,0,6,1}, {0,13073,0,3,1},
+    {0,1429,0,3,1}, {0,135,0,3,1}, {0,4166,0,3,1}, {0,2933,0,3,1},
+    {0,3730,0,3,1}, {0,26705,0,3,1}, {0,45991,0,3,1}, {0,24132,0,3,1},
+    {0,46045,0,3,1}, {0,32310,0,3,1}, {0,7419,0,3,1}, {0,24658,0,3,1},
+    {0,46156,0,3,1}, {0,46180,0,3,1}, {0,5703,0,3,1}, {0,5878,0,3,1},
+    {0,4537,0,4,1}, {0,44734,0,4,1}, {0,21972,0,4,1}, {0,6818,0,4,1},
+    {0,15895,0,4,1}, {0,44770,0,4,1}, {0,44794,0,4,1}, {0,44830,0,4,1},
+    {0,44834,0,4,1}, {0,12352,0,4,1}, {0,9008,0,4,1}, {0,44942,0,4,1},
+    {0,32900,0,4,1}, {0,28425,0,4,1}, {0,45018,0,4,1}, {0,45090,0,4,1},
+    {0,160,0,4,1}, {0,45130,0,4,1}, {0,36116,0,4,1}, {0,45218,0,4,1},
+    {0,25941,0,4,1}, {0,45262,0,4,1}, {0,15303,0,4,1}, {0,28584,0,4,1},
+    {0,45370,0,4,1}, {0,5831,0,4,1}, {0,45486,0,4,1}, {0,45522,0,4,1},
+    {0,45578,0,4,1}, {0,6716,0,4,1}, {0,4397,0,4,1}, {0,45622,0,4,1},
+    {0,45674,0,4,1}, {0,45678,0,4,1}, {0,25567,0,4,1}, {0,42074,0,5,1},
+    {0,42184,0,5,1}, {0,42189,0,5,1}, {0,42224,0,5,1}, {0,6042,0,5,1},
+    {0,42384,0,5,1}, {0,42389,0,5,1}, {0,22475,0,5,1}, {0,42464,0,5,1},
+    {0,42549,0,5,1}, {0,42594,0,5,1}, {0,19842,0,5,1}, {0,42719,0,5,1},
+    {0,42744,0,5,1}, {0,7218,0,5,1}, {0,43079,0,5,1}, {0,7434,0,5,1},
+    {0,43159,0,5,1}, {0,43294,0,5,1}, {0,23461,0,5,1}, {0,43379,0,5,1},
+    {0,9260,0,5,1}, {0,43484,0,5,1}, {0,43499,0,5,1}, {0,196,0,5,1},
+    {0,43629,0,5,1}, {0,43664,0,5,1}, {0,43719,0,5,1}, {0,43724,0,5,1},
+    {0,43789,0,5,1}, {0,4902,0,5,1}, {0,43829,0,5,1}, {0,22790,0,5,1},
+    {0,44079,0,5,1}, {0,44114,0,5,1}, {0,1489,0,5,1}, {0,25014,0,5,1},
+    {0,5867,0,5,1}, {0,44204,0,5,1}, {0,44304,0,5,1}, {0,30036,0,5,1},
+    {0,36365,0,5,1}, {0,7191,0,5,1}, {0,44549,0,5,1}, {0,44624,0,5,1},
+    {0,36925,0,6,1}, {0,10736,0,6,1}, {0,37045,0,6,1}, {0,37057,0,6,1},
+    {0,37105,0,6,1}, {0,18081,0,6,1}, {0,37177,0,6,1}, {0,37207,0,6,1},
+    {0,37213,0,6,1}, {0,26194,0,6,1}, {0,37231,0,6,1}, {0,37243,0,6,1},
+    {0,37267,0,6,1}, {0,37279,0,6,1}, {0,5512,0,6,1}, {0,6994,0,6,1},
+    {0,37339,0,6,1}, {0,37351,0,6,1}, {0,37393,0,6,1}, {0,7681,0,6,1},
+    {0,37429,0,6,1}, {0,7442,0,6,1}, {0,37549,0,6,1}, {0,37615,0,6,1},
+    {0,5996,0,6,1}, {0,37651,0,6,1}, {0,6742,0,6,1}, {0,4961,0,6,1},
+    {0,38059,0,6,1}, {0,291,0,6,1}, {0,38071,0,6,1}, {0,11384,0,6,1},
+    {0,22795,0,6,1}, {0,38413,0,6,1}, {0,38671,0,6,1}, {0,38695,0,6,1},
+    {0,6004,0,6,1}, {0,38791,0,6,1}, {0,38797,0,6,1}, {0,38833,0,6,1},
+    {0,38863,0,6,1}, {0,38953,0,6,1}, {0,39061,0,6,1}, {0,39067,0,6,1},
+    {0,39181,0,6,1}, {0,39211,0,6,1}, {0,39241,0,6,1}, {0,39259,0,6,1},
+    {0,2240,0,6,1}, {0,39433,0,6,1}, {0,7610,0,6,1}, {0,15639,0,6,1},
+    {0,39661,0,6,1}, {0,39679,0,6,1}, {0,39691,0,6,1}, {0,39745,0,6,1},
+    {0,39763,0,6,1}, {0,39781,0,6,1}, {0,5559,0,6,1}, {0,39835,0,6,1},
+    {0,39961,0,6,1}, {0,24280,0,6,1}, {0,35959,0,6,1}, {0,40285,0,6,1},
+    {0,40315,0,6,1}, {0,40351,0,6,1}, {0,40393,0,6,1}, {0,40399,0,6,1},
+    {0,40639,0,6,1}, {0,40813,0,6,1}, {0,3799,0,6,1}, {0,40855,0,6,1},
+    {0,40927,0,6,1}, {0,31535,0,7,1}, {0,31605,0,7,1}, {0,31675,0,7,1},
+    {0,31710,0,7,1}, {0,31801,0,7,1}, {0,31808,0,7,1}, {0,31871,0,7,1},
+    {0,31906,0,7,1}, {0,31983,0,7,1}, {0,4997,0,7,1}, {0,26226,0,7,1},
+    {0,32018,0,7,1}, {0,32067,0,7,1}, {0,32088,0,7,1}, {0,32144,0,7,1},
+    {0,32242,0,7,1}, {0,32277,0,7,1}, {0,32326,0,7,1}, {0,32354,0,7,1},
+    {0,14059,0,7,1}, {0,32445,0,7,1}, {0,32459,0,7,1}, {0,32655,0,7,1},
+    {0,32718,0,7,1}, {0,26922,0,7,1}, {0,32767,0,7,1}, {0,32823,0,7,1},
+    {0,17520,0,7,1}, {0,3958,0,7,1}, {0,33355,0,7,1}, {0,33362,0,7,1},
+    {0,33383,0,7,1}, {0,33614,0,7,1}, {0,33621,0,7,1}, {0,1197,0,7,1},
+    {0,11384,0,7,1}, {0,33978,0,7,1}, {0,33999,0,7,1}, {0,34013,0,7,1},
+    {0,34384,0,7,1}, {0,34412,0,7,1}, {0,34503,0,7,1}, {0,34559,0,7,1},
+    {0,28562,0,7,1}, {0,34636,0,7,1}, {0,34706,0,7,1}, {0,34755,0,7,1},
+    {0,34972,0,7,1}, {0,34979,0,7,1}, {0,35063,0,7,1}, {0,35224,0,7,1},
+    {0,35238,0,7,1}, {0,35308,0,7,1}, {0,35343,0,7,1}, {0,9027,0,7,1},
+    {0,35441,0,7,1}, {0,35553,0,7,1}, {0,35665,0,7,1}, {0,35721,0,7,1},
+    {0,2214,0,7,1}, {0,35735,0,7,1}, {0,35847,0,7,1}, {0,3006,0,7,1},
+    {0,35938,0,7,1}, {0,1323,0,7,1}, {0,36155,0,7,1}, {0,36162,0,7,1},
+    {0,36351,0,7,1}, {0,36365,0,7,1}, {0,36470,0,7,1}, {0,36526,0,7,1},
+    {0,10087,0,7,1}, {0,36540,0,7,1}, {0,2183,0,7,1}, {0,36645,0,7,1},
+    {0,36799,0,7,1}, {0,25898,0,8,1}, {0,3725,0,8,1}, {0,3733,0,8,1},
+    {0,25946,0,8,1}, {0,25970,0,8,1}, {0,8805,0,8,1}, {0,26074,0,8,1},
+    {0,26082,0,8,1}, {0,26090,0,8,1}, {0,26226,0,8,1}, {0,26234,0,8,1},
+    {0,26290,0,8,1}, {0,5042,0,8,1}, {0,26442,0,8,1}, {0,5004,0,8,1},
+    {0,26498,0,8,1}, {0,5117,0,8,1}, {0,26530,0,8,1}, {0,19719,0,8,1},
+    {0,6986,0,8,1}, {0,26578,0,8,1}, {0,5874,0,8,1}, {0,26658,0,8,1},
+    {0,26690,0,8,1}, {0,26778,0,8,1}, {0,26826,0,8,1}, {0,26914,0,8,1},
+    {0,26922,0,8,1}, {0,26946,0,8,1}, {0,27018,0,8,1}, {0,27026,0,8,1},
+    {0,27106,0,8,1}, {0,27226,0,8,1}, {0,27322,0,8,1}, {0,4277,0,8,1},
+    {0,27394,0,8,1}, {0,27474,0,8,1}, {0,28506,0,8,1}, {0,28554,0,8,1},
+    {0,28562,0,8,1}, {0,28570,0,8,1}, {0,28578,0,8,1}, {0,28610,0,8,1},
+    {0,28682,0,8,1}, {0,28722,0,8,1}, {0,28730,0,8,1}, {0,11172,0,8,1},
+    {0,28826,0,8,1}, {0,28834,0,8,1}, {0,28914,0,8,1}, {0,14696,0,8,1},
+    {0,28922,0,8,1}, {0,4253,0,8,1}, {0,29146,0,8,1}, {0,29178,0,8,1},
+    {0,29498,0,8,1}, {0,29514,0,8,1}, {0,29618,0,8,1}, {0,29626,0,8,1},
+    {0,29690,0,8,1}, {0,29770,0,8,1}, {0,29850,0,8,1}, {0,29890,0,8,1},
+    {0,2232,0,8,1}, {0,29946,0,8,1}, {0,30042,0,8,1}, {0,30290,0,8,1},
+    {0,30386,0,8,1}, {0,30738,0,8,1}, {0,30906,0,8,1}, {0,30946,0,8,1},
+    {0,31034,0,8,1}, {0,31082,0,8,1}, {0,31138,0,8,1}, {0,31146,0,8,1},
+    {0,31162,0,8,1}, {0,31306,0,8,1}, {0,31402,0,8,1}, {0,21265,0,9,1},
+    {0,3725,0,9,1}, {0,21274,0,9,1}, {0,21319,0,9,1}, {0,21373,0,9,1},
+    {0,21391,0,9,1}, {0,21427,0,9,1}, {0,21454,0,9,1}, {0,21508,0,9,1},
+    {0,21517,0,9,1}, {0,21553,0,9,1}, {0,4952,0,9,1}, {0,21643,0,9,1},
+    {0,21652,0,9,1}, {0,21670,0,9,1}, {0,5042,0,9,1}, {0,21769,0,9,1},
+    {0,8839,0,9,1}, {0,21841,0,9,1}, {0,21868,0,9,1}, {0,21931,0,9,1},
+    {0,10787,0,9,1}, {0,21967,0,9,1}, {0,22012,0,9,1}, {0,22030,0,9,1},
+    {0,22039,0,9,1}, {0,22084,0,9,1}, {0,22093,0,9,1}, {0,22102,0,9,1},
+    {0,22210,0,9,1}, {0,22246,0,9,1}, {0,22678,0,9,1}, {0,22768,0,9,1},
+    {0,22786,0,9,1}, {0,22795,0,9,1}, {0,22867,0,9,1}, {0,23488,0,9,1},
+    {0,23542,0,9,1}, {0,23740,0,9,1}, {0,23749,0,9,1}, {0,23758,0,9,1},
+    {0,23983,0,9,1}, {0,24019,0,9,1}, {0,24199,0,9,1}, {0,24244,0,9,1},
+    {0,24649,0,9,1}, {0,24667,0,9,1}, {0,24730,0,9,1}, {0,24757,0,9,1},
+    {0,20237,0,9,1}, {0,25099,0,9,1}, {0,25108,0,9,1}, {0,25225,0,9,1},
+    {0,25567,0,9,1}, {0,17517,0,10,1}, {0,17537,0,10,1}, {0,17647,0,10,1},
+    {0,17727,0,10,1}, {0,17757,0,10,1}, {0,17777,0,10,1}, {0,17787,0,10,1},
+    {0,17827,0,10,1}, {0,17897,0,10,1}, {0,17947,0,10,1}, {0,18107,0,10,1},
+    {0,18127,0,10,1}, {0,18137,0,10,1}, {0,18147,0,10,1}, {0,18187,0,10,1},
+    {0,18237,0,10,1}, {0,18387,0,10,1}, {0,2996,0,10,1}, {0,1588,0,10,1},
+    {0,18497,0,10,1}, {0,18637,0,10,1}, {0,18657,0,10,1}, {0,18847,0,10,1},
+    {0,18927,0,10,1}, {0,18997,0,10,1}, {0,19017,0,10,1}, {0,19087,0,10,1},
+    {0,19107,0,10,1}, {0,19277,0,10,1}, {0,15452,0,10,1}, {0,19577,0,10,1},
+    {0,19587,0,10,1}, {0,19627,0,10,1}, {0,19737,0,10,1}, {0,19777,0,10,1},
+    {0,19827,0,10,1}, {0,19917,0,10,1}, {0,19937,0,10,1}, {0,20057,0,10,1},
+    {0,20157,0,10,1}, {0,20177,0,10,1}, {0,20267,0,10,1}, {0,20277,0,10,1},
+    {0,20347,0,10,1}, {0,20377,0,10,1}, {0,20737,0,10,1}, {0,21037,0,10,1},
+    {0,14055,0,11,1}, {0,14077,0,11,1}, {0,14099,0,11,1}, {0,850,0,11,1},
+    {0,14363,0,11,1}, {0,14429,0,11,1}, {0,14473,0,11,1}, {0,14638,0,11,1},
+    {0,157,0,11,1}, {0,14836,0,11,1}, {0,14880,0,11,1}, {0,14902,0,11,1},
+    {0,15012,0,11,1}, {0,15155,0,11,1}, {0,15298,0,11,1}, {0,15386,0,11,1},
+    {0,15639,0,11,1}, {0,15683,0,11,1}, {0,15727,0,11,1}, {0,15738,0,11,1},
+    {0,15914,0,11,1}, {0,15925,0,11,1}, {0,16145,0,11,1}, {0,16288,0,11,1},
+    {0,16904,0,11,1}, {0,10736,0,12,1}, {0,10760,0,12,1}, {0,10772,0,12,1},
+    {0,10784,0,12,1}, {0,10964,0,12,1}, {0,10976,0,12,1}, {0,10988,0,12,1},
+    {0,5132,0,12,1}, {0,11084,0,12,1}, {0,11168,0,12,1}, {0,11192,0,12,1},
+    {0,1588,0,12,1}, {0,11348,0,12,1}, {0,11384,0,12,1}, {0,11396,0,12,1},
+    {0,11420,0,12,1}, {0,11804,0,12,1}, {0,11888,0,12,1}, {0,11984,0,12,1},
+    {0,4317,0,12,1}, {0,12152,0,12,1}, {0,12248,0,12,1}, {0,12344,0,12,1},
+    {0,12368,0,12,1}, {0,12380,0,12,1}, {0,12392,0,12,1}, {0,12404,0,12,1},
+    {0,12524,0,12,1}, {0,12560,0,12,1}, {0,12800,0,12,1}, {0,1118,0,12,1},
+    {0,8592,0,13,1}, {0,8618,0,13,1}, {0,8657,0,13,1}, {0,8670,0,13,1},
+    {0,8787,0,13,1}, {0,143,0,13,1}, {0,5989,0,13,1}, {0,9008,0,13,1},
+    {0,9203,0,13,1}, {0,9385,0,13,1}, {0,6004,0,13,1}, {0,9606,0,13,1},
+    {0,7630,0,13,1}, {0,9892,0,13,1}, {0,10100,0,13,1}, {0,6776,0,14,1},
+    {0,6888,0,14,1}, {0,6916,0,14,1}, {0,6958,0,14,1}, {0,143,0,14,1},
+    {0,115,0,14,1}, {0,6986,0,14,1}, {0,4527,0,14,1}, {0,7182,0,14,1},
+    {0,7210,0,14,1}, {0,7434,0,14,1}, {0,7518,0,14,1}, {0,1190,0,14,1},
+    {0,7630,0,14,1}, {0,7644,0,14,1}, {0,7686,0,14,1}, {0,7840,0,14,1},
+    {0,8428,0,14,1}, {0,4952,0,15,1}, {0,4997,0,15,1}, {0,5042,0,15,1},
+    {0,5102,0,15,1}, {0,5117,0,15,1}, {0,5132,0,15,1}, {0,5372,0,15,1},
+    {0,5732,0,15,1}, {0,5747,0,15,1}, {0,5837,0,15,1}, {0,5867,0,15,1},
+    {0,5987,0,15,1}, {0,6002,0,15,1}, {0,6032,0,15,1}, {0,3725,0,16,1},
+    {0,3789,0,16,1}, {0,4061,0,16,1}, {0,4205,0,16,1}, {0,4253,0,16,1},
+    {0,4269,0,16,1}, {0,4317,0,16,1}, {0,4525,0,16,1}, {0,2996,0,17,1},
+    {0,3132,0,17,1}, {0,3234,0,17,1}, {0,3268,0,17,1}, {0,2070,0,18,1},
+    {0,2214,0,18,1}, {0,2232,0,18,1}, {0,1581,0,19,1}, {0,1600,0,19,1},
+    {0,1110,0,20,1}, {0,1190,0,20,1}, {0,1330,0,20,1}, {0,157,0,25,1},
+    {0,129,0,28,1}, {0,100,0,29,1}, {0,0,0,36,1}, {0,18117,0,4,1},
+    {0,14165,0,5,1}, {0,18117,0,10,1}, {0,15105,0,4,1}, {0,11180,0,6,1},
+    {0,37218,0,3,1}, {0,46250,0,2,1}, {0,41239,0,6,1}, {0,31404,0,6,1},
+    {0,41245,0,6,1}, {0,41263,0,6,1}, {0,41275,0,6,1}, {0,41287,0,6,1},
+    {0,31410,0,8,1}, {0,31426,0,8,1}, {0,13700,0,12,1}, {0,45770,0,4,1},
+    {0,45782,0,4,1}, {0,41307,0,4,1}, {0,41269,0,6,1}, {0,41275,0,6,1},
+    {0,41305,0,6,1}, {0,41437,0,6,1}, {0,41455,0,6,1}, {0,41683,0,6,1},
+    {0,41695,0,6,1}, {0,41821,0,6,1}, {0,41833,0,6,1}, {0,29370,0,8,1},
+    {9990,21796,1,9,1}, {0,23920,0,9,1}, {0,4,0,2,1}, {0,44726,0,4,1},
+    {0,45602,0,4,1}, {0,42069,0,5,2}, {0,31787,0,7,1}, {0,37218,0,3,1},
+    {0,14165,0,5,1}, {0,15232,0,11,1}, {0,11180,0,6,1}, {0,21814,0,9,1},
+    {0,4,0,2,1}, {0,44682,0,4,1}, {0,23344,0,9,1}, {0,5751,0,3,1},
+    {0,34853,0,7,1}, {0,35448,0,7,1}, {0,4,0,2,1}, {0,4,0,2,1},
+    {0,42459,0,5,2}, {0,36736,0,7,1}, {0,25288,0,9,1}, {0,25315,0,9,1},
+    {0,25369,0,9,1}, {0,25378,0,9,1}, {0,25387,0,9,1}, {0,20577,0,10,1},
+    {0,20747,0,10,1}, {0,16816,0,11,1}, {0,7812,0,14,1}, {0,13892,0,12,1},
+    {0,13904,0,12,1}, {0,6662,0,15,1}, {0,2754,0,18,1}, {0,2772,0,18,1},
+    {0,2790,0,18,1}, {0,800,0,2,1}, {0,21445,0,3,1}, {0,23671,0,6,1},
+    {0,4,0,2,1}, {0,31170,0,8,1}, {0,31186,0,8,1}, {0,25432,0,8,1},
+    {0,25297,0,9,1}, {0,25315,0,9,1}, {0,25432,0,9,1}, {0,17036,0,11,1},
+    {0,13160,0,12,1}, {0,10165,0,13,1}, {0,10347,0,13,1}, {0,6062,0,15,1},
+    {0,4541,0,16,1}, {0,41323,0,6,1}, {0,31434,0,8,1}, {0,31442,0,8,1},
+    {0,13712,0,12,1}, {0,20507,0,10,1}, {0,20727,0,10,1}, {0,20827,0,10,1},
+    {0,20847,0,10,1}, {0,20907,0,10,1}, {0,17278,0,11,1}, {0,20557,0,10,1},
+    {0,16519,0,11,1}, {0,16783,0,11,1}, {0,10178,0,13,1}, {0,26138,0,8,1},
+    {0,7775,0,3,1}, {0,26138,0,8,1}, {0,305,0,2,2}, {0,38623,0,6,2},
+    {0,45714,0,4,1}, {0,305,0,2,2}, {0,266,0,2,2}, {0,26138,0,8,1},
+    {9991,21805,1,9,0}, {0,11912,0,12,1}, {0,83,0,2,1}, {0,568,0,2,1},
+    {0,1860,0,2,1}, {0,3117,0,3,1}, {9992,46048,1,3,1}, {0,46102,0,3,1},
+    {0,8895,0,3,1}, {0,6827,0,3,1}, {0,26354,0,8,1}, {0,568,0,2,1},
+    {0,1860,0,2,1}, {0,46102,0,3,1}, {0,8895,0,3,1}, {0,6827,0,3,1},
+    {0,32704,0,7,1}, {0,2855,0,5,1}, {0,26138,0,8,1}, {0,20007,0,10,1},
+    {9993,12776,1,12,0}, {0,517,0,2,1}, {0,168,0,2,1}, {0,1052,0,2,1},
+    {0,193,0,2,1}, {0,516,0,2,1}, {0,98,0,2,1}, {0,3948,0,2,1},
+    {0,27,0,2,1}, {0,872,0,2,1}, {0,1053,0,2,1}, {0,385,0,2,1},
+    {0,640,0,2,1}, {0,1354,0,2,1}, {0,840,0,2,1}, {0,10855,0,2,1},
+    {0,543,0,2,1}, {0,5030,0,2,1}, {0,282,0,2,1}, {0,1360,0,2,1},
+    {0,981,0,2,1}, {0,161,0,2,1}, {0,6,0,2,1}, {0,930,0,2,1},
+    {0,1595,0,2,1}, {0,156,0,2,1}, {0,128,0,2,1}, {0,1087,0,2,1},
+    {0,517,0,2,1}, {0,168,0,2,1}, {0,1052,0,2,1}, {0,193,0,2,1},
+    {0,516,0,2,1}, {0,98,0,2,1}, {0,3948,0,2,1}, {0,27,0,2,1},
+    {0,872,0,2,1}, {0,1053,0,2,1}, {0,385,0,2,1}, {0,640,0,2,1},
+    {0,1354,0,2,1}, {0,840,0,2,1}, {0,10855,0,2,1}, {0,543,0,2,1},
+    {0,5030,0,2,1}, {0,282,0,2,1}, {0,1360,0,2,1}, {0,981,0,2,1},
+    {0,161,0,2,1}, {0,6,0,2,1}, {0,930,0,2,1}, {0,1595,0,2,1},
+    {0,156,0,2,1}, {0,128,0,2,1}, {0,1087,0,2,1}, {0,26138,0,8,1},
+    {0,22633,0,9,1}, {9994,26,1,2,0}, {0,21355,0,9,1}, {0,46150,0,3,2},
+    {9995,21256,4,9,0}, {0,3123,0,6,1}, {0,26138,0,8,1}, {0,520,0,2,1},
+    {0,520,0,2,1}, {0,26138,0,8,1}, {9999,19837,1,10,0}, {10000,2855,2,5,0},
+    {0,2855,0,5,2}, {0,11024,0,6,1}, {0,5162,0,3,1}, {0,7042,0,6,1},
+    {0,5162,0,3,1}, {10002,189,1,2,0}, {0,11024,0,8,1}, {0,5162,0,3,1},
+    {0,26138,0,8,1}, {0,26138,0,8,1}, {0,26138,0,8,1}, {0,27682,0,8,1},
+    {0,9234,0,4,1}, {0,36627,0,4,1}, {0,782,0,2,1}, {0,37417,0,6,1},
+    {0,26138,0,8,1}, {0,7642,0,3,2}, {0,34867,0,7,1}, {0,35462,0,7,1},
+    {0,26138,0,8,1}, {0,20077,0,10,1}, {0,35639,0,3,1}, {0,46072,0,3,1},
+    {0,5765,0,3,2}, {0,46177,0,3,1}, {0,1486,0,4,1}, {0,45290,0,4,1},
+    {0,36627,0,4,1}, {0,17852,0,5,1}, {0,7042,0,6,1}, {0,21787,0,9,1},
+    {0,30,0,1,1}, {0,520,0,2,1}, {10003,5147,2,3,0}, {10005,8849,1,4,0},
+    {10006,37501,2,6,0}, {10008,36148,2,7,0}, {0,44044,0,5,1}, {0,1486,0,3,1},
+    {0,21481,0,9,2}, {0,6825,0,7,1}, {10010,17948,1,4,0}, {0,7392,0,2,1},
+    {0,37819,0,6,1}, {10011,31689,1,7,0}, {0,5214,0,3,1}, {0,2988,0,3,1},
+    {0,38503,0,4,1}, {0,40997,0,4,1}, {0,36078,0,4,1}, {0,23018,0,4,1},
+    {0,45606,0,4,1}, {0,19562,0,5,1}, {0,42929,0,5,1}, {0,43334,0,5,1},
+    {0,2983,0,5,1}, {0,44254,0,5,1}, {0,27125,0,5,1}, {0,38563,0,6,1},
+    {0,38617,0,6,1}, {0,38659,0,6,1}, {0,39019,0,6,1}, {0,39097,0,6,1},
+    {0,5676,0,6,1}, {0,39313,0,6,1}, {0,40375,0,6,1}, {0,40495,0,6,1},
+    {0,34167,0,7,1}, {0,36596,0,7,1}, {0,27826,0,8,1}, {0,28082,0,8,1},
+    {0,30938,0,8,1}, {0,23443,0,9,1}, {0,23524,0,9,1}, {0,25558,0,9,1},
+    {0,1740,0,3,1}, {0,44990,0,4,1}, {0,45006,0,4,1}, {0,45038,0,4,1},
+    {0,14854,0,4,1}, {0,15487,0,4,1}, {0,11858,0,4,1}, {0,11627,0,4,1},
+    {0,28144,0,4,1}, {0,39399,0,4,1}, {0,42699,0,5,1}, {0,42914,0,5,1},
+    {0,36980,0,5,1}, {0,44279,0,5,1}, {0,38467,0,6,1}, {0,39109,0,6,1},
+    {0,39235,0,6,1}, {0,40465,0,6,1}, {0,40603,0,6,1}, {0,41119,0,6,1},
+    {0,31640,0,7,1}, {0,33642,0,7,1}, {0,33663,0,7,1}, {0,33768,0,7,1},
+    {0,27930,0,8,1}, {0,28098,0,8,1}, {0,28762,0,8,1}, {0,28802,0,8,1},
+    {0,29826,0,8,1}, {0,30530,0,8,1}, {0,31090,0,8,1}, {0,31218,0,8,1},
+    {0,22885,0,9,1}, {0,4036,0,9,1}, {0,19877,0,10,1}, {0,15496,0,11,1},
+    {0,11636,0,12,1}, {0,4029,0,16,1}, {0,23304,0,4,4}, {0,27255,0,3,1},
+    {0,8564,0,3,1}, {0,39634,0,4,1}, {0,42749,0,4,1}, {0,23731,0,4,1},
+    {0,8563,0,4,1}, {0,23996,0,4,1}, {0,34675,0,5,1}, {0,18767,0,5,1},
+    {0,43104,0,5,1}, {0,43704,0,5,1}, {0,44004,0,5,1}, {0,44294,0,5,1},
+    {0,38065,0,6,1}, {0,27876,0,6,1}, {0,39133,0,6,1}, {0,40147,0,6,1},
+    {0,33782,0,7,1}, {0,34055,0,7,1}, {0,34146,0,7,1}, {0,35623,0,7,1},
+    {0,36141,0,7,1}, {0,36757,0,7,1}, {0,7203,0,7,1}, {0,18703,0,8,1},
+    {0,28346,0,8,1}, {0,29298,0,8,1}, {0,30522,0,8,1}, {0,22894,0,9,1},
+    {0,22930,0,9,1}, {0,22957,0,9,1}, {0,24433,0,9,1}, {0,20137,0,10,1},
+    {0,11648,0,12,1}, {0,13616,0,12,1}, {0,9840,0,13,1}, {0,7196,0,14,1},
+    {0,8386,0,14,1}, {0,5703,0,3,1}, {0,32152,0,4,1}, {0,11312,0,4,1},
+    {0,28242,0,4,1}, {0,45202,0,4,1}, {0,42963,0,4,1}, {0,45750,0,4,1},
+    {0,42214,0,5,1}, {0,43969,0,5,1}, {0,44484,0,5,1}, {0,38035,0,6,1},
+    {0,40489,0,6,1}, {0,34265,0,7,1}, {0,36400,0,7,1}, {0,26242,0,8,1},
+    {0,27874,0,8,1}, {0,28306,0,8,1}, {0,22417,0,9,1}, {0,14297,0,11,1},
+    {0,6784,0,3,1}, {0,19767,0,4,1}, {0,33930,0,4,1}, {0,12513,0,4,1},
+    {0,39237,0,4,1}, {0,19422,0,5,1}, {0,9484,0,5,1}, {0,42924,0,5,1},
+    {0,20992,0,5,1}, {0,37015,0,6,1}, {0,37831,0,6,1}, {0,38533,0,6,1},
+    {0,12446,0,6,1}, {0,34076,0,7,1}, {0,34090,0,7,1}, {0,24867,0,7,1},
+    {0,34293,0,7,1}, {0,34370,0,7,1}, {0,27074,0,8,1}, {0,27266,0,8,1},
+    {0,27858,0,8,1}, {0,28098,0,8,1}, {0,28114,0,8,1}, {0,24532,0,9,1},
+    {0,19417,0,10,1}, {0,17344,0,11,1}, {0,1052,0,3,1}, {0,26249,0,3,1},
+    {0,43460,0,4,1}, {0,44978,0,4,1}, {0,31793,0,4,1}, {0,28036,0,4,1},
+    {0,30061,0,4,1}, {0,27214,0,4,1}, {0,45610,0,4,1}, {0,45614,0,4,1},
+    {0,42059,0,5,1}, {0,42134,0,5,1}, {0,42344,0,5,1}, {0,42814,0,5,1},
+    {0,43024,0,5,1}, {0,43089,0,5,1}, {0,43609,0,5,1}, {0,44349,0,5,1},
+    {0,37303,0,6,1}, {0,38425,0,6,1}, {0,38545,0,6,1}, {0,38557,0,6,1},
+    {0,39019,0,6,1}, {0,15529,0,6,1}, {0,39541,0,6,1}, {0,40447,0,6,1},
+    {0,40657,0,6,1}, {0,40669,0,6,1}, {0,41149,0,6,1}, {0,33656,0,7,1},
+    {0,33824,0,7,1}, {0,33845,0,7,1}, {0,33915,0,7,1}, {0,33964,0,7,1},
+    {0,34153,0,7,1}, {0,4054,0,7,1}, {0,35021,0,7,1}, {0,35147,0,7,1},
+    {0,35833,0,7,1}, {0,36274,0,7,1}, {0,27146,0,8,1}, {0,12010,0,8,1},
+    {0,30458,0,8,1}, {0,30698,0,8,1}, {0,30754,0,8,1}, {0,2988,0,8,1},
+    {0,24487,0,9,1}, {0,24919,0,9,1}, {0,24991,0,9,1}, {0,18447,0,10,1},
+    {0,18517,0,10,1}, {0,19557,0,10,1}, {0,5442,0,3,1}, {0,9371,0,5,1},
+    {0,25598,0,5,1}, {0,5330,0,5,1}, {0,43154,0,5,1}, {0,24419,0,5,1},
+    {0,14919,0,5,1}, {0,37423,0,6,1}, {0,37903,0,6,1}, {0,38017,0,6,1},
+    {0,38167,0,6,1}, {0,38485,0,6,1}, {0,38587,0,6,1}, {0,7274,0,6,1},
+    {0,19221,0,6,1}, {0,39439,0,6,1}, {0,41167,0,6,1}, {0,34048,0,7,1},
+    {0,35070,0,7,1}, {0,35749,0,7,1}, {0,27050,0,8,1}, {0,27946,0,8,1},
+    {0,22840,0,9,1}, {0,23011,0,9,1}, {0,23632,0,9,1}, {0,25594,0,9,1},
+    {0,14913,0,11,1}, {0,9177,0,13,1}, {0,15998,0,4,1}, {0,23096,0,4,1},
+    {0,28084,0,4,1}, {0,42960,0,4,1}, {0,42034,0,5,1}, {0,19562,0,5,1},
+    {0,42944,0,5,1}, {0,4051,0,5,1}, {0,28349,0,5,1}, {0,43979,0,5,1},
+    {0,37309,0,6,1}, {0,37315,0,6,1}, {0,37321,0,6,1}, {0,37777,0,6,1},
+    {0,30524,0,6,1}, {0,38605,0,6,1}, {0,38665,0,6,1}, {0,38995,0,6,1},
+    {0,39019,0,6,1}, {0,39169,0,6,1}, {0,39319,0,6,1}, {0,39373,0,6,1},
+    {0,39601,0,6,1}, {0,19787,0,6,1}, {0,18562,0,6,1}, {0,40159,0,6,1},
+    {0,40585,0,6,1}, {0,15188,0,7,1}, {0,34223,0,7,1}, {0,34685,0,7,1},
+    {0,35189,0,7,1}, {0,35819,0,7,1}, {0,36463,0,7,1}, {0,36743,0,7,1},
+    {0,27514,0,8,1}, {0,7266,0,8,1}, {0,27802,0,8,1}, {0,27890,0,8,1},
+    {0,9559,0,8,1}, {0,28074,0,8,1}, {0,28242,0,8,1}, {0,30634,0,8,1},
+    {0,30682,0,8,1}, {0,30714,0,8,1}, {0,22183,0,9,1}, {0,23659,0,9,1},
+    {0,23731,0,9,1}, {0,24424,0,9,1}, {0,24613,0,9,1}, {0,25504,0,9,1},
+    {0,18407,0,10,1}, {0,18517,0,10,1}, {0,19197,0,10,1}, {0,19337,0,10,1},
+    {0,21017,0,10,1}, {0,21027,0,10,1}, {0,9593,0,13,1}, {0,6572,0,15,1},
+    {0,4055,0,3,1}, {0,45647,0,3,1}, {0,21569,0,4,1}, {0,4168,0,4,1},
+    {0,38372,0,5,1}, {0,40166,0,5,1}, {0,23798,0,5,1}, {0,43964,0,5,1},
+    {0,44034,0,5,1}, {0,38503,0,6,1}, {0,38917,0,6,1}, {0,5336,0,6,1},
+    {0,33796,0,7,1}, {0,34692,0,7,1}, {0,35007,0,7,1}, {0,36484,0,7,1},
+    {0,9637,0,8,1}, {0,29114,0,8,1}, {0,23110,0,9,1}, {0,4020,0,9,1},
+    {0,21007,0,10,1}, {0,15991,0,11,1}, {0,7209,0,3,1}, {0,14456,0,3,1},
+    {0,42664,0,5,1}, {0,42914,0,5,1}, {0,43569,0,5,1}, {0,43954,0,5,1},
+    {0,15881,0,5,1}, {0,39019,0,6,1}, {0,22883,0,6,1}, {0,9482,0,7,1},
+    {0,32599,0,7,1}, {0,12644,0,7,1}, {0,30458,0,8,1}, {0,22939,0,9,1},
+    {0,9476,0,13,1}, {0,3936,0,3,1}, {0,3859,0,3,1}, {0,30898,0,4,1},
+    {0,34062,0,5,1}, {0,43029,0,5,1}, {0,43054,0,5,1}, {0,43334,0,5,1},
+    {0,44089,0,5,1}, {0,36967,0,6,1}, {0,38455,0,6,1}, {0,38995,0,6,1},
+    {0,39511,0,6,1}, {0,22722,0,6,1}, {0,30090,0,6,1}, {0,32193,0,7,1},
+    {0,33292,0,7,1}, {0,33901,0,7,1}, {0,33929,0,7,1}, {0,34342,0,7,1},
+    {0,34916,0,7,1}, {0,36218,0,7,1}, {0,28538,0,8,1}, {0,28738,0,8,1},
+    {0,29066,0,8,1}, {0,30514,0,8,1}, {0,30530,0,8,1}, {0,30586,0,8,1},
+    {0,30834,0,8,1}, {0,31314,0,8,1}, {0,22921,0,9,1}, {0,24370,0,9,1},
+    {0,24451,0,9,1}, {0,25036,0,9,1}, {0,19317,0,10,1}, {0,16123,0,11,1},
+    {0,5387,0,15,1}, {0,11707,0,3,1}, {0,14456,0,3,1}, {0,44714,0,4,1},
+    {0,11650,0,4,1}, {0,45494,0,4,1}, {0,9704,0,4,1}, {0,41077,0,4,1},
+    {0,21017,0,4,1}, {0,30509,0,5,1}, {0,15414,0,5,1}, {0,38528,0,5,1},
+    {0,43039,0,5,1}, {0,21300,0,5,1}, {0,16021,0,5,1}, {0,28397,0,5,1},
+    {0,22902,0,6,1}, {0,36979,0,6,1}, {0,9193,0,6,1}, {0,38029,0,6,1},
+    {0,38119,0,6,1}, {0,34153,0,6,1}, {0,40033,0,6,1}, {0,40141,0,6,1},
+    {0,23437,0,6,1}, {0,36085,0,6,1}, {0,30570,0,6,1}, {0,28148,0,6,1},
+    {0,33481,0,7,1}, {0,24471,0,7,1}, {0,36106,0,7,1}, {0,36281,0,7,1},
+    {0,23553,0,7,1}, {0,27082,0,8,1}, {0,7266,0,8,1}, {0,27786,0,8,1},
+    {0,27834,0,8,1}, {0,27850,0,8,1}, {0,29930,0,8,1}, {0,30506,0,8,1},
+    {0,21247,0,9,1}, {0,22957,0,9,1}, {0,23830,0,9,1}, {0,24478,0,9,1},
+    {0,20107,0,10,1}, {0,15408,0,11,1}, {0,15518,0,11,1}, {0,45194,0,4,1},
+    {0,23096,0,4,1}, {0,43120,0,4,1}, {0,14455,0,4,1}, {0,42659,0,5,1},
+    {0,42989,0,5,1}, {0,18767,0,5,1}, {0,15190,0,5,1}, {0,35073,0,6,1},
+    {0,38317,0,6,1}, {0,29796,0,6,1}, {0,19247,0,6,1}, {0,39451,0,6,1},
+    {0,40339,0,6,1}, {0,41089,0,6,1}, {0,41113,0,6,1}, {0,34132,0,7,1},
+    {0,34790,0,7,1}, {0,35112,0,7,1}, {0,35301,0,7,1}, {0,27058,0,8,1},
+    {0,27274,0,8,1}, {0,19949,0,8,1}, {0,27658,0,8,1}, {0,27810,0,8,1},
+    {0,28122,0,8,1}, {0,28362,0,8,1}, {0,28810,0,8,1}, {0,30610,0,8,1},
+    {0,22426,0,9,1}, {0,18527,0,10,1}, {0,18717,0,10,1}, {0,16013,0,11,1},
+    {0,9697,0,13,1}, {0,9371,0,3,1}, {0,266,0,3,1}, {0,9637,0,4,1},
+    {0,5041,0,4,1}, {0,15890,0,4,1}, {0,24991,0,4,1}, {0,43074,0,5,1},
+    {0,18702,0,5,1}, {0,30777,0,5,1}, {0,11307,0,5,1}, {0,44439,0,5,1},
+    {0,37825,0,6,1}, {0,38101,0,6,1}, {0,18677,0,6,1}, {0,19771,0,6,1},
+    {0,39253,0,6,1}, {0,39343,0,6,1}, {0,39655,0,6,1}, {0,31683,0,6,1},
+    {0,40321,0,6,1}, {0,40357,0,6,1}, {0,41137,0,6,1}, {0,34909,0,7,1},
+    {0,28106,0,8,1}, {0,28898,0,8,1}, {0,29058,0,8,1}, {0,31330,0,8,1},
+    {0,23821,0,9,1}, {0,19427,0,10,1}, {0,16156,0,11,1}, {0,11300,0,12,1},
+    {0,520,0,3,1}, {0,1186,0,3,1}, {0,5328,0,3,1}, {0,45118,0,4,1},
+    {0,27882,0,4,1}, {0,7420,0,4,1}, {0,45166,0,4,1}, {0,45306,0,4,1},
+    {0,38480,0,5,1}, {0,43984,0,5,1}, {0,38380,0,5,1}, {0,5672,0,6,1},
+    {0,39139,0,6,1}, {0,39361,0,6,1}, {0,23194,0,6,1}, {0,38475,0,6,1},
+    {0,21007,0,6,1}, {0,34041,0,7,1}, {0,34608,0,7,1}, {0,34881,0,7,1},
+    {0,28290,0,8,1}, {0,28394,0,8,1}, {0,28402,0,8,1}, {0,23191,0,9,1},
+    {0,23974,0,9,1}, {0,25090,0,9,1}, {0,25531,0,9,1}, {0,19327,0,10,1},
+    {0,14858,0,11,1}, {0,9190,0,11,1}, {0,5672,0,15,1}, {0,10747,0,3,1},
+    {0,15998,0,4,1}, {0,7420,0,4,1}, {0,16007,0,4,1}, {0,42029,0,5,1},
+    {0,15425,0,5,1}, {0,42914,0,5,1}, {0,17448,0,5,1}, {0,43019,0,5,1},
+    {0,43354,0,5,1}, {0,11996,0,5,1}, {0,15881,0,5,1}, {0,44234,0,5,1},
+    {0,38005,0,6,1}, {0,19349,0,6,1}, {0,38443,0,6,1}, {0,15886,0,6,1},
+    {0,39079,0,6,1}, {0,15655,0,6,1}, {0,40117,0,6,1}, {0,40123,0,6,1},
+    {0,36085,0,6,1}, {0,40471,0,6,1}, {0,40663,0,6,1}, {0,33754,0,7,1},
+    {0,34034,0,7,1}, {0,36071,0,7,1}, {0,27242,0,8,1}, {0,27354,0,8,1},
+    {0,28274,0,8,1}, {0,29194,0,8,1}, {0,30482,0,8,1}, {0,30762,0,8,1},
+    {0,22156,0,9,1}, {0,22705,0,9,1}, {0,22714,0,9,1}, {0,22903,0,9,1},
+    {0,23002,0,9,1}, {0,23416,0,9,1}, {0,23614,0,9,1}, {0,24406,0,9,1},
+    {0,24874,0,9,1}, {0,15650,0,11,1}, {0,15980,0,11,1}, {0,11288,0,12,1},
+    {0,12608,0,12,1}, {0,9346,0,13,1}, {0,6902,0,14,1}, {0,5432,0,15,1},
+    {0,4045,0,16,1}, {0,31867,0,4,1}, {0,45178,0,4,1}, {0,28194,0,4,1},
+    {0,12472,0,4,1}, {0,23678,0,4,1}, {0,40169,0,5,1}, {0,43089,0,5,1},
+    {0,43114,0,5,1}, {0,43894,0,5,1}, {0,43939,0,5,1}, {0,38113,0,6,1},
+    {0,34342,0,7,1}, {0,34601,0,7,1}, {0,28850,0,8,1}, {0,29026,0,8,1},
+    {0,29330,0,8,1}, {0,30746,0,8,1}, {0,30770,0,8,1}, {0,23776,0,9,1},
+    {0,24865,0,9,1}, {0,24874,0,9,1}, {0,18437,0,10,1}, {0,15617,0,11,1},
+    {0,5344,0,3,1}, {0,3859,0,3,1}, {0,15998,0,4,1}, {0,7206,0,4,1},
+    {0,7420,0,4,1}, {0,28194,0,4,1}, {0,16112,0,4,1}, {0,42349,0,5,1},
+    {0,42654,0,5,1}, {0,42669,0,5,1}, {0,42934,0,5,1}, {0,43084,0,5,1},
+    {0,44264,0,5,1}, {0,36871,0,6,1}, {0,37237,0,6,1}, {0,37993,0,6,1},
+    {0,35047,0,6,1}, {0,38539,0,6,1}, {0,38959,0,6,1}, {0,15886,0,6,1},
+    {0,39103,0,6,1}, {0,39151,0,6,1}, {0,29066,0,6,1}, {0,39409,0,6,1},
+    {0,4007,0,6,1}, {0,40333,0,6,1}, {0,31591,0,7,1}, {0,27967,0,7,1},
+    {0,32193,0,7,1}, {0,32585,0,7,1}, {0,33579,0,7,1}, {0,34251,0,7,1},
+    {0,34258,0,7,1}, {0,34594,0,7,1}, {0,35168,0,7,1}, {0,35763,0,7,1},
+    {0,36253,0,7,1}, {0,24403,0,8,1}, {0,27250,0,8,1}, {0,27346,0,8,1},
+    {0,27642,0,8,1}, {0,30026,0,8,1}, {0,30082,0,8,1}, {0,30330,0,8,1},
+    {0,21328,0,9,1}, {0,23038,0,9,1}, {0,23119,0,9,1}, {0,23650,0,9,1},
+    {0,23884,0,9,1}, {0,24469,0,9,1}, {0,24829,0,9,1}, {0,18747,0,10,1},
+    {0,18867,0,10,1}, {0,9164,0,13,1}, {0,9190,0,13,1}, {0,5417,0,15,1},
+    {0,5702,0,15,1}, {0,23659,0,5,1}, {0,43689,0,5,1}, {0,44269,0,5,1},
+    {0,36985,0,6,1}, {0,37915,0,6,1}, {0,39091,0,6,1}, {0,39475,0,6,1},
+    {0,39553,0,6,1}, {0,40135,0,6,1}, {0,40645,0,6,1}, {0,33670,0,7,1},
+    {0,35658,0,7,1}, {0,36386,0,7,1}, {0,36414,0,7,1}, {0,27378,0,8,1},
+    {0,28338,0,8,1}, {0,29794,0,8,1}, {0,22336,0,9,1}, {0,22354,0,9,1},
+    {0,22687,0,9,1}, {0,19347,0,10,1}, {0,19947,0,10,1}, {0,43309,0,5,1},
+    {0,44489,0,5,1}, {0,39115,0,6,1}, {0,40045,0,6,1}, {0,31780,0,7,1},
+    {0,34069,0,7,1}, {0,36078,0,7,1}, {0,36225,0,7,1}, {0,28194,0,8,1},
+    {0,28594,0,8,1}, {0,29122,0,8,1}, {0,30890,0,8,1}, {0,31346,0,8,1},
+    {0,24856,0,9,1}, {0,9138,0,13,1}, {0,817,0,3,1}, {0,9637,0,4,1},
+    {0,15875,0,4,1}, {0,11027,0,4,1}, {0,28197,0,5,1}, {0,9632,0,5,1},
+    {0,42987,0,5,1}, {0,38383,0,6,1}, {0,7274,0,6,1}, {0,30590,0,6,1},
+    {0,39391,0,6,1}, {0,40105,0,6,1}, {0,40441,0,6,1}, {0,40609,0,6,1},
+    {0,40999,0,6,1}, {0,41023,0,6,1}, {0,33971,0,7,1}, {0,35119,0,7,1},
+    {0,35210,0,7,1}, {0,35756,0,7,1}, {0,27815,0,7,1}, {0,27130,0,8,1},
+    {0,28002,0,8,1}, {0,28602,0,8,1}, {0,30106,0,8,1}, {0,31234,0,8,1},
+    {0,24532,0,9,1}, {0,18607,0,10,1}, {0,2986,0,10,1}, {0,9489,0,13,1},
+    {0,9827,0,13,1}, {0,2979,0,17,1}, {0,783,0,3,1}, {0,5671,0,3,1},
+    {0,6901,0,4,1}, {0,3731,0,4,1}, {0,35160,0,4,1}, {0,11644,0,4,1},
+    {0,18033,0,4,1}, {0,9359,0,4,1}, {0,19787,0,4,1}, {0,24465,0,4,1},
+    {0,9862,0,4,1}, {0,45638,0,4,1}, {0,23007,0,4,1}, {0,19562,0,5,1},
+    {0,18518,0,5,1}, {0,42914,0,5,1}, {0,43349,0,5,1}, {0,43579,0,5,1},
+    {0,5442,0,5,1}, {0,35140,0,5,1}, {0,28349,0,5,1}, {0,43674,0,5,1},
+    {0,43979,0,5,1}, {0,27042,0,6,1}, {0,37975,0,6,1}, {0,38143,0,6,1},
+    {0,38221,0,6,1}, {0,38233,0,6,1}, {0,38245,0,6,1}, {0,38569,0,6,1},
+    {0,11858,0,6,1}, {0,39121,0,6,1}, {0,39145,0,6,1}, {0,9353,0,6,1},
+    {0,11666,0,6,1}, {0,39331,0,6,1}, {0,29066,0,6,1}, {0,12446,0,6,1},
+    {0,39607,0,6,1}, {0,40009,0,6,1}, {0,40021,0,6,1}, {0,40369,0,6,1},
+    {0,40477,0,6,1}, {0,40591,0,6,1}, {0,41125,0,6,1}, {0,31794,0,7,1},
+    {0,32172,0,7,1}, {0,33789,0,7,1}, {0,35231,0,7,1}, {0,36106,0,7,1},
+    {0,36771,0,7,1}, {0,25874,0,8,1}, {0,18703,0,8,1}, {0,28090,0,8,1},
+    {0,28162,0,8,1}, {0,29050,0,8,1}, {0,30114,0,8,1}, {0,30490,0,8,1},
+    {0,30530,0,8,1}, {0,31218,0,8,1}, {0,21760,0,9,1}, {0,22876,0,9,1},
+    {0,23425,0,9,1}, {0,23434,0,9,1}, {0,23578,0,9,1}, {0,24460,0,9,1},
+    {0,24883,0,9,1}, {0,24928,0,9,1}, {0,19187,0,10,1}, {0,19207,0,10,1},
+    {0,20987,0,10,1}, {0,15584,0,11,1}, {0,11852,0,12,1}, {0,12440,0,12,1},
+    {0,9359,0,13,1}, {0,23304,0,4,4}, {0,23304,0,4,4}, {0,16161,0,4,1},
+    {0,24928,0,4,1}, {0,45646,0,4,1}, {0,19562,0,5,1}, {0,42654,0,5,1},
+    {0,16162,0,5,1}, {0,5673,0,5,1}, {0,43464,0,5,1}, {0,43699,0,5,1},
+    {0,44259,0,5,1}, {0,38341,0,6,1}, {0,38647,0,6,1}, {0,39523,0,6,1},
+    {0,40627,0,6,1}, {0,27300,0,6,1}, {0,41113,0,6,1}, {0,36092,0,7,1},
+    {0,36442,0,7,1}, {0,27842,0,8,1}, {0,30634,0,8,1}, {0,22174,0,9,1},
+    {0,22192,0,9,1}, {0,19367,0,10,1}, {0,15485,0,11,1}, {0,6974,0,3,1},
+    {0,3071,0,3,1}, {0,1685,0,3,1}, {0,4053,0,3,1}, {0,15998,0,4,1},
+    {0,14977,0,4,1}, {0,19382,0,4,1}, {0,33339,0,4,1}, {0,38159,0,4,1},
+    {0,44233,0,4,1}, {0,4891,0,4,1}, {0,42284,0,5,1}, {0,11996,0,5,1},
+    {0,43599,0,5,1}, {0,18702,0,5,1}, {0,43639,0,5,1}, {0,19252,0,5,1},
+    {0,44154,0,5,1}, {0,44429,0,5,1}, {0,9193,0,6,1}, {0,37963,0,6,1},
+    {0,38239,0,6,1}, {0,34153,0,6,1}, {0,38437,0,6,1}, {0,38461,0,6,1},
+    {0,38491,0,6,1}, {0,38635,0,6,1}, {0,38653,0,6,1}, {0,9171,0,6,1},
+    {0,5672,0,6,1}, {0,19247,0,6,1}, {0,5676,0,6,1}, {0,39349,0,6,1},
+    {0,39469,0,6,1}, {0,40141,0,6,1}, {0,40165,0,6,1}, {0,28108,0,6,1},
+    {0,9704,0,6,1}, {0,40741,0,6,1}, {0,41113,0,6,1}, {0,32158,0,7,1},
+    {0,21760,0,7,1}, {0,32165,0,7,1}, {0,32431,0,7,1}, {0,14858,0,7,1},
+    {0,2979,0,7,1}, {0,35133,0,7,1}, {0,35609,0,7,1}, {0,36288,0,7,1},
+    {0,26386,0,8,1}, {0,27370,0,8,1}, {0,27386,0,8,1}, {0,27530,0,8,1},
+    {0,28778,0,8,1}, {0,28794,0,8,1}, {0,28930,0,8,1}, {0,29050,0,8,1},
+    {0,29922,0,8,1}, {0,31250,0,8,1}, {0,24820,0,9,1}, {0,25585,0,9,1},
+    {0,17817,0,10,1}, {0,9853,0,13,1}, {0,5165,0,3,1}, {0,783,0,3,1},
+    {0,45114,0,4,1}, {0,19382,0,4,1}, {0,45286,0,4,1}, {0,22851,0,4,1},
+    {0,7424,0,4,1}, {0,45550,0,4,1}, {0,14282,0,4,1}, {0,45754,0,4,1},
+    {0,19562,0,5,1}, {0,42169,0,5,1}, {0,42409,0,5,1}, {0,42959,0,5,1},
+    {0,42979,0,5,1}, {0,43564,0,5,1}, {0,5442,0,5,1}, {0,15881,0,5,1},
+    {0,44229,0,5,1}, {0,44349,0,5,1}, {0,11660,0,6,1}, {0,22885,0,6,1},
+    {0,28850,0,6,1}, {0,40615,0,6,1}, {0,40633,0,6,1}, {0,40819,0,6,1},
+    {0,41155,0,6,1}, {0,11312,0,7,1}, {0,33754,0,7,1}, {0,24867,0,7,1},
+    {0,35196,0,7,1}, {0,36393,0,7,1}, {0,36743,0,7,1}, {0,26378,0,8,1},
+    {0,27522,0,8,1}, {0,29098,0,8,1}, {0,30450,0,8,1}, {0,30874,0,8,1},
+    {0,31218,0,8,1}, {0,22165,0,9,1}, {0,24208,0,9,1}, {0,24415,0,9,1},
+    {0,24541,0,9,1}, {0,25018,0,9,1}, {0,18457,0,10,1}, {0,19787,0,10,1},
+    {0,19967,0,10,1}, {0,14968,0,11,1}, {0,15199,0,11,1}, {0,16112,0,11,1},
+    {0,11312,0,12,1}, {0,2580,0,3,1}, {0,5671,0,3,1}, {0,27882,0,4,1},
+    {0,45478,0,4,1}, {0,9354,0,5,1}, {0,42749,0,5,1}, {0,43389,0,5,1},
+    {0,43399,0,5,1}, {0,43614,0,5,1}, {0,44009,0,5,1}, {0,40087,0,5,1},
+    {0,44609,0,5,1}, {0,38329,0,6,1}, {0,38419,0,6,1}, {0,40087,0,6,1},
+    {0,27948,0,6,1}, {0,40453,0,6,1}, {0,40579,0,6,1}, {0,40753,0,6,1},
+    {0,11870,0,6,1}, {0,41095,0,6,1}, {0,41185,0,6,1}, {0,34762,0,7,1},
+    {0,19327,0,7,1}, {0,35000,0,7,1}, {0,35756,0,7,1}, {0,36372,0,7,1},
+    {0,27650,0,8,1}, {0,28938,0,8,1}, {0,29962,0,8,1}, {0,22732,0,9,1},
+    {0,24946,0,9,1}, {0,15188,0,11,1}, {0,11864,0,12,1}, {0,9097,0,4,1},
+    {0,45518,0,4,1}, {0,45534,0,4,1}, {0,45706,0,4,1}, {0,42239,0,5,1},
+    {0,33595,0,5,1}, {0,43509,0,5,1}, {0,36919,0,6,1}, {0,38296,0,6,1},
+    {0,39079,0,6,1}, {0,40147,0,6,1}, {0,40501,0,6,1}, {0,41101,0,6,1},
+    {0,34139,0,7,1}, {0,34328,0,7,1}, {0,35140,0,7,1}, {0,35693,0,7,1},
+    {0,4022,0,7,1}, {0,25954,0,8,1}, {0,27762,0,8,1}, {0,28026,0,8,1},
+    {0,30034,0,8,1}, {0,22381,0,9,1}, {0,23137,0,9,1}, {0,24847,0,9,1},
+    {0,11996,0,12,1}, {0,6128,0,3,1}, {0,24237,0,4,1}, {0,18375,0,4,1},
+    {0,33994,0,4,1}, {0,31293,0,5,1}, {0,42909,0,5,1}, {0,42994,0,5,1},
+    {0,43459,0,5,1}, {0,43594,0,5,1}, {0,34612,0,5,1}, {0,44584,0,5,1},
+    {0,37849,0,6,1}, {0,38137,0,6,1}, {0,38293,0,6,1}, {0,38359,0,6,1},
+    {0,39229,0,6,1}, {0,40519,0,6,1}, {0,40621,0,6,1}, {0,40801,0,6,1},
+    {0,41191,0,6,1}, {0,33390,0,7,1}, {0,33586,0,7,1}, {0,2979,0,7,1},
+    {0,34888,0,7,1}, {0,35161,0,7,1}, {0,35812,0,7,1}, {0,36785,0,7,1},
+    {0,27618,0,8,1}, {0,23804,0,8,1}, {0,28282,0,8,1}, {0,28298,0,8,1},
+    {0,30554,0,8,1}, {0,31282,0,8,1}, {0,31290,0,8,1}, {0,22309,0,9,1},
+    {0,23020,0,9,1}, {0,23785,0,9,1}, {0,24955,0,9,1}, {0,7424,0,10,1},
+    {0,20207,0,10,1}, {0,15419,0,11,1}, {0,7420,0,14,1}, {0,783,0,3,1},
+    {0,45138,0,4,1}, {0,38507,0,4,1}, {0,45538,0,4,1}, {0,44339,0,4,1},
+    {0,25041,0,4,1}, {0,6911,0,5,1}, {0,42819,0,5,1}, {0,42824,0,5,1},
+    {0,25598,0,5,1}, {0,42949,0,5,1}, {0,43514,0,5,1}, {0,43589,0,5,1},
+    {0,5442,0,5,1}, {0,43604,0,5,1}, {0,11319,0,5,1}, {0,28349,0,5,1},
+    {0,44019,0,5,1}, {0,23141,0,5,1}, {0,44464,0,5,1}, {0,44619,0,5,1},
+    {0,27042,0,6,1}, {0,37759,0,6,1}, {0,38047,0,6,1}, {0,38101,0,6,1},
+    {0,39049,0,6,1}, {0,7274,0,6,1}, {0,39865,0,6,1}, {0,40003,0,6,1},
+    {0,15655,0,6,1}, {0,40309,0,6,1}, {0,41011,0,6,1}, {0,41131,0,6,1},
+    {0,41173,0,6,1}, {0,27967,0,7,1}, {0,34167,0,7,1}, {0,34300,0,7,1},
+    {0,4054,0,7,1}, {0,35154,0,7,1}, {0,35574,0,7,1}, {0,35616,0,7,1},
+    {0,14851,0,7,1}, {0,36792,0,7,1}, {0,5409,0,8,1}, {0,27042,0,8,1},
+    {0,27290,0,8,1}, {0,27298,0,8,1}, {0,27666,0,8,1}, {0,27850,0,8,1},
+    {0,27866,0,8,1}, {0,27938,0,8,1}, {0,27970,0,8,1}, {0,28138,0,8,1},
+    {0,28258,0,8,1}, {0,28858,0,8,1}, {0,29042,0,8,1}, {0,29106,0,8,1},
+    {0,30122,0,8,1}, {0,30690,0,8,1}, {0,22831,0,9,1}, {0,5331,0,9,1},
+    {0,23065,0,9,1}, {0,23551,0,9,1}, {0,25576,0,9,1}, {0,19127,0,10,1},
+    {0,20197,0,10,1}, {0,12644,0,12,1}, {0,5402,0,15,1}, {0,4013,0,16,1},
+    {0,23304,0,4,4}, {0,1052,0,3,1}, {0,45382,0,4,1}, {0,40478,0,5,1},
+    {0,42754,0,5,1}, {0,11283,0,5,1}, {0,44444,0,5,1}, {0,37987,0,6,1},
+    {0,7268,0,6,1}, {0,34221,0,6,1}, {0,38923,0,6,1}, {0,38935,0,6,1},
+    {0,7274,0,6,1}, {0,40507,0,6,1}, {0,41107,0,6,1}, {0,41143,0,6,1},
+    {0,35798,0,7,1}, {0,36421,0,7,1}, {0,36778,0,7,1}, {0,27778,0,8,1},
+    {0,29386,0,8,1}, {0,19467,0,10,1}, {0,11276,0,12,1}, {0,12032,0,12,1},
+    {0,36251,0,4,1}, {0,45042,0,4,1}, {0,45282,0,4,1}, {0,24445,0,4,1},
+    {0,11960,0,4,1}, {0,45342,0,4,1}, {0,22719,0,4,1}, {0,43519,0,5,1},
+    {0,28197,0,5,1}, {0,18712,0,5,1}, {0,15500,0,5,1}, {0,44424,0,5,1},
+    {0,44594,0,5,1}, {0,38407,0,6,1}, {0,39223,0,6,1}, {0,19787,0,6,1},
+    {0,40153,0,6,1}, {0,33775,0,7,1}, {0,33950,0,7,1}, {0,34335,0,7,1},
+    {0,34671,0,7,1}, {0,36204,0,7,1}, {0,9141,0,8,1}, {0,29378,0,8,1},
+    {0,23794,0,9,1}, {0,18697,0,10,1}, {0,18737,0,10,1}, {0,19957,0,10,1},
+    {0,20097,0,10,1}, {0,20287,0,10,1}, {0,11960,0,12,1}, {0,7206,0,4,1},
+    {0,5340,0,4,1}, {0,39141,0,4,1}, {0,23580,0,5,1}, {0,43449,0,5,1},
+    {0,39085,0,6,1}, {0,22883,0,6,1}, {0,41179,0,6,1}, {0,34286,0,7,1},
+    {0,36260,0,7,1}, {0,27962,0,8,1}, {0,29202,0,8,1}, {0,15881,0,11,1},
+    {0,44758,0,4,1}, {0,7332,0,4,1}, {0,23294,0,4,1}, {0,45330,0,4,1},
+    {0,39445,0,4,1}, {0,4203,0,4,1}, {0,27300,0,4,1}, {0,33680,0,4,1},
+    {0,31586,0,5,1}, {0,42219,0,5,1}, {0,42534,0,5,1}, {0,42544,0,5,1},
+    {0,35094,0,5,1}, {0,42914,0,5,1}, {0,43154,0,5,1}, {0,43439,0,5,1},
+    {0,43574,0,5,1}, {0,43619,0,5,1}, {0,43679,0,5,1}, {0,43684,0,5,1},
+    {0,43709,0,5,1}, {0,43779,0,5,1}, {0,43859,0,5,1}, {0,44069,0,5,1},
+    {0,44254,0,5,1}, {0,44344,0,5,1}, {0,37027,0,6,1}, {0,37039,0,6,1},
+    {0,5396,0,6,1}, {0,37165,0,6,1}, {0,37171,0,6,1}, {0,37585,0,6,1},
+    {0,37633,0,6,1}, {0,11846,0,6,1}, {0,37945,0,6,1}, {0,38101,0,6,1},
+    {0,38155,0,6,1}, {0,38299,0,6,1}, {0,38479,0,6,1}, {0,38527,0,6,1},
+    {0,39031,0,6,1}, {0,29876,0,6,1}, {0,39397,0,6,1}, {0,39403,0,6,1},
+    {0,39511,0,6,1}, {0,15534,0,6,1}, {0,40051,0,6,1}, {0,40483,0,6,1},
+    {0,40597,0,6,1}, {0,40651,0,6,1}, {0,40807,0,6,1}, {0,41107,0,6,1},
+    {0,41161,0,6,1}, {0,31563,0,7,1}, {0,31584,0,7,1}, {0,31598,0,7,1},
+    {0,32186,0,7,1}, {0,32620,0,7,1}, {0,33677,0,7,1}, {0,33803,0,7,1},
+    {0,34209,0,7,1}, {0,34349,0,7,1}, {0,34356,0,7,1}, {0,34657,0,7,1},
+    {0,34818,0,7,1}, {0,34923,0,7,1}, {0,35091,0,7,1}, {0,35294,0,7,1},
+    {0,15870,0,7,1}, {0,35770,0,7,1}, {0,35777,0,7,1}, {0,16160,0,7,1},
+    {0,35826,0,7,1}, {0,35917,0,7,1}, {0,36197,0,7,1}, {0,36295,0,7,1},
+    {0,36456,0,7,1}, {0,36589,0,7,1}, {0,25826,0,8,1}, {0,26106,0,8,1},
+    {0,27066,0,8,1}, {0,27114,0,8,1}, {0,27258,0,8,1}, {0,27458,0,8,1},
+    {0,27482,0,8,1}, {0,27626,0,8,1}, {0,27850,0,8,1}, {0,27882,0,8,1},
+    {0,28018,0,8,1}, {0,28154,0,8,1}, {0,28322,0,8,1}, {0,28330,0,8,1},
+    {0,28626,0,8,1}, {0,28818,0,8,1}, {0,28874,0,8,1}, {0,29050,0,8,1},
+    {0,29210,0,8,1}, {0,29714,0,8,1}, {0,30058,0,8,1}, {0,30066,0,8,1},
+    {0,21419,0,8,1}, {0,30090,0,8,1}, {0,11664,0,8,1}, {0,30562,0,8,1},
+    {0,30570,0,8,1}, {0,30778,0,8,1}, {0,30818,0,8,1}, {0,31074,0,8,1},
+    {0,21400,0,9,1}, {0,21418,0,9,1}, {0,9363,0,9,1}, {0,22534,0,9,1},
+    {0,22696,0,9,1}, {0,22993,0,9,1}, {0,23074,0,9,1}, {0,23956,0,9,1},
+    {0,24163,0,9,1}, {0,24262,0,9,1}, {0,24397,0,9,1}, {0,24442,0,9,1},
+    {0,24505,0,9,1}, {0,24523,0,9,1}, {0,24892,0,9,1}, {0,24973,0,9,1},
+    {0,25027,0,9,1}, {0,25117,0,9,1}, {0,18687,0,10,1}, {0,14374,0,11,1},
+    {0,14957,0,11,1}, {0,15177,0,11,1}, {0,15529,0,11,1}, {0,15540,0,11,1},
+    {0,15870,0,11,1}, {0,11240,0,12,1}, {0,11660,0,12,1}, {0,11756,0,12,1},
+    {0,11840,0,12,1}, {0,11936,0,12,1}, {0,11948,0,12,1}, {0,12464,0,12,1},
+    {0,9151,0,13,1}, {0,9372,0,13,1}, {0,9145,0,4,1}, {0,5670,0,4,1},
+    {0,29078,0,4,1}, {0,40375,0,4,1}, {0,42804,0,5,1}, {0,43444,0,5,1},
+    {0,9142,0,5,1}, {0,38365,0,6,1}, {0,27972,0,6,1}, {0,31626,0,7,1},
+    {0,33600,0,7,1}, {0,11708,0,7,1}, {0,36379,0,7,1}, {0,36407,0,7,1},
+    {0,27906,0,8,1}, {0,27978,0,8,1}, {0,29074,0,8,1}, {0,29274,0,8,1},
+    {0,30882,0,8,1}, {0,2005,0,2,1}, {0,34338,0,4,1}, {0,41191,0,4,1},
+    {0,30031,0,5,1}, {0,42519,0,5,1}, {0,43364,0,5,1}, {0,43429,0,5,1},
+    {0,18870,0,5,1}, {0,36895,0,6,1}, {0,37051,0,6,1}, {0,37951,0,6,1},
+    {0,37969,0,6,1}, {0,38377,0,6,1}, {0,40747,0,6,1}, {0,8386,0,6,1},
+    {0,33887,0,7,1}, {0,34678,0,7,1}, {0,35105,0,7,1}, {0,27058,0,8,1},
+    {0,27818,0,8,1}, {0,28146,0,8,1}, {0,29226,0,8,1}, {0,29874,0,8,1},
+    {0,31226,0,8,1}, {0,31266,0,8,1}, {0,31322,0,8,1}, {0,21751,0,9,1},
+    {0,22435,0,9,1}, {0,19767,0,10,1}, {0,7490,0,14,1}, {0,23304,0,4,4},
+    {0,14841,0,3,1}, {0,45647,0,3,1}, {0,23001,0,3,1}, {0,17538,0,3,1},
+    {0,23890,0,4,1}, {0,42354,0,5,1}, {0,15436,0,5,1}, {0,39013,0,6,1},
+    {0,39325,0,6,1}, {0,23437,0,6,1}, {0,14865,0,6,1}, {0,8386,0,6,1},
+    {0,15170,0,7,1}, {0,33565,0,7,1}, {0,34216,0,7,1}, {0,34664,0,7,1},
+    {0,28266,0,8,1}, {0,28746,0,8,1}, {0,30490,0,8,1}, {0,23785,0,9,1},
+    {0,20997,0,10,1}, {0,15166,0,11,1}, {0,15430,0,11,1}, {0,5427,0,3,1},
+    {0,45150,0,4,1}, {0,42524,0,5,1}, {0,42899,0,5,1}, {0,43974,0,5,1},
+    {0,11307,0,5,1}, {0,37909,0,6,1}, {0,39043,0,6,1}, {0,40129,0,6,1},
+    {0,34230,0,7,1}, {0,9365,0,7,1}, {0,35035,0,7,1}, {0,27754,0,8,1},
+    {0,28106,0,8,1}, {0,28130,0,8,1}, {0,28314,0,8,1}, {0,28786,0,8,1},
+    {0,29202,0,8,1}, {0,30098,0,8,1}, {0,30466,0,8,1}, {0,30498,0,8,1},
+    {0,30538,0,8,1}, {0,23029,0,9,1}, {0,23641,0,9,1}, {0,23812,0,9,1},
+    {0,18777,0,10,1}, {0,19247,0,10,1}, {0,11651,0,3,1}, {0,12460,0,4,1},
+    {0,24266,0,5,1}, {0,43569,0,5,1}, {0,40799,0,5,1}, {0,43659,0,5,1},
+    {0,44029,0,5,1}, {0,44449,0,5,1}, {0,38041,0,6,1}, {0,38131,0,6,1},
+    {0,39997,0,6,1}, {0,40057,0,6,1}, {0,32151,0,7,1}, {0,33880,0,7,1},
+    {0,36211,0,7,1}, {0,28010,0,8,1}, {0,28634,0,8,1}, {0,29034,0,8,1},
+    {0,2988,0,8,1}, {0,24388,0,9,1}, {0,18897,0,10,1}, {0,12452,0,12,1},
+    {0,9861,0,3,1}, {0,8580,0,3,1}, {0,24825,0,4,1}, {0,5327,0,4,1},
+    {0,28751,0,5,1}, {0,42984,0,5,1}, {0,43109,0,5,1}, {0,44599,0,5,1},
+    {0,38473,0,6,1}, {0,39517,0,6,1}, {0,40363,0,6,1}, {0,33285,0,7,1},
+    {0,33313,0,7,1}, {0,33488,0,7,1}, {0,33593,0,7,1}, {0,34062,0,7,1},
+    {0,34748,0,7,1}, {0,35791,0,7,1}, {0,16160,0,7,1}, {0,24415,0,7,1},
+    {0,14851,0,7,1}, {0,5327,0,8,1}, {0,27770,0,8,1}, {0,28042,0,8,1},
+    {0,29242,0,8,1}, {0,29394,0,8,1}, {0,30130,0,8,1}, {0,22345,0,9,1},
+    {0,22741,0,9,1}, {0,22948,0,9,1}, {0,23452,0,9,1}, {0,23533,0,9,1},
+    {0,23623,0,9,1}, {0,18267,0,10,1}, {0,11276,0,10,1}, {0,19037,0,10,1},
+    {0,45002,0,4,1}, {0,20985,0,4,1}, {0,28202,0,4,1}, {0,34371,0,4,1},
+    {0,21382,0,5,1}, {0,5673,0,5,1}, {0,42974,0,5,1}, {0,44249,0,5,1},
+    {0,44629,0,5,1}, {0,38101,0,6,1}, {0,38371,0,6,1}, {0,38509,0,6,1},
+    {0,39019,0,6,1}, {0,7274,0,6,1}, {0,40141,0,6,1}, {0,23194,0,6,1},
+    {0,27362,0,8,1}, {0,28058,0,8,1}, {0,9845,0,8,1}, {0,28202,0,8,1},
+    {0,28234,0,8,1}, {0,31066,0,8,1}, {0,21382,0,9,1}, {0,22363,0,9,1},
+    {0,22849,0,9,1}, {0,22930,0,9,1}, {0,23146,0,9,1}, {0,24496,0,9,1},
+    {0,9554,0,13,1}, {0,12217,0,2,1}, {0,22159,0,4,1}, {0,41185,0,4,1},
+    {0,19562,0,5,1}, {0,43424,0,5,1}, {0,43469,0,5,1}, {0,15436,0,5,1},
+    {0,43959,0,5,1}, {0,44284,0,5,1}, {0,38365,0,6,1}, {0,27852,0,6,1},
+    {0,39547,0,6,1}, {0,40015,0,6,1}, {0,40147,0,6,1}, {0,40165,0,6,1},
+    {0,40675,0,6,1}, {0,35126,0,7,1}, {0,27098,0,8,1}, {0,27914,0,8,1},
+    {0,5424,0,8,1}, {0,29090,0,8,1}, {0,29834,0,8,1}, {0,30474,0,8,1},
+    {0,30842,0,8,1}, {0,31218,0,8,1}, {0,31242,0,8,1}, {0,31298,0,8,1},
+    {0,22408,0,9,1}, {0,22957,0,9,1}, {0,23803,0,9,1}, {0,23875,0,9,1},
+    {0,24514,0,9,1}, {0,18707,0,10,1}, {0,19067,0,10,1}, {0,23304,0,4,4},
+    {0,14456,0,3,1}, {0,7332,0,4,1}, {0,45542,0,4,1}, {0,23834,0,5,1},
+    {0,43099,0,5,1}, {0,9478,0,5,1}, {0,43454,0,5,1}, {0,28273,0,5,1},
+    {0,40506,0,5,1}, {0,44089,0,5,1}, {0,44289,0,5,1}, {0,37099,0,6,1},
+    {0,37765,0,6,1}, {0,37999,0,6,1}, {0,24515,0,6,1}, {0,35073,0,6,1},
+    {0,38227,0,6,1}, {0,38629,0,6,1}, {0,39025,0,6,1}, {0,41077,0,6,1},
+    {0,8386,0,6,1}, {0,31322,0,6,1}, {0,31682,0,7,1}, {0,2979,0,7,1},
+    {0,34748,0,7,1}, {0,35014,0,7,1}, {0,35203,0,7,1}, {0,35805,0,7,1},
+    {0,36085,0,7,1}, {0,36764,0,7,1}, {0,27122,0,8,1}, {0,23804,0,8,1},
+    {0,27914,0,8,1}, {0,27986,0,8,1}, {0,28130,0,8,1}, {0,8392,0,8,1},
+    {0,29858,0,8,1}, {0,30338,0,8,1}, {0,30578,0,8,1}, {0,30594,0,8,1},
+    {0,21202,0,9,1}, {0,9363,0,9,1}, {0,22723,0,9,1}, {0,23767,0,9,1},
+    {0,4036,0,9,1}, {0,25540,0,9,1}, {0,17447,0,10,1}, {0,18557,0,10,1},
+    {0,18677,0,10,1}, {0,11696,0,12,1}, {0,8579,0,13,1}, {0,16018,0,3,1},
+    {0,45198,0,4,1}, {0,7424,0,4,1}, {0,6912,0,4,1}, {0,10598,0,4,1},
+    {0,42414,0,5,1}, {0,42654,0,5,1}, {0,42869,0,5,1}, {0,43014,0,5,1},
+    {0,43669,0,5,1}, {0,38617,0,6,1}, {0,19771,0,6,1}, {0,32676,0,7,1},
+    {0,4054,0,7,1}, {0,35840,0,7,1}, {0,27090,0,8,1}, {0,29410,0,8,1},
+    {0,30074,0,8,1}, {0,30546,0,8,1}, {0,21409,0,9,1}, {0,24307,0,9,1},
+    {0,14946,0,11,1}, {0,11624,0,12,1}, {0,9632,0,13,1}, {0,3997,0,16,1},
+    {0,6505,0,3,1}, {0,46138,0,3,1}, {0,21968,0,4,1}, {0,42064,0,5,1},
+    {0,39022,0,5,1}, {0,42844,0,5,1}, {0,17448,0,5,1}, {0,43049,0,5,1},
+    {0,44634,0,5,1}, {0,38401,0,6,1}, {0,34307,0,7,1}, {0,27994,0,8,1},
+    {0,29082,0,8,1}, {0,30618,0,8,1}, {0,22822,0,9,1}, {0,23434,0,9,1},
+    {0,19047,0,10,1}, {0,19217,0,10,1}, {0,12020,0,12,1}, {0,9762,0,13,1},
+    {0,3731,0,4,1}, {0,15351,0,4,1}, {0,45302,0,4,1}, {0,42964,0,5,1},
+    {0,17447,0,6,1}, {0,21021,0,6,1}, {0,38371,0,6,1}, {0,5672,0,6,1},
+    {0,39379,0,6,1}, {0,40993,0,6,1}, {0,4054,0,7,1}, {0,29050,0,8,1},
+    {0,24235,0,9,1}, {0,24550,0,9,1}, {0,24964,0,9,1}, {0,19137,0,10,1},
+    {0,11708,0,12,1}, {0,5011,0,3,1}, {0,11782,0,3,1}, {0,46231,0,3,1},
+    {0,30454,0,4,1}, {0,42350,0,4,1}, {0,43359,0,5,1}, {0,6581,0,6,1},
+    {0,29042,0,6,1}, {0,4007,0,6,1}, {0,40177,0,6,1}, {0,40435,0,6,1},
+    {0,40669,0,6,1}, {0,33957,0,7,1}, {0,30706,0,8,1}, {0,23101,0,9,1},
+    {0,16002,0,11,1}, {0,14951,0,3,1}, {0,15998,0,4,1}, {0,45174,0,4,1},
+    {0,42474,0,5,1}, {0,43119,0,5,1}, {0,43449,0,5,1}, {0,44089,0,5,1},
+    {0,12644,0,5,1}, {0,38155,0,6,1}, {0,38599,0,6,1}, {0,39073,0,6,1},
+    {0,7204,0,6,1}, {0,39655,0,6,1}, {0,33278,0,7,1}, {0,5327,0,8,1},
+    {0,27306,0,8,1}, {0,29130,0,8,1}, {0,29234,0,8,1}, {0,30442,0,8,1},
+    {0,30898,0,8,1}, {0,23713,0,9,1}, {0,25522,0,9,1}, {0,20977,0,10,1},
+    {0,14847,0,11,1}, {0,15397,0,11,1}, {0,12008,0,12,1}, {0,7266,0,14,1},
+    {0,5327,0,15,1}, {0,23304,0,4,4}, {0,26138,0,8,1}, {0,44454,0,5,1},
+    {0,23326,0,9,1}, {0,188,0,4,1}, {0,26138,0,8,1}, {0,26138,0,8,1},
+    {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1},
+    {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1},
+    {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1},
+    {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1},
+    {0,3486,0,2,1}, {0,3486,0,2,1}, {0,3486,0,2,1}, {0,10,0,2,1},
+    {0,38204,0,5,1}, {0,40987,0,6,1}, {0,13592,0,12,1}, {0,38204,0,5,1},
+    {0,1912,0,3,1}, {0,1912,0,3,1}, {0,949,0,2,1}, {0,37255,0,3,1},
+    {0,42834,0,5,1}, {0,38089,0,6,1}, {0,25306,0,9,1}, {0,13100,0,12,1},
+    {0,3486,0,2,1}, {0,949,0,2,1}, {0,37255,0,3,1}, {0,25306,0,9,1},
+    {0,19797,0,5,1}, {0,40987,0,6,1}, {0,10,0,2,1}, {0,3486,0,2,1},
+    {0,13592,0,12,1}, {0,42834,0,5,1}, {0,19797,0,5,1}, {0,19797,0,5,1},
+    {0,38089,0,6,1}, {0,19797,0,5,1}, {0,13100,0,12,1}, {0,26138,0,8,1},
+    {0,193,0,2,1}, {0,24,0,2,1}, {0,85,0,2,1}, {0,41040,0,2,1},
+    {0,840,0,2,1}, {0,129,0,2,1}, {0,568,0,2,1}, {0,221,0,2,1},
+    {0,1927,0,2,1}, {0,12648,0,2,1}, {0,1208,0,2,1}, {0,829,0,2,1},
+    {0,8582,0,2,1}, {0,32705,0,2,1}, {0,6046,0,3,1}, {0,46027,0,3,1},
+    {0,4203,0,3,1}, {0,46069,0,3,1}, {0,1488,0,3,1}, {0,43782,0,3,1},
+    {0,26681,0,3,1}, {0,931,0,3,1}, {0,24251,0,3,1}, {0,23916,0,3,1},
+    {0,46204,0,3,1}, {0,21263,0,3,1}, {0,45022,0,4,1}, {0,45386,0,4,1},
+    {0,45418,0,4,1}, {0,12426,0,4,1}, {0,45474,0,4,1}, {0,39100,0,4,1},
+    {0,15202,0,4,1}, {0,45654,0,4,1}, {0,36023,0,4,1}, {0,45718,0,4,1},
+    {0,45722,0,4,1}, {0,45726,0,4,1}, {0,45730,0,4,1}, {0,45734,0,4,1},
+    {0,45738,0,4,1}, {0,43069,0,5,1}, {0,43129,0,5,1}, {0,43144,0,5,1},
+    {0,41059,0,6,1}, {0,28170,0,8,1}, {0,24676,0,9,1}, {0,7094,0,4,1},
+    {0,7116,0,3,1}, {0,7116,0,3,2}, {0,5462,0,7,2}, {0,34391,0,7,2},
+    {0,30282,0,8,2}, {0,1027,0,2,1}, {0,27682,0,8,1}, {0,299,0,2,1},
+    {0,1902,0,2,1}, {0,828,0,2,1}, {0,829,0,2,1}, {0,82,0,3,1},
+    {0,3123,0,6,1}, {0,872,0,3,1}, {0,26138,0,8,1}, {0,28994,0,8,1},
+    {0,42039,0,5,1}, {0,14165,0,5,1}, {0,43534,0,5,1}, {0,34993,0,7,1},
+    {0,26138,0,8,1}, {10012,26266,2,8,0}, {10014,24145,1,9,0}, {10015,18937,1,10,0},
+    {0,14176,0,11,1}, {0,11912,0,12,1}, {0,10126,0,13,1}, {0,7373,0,3,1},
+    {0,30018,0,7,1}, {0,26306,0,8,1}, {0,18487,0,10,1}, {0,21878,0,3,1},
+    {0,44994,0,4,1}, {0,45246,0,4,1}, {0,15815,0,11,1}, {0,10113,0,13,1},
+    {0,4877,0,15,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {10016,46006,3,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,45868,0,3,1}, {0,16034,0,3,1}, {0,386,0,3,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,1204,0,3,1}, {0,10765,0,3,1},
+    {0,42514,0,5,1}, {0,21310,0,9,1}, {0,25207,0,9,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1},
+    {0,46006,0,3,1}, {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1},
+    {0,4130,0,3,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,518,0,2,1}, {0,518,0,2,1}, {0,46006,0,3,1}, {0,4130,0,3,1},
+    {0,46066,0,3,1}, {0,26138,0,8,1}, {0,81,0,1,1}, {0,26138,0,8,1},
+    {0,26,0,1,1}, {0,15760,0,11,1}, {0,14488,0,7,2}, {0,14484,0,11,2},
+    {0,16035,0,11,2}, {0,1486,0,3,1}, {0,1486,0,4,1}, {0,46216,0,3,1},
+    {0,20664,0,2,1}, {0,30866,0,8,1}, {0,45862,0,3,2}, {0,34713,0,7,1},
+    {0,12044,0,12,2}, {0,1486,0,3,1}, {0,7373,0,3,1}, {0,6,0,1,2},
+    {0,12200,0,9,1}, {0,12200,0,12,1}, {0,44902,0,4,1}, {0,44906,0,4,1},
+    {0,44910,0,4,1}, {0,44914,0,4,1}, {0,45658,0,4,1}, {0,45662,0,4,1},
+    {0,45666,0,4,1}, {0,45670,0,4,1}, {0,9234,0,4,1}, {0,5632,0,3,1},
+    {0,2196,0,5,1}, {0,182,0,2,1}, {0,23480,0,3,2}, {0,5117,0,7,2},
+    {10019,21337,1,9,0}, {0,21823,0,9,2}, {10020,1221,2,9,0}, {10022,12275,4,9,0},
+    {10026,12287,4,9,0}, {10030,1241,2,9,0}, {10032,1261,2,9,1}, {10034,12311,4,9,0},
+    {10038,1281,1,9,0}, {10039,1301,1,9,0}, {10040,17417,1,10,0}, {10041,9726,4,10,0},
+    {10045,18157,1,10,0}, {10046,18167,1,10,0}, {10047,19147,1,10,0}, {10048,5795,4,12,0},
+    {10052,5810,4,12,0}, {0,12260,0,12,1}, {0,12272,0,12,1}, {0,12284,0,12,1},
+    {0,12296,0,12,1}, {0,12308,0,12,1}, {0,12320,0,12,1}, {0,12332,0,12,1},
+    {0,9723,0,13,1}, {0,9736,0,13,1}, {10056,193,2,14,0}, {10058,3186,4,14,0},
+    {10062,6748,1,14,0}, {10063,218,2,14,0}, {10065,243,2,14,0}, {0,5792,0,15,1},
+    {0,5807,0,15,1}, {0,4349,0,16,1}, {0,3166,0,17,1}, {0,3183,0,17,1},
+    {0,3200,0,17,1}, {0,3217,0,17,1}, {0,1210,0,20,1}, {0,1230,0,20,1},
+    {0,1250,0,20,1}, {0,1270,0,20,1}, {0,1290,0,20,1}, {0,861,0,21,1},
+    {0,182,0,25,1}, {0,207,0,25,1}, {0,232,0,25,1}, {0,7392,0,6,1},
+    {0,7392,0,14,1}, {0,828,0,2,1}, {0,9234,0,4,1}, {0,22633,0,8,1},
+    {0,188,0,4,1}, {0,45988,0,3,1}, {0,1112,0,3,1}, {0,21875,0,3,1},
+    {0,17617,0,4,1}, {0,2843,0,5,1}, {0,36627,0,4,1}, {0,2855,0,5,1},
+    {0,853,0,3,2}, {0,46051,0,3,2}, {0,15845,0,3,2}, {0,5147,0,3,2},
+    {0,0,0,1,1}, {0,5609,0,2,1}, {0,45254,0,4,1}, {0,799,0,4,1},
+    {0,28508,0,4,1}, {0,39529,0,6,1}, {0,40267,0,6,1}, {0,32046,0,7,1},
+    {0,35217,0,7,1}, {0,11024,0,8,1}, {0,26890,0,8,1}, {0,828,0,2,1},
+    {0,16085,0,2,1}, {0,1221,0,9,1}, {0,12275,0,9,1}, {0,12287,0,9,1},
+    {0,1241,0,9,1}, {0,1261,0,9,1}, {0,12311,0,9,1}, {0,1281,0,9,1},
+    {0,1301,0,9,1}, {0,9726,0,10,1}, {0,5795,0,12,1}, {0,5810,0,12,1},
+    {0,869,0,13,1}, {0,193,0,14,1}, {0,3186,0,14,1}, {0,6748,0,14,1},
+    {0,218,0,14,1}, {0,243,0,14,1}, {0,865,0,2,1}, {0,36627,0,4,1},
+    {0,4927,0,6,1}, {0,829,0,4,2}, {0,22264,0,9,1}, {0,829,0,4,1},
+    {0,5462,0,7,2}, {0,36624,0,7,2}, {0,852,0,3,1}, {0,829,0,4,1},
+    {0,6,0,1,1}, {0,27706,0,8,1}, {0,27714,0,8,1}, {0,27722,0,8,1},
+    {0,39695,0,3,1}, {10067,21703,3,3,0}, {10070,8849,2,4,0}, {0,32893,0,7,1},
+    {0,39695,0,3,1}, {0,27682,0,8,1}, {10072,27682,3,8,0}, {0,17617,0,4,1},
+    {0,32886,0,7,1}, {0,31122,0,8,1}, {0,655,0,1,1}, {0,2196,0,5,1},
+    {0,22,0,1,1}, {10075,36627,6,4,0}, {0,27682,0,8,1}, {0,12056,0,12,1},
+    {0,35994,0,7,1}, {0,185,0,7,1}, {10081,8849,1,4,0}, {0,206,0,1,1},
+    {0,33,0,1,1}, {0,32564,0,7,1}, {0,36638,0,7,1}, {0,26738,0,8,1},
+    {0,21706,0,9,1}, {0,20427,0,10,1}, {0,1063,0,7,1}, {0,168,0,2,1},
+    {0,151,0,2,1}, {0,928,0,2,1}, {0,390,0,2,1}, {0,3485,0,2,1},
+    {0,25,0,2,1}, {0,625,0,2,1}, {0,69,0,2,1}, {0,6944,0,2,1},
+    {0,11086,0,2,1}, {0,16633,0,2,1}, {0,81,0,2,1}, {0,11731,0,2,1},
+    {0,2202,0,2,1}, {0,27,0,2,1}, {0,782,0,2,1}, {0,94,0,2,1},
+    {0,3074,0,2,1}, {0,6917,0,2,1}, {0,1383,0,2,1}, {0,76,0,2,1},
+    {0,1119,0,2,1}, {0,266,0,2,1}, {0,85,0,2,1}, {0,189,0,2,1},
+    {0,7403,0,2,1}, {0,1851,0,2,1}, {0,294,0,2,1}, {0,1834,0,2,1},
+    {0,2447,0,2,1}, {0,1749,0,2,1}, {0,164,0,2,1}, {0,13272,0,2,1},
+    {0,1354,0,2,1}, {0,2849,0,2,1}, {0,396,0,2,1}, {0,6458,0,2,1},
+    {0,196,0,2,1}, {0,800,0,2,1}, {0,3149,0,2,1}, {0,2063,0,2,1},
+    {0,161,0,2,1}, {0,72,0,2,1}, {0,156,0,2,1}, {0,188,0,2,1},
+    {0,931,0,2,1}, {0,261,0,2,1}, {0,7431,0,2,1}, {0,829,0,2,1},
+    {0,10787,0,3,1}, {0,2124,0,3,1}, {0,3261,0,3,1}, {0,46093,0,3,1},
+    {0,850,0,4,1}, {0,43724,0,5,1}, {0,15,0,4,1}, {0,4,0,1,1},
+    {0,2213,0,3,1}, {0,872,0,2,1}, {0,5447,0,4,1}, {0,182,0,2,1},
+    {10082,1056,1,6,0}, {10083,10,1,2,0}, {10084,16035,1,3,0}, {0,2855,0,5,1},
+    {0,45068,0,3,1}, {0,1577,0,2,1}, {0,5147,0,3,1}, {0,8652,0,5,1},
+    {0,37711,0,6,1}, {0,37711,0,6,1}, {0,30018,0,7,1}, {0,1726,0,2,1},
+    {0,7431,0,2,1}, {0,46009,0,3,1}, {10085,26986,5,6,0}, {10090,29266,4,6,0},
+    {10094,39757,3,6,0}, {10097,21526,3,9,0}, {10100,22633,2,9,0}, {0,24271,0,9,1},
+    {0,9879,0,13,1}, {0,44898,0,4,1}, {0,828,0,2,1}, {0,5517,0,2,1},
+    {0,25,0,2,1}, {0,7431,0,2,1}, {0,829,0,2,1}, {0,20367,0,3,1},
+    {0,7431,0,2,1}, {0,16491,0,3,1}, {10102,18632,1,5,0}, {0,69,0,2,1},
+    {0,81,0,2,1}, {0,45835,0,3,2}, {0,38791,0,6,1}, {0,11674,0,3,1},
+    {0,35707,0,7,1}, {10103,19837,1,5,0}, {0,44722,0,4,1}, {10104,186,2,2,0},
+    {0,23480,0,3,2}, {0,5117,0,7,2}, {10106,17887,1,10,0}, {0,655,0,1,1},
+    {0,45913,0,3,1}, {0,46183,0,3,1}, {0,2196,0,5,1}, {0,11024,0,4,1},
+    {0,35511,0,7,1}, {0,11024,0,4,1}, {0,11024,0,4,1}, {0,35511,0,7,1},
+    {0,11024,0,4,1}, {0,35511,0,7,1}, {10107,27682,1,8,0}, {0,829,0,4,1},
+    {0,3243,0,2,1}, {0,19166,0,2,1}, {0,11024,0,4,1}, {0,655,0,1,1},
+    {0,46087,0,3,1}, {0,43866,0,4,1}, {0,39697,0,6,1}, {10108,37369,2,6,0},
+    {10110,37369,2,6,0}, {10112,21904,1,9,0}, {0,182,0,2,1}, {10113,37369,2,6,0},
+    {10115,21904,1,9,0}, {0,182,0,10,1}, {0,182,0,2,1}, {10116,37369,2,6,0},
+    {10118,21904,1,9,0}, {0,182,0,10,1}, {10119,37369,2,6,0}, {10121,21904,1,9,0},
+    {10122,37369,2,6,0}, {10124,21904,1,9,0}, {0,182,0,2,1}, {10125,37369,2,6,0},
+    {10127,21904,1,9,0}, {0,182,0,10,1}, {10128,37369,2,6,0}, {10130,37369,2,6,0},
+    {10132,37369,2,6,0}, {0,182,0,2,1}, {10134,37369,2,6,0}, {10136,21904,1,9,0},
+    {0,182,0,10,1}, {10137,37369,2,6,0}, {10139,37369,2,6,0}, {10141,37369,2,6,0},
+    {0,182,0,2,1}, {10143,37369,2,6,0}, {10145,21904,1,9,0}, {0,182,0,10,1},
+    {0,182,0,2,1}, {10146,37369,2,6,0}, {10148,21904,1,9,0}, {0,182,0,10,1},
+    {10149,37369,2,6,0}, {10151,21904,1,9,0}, {0,182,0,2,1}, {10152,37369,2,6,0},
+    {10154,21904,1,9,0}, {0,182,0,10,1}, {10155,37369,2,6,0}, {10157,37369,2,6,0},
+    {10159,21904,1,9,0}, {10160,37369,2,6,0}, {10162,21904,1,9,0}, {0,26,0,1,1},
+    {0,187,0,1,1}, {0,1073,0,6,1}, {0,26,0,1,1}, {0,1073,0,6,1},
+    {0,8631,0,3,1}, {0,46042,0,3,1}, {0,3001,0,3,1}, {0,44970,0,4,1},
+    {0,45354,0,4,1}, {0,45358,0,4,1}, {0,45510,0,4,1}, {0,43244,0,5,1},
+    {0,43249,0,5,1}, {0,8868,0,3,1}, {0,21703,0,3,1}, {0,1486,0,3,1},
+    {10163,10,1,2,0}, {0,182,0,2,1}, {10164,45916,1,3,1}, {10165,46009,1,3,1},
+    {0,46201,0,3,1}, {0,182,0,10,1}, {0,182,0,2,1}, {10166,46009,1,3,1},
+    {0,46201,0,3,1}, {0,182,0,10,1}, {0,182,0,2,1}, {10167,46009,1,3,1},
+    {0,182,0,10,1}, {0,26986,0,8,1}, {0,26994,0,8,1}, {0,29266,0,8,1},
+    {0,5559,0,3,1}, {0,282,0,4,1}, {10168,3914,1,3,0}, {0,44474,0,5,1},
+    {0,17887,0,10,1}, {0,6944,0,14,1}, {0,182,0,2,1}, {0,2855,0,5,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,46189,0,3,1}, {0,7756,0,14,1},
+    {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1}, {0,46189,0,3,1},
+    {0,7756,0,14,1}, {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1},
+    {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,46189,0,3,1}, {0,7756,0,14,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,46189,0,3,1}, {0,7756,0,14,1},
+    {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,46189,0,3,1},
+    {0,7756,0,14,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,46189,0,3,1},
+    {0,7756,0,14,1}, {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1},
+    {0,182,0,2,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1}, {0,46189,0,3,1},
+    {0,7756,0,14,1}, {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1},
+    {0,46189,0,3,1}, {0,7756,0,14,1}, {0,182,0,2,1}, {0,1486,0,3,1},
+    {0,6935,0,9,1}, {0,43539,0,5,1}, {0,43539,0,5,1}, {0,43539,0,5,1},
+    {0,16491,0,3,1},
+};
+
+/*
+ *  END OF FILE
+ */
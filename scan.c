@@ -0,0 +1,213 @@
+#include "scan.h"
+
+/*
+ * This file is generated automatically with program "encode".
+ * We use it to classify characters one at a time.
+ */
+#define URI_TABLES_SOME
+#define URI_TABLE_ENCODE
+#define URI_TABLE_PLAIN
+#include "uri_tables.h"
+
+/*
+ * SIMD implementations are only available for x86 processors, when compiling
+ * with gcc or clang; the AVX2 version also requires a compiler that supports
+ * enabling AVX2 for a single function.
+ */
+#if defined(__GNUC__) && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SCAN_SSE2 1
+#include <emmintrin.h>
+#if defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#define SCAN_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+typedef unsigned int (*ScanFunc)(const char* data, unsigned int len);
+
+static unsigned int scan_plain_table(const char* data, unsigned int len);
+static unsigned int scan_unreserved_table(const char* data, unsigned int len);
+
+static ScanFunc scan_func = scan_plain_table;
+static ScanFunc scan_unreserved_func = scan_unreserved_table;
+
+static unsigned int scan_plain_table(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    while (pos < len && uri_plain_tbl[(unsigned char) data[pos]]) {
+        ++pos;
+    }
+    return pos;
+}
+
+static unsigned int scan_unreserved_table(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    while (pos < len && !uri_encode_tbl[(unsigned char) data[pos]]) {
+        ++pos;
+    }
+    return pos;
+}
+
+#if defined(SCAN_SSE2)
+
+/*
+ * Compute a mask with the bits set for all non-plain characters in chunk:
+ * '\0', ';', '=', '%', ' ', and '\t' ~ '\r' (the remaining whitespace).
+ */
+static int scan_mask_sse2(__m128i chunk)
+{
+    __m128i special = _mm_cmpeq_epi8(chunk, _mm_setzero_si128());
+    __m128i shifted = _mm_sub_epi8(chunk, _mm_set1_epi8('\t'));
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(';')));
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('=')));
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('%')));
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')));
+    /* unsigned (c - '\t') <= ('\r' - '\t') */
+    special = _mm_or_si128(special,
+                           _mm_cmpeq_epi8(shifted,
+                                          _mm_min_epu8(shifted,
+                                                       _mm_set1_epi8('\r' - '\t'))));
+    return _mm_movemask_epi8(special);
+}
+
+static unsigned int scan_plain_sse2(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    for (; pos + 16 <= len; pos += 16) {
+        int mask = scan_mask_sse2(_mm_loadu_si128((const __m128i*) (data + pos)));
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+    return pos + scan_plain_table(data + pos, len - pos);
+}
+
+/*
+ * Compute a mask with the bits set for all unreserved characters in chunk:
+ * 'A' ~ 'Z', 'a' ~ 'z', '0' ~ '9', '-', '.', '_' and '~'; these are the
+ * characters that tools/encode/encode.c leaves alone when URL-encoding.
+ * Each range is checked as unsigned (c - low) <= (high - low).
+ */
+#define SCAN_IN_RANGE_SSE2(x, low, width) \
+    _mm_cmpeq_epi8(_mm_sub_epi8(x, _mm_set1_epi8(low)), \
+                   _mm_min_epu8(_mm_sub_epi8(x, _mm_set1_epi8(low)), \
+                                _mm_set1_epi8(width)))
+
+static int scan_unreserved_mask_sse2(__m128i chunk)
+{
+    /* OR-ing 0x20 turns upper case letters into lower case */
+    __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    __m128i unreserved = SCAN_IN_RANGE_SSE2(lower, 'a', 'z' - 'a');
+    unreserved = _mm_or_si128(unreserved, SCAN_IN_RANGE_SSE2(chunk, '0', '9' - '0'));
+    unreserved = _mm_or_si128(unreserved, SCAN_IN_RANGE_SSE2(chunk, '-', '.' - '-'));
+    unreserved = _mm_or_si128(unreserved, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+    unreserved = _mm_or_si128(unreserved, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~')));
+    return _mm_movemask_epi8(unreserved);
+}
+
+static unsigned int scan_unreserved_sse2(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    for (; pos + 16 <= len; pos += 16) {
+        int mask = scan_unreserved_mask_sse2(_mm_loadu_si128((const __m128i*) (data + pos)));
+        if (mask != 0xffff) {
+            return pos + __builtin_ctz(~mask);
+        }
+    }
+    return pos + scan_unreserved_table(data + pos, len - pos);
+}
+
+#endif /* #if defined(SCAN_SSE2) */
+
+#if defined(SCAN_AVX2)
+
+__attribute__((target("avx2")))
+static unsigned int scan_plain_avx2(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i semi = _mm256_set1_epi8(';');
+    const __m256i equals = _mm256_set1_epi8('=');
+    const __m256i percent = _mm256_set1_epi8('%');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i range = _mm256_set1_epi8('\r' - '\t');
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*) (data + pos));
+        __m256i shifted = _mm256_sub_epi8(chunk, tab);
+        __m256i special = _mm256_cmpeq_epi8(chunk, zero);
+        unsigned int mask = 0;
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chunk, semi));
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chunk, equals));
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chunk, percent));
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chunk, space));
+        special = _mm256_or_si256(special,
+                                  _mm256_cmpeq_epi8(shifted,
+                                                    _mm256_min_epu8(shifted, range)));
+        mask = (unsigned int) _mm256_movemask_epi8(special);
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+    return pos + scan_plain_sse2(data + pos, len - pos);
+}
+
+#define SCAN_IN_RANGE_AVX2(x, low, width) \
+    _mm256_cmpeq_epi8(_mm256_sub_epi8(x, _mm256_set1_epi8(low)), \
+                      _mm256_min_epu8(_mm256_sub_epi8(x, _mm256_set1_epi8(low)), \
+                                      _mm256_set1_epi8(width)))
+
+__attribute__((target("avx2")))
+static unsigned int scan_unreserved_avx2(const char* data, unsigned int len)
+{
+    unsigned int pos = 0;
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i underscore = _mm256_set1_epi8('_');
+    const __m256i tilde = _mm256_set1_epi8('~');
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*) (data + pos));
+        __m256i lower = _mm256_or_si256(chunk, case_bit);
+        __m256i unreserved = SCAN_IN_RANGE_AVX2(lower, 'a', 'z' - 'a');
+        unsigned int mask = 0;
+        unreserved = _mm256_or_si256(unreserved, SCAN_IN_RANGE_AVX2(chunk, '0', '9' - '0'));
+        unreserved = _mm256_or_si256(unreserved, SCAN_IN_RANGE_AVX2(chunk, '-', '.' - '-'));
+        unreserved = _mm256_or_si256(unreserved, _mm256_cmpeq_epi8(chunk, underscore));
+        unreserved = _mm256_or_si256(unreserved, _mm256_cmpeq_epi8(chunk, tilde));
+        mask = (unsigned int) _mm256_movemask_epi8(unreserved);
+        if (mask != 0xffffffffU) {
+            return pos + __builtin_ctz(~mask);
+        }
+    }
+    return pos + scan_unreserved_sse2(data + pos, len - pos);
+}
+
+#endif /* #if defined(SCAN_AVX2) */
+
+void scan_init(void)
+{
+    scan_func = scan_plain_table;
+    scan_unreserved_func = scan_unreserved_table;
+#if defined(SCAN_SSE2)
+    scan_func = scan_plain_sse2;
+    scan_unreserved_func = scan_unreserved_sse2;
+#endif
+#if defined(SCAN_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        scan_func = scan_plain_avx2;
+        scan_unreserved_func = scan_unreserved_avx2;
+    }
+#endif
+}
+
+unsigned int scan_plain(const char* data, unsigned int len)
+{
+    return scan_func(data, len);
+}
+
+unsigned int scan_unreserved(const char* data, unsigned int len)
+{
+    return scan_unreserved_func(data, len);
+}
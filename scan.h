@@ -0,0 +1,33 @@
+#ifndef SCAN_H_
+#define SCAN_H_
+
+/*
+ * Find runs of "plain" characters within a cookie string; these are the
+ * characters that can be copied verbatim into a name or value, which is
+ * anything except '\0', ';', '=', '%' and whitespace.  Also find runs of
+ * "unreserved" characters, which need no URL-encoding.
+ *
+ * There are several implementations of the scanner: a portable one, which
+ * checks one character at a time using a precomputed table, and others that
+ * use SIMD instructions (SSE2 / AVX2) to check 16 or 32 characters at once.
+ * The best implementation supported by the current CPU is selected when
+ * calling scan_init(), which must happen once, before calling any of the
+ * scanning functions.
+ */
+
+void scan_init(void);
+
+/*
+ * Return the number of plain characters found at the start of data,
+ * looking at no more than len characters.
+ */
+unsigned int scan_plain(const char* data, unsigned int len);
+
+/*
+ * Return the number of unreserved characters found at the start of data,
+ * looking at no more than len characters; these are the characters that
+ * url_encode() copies verbatim.
+ */
+unsigned int scan_unreserved(const char* data, unsigned int len);
+
+#endif
@@ -0,0 +1,64 @@
+#include "gmem.h"
+#include "scratch.h"
+
+void scratch_init(Scratch* scratch)
+{
+    scratch->entries = 0;
+    scratch->count = scratch->used = 0;
+    scratch->allocs = 0;
+}
+
+void scratch_fini(Scratch* scratch)
+{
+    unsigned int j = 0;
+    for (j = 0; j < scratch->count; ++j) {
+        buffer_fini(&scratch->entries[j]->buffer);
+        GMEM_DEL(scratch->entries[j], ScratchEntry, 1);
+    }
+    if (scratch->entries) {
+        GMEM_DEL(scratch->entries, ScratchEntry*, scratch->count);
+    }
+    scratch->count = scratch->used = 0;
+}
+
+Buffer* scratch_get(Scratch* scratch)
+{
+    ScratchEntry* entry = 0;
+
+    if (scratch->used >= scratch->count) {
+        /* entries are allocated one by one, so that the buffers
+         * (and their fixed arrays) never move */
+        unsigned int count = scratch->count ? scratch->count * 2 : 4;
+        if (scratch->entries) {
+            GMEM_REALLOC(scratch->entries, ScratchEntry*, scratch->count, count);
+        } else {
+            GMEM_NEW(scratch->entries, ScratchEntry*, count);
+        }
+        for (; scratch->count < count; ++scratch->count) {
+            GMEM_NEW(entry, ScratchEntry, 1);
+            buffer_init(&entry->buffer, 0);
+            scratch->entries[scratch->count] = entry;
+        }
+        ++scratch->allocs;
+    }
+
+    entry = scratch->entries[scratch->used++];
+    buffer_reset(&entry->buffer);
+    entry->size = entry->buffer.size;
+    return &entry->buffer;
+}
+
+void scratch_release(Scratch* scratch, unsigned int mark)
+{
+    while (scratch->used > mark) {
+        ScratchEntry* entry = scratch->entries[--scratch->used];
+        if (entry->buffer.size != entry->size) {
+            /* the buffer grew while it was handed out */
+            ++scratch->allocs;
+        }
+        if (entry->buffer.size > SCRATCH_KEEP_MAX) {
+            buffer_fini(&entry->buffer);
+            buffer_init(&entry->buffer, 0);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef SCRATCH_H_
+#define SCRATCH_H_
+
+/*
+ * A pool of scratch buffers, to be reused over and over again.
+ *
+ * Instead of initializing a buffer (and maybe allocating memory for it,
+ * and growing it several times) every time we need one, we get one from
+ * the pool; when we are done with it, we give it back without releasing
+ * its memory.  After a few calls, all the buffers in the pool are large
+ * enough, and getting and using them does not allocate any memory at all.
+ *
+ * Buffers must be given back in the reverse order they were taken: we
+ * remember a mark before getting some buffers, and release all of them
+ * back to that mark.  Buffers that grew too large are shrunk when they are
+ * given back, so that a single huge cookie does not keep lots of memory
+ * around forever.
+ *
+ * The pool is not protected in any way, so each thread / interpreter must
+ * use its own.
+ */
+
+#include "buffer.h"
+
+/*
+ * Buffers larger than this are shrunk when given back.
+ */
+#define SCRATCH_KEEP_MAX (64 * 1024)
+
+typedef struct ScratchEntry {
+    Buffer buffer;
+    unsigned int size;      /* size of the buffer when it was handed out */
+} ScratchEntry;
+
+typedef struct Scratch {
+    ScratchEntry** entries;
+    unsigned int count;     /* entries allocated */
+    unsigned int used;      /* entries currently handed out */
+    unsigned long allocs;   /* times we had to allocate memory */
+} Scratch;
+
+void scratch_init(Scratch* scratch);
+void scratch_fini(Scratch* scratch);
+
+/*
+ * Get an empty buffer from the pool.
+ */
+Buffer* scratch_get(Scratch* scratch);
+
+/*
+ * Remember how many buffers are in use, to later give back all the buffers
+ * taken after this point.
+ */
+#define scratch_mark(scratch) ((scratch)->used)
+
+/*
+ * Give back all the buffers taken after a mark.
+ */
+void scratch_release(Scratch* scratch, unsigned int mark);
+
+#endif
@@ -0,0 +1,141 @@
+#include <memory.h>
+#include <stdio.h>
+#if defined(_WIN32) || defined(_WIN64)
+#define _CRT_RAND_S
+#include <stdlib.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+#include "base64.h"
+#include "seal.h"
+
+/*
+ * Nonces from one key stream are taken until the block counter wraps
+ * around; we then read a new key.
+ */
+#define SEAL_MAX_BLOCKS 0xffffffffU
+
+/*
+ * Fill a buffer with bytes from the system's random source; return
+ * non-zero on success.
+ */
+static int seal_random(unsigned char* data, unsigned int len)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    unsigned int j = 0;
+    for (j = 0; j < len; j += sizeof(unsigned int)) {
+        unsigned int value = 0;
+        unsigned int left = len - j;
+        if (rand_s(&value) != 0) {
+            return 0;
+        }
+        memcpy(data + j, &value, left < sizeof(value) ? left : sizeof(value));
+    }
+    return 1;
+#else
+    size_t got = 0;
+    FILE* fp = fopen("/dev/urandom", "rb");
+    if (!fp) {
+        return 0;
+    }
+    got = fread(data, 1, len, fp);
+    fclose(fp);
+    return got == len;
+#endif
+}
+
+/*
+ * Get a nonce; return zero if we could not get random bytes for it.
+ */
+static int seal_nonce(SealNonces* nonces, unsigned char nonce[AEAD_NONCE_LEN])
+{
+    static const unsigned char zeros[CHACHA20_BLOCK_LEN] = { 0 };
+    static const unsigned char stream_nonce[AEAD_NONCE_LEN] = { 0 };
+    long pid = (long) getpid();
+
+    if (!nonces->ready || nonces->pid != pid ||
+        nonces->counter == SEAL_MAX_BLOCKS) {
+        if (!seal_random(nonces->key, AEAD_KEY_LEN)) {
+            return 0;
+        }
+        nonces->ready = 1;
+        nonces->pid = pid;
+        nonces->counter = 0;
+        nonces->used = CHACHA20_BLOCK_LEN;
+    }
+
+    if (nonces->used + AEAD_NONCE_LEN > CHACHA20_BLOCK_LEN) {
+        chacha20_xor(nonces->key, nonces->counter++, stream_nonce,
+                     zeros, CHACHA20_BLOCK_LEN, nonces->block);
+        nonces->used = 0;
+    }
+
+    /* never hand out the same bytes twice */
+    memcpy(nonce, nonces->block + nonces->used, AEAD_NONCE_LEN);
+    memset(nonces->block + nonces->used, 0, AEAD_NONCE_LEN);
+    nonces->used += AEAD_NONCE_LEN;
+    return 1;
+}
+
+void seal_nonces_init(SealNonces* nonces)
+{
+    memset(nonces, 0, sizeof(*nonces));
+}
+
+int seal_append(const Buffer* value, const char* name, unsigned int nlen,
+                const unsigned char key[AEAD_KEY_LEN],
+                SealNonces* nonces, Buffer* tgt)
+{
+    unsigned int vlen = buffer_used(value);
+    unsigned int slen = SEAL_OVERHEAD + vlen;
+    unsigned char* raw = 0;
+    unsigned int rpos = 0;
+
+    /* lay out nonce, ciphertext and tag at the end of the target, and
+     * encode them into base64url right before them */
+    buffer_ensure_unused(tgt, BASE64_ENCODED_LEN(slen) + slen);
+    rpos = tgt->wpos + BASE64_ENCODED_LEN(slen);
+    raw = (unsigned char*) tgt->data + rpos;
+
+    if (!seal_nonce(nonces, raw)) {
+        return 0;
+    }
+    aead_seal(key, raw, (const unsigned char*) name, nlen,
+              (const unsigned char*) value->data + value->rpos, vlen,
+              raw + AEAD_NONCE_LEN, raw + AEAD_NONCE_LEN + vlen);
+
+    tgt->wpos += base64_encode_str((const char*) raw, slen, tgt->data + tgt->wpos);
+    return 1;
+}
+
+int seal_open(const char* name, unsigned int nlen,
+              const char* data, unsigned int len,
+              const unsigned char key[AEAD_KEY_LEN], Buffer* tgt)
+{
+    unsigned char* raw = 0;
+    unsigned int vlen = 0;
+    int rlen = 0;
+
+    /* decode into the target, and decrypt in place */
+    buffer_ensure_unused(tgt, BASE64_DECODED_LEN(len));
+    raw = (unsigned char*) tgt->data + tgt->wpos;
+    rlen = base64_decode_str(data, len, (char*) raw);
+    if (rlen < SEAL_OVERHEAD) {
+        return 0;
+    }
+    vlen = rlen - SEAL_OVERHEAD;
+
+    if (!aead_open(key, raw, (const unsigned char*) name, nlen,
+                   raw + AEAD_NONCE_LEN, vlen,
+                   raw + AEAD_NONCE_LEN + vlen,
+                   raw + AEAD_NONCE_LEN)) {
+        return 0;
+    }
+
+    /* move the plaintext over the nonce */
+    memmove(raw, raw + AEAD_NONCE_LEN, vlen);
+    tgt->wpos += vlen;
+    return 1;
+}
@@ -0,0 +1,62 @@
+#ifndef SEAL_H_
+#define SEAL_H_
+
+/*
+ * Sealed cookie values: the value is encrypted and authenticated with
+ * ChaCha20-Poly1305 (see aead.h), using a random nonce, and the nonce,
+ * ciphertext and tag are put in the cookie in base64url, which needs no
+ * URL-encoding.  Nobody without the key can read a sealed value, or change
+ * it (or make up a new one) without opening it failing.  The cookie name is
+ * authenticated as associated data, so a value sealed for one cookie does
+ * not open as the value of any other cookie.
+ *
+ * A nonce must never be used twice with the same key.  Nonces are taken
+ * from a ChaCha20 key stream, with a key read from the system's random
+ * source the first time one is needed, and again whenever the process id
+ * changes, so that processes forked from a parent that already sealed
+ * values don't repeat its nonces.
+ */
+
+#include "buffer.h"
+#include "aead.h"
+
+/*
+ * Extra length added to a value when sealing it, before base64url.
+ */
+#define SEAL_OVERHEAD (AEAD_NONCE_LEN + AEAD_TAG_LEN)
+
+/*
+ * Where we get our nonces from.  It is not protected in any way, so each
+ * thread / interpreter must use its own.
+ */
+typedef struct SealNonces {
+    int ready;
+    long pid;                   /* process that read the key */
+    unsigned int counter;       /* next block in the key stream */
+    unsigned int used;          /* bytes of block already used */
+    unsigned char key[AEAD_KEY_LEN];
+    unsigned char block[CHACHA20_BLOCK_LEN];
+} SealNonces;
+
+void seal_nonces_init(SealNonces* nonces);
+
+/*
+ * Seal the unread contents of a buffer with a key, as the value for a
+ * cookie with the given name, appending the sealed value (in base64url) to
+ * tgt.  Return zero if we could not get random bytes for the nonce,
+ * non-zero otherwise.
+ */
+int seal_append(const Buffer* value, const char* name, unsigned int nlen,
+                const unsigned char key[AEAD_KEY_LEN],
+                SealNonces* nonces, Buffer* tgt);
+
+/*
+ * Open a sealed value for a cookie with the given name with a key,
+ * appending the original value to tgt.  Return zero if the sealed value is
+ * not valid (or was sealed for another name), non-zero otherwise.
+ */
+int seal_open(const char* name, unsigned int nlen,
+              const char* data, unsigned int len,
+              const unsigned char key[AEAD_KEY_LEN], Buffer* tgt);
+
+#endif
@@ -0,0 +1,203 @@
+#include <memory.h>
+#include "sha256.h"
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define SHA256_CH(x, y, z)  (((x) & (y)) ^ (~(x) & (z)))
+#define SHA256_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SHA256_S0(x) (SHA256_ROTR(x,  2) ^ SHA256_ROTR(x, 13) ^ SHA256_ROTR(x, 22))
+#define SHA256_S1(x) (SHA256_ROTR(x,  6) ^ SHA256_ROTR(x, 11) ^ SHA256_ROTR(x, 25))
+#define SHA256_G0(x) (SHA256_ROTR(x,  7) ^ SHA256_ROTR(x, 18) ^ ((x) >>  3))
+#define SHA256_G1(x) (SHA256_ROTR(x, 17) ^ SHA256_ROTR(x, 19) ^ ((x) >> 10))
+
+#define SHA256_GET_BE32(p) \
+    (((unsigned int) (p)[0] << 24) | ((unsigned int) (p)[1] << 16) | \
+     ((unsigned int) (p)[2] <<  8) | ((unsigned int) (p)[3]      ))
+
+#define SHA256_PUT_BE32(p, v) \
+    do { \
+        (p)[0] = (unsigned char) ((v) >> 24); \
+        (p)[1] = (unsigned char) ((v) >> 16); \
+        (p)[2] = (unsigned char) ((v) >>  8); \
+        (p)[3] = (unsigned char) ((v)      ); \
+    } while (0)
+
+static const unsigned int sha256_k[64] = {
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U,
+    0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U,
+    0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU,
+    0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U,
+    0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U,
+    0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U,
+    0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U,
+    0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U,
+    0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U,
+};
+
+static void sha256_block(Sha256* sha, const unsigned char* block)
+{
+    unsigned int w[64];
+    unsigned int a, b, c, d, e, f, g, h;
+    int j = 0;
+
+    for (j = 0; j < 16; ++j) {
+        w[j] = SHA256_GET_BE32(block + 4 * j);
+    }
+    for (j = 16; j < 64; ++j) {
+        w[j] = SHA256_G1(w[j-2]) + w[j-7] + SHA256_G0(w[j-15]) + w[j-16];
+    }
+
+    a = sha->state[0];
+    b = sha->state[1];
+    c = sha->state[2];
+    d = sha->state[3];
+    e = sha->state[4];
+    f = sha->state[5];
+    g = sha->state[6];
+    h = sha->state[7];
+
+    for (j = 0; j < 64; ++j) {
+        unsigned int t1 = h + SHA256_S1(e) + SHA256_CH(e, f, g) + sha256_k[j] + w[j];
+        unsigned int t2 = SHA256_S0(a) + SHA256_MAJ(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    sha->state[0] += a;
+    sha->state[1] += b;
+    sha->state[2] += c;
+    sha->state[3] += d;
+    sha->state[4] += e;
+    sha->state[5] += f;
+    sha->state[6] += g;
+    sha->state[7] += h;
+}
+
+void sha256_init(Sha256* sha)
+{
+    sha->state[0] = 0x6a09e667U;
+    sha->state[1] = 0xbb67ae85U;
+    sha->state[2] = 0x3c6ef372U;
+    sha->state[3] = 0xa54ff53aU;
+    sha->state[4] = 0x510e527fU;
+    sha->state[5] = 0x9b05688cU;
+    sha->state[6] = 0x1f83d9abU;
+    sha->state[7] = 0x5be0cd19U;
+    sha->used = 0;
+    sha->length = 0;
+}
+
+void sha256_update(Sha256* sha, const void* data, unsigned int len)
+{
+    const unsigned char* bytes = (const unsigned char*) data;
+
+    sha->length += len;
+
+    /* complete a partial block first */
+    if (sha->used) {
+        unsigned int left = SHA256_BLOCK_LEN - sha->used;
+        if (len < left) {
+            memcpy(sha->block + sha->used, bytes, len);
+            sha->used += len;
+            return;
+        }
+        memcpy(sha->block + sha->used, bytes, left);
+        sha256_block(sha, sha->block);
+        sha->used = 0;
+        bytes += left;
+        len -= left;
+    }
+
+    /* whole blocks are hashed straight from the data */
+    while (len >= SHA256_BLOCK_LEN) {
+        sha256_block(sha, bytes);
+        bytes += SHA256_BLOCK_LEN;
+        len -= SHA256_BLOCK_LEN;
+    }
+
+    memcpy(sha->block, bytes, len);
+    sha->used = len;
+}
+
+void sha256_final(Sha256* sha, unsigned char digest[SHA256_DIGEST_LEN])
+{
+    /* length in bits, as a 64-bit big endian number */
+    unsigned int hi = (unsigned int) (sha->length >> 29);
+    unsigned int lo = (unsigned int) (sha->length << 3);
+    int j = 0;
+
+    sha->block[sha->used++] = 0x80;
+    if (sha->used > SHA256_BLOCK_LEN - 8) {
+        memset(sha->block + sha->used, 0, SHA256_BLOCK_LEN - sha->used);
+        sha256_block(sha, sha->block);
+        sha->used = 0;
+    }
+    memset(sha->block + sha->used, 0, SHA256_BLOCK_LEN - 8 - sha->used);
+    SHA256_PUT_BE32(sha->block + SHA256_BLOCK_LEN - 8, hi);
+    SHA256_PUT_BE32(sha->block + SHA256_BLOCK_LEN - 4, lo);
+    sha256_block(sha, sha->block);
+
+    for (j = 0; j < 8; ++j) {
+        SHA256_PUT_BE32(digest + 4 * j, sha->state[j]);
+    }
+}
+
+void hmac_sha256_init(HmacSha256* hmac, const char* key, unsigned int klen)
+{
+    unsigned char pad[SHA256_BLOCK_LEN];
+    unsigned char hashed[SHA256_DIGEST_LEN];
+    int j = 0;
+
+    /* keys longer than a block are hashed first */
+    if (klen > SHA256_BLOCK_LEN) {
+        Sha256 sha;
+        sha256_init(&sha);
+        sha256_update(&sha, key, klen);
+        sha256_final(&sha, hashed);
+        key = (const char*) hashed;
+        klen = SHA256_DIGEST_LEN;
+    }
+
+    /* inner hash starts with key ^ ipad */
+    memset(pad, 0, SHA256_BLOCK_LEN);
+    memcpy(pad, key, klen);
+    for (j = 0; j < SHA256_BLOCK_LEN; ++j) {
+        pad[j] ^= 0x36;
+    }
+    sha256_init(&hmac->inner);
+    sha256_update(&hmac->inner, pad, SHA256_BLOCK_LEN);
+
+    /* outer hash starts with key ^ opad */
+    for (j = 0; j < SHA256_BLOCK_LEN; ++j) {
+        pad[j] ^= 0x36 ^ 0x5c;
+    }
+    sha256_init(&hmac->outer);
+    sha256_update(&hmac->outer, pad, SHA256_BLOCK_LEN);
+}
+
+void hmac_sha256_compute(const HmacSha256* hmac,
+                         const char* data, unsigned int dlen,
+                         unsigned char mac[SHA256_DIGEST_LEN])
+{
+    /* work on copies, so that the prepared key can be used again */
+    Sha256 sha = hmac->inner;
+    sha256_update(&sha, data, dlen);
+    sha256_final(&sha, mac);
+
+    sha = hmac->outer;
+    sha256_update(&sha, mac, SHA256_DIGEST_LEN);
+    sha256_final(&sha, mac);
+}
@@ -0,0 +1,40 @@
+#ifndef SHA256_H_
+#define SHA256_H_
+
+/*
+ * SHA-256 (FIPS 180-4) and HMAC-SHA256 (RFC 2104), used to sign cookie
+ * values.  This is a plain implementation, with no dependencies; we assume
+ * an unsigned int has (at least) 32 bits, as it does on every platform Perl
+ * runs on.
+ */
+
+#define SHA256_BLOCK_LEN  64
+#define SHA256_DIGEST_LEN 32
+
+typedef struct Sha256 {
+    unsigned int state[8];
+    unsigned char block[SHA256_BLOCK_LEN];
+    unsigned int used;      /* bytes waiting in block */
+    unsigned long length;   /* total bytes hashed */
+} Sha256;
+
+void sha256_init(Sha256* sha);
+void sha256_update(Sha256* sha, const void* data, unsigned int len);
+void sha256_final(Sha256* sha, unsigned char digest[SHA256_DIGEST_LEN]);
+
+/*
+ * HMAC-SHA256 with a given key, ready to compute the HMAC for any data.
+ * Preparing a key hashes a block for each of the inner and outer hashes;
+ * keeping the prepared key avoids doing that for every HMAC.
+ */
+typedef struct HmacSha256 {
+    Sha256 inner;           /* state after hashing key ^ ipad */
+    Sha256 outer;           /* state after hashing key ^ opad */
+} HmacSha256;
+
+void hmac_sha256_init(HmacSha256* hmac, const char* key, unsigned int klen);
+void hmac_sha256_compute(const HmacSha256* hmac,
+                         const char* data, unsigned int dlen,
+                         unsigned char mac[SHA256_DIGEST_LEN]);
+
+#endif
@@ -0,0 +1,89 @@
+#include <memory.h>
+#include "sign.h"
+
+/*
+ * Compute the signature for a name and a value, in base64url, into sig,
+ * which must have room for SIGN_SIGNATURE_LEN characters.  This is the
+ * HMAC of name || 0x00 || value; a cookie name never has a zero byte, so
+ * no two names and values give the same message.
+ */
+static void sign_compute(const char* name, unsigned int nlen,
+                         const char* data, unsigned int len,
+                         const HmacSha256* hmac, char* sig)
+{
+    unsigned char mac[SHA256_DIGEST_LEN];
+    /* work on copies, so that the prepared key can be used again */
+    Sha256 sha = hmac->inner;
+
+    sha256_update(&sha, name, nlen);
+    sha256_update(&sha, "", 1);
+    sha256_update(&sha, data, len);
+    sha256_final(&sha, mac);
+
+    sha = hmac->outer;
+    sha256_update(&sha, mac, SHA256_DIGEST_LEN);
+    sha256_final(&sha, mac);
+    base64_encode_str((const char*) mac, SHA256_DIGEST_LEN, sig);
+}
+
+void sign_key_init(SignKey* skey)
+{
+    skey->klen = 0;
+}
+
+const HmacSha256* sign_key_get(SignKey* skey, const char* key, unsigned int klen)
+{
+    if (skey->klen && klen == skey->klen && memcmp(key, skey->key, klen) == 0) {
+        return &skey->hmac;
+    }
+
+    hmac_sha256_init(&skey->hmac, key, klen);
+    if (klen <= SHA256_BLOCK_LEN) {
+        memcpy(skey->key, key, klen);
+        skey->klen = klen;
+    } else {
+        skey->klen = 0;
+    }
+    return &skey->hmac;
+}
+
+Buffer* sign_append(Buffer* value, const char* name, unsigned int nlen,
+                    const HmacSha256* hmac)
+{
+    char sig[SIGN_SIGNATURE_LEN];
+
+    /* compute the signature before growing the buffer */
+    sign_compute(name, nlen, value->data + value->rpos, buffer_used(value), hmac, sig);
+
+    buffer_ensure_unused(value, 1 + SIGN_SIGNATURE_LEN);
+    value->data[value->wpos++] = '.';
+    memcpy(value->data + value->wpos, sig, SIGN_SIGNATURE_LEN);
+    value->wpos += SIGN_SIGNATURE_LEN;
+    return value;
+}
+
+int sign_verify(const char* name, unsigned int nlen,
+                const char* data, unsigned int len, const HmacSha256* hmac)
+{
+    char sig[SIGN_SIGNATURE_LEN];
+    unsigned int vlen = 0;
+    unsigned char diff = 0;
+    unsigned int j = 0;
+
+    /* the signature has a fixed length, right after the last '.' */
+    if (len < 1 + SIGN_SIGNATURE_LEN) {
+        return -1;
+    }
+    vlen = len - 1 - SIGN_SIGNATURE_LEN;
+    if (data[vlen] != '.') {
+        return -1;
+    }
+
+    /* compare all the characters, so that the time this takes does not
+     * tell how many of them were right */
+    sign_compute(name, nlen, data, vlen, hmac, sig);
+    for (j = 0; j < SIGN_SIGNATURE_LEN; ++j) {
+        diff |= (unsigned char) (sig[j] ^ data[vlen + 1 + j]);
+    }
+    return diff ? -1 : (int) vlen;
+}
@@ -0,0 +1,63 @@
+#ifndef SIGN_H_
+#define SIGN_H_
+
+/*
+ * Signed cookie values.  A signed value is the original value, followed by
+ * a '.' and the HMAC-SHA256 (computed with a secret key) of the cookie name,
+ * a zero byte and the original value, in base64url.  The signature needs no
+ * URL-encoding, and since it never contains a '.', the value can be split on
+ * the last '.' in it.
+ *
+ * Anyone can read a signed value, but nobody without the key can change it
+ * (or make up a new one) without the signature becoming invalid.  Since the
+ * name is signed too, a value signed for one cookie is not valid for any
+ * other cookie.
+ */
+
+#include "buffer.h"
+#include "base64.h"
+#include "sha256.h"
+
+/*
+ * Length of the signature in a signed value, not counting the '.'.
+ */
+#define SIGN_SIGNATURE_LEN BASE64_ENCODED_LEN(SHA256_DIGEST_LEN)
+
+/*
+ * The last key used for signing, already prepared.  Programs sign all their
+ * cookies with one key (or a few), so we only prepare a key when it is not
+ * the same as the last one.  Keys longer than a block are not kept.
+ *
+ * The key is not protected in any way, so each thread / interpreter must
+ * use its own.
+ */
+typedef struct SignKey {
+    HmacSha256 hmac;
+    unsigned int klen;      /* 0 if there is no key yet */
+    char key[SHA256_BLOCK_LEN];
+} SignKey;
+
+void sign_key_init(SignKey* skey);
+
+/*
+ * Prepare a key for signing, reusing the last one if it is the same.
+ */
+const HmacSha256* sign_key_get(SignKey* skey, const char* key, unsigned int klen);
+
+/*
+ * Sign the unread contents of a buffer, as the value for a cookie with the
+ * given name, appending the '.' and signature to it.
+ */
+Buffer* sign_append(Buffer* value, const char* name, unsigned int nlen,
+                    const HmacSha256* hmac);
+
+/*
+ * Check the signature in a signed value for a cookie with the given name;
+ * if it is valid, return the length of the original value (the part before
+ * the '.'), otherwise return -1.  The signatures are compared in constant
+ * time.
+ */
+int sign_verify(const char* name, unsigned int nlen,
+                const char* data, unsigned int len, const HmacSha256* hmac);
+
+#endif
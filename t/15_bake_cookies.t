@@ -0,0 +1,75 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[bake_cookie bake_cookies];
+
+exit main();
+
+sub main {
+    test_bake_cookies_pairs();
+    test_bake_cookies_hash();
+    test_bake_cookies_expires();
+
+    done_testing();
+    return 0;
+}
+
+# Attributes can come out in any order, so compare them as a set
+sub split_cookie {
+    my ($cookie) = @_;
+    my ($pair, @attributes) = split /; /, $cookie;
+    return [ defined($pair) ? $pair : '', sort @attributes ];
+}
+
+sub specs {
+    return (
+        foo           => 'bar',
+        'Bilbo&Frodo' => 'Foo Bar',
+        session       => { value => 'abc def', path => '/', domain => '.example.com', httponly => 1 },
+        old           => { value => 'x', expires => 1452449969, secure => 1 },
+        empty         => '',
+        novalue       => { path => '/' },
+    );
+}
+
+sub test_bake_cookies_pairs {
+    my @specs = specs();
+    my @expected;
+    for (my $j = 0; $j < @specs; $j += 2) {
+        my @copy = specs();
+        push @expected, bake_cookie($copy[$j], $copy[$j + 1]);
+    }
+
+    my $baked = bake_cookies(\@specs);
+    is(scalar @$baked, scalar @expected, 'baked all pairs');
+    is_deeply([ map { split_cookie($_) } @$baked ], [ map { split_cookie($_) } @expected ],
+              'baked pairs same as bake_cookie');
+
+    is_deeply(bake_cookies([]), [], 'baked no pairs');
+    is_deeply(bake_cookies([ 'foo' ]), [], 'ignored name without value');
+    is_deeply(bake_cookies([ foo => undef, bar => 'baz' ]), [ '', 'bar=baz' ], 'undef value');
+}
+
+sub test_bake_cookies_hash {
+    my %specs = specs();
+    my %copy = specs();
+    my @expected = sort map { join('; ', @{ split_cookie(bake_cookie($_, $copy{$_})) }) } keys %copy;
+
+    my $baked = bake_cookies(\%specs);
+    is_deeply([ sort map { join('; ', @{ split_cookie($_) }) } @$baked ], \@expected,
+              'baked hash same as bake_cookie');
+
+    is_deeply(bake_cookies({}), [], 'baked empty hash');
+
+    ok(!eval { bake_cookies('foo'); 1 }, 'cookies must be a reference');
+    like($@, qr/must be an arrayref or a hashref/, 'got the right error');
+}
+
+sub test_bake_cookies_expires {
+    my @specs = map { ("c$_" => { value => $_, expires => ($_ % 2 ? '+1y' : '+30d') }) } 1..10;
+    my $baked = bake_cookies(\@specs);
+    my %dates = map { (m/Expires=([^;]+)/)[0] => 1 } @$baked;
+    ok(keys %dates >= 2 && keys %dates <= 4, 'baked with two different expiration dates');
+    like($baked->[0], qr/^c1=1; Expires=\w{3}, \d\d-\w{3}-\d{4} \d\d:\d\d:\d\d GMT$/, 'expires looks right');
+}
@@ -0,0 +1,62 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[bake_cookie];
+
+exit main();
+
+sub main {
+    test_encode_every_byte();
+    test_encode_random();
+
+    done_testing();
+    return 0;
+}
+
+# What url_encode() has always done, one byte at a time: characters in
+# the unreserved set are copied, all others become "%xx".
+sub reference_encode {
+    my ($str) = @_;
+    $str =~ s/([^A-Za-z0-9\-_.~])/sprintf('%%%02x', ord($1))/ge;
+    return $str;
+}
+
+sub baked_value {
+    my ($value) = @_;
+    my $cookie = bake_cookie('n', $value);
+    return substr($cookie, 2);
+}
+
+# Every byte value at every position of values long enough to span several
+# 16 / 32 byte chunks, so that all the SIMD code paths (and the tails
+# handled one byte at a time) see every character.
+sub test_encode_every_byte {
+    my $plain = join('', 'a'..'z', 'A'..'Z', '0'..'9', '-', '_', '.', '~');
+    my @failed;
+    for my $len (1, 15, 16, 17, 31, 32, 33, 48, 64, 70) {
+        my $base = substr($plain x 2, 0, $len);
+        for my $pos (0..$len-1) {
+            for my $byte (0..255) {
+                my $value = $base;
+                substr($value, $pos, 1) = chr($byte);
+                push @failed, "$len/$pos/$byte"
+                    if baked_value($value) ne reference_encode($value);
+            }
+        }
+    }
+    is_deeply(\@failed, [], 'encoded every byte at every position');
+    is(baked_value($plain x 3), $plain x 3, 'unreserved characters are not encoded');
+}
+
+sub test_encode_random {
+    my @chars = ('a'..'e', 'X', '0'..'3', '-', '_', '.', '~', ' ', '%', '&',
+                 ';', '=', '+', '/', "\x{e9}", "\x{ff}", "\0", 'plain' x 8);
+    srand(20261017);
+    for my $iter (1..500) {
+        my $value = join('', map { $chars[int(rand(@chars))] } 1..int(rand(200)));
+        is(baked_value($value), reference_encode($value), "encoded random value $iter");
+    }
+    is(bake_cookie('n', { value => [ 'a b', 'c~d' ] }), 'n=a%20b%26c~d',
+       'encoded multiple values');
+}
@@ -0,0 +1,123 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie];
+
+exit main();
+
+sub main {
+    test_crush_long();
+    test_crush_random();
+
+    done_testing();
+    return 0;
+}
+
+# Long cookies, so that plain runs span several 16 / 32 byte chunks,
+# with interesting characters placed right at the chunk boundaries.
+sub test_crush_long {
+    for my $len (1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 4096) {
+        my $plain = join('', map { chr(ord('a') + $_ % 26) } 0..$len-1);
+        my @tests = (
+            [ "n=$plain", { n => $plain } ],
+            [ "$plain=v", { $plain => 'v' } ],
+            [ "n=$plain%20x", { n => "$plain x" } ],
+            [ "n=$plain  ; m=$plain", { n => $plain, m => $plain } ],
+            [ "n=$plain\t\tx ; m=1", { n => "$plain\t\tx", m => 1 } ],
+            [ "n=$plain \t%41 ; m=$plain%41", { n => "$plain \tA", m => "${plain}A" } ],
+            [ "n=$plain=$plain", { n => "$plain=$plain" } ],
+            [ "n=$plain&$plain", { n => [ $plain, $plain ] } ],
+            [ "n=\x{e9}$plain\x{ff}", { n => "\x{e9}$plain\x{ff}" } ],
+        );
+        for my $test (@tests) {
+            is_deeply(crush_cookie($test->[0]), $test->[1],
+                      sprintf('crushed long cookie, length %d', length($test->[0])));
+        }
+    }
+}
+
+# Random cookies made of characters that exercise every state transition,
+# checked against a straightforward implementation of the state machine.
+sub test_crush_random {
+    my @chars = ('a'..'e', 'X', '0'..'3', '%', '%2', '%41', '=', ';', '; ',
+                 ' ', "\t", '&', "\x{e9}", 'plain' x 8);
+    srand(20160125);
+    for my $iter (1..500) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(200)));
+        for my $allow (0, 1) {
+            is_deeply(crush_cookie($str, $allow), reference_crush($str, $allow),
+                      "crushed random cookie $iter, allow is $allow");
+        }
+    }
+}
+
+sub reference_crush {
+    my ($str, $allow_no_value) = @_;
+
+    my %crushed;
+    my $pos = 0;
+    my $len = length($str);
+    while (1) {
+        my ($state, $name, $value, $vend, $equals) = ('start', '', '', 0, 0);
+        while ($state ne 'end' && $state ne 'error') {
+            my $c = $pos < $len ? substr($str, $pos, 1) : "\0";
+            if ($c eq "\0" || $c eq ';') {
+                $state = $state eq 'start' ? 'error' : 'end';
+                ++$pos;
+                next;
+            }
+            if ($c =~ m/^[ \t\n\x0b\f\r]$/) {
+                $name  .= $c if $state eq 'name';
+                $value .= $c if $state eq 'value';
+                ++$pos;
+                next;
+            }
+            if ($c eq '=' && $state ne 'value') {
+                $state = $state eq 'name'   ? 'equals'
+                       : $state eq 'equals' ? 'value'
+                       : 'error';
+                $equals = 1 if $state eq 'equals';
+                $value .= $c if $state eq 'value';
+                $vend = length($value);
+                ++$pos;
+                next;
+            }
+            $state = $state eq 'start'  ? 'name'
+                   : $state eq 'equals' ? 'value'
+                   : $state;
+            if (substr($str, $pos, 3) =~ m/^%([0-9a-fA-F]{2})$/) {
+                $c = chr(hex($1));
+                $pos += 3;
+            } else {
+                ++$pos;
+            }
+            $name  .= $c if $state eq 'name';
+            $value .= $c if $state eq 'value';
+            $vend = length($value);
+        }
+        last if $state ne 'end' || $name eq '';
+        next if exists($crushed{$name});
+
+        if (!$equals) {
+            $crushed{$name} = undef if $allow_no_value;
+            next;
+        }
+
+        $value = substr($value, 0, $vend);
+        if (index($value, '&') < 0) {
+            $crushed{$name} = $value;
+            next;
+        }
+        my @values;
+        my $ini = 0;
+        while ($ini < length($value)) {
+            my $end = index($value, '&', $ini);
+            $end = length($value) if $end < 0;
+            push @values, substr($value, $ini, $end - $ini);
+            $ini = $end + 1;
+        }
+        $crushed{$name} = \@values;
+    }
+    return \%crushed;
+}
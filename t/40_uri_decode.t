@@ -0,0 +1,89 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[uri_decode crush_cookie];
+
+exit main();
+
+sub main {
+    test_uri_decode_simple();
+    test_uri_decode_every_position();
+    test_uri_decode_random();
+
+    done_testing();
+    return 0;
+}
+
+# What url_decode() has always done: "%XY" with two hex digits becomes a
+# byte, everything else is copied.
+sub reference_decode {
+    my ($str) = @_;
+    $str =~ s/%([0-9A-Fa-f]{2})/chr(hex($1))/ge;
+    return $str;
+}
+
+sub test_uri_decode_simple {
+    my @tests = (
+        [ ''                   , ''             , 'empty string' ],
+        [ 'hello world'        , 'hello world'  , 'nothing to decode' ],
+        [ 'a+b'                , 'a+b'          , 'plus sign is left alone' ],
+        [ '%41%42%43'          , 'ABC'          , 'only escapes' ],
+        [ '%7e%7E'             , '~~'           , 'lower and upper case hex digits' ],
+        [ 'caf%C3%A9'          , "caf\xc3\xa9"  , 'UTF-8 bytes are not decoded' ],
+        [ '%00x'               , "\0x"          , 'null byte' ],
+        [ '%'                  , '%'            , 'lone percent' ],
+        [ 'a%'                 , 'a%'           , 'percent at the end' ],
+        [ 'a%4'                , 'a%4'          , 'one hex digit at the end' ],
+        [ '%4g%g4'             , '%4g%g4'       , 'invalid hex digits' ],
+        [ '%%41'               , '%A'           , 'percent before an escape' ],
+        [ '%2541'              , '%41'          , 'decode only once' ],
+        [ "\xff%ff\x80"        , "\xff\xff\x80" , 'bytes above 0x7f' ],
+    );
+    foreach my $test (@tests) {
+        my ($str, $expected, $name) = @$test;
+        is(uri_decode($str), $expected, $name);
+    }
+
+    is(uri_decode(undef), undef, 'undef gives undef');
+    is(uri_decode(42), '42', 'number');
+
+    my $str = 'x%41y';
+    my $decoded = uri_decode($str);
+    is($str, 'x%41y', 'argument is not changed');
+    is($decoded, 'xAy', 'argument is decoded');
+}
+
+# Escapes and lone '%' at every position of long strings, so that the copies
+# of the runs between them have all lengths.
+sub test_uri_decode_every_position {
+    my $plain = join('', 'a'..'z', 'A'..'Z', '0'..'9');
+    my @failed;
+    foreach my $len (1, 15, 16, 17, 31, 32, 33, 64, 100) {
+        my $base = substr($plain x 2, 0, $len);
+        foreach my $pos (0..$len-1) {
+            foreach my $insert ('%41', '%e9', '%', '%4', '%zz', '%41%42') {
+                my $str = $base;
+                substr($str, $pos, 0) = $insert;
+                push @failed, "$len/$pos/$insert"
+                    if uri_decode($str) ne reference_decode($str);
+            }
+        }
+    }
+    is_deeply(\@failed, [], 'decoded escapes at every position');
+}
+
+sub test_uri_decode_random {
+    my @chars = ('a'..'e', '0'..'9', 'A', 'F', 'g', '%', '%', '%', '+', ' ',
+                 "\0", "\xff", 'plain' x 8);
+    srand(20261017);
+    foreach my $iter (1..500) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(200)));
+        is(uri_decode($str), reference_decode($str), "decoded random string $iter");
+    }
+
+    # crush_cookie uses the same decoder for values it cannot copy verbatim
+    my $value = 'a%20b%25c%';
+    is(crush_cookie("n=$value")->{n}, uri_decode($value),
+       'uri_decode agrees with crush_cookie');
+}
@@ -0,0 +1,105 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[
+    uri_encode
+    uri_decode
+    uri_encode_inplace
+    uri_decode_inplace
+    uri_encode_append
+    uri_decode_append
+];
+
+exit main();
+
+sub main {
+    test_uri_encode();
+    test_uri_inplace();
+    test_uri_append();
+
+    done_testing();
+    return 0;
+}
+
+sub reference_encode {
+    my ($str) = @_;
+    $str =~ s/([^A-Za-z0-9\-_.~])/sprintf('%%%02x', ord($1))/ge;
+    return $str;
+}
+
+sub test_uri_encode {
+    my $all = join('', map { chr } 0..255);
+    is(uri_encode($all), reference_encode($all), 'encoded every byte');
+    is(uri_decode(uri_encode($all)), $all, 'decoded every byte back');
+    is(uri_encode(''), '', 'empty string');
+    is(uri_encode(undef), undef, 'undef gives undef');
+    is(uri_encode('a.b-c_d~e'), 'a.b-c_d~e', 'nothing to encode');
+    is(uri_encode("\x{263a}"), '%e2%98%ba', 'characters are encoded as UTF-8');
+    is(uri_encode('a+b c'), 'a%2bb%20c', 'plus sign and space');
+}
+
+sub test_uri_inplace {
+    my $all = join('', map { chr } 0..255);
+    foreach my $len (0, 1, 15, 16, 17, 33, 256) {
+        my $str = substr($all x 2, 100, $len);
+        my $copy = $str;
+        uri_encode_inplace($copy);
+        is($copy, reference_encode($str), "encoded $len bytes in place");
+        uri_decode_inplace($copy);
+        is($copy, $str, "decoded $len bytes in place");
+    }
+
+    my $str = 'nothing_to_encode';
+    uri_encode_inplace($str);
+    is($str, 'nothing_to_encode', 'encoded in place with nothing to encode');
+
+    $str = '%41%4';
+    uri_decode_inplace($str);
+    is($str, 'A%4', 'decoded in place with incomplete escape');
+
+    $str = "\x{263a}%41";
+    uri_decode_inplace($str);
+    is($str, "\xe2\x98\xbaA", 'decoded in place gives bytes');
+    ok(!utf8::is_utf8($str), 'decoded in place has no UTF8 flag');
+
+    $str = 42;
+    uri_encode_inplace($str);
+    is($str, '42', 'encoded a number in place');
+
+    my $undef;
+    uri_decode_inplace($undef);
+    is($undef, undef, 'undef is left alone');
+
+    ok(!eval { uri_decode_inplace('constant'); 1 },
+       'cannot decode a constant in place');
+    like($@, qr/read-only/, 'got error for constant');
+}
+
+sub test_uri_append {
+    my $query = 'q=';
+    uri_encode_append($query, 'fish & chips');
+    $query .= '&page=';
+    uri_encode_append($query, 2);
+    is($query, 'q=fish%20%26%20chips&page=2', 'encoded appending');
+
+    my $decoded = '';
+    uri_decode_append($decoded, $_) for ('fish%20', '%26', '%20chips');
+    is($decoded, 'fish & chips', 'decoded appending');
+
+    my $target;
+    uri_decode_append($target, '%41');
+    is($target, 'A', 'appended to undef');
+    uri_encode_append($target, undef);
+    is($target, 'A', 'appended undef');
+
+    my $self = 'a b';
+    uri_encode_append($self, $self);
+    is($self, 'a ba%20b', 'appended encoded string to itself');
+
+    my $chars = "\x{263a}";
+    uri_decode_append($chars, '%e9%41');
+    is($chars, "\x{263a}\x{e9}A", 'decoded bytes appended to characters');
+    uri_encode_append($chars, ' ');
+    is($chars, "\x{263a}\x{e9}A%20", 'encoded string appended to characters');
+}
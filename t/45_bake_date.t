@@ -0,0 +1,115 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[bake_cookie parse_http_date];
+
+exit main();
+
+sub main {
+    test_bake_date();
+    test_bake_date_max();
+    test_bake_date_cache();
+    test_bake_date_every_day();
+    test_bake_date_http();
+    test_parse_date_every_day();
+
+    done_testing();
+    return 0;
+}
+
+sub expected_date {
+    my ($epoch) = @_;
+    my @day = qw/Sun Mon Tue Wed Thu Fri Sat/;
+    my @mon = qw/Jan Feb Mar Apr May Jun Jul Aug Sep Oct Nov Dec/;
+    my ($sec, $min, $hour, $mday, $mon, $year, $wday) = gmtime($epoch);
+    return sprintf('%s, %02d-%s-%04d %02d:%02d:%02d GMT',
+                   $day[$wday], $mday, $mon[$mon], $year + 1900, $hour, $min, $sec);
+}
+
+sub baked_date {
+    my ($expires) = @_;
+    my $cookie = bake_cookie('foo', { value => 'bar', expires => $expires });
+    return ($cookie =~ m/Expires=([^;]+)/)[0];
+}
+
+sub test_bake_date {
+    for my $epoch (0, 1, 59, 86399, 86400, 951782400, 1452449969, 2147483647, 2147483648, 4133980799) {
+        is(baked_date($epoch), expected_date($epoch), "baked date for epoch $epoch");
+    }
+}
+
+# Dates after the year 9999 are written as the last second of it, so they
+# stay in the future.
+sub test_bake_date_max {
+    my $max = 253402300799;
+    my $last = 'Fri, 31-Dec-9999 23:59:59 GMT';
+    is(baked_date($max - 1), 'Fri, 31-Dec-9999 23:59:58 GMT', 'baked date before the last one');
+    is(baked_date($max), $last, 'baked last date');
+    for my $expires ($max + 1, $max + 86400 * 366, '1000000000000000', '+10000y') {
+        is(baked_date($expires), $last, "baked date for $expires is the last one");
+    }
+}
+
+# Dates in the same second come from the cache; make sure we notice when
+# the second changes, in either direction.
+sub test_bake_date_cache {
+    my @epochs = (1452449969, 1452449969, 1452449970, 1452449969, 0, 0, 2000000000);
+    for my $epoch (@epochs) {
+        is(baked_date($epoch), expected_date($epoch), "baked cached date for epoch $epoch");
+    }
+
+    my $before = time();
+    my $date = baked_date('+1h');
+    my $after = time();
+    ok((grep { $date eq expected_date($_ + 3600) } ($before..$after)),
+       'baked relative date');
+}
+
+# Every day from 1970 to 2100, at a different time of the day each time;
+# tools/format/check does this for every second.
+sub test_bake_date_every_day {
+    my $last = 4133980799;
+    my @failed;
+    for (my $day = 0; $day * 86400 <= $last; ++$day) {
+        my $epoch = $day * 86400 + ($day * 7919) % 86400;
+        push @failed, $epoch if baked_date($epoch) ne expected_date($epoch);
+    }
+    is_deeply(\@failed, [], 'baked dates for every day from 1970 to 2100');
+
+    my @day_failed = grep { baked_date($_) ne expected_date($_) }
+                     map { 951782400 + $_ } 0..86399;
+    is_deeply(\@day_failed, [], 'baked dates for every second of a leap day');
+}
+
+# Absolute HTTP dates are normalized; anything else is used verbatim.
+sub test_bake_date_http {
+    my @tests = (
+        [ 'Sun, 06 Nov 1994 08:49:37 GMT', 'Sun, 06-Nov-1994 08:49:37 GMT', 784111777 ],
+        [ 'Sunday, 06-Nov-94 08:49:37 GMT', 'Sun, 06-Nov-1994 08:49:37 GMT', 784111777 ],
+        [ 'Sun Nov  6 08:49:37 1994', 'Sun, 06-Nov-1994 08:49:37 GMT', 784111777 ],
+        [ 'Sun, 06-Nov-1994 08:49:37 GMT', 'Sun, 06-Nov-1994 08:49:37 GMT', 784111777 ],
+        [ 'Wed, 18-Sep-2016 22:33:44 GMT', 'Sun, 18-Sep-2016 22:33:44 GMT', 1474238024 ],
+        [ 'Sun, 31 Feb 1994 08:49:37 GMT', 'Sun, 31 Feb 1994 08:49:37 GMT', undef ],
+        [ 'next tuesday', 'next tuesday', undef ],
+    );
+    for my $test (@tests) {
+        is(baked_date($test->[0]), $test->[1], "baked HTTP date [$test->[0]]");
+        is(parse_http_date($test->[0]), $test->[2], "parsed HTTP date [$test->[0]]");
+    }
+    is(parse_http_date(undef), undef, 'parsed undef HTTP date');
+    is(parse_http_date(''), undef, 'parsed empty HTTP date');
+    is(parse_http_date('1452449969'), undef, 'parsed epoch as HTTP date');
+}
+
+# Parsing the dates we bake gives back the same epoch.
+sub test_parse_date_every_day {
+    my $last = 4133980799;
+    my @failed;
+    for (my $day = 0; $day * 86400 <= $last; ++$day) {
+        my $epoch = $day * 86400 + ($day * 7919) % 86400;
+        my $parsed = parse_http_date(expected_date($epoch));
+        push @failed, $epoch if !defined($parsed) || $parsed != $epoch;
+    }
+    is_deeply(\@failed, [], 'parsed dates for every day from 1970 to 2100');
+}
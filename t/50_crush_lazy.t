@@ -0,0 +1,82 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie crush_cookie_lazy];
+
+exit main();
+
+sub main {
+    test_lazy_same_as_crush();
+    test_lazy_fetch();
+    test_lazy_read_only();
+
+    done_testing();
+    return 0;
+}
+
+sub test_lazy_same_as_crush {
+    my $longkey = 'x'x1024;
+
+    my @tests = (
+        [ 't00', 'Foo=Bar; Bar=Baz; XXX=Foo%20Bar; YYY=0; YYY=3' ],
+        [ 't01', 'Foo=Bar; Bar=Baz;  XXX=Foo%20Bar   ; YYY=0; YYY=3;   ' ],
+        [ 't02', 'Foo=Bar; XXX=Foo%20Bar   ; YYY=; ' ],
+        [ 't03', "Foo=Bar; $longkey=Bar; Bar=Baz" ],
+        [ 't04', 'product_data=blah; HttpOnly; Expires=Mon, 30-Oct-2017 19:02:53 GMT' ],
+        [ 't05', 'foo=bar%26baz; Secure' ],
+        [ 't06', 'cookie.a=foo=bar; cookie.b=1234abcd; HttpOnly; no.value.cookie; Secure' ],
+        [ 't07', 'a; a=1; b=2; b; c=%41%42  %43  ; d=&x&&y&' ],
+        [ 't08', '%41%42=1; AB=2; =3; x=4' ],
+        [ 't09', join('; ', map { "c$_=" . ('v' x $_) } 1..40) ],
+        [ 't10', '' ],
+        [ 't11', undef ],
+    );
+
+    for my $test (@tests) {
+        for my $allow (0, 1) {
+            is_deeply(crush_cookie_lazy($test->[1], $allow),
+                      crush_cookie($test->[1], $allow),
+                      "$test->[0] - lazy crush same as crush, allow is $allow");
+        }
+    }
+}
+
+sub test_lazy_fetch {
+    my $cookie = 'session=abc%20def; csrf=1234; list=a&b; flag';
+    my $lazy = crush_cookie_lazy($cookie, 1);
+
+    is($lazy->{session}, 'abc def', 'fetched decoded value');
+    is($lazy->{session}, 'abc def', 'fetched decoded value again');
+    is($lazy->{csrf}, '1234', 'fetched plain value');
+    is_deeply($lazy->{list}, [qw/a b/], 'fetched multiple values');
+    ok(exists($lazy->{flag}), 'name with no value exists');
+    ok(!defined($lazy->{flag}), 'name with no value is undef');
+    ok(!exists($lazy->{missing}), 'missing name does not exist');
+    ok(!defined($lazy->{missing}), 'missing name is undef');
+    is_deeply([sort keys %$lazy], [qw/csrf flag list session/], 'got all names');
+    ok(scalar(%$lazy), 'hash is true when it has names');
+    ok(!scalar(%{ crush_cookie_lazy('') }), 'hash is false when empty');
+
+    my $repeated = crush_cookie_lazy('a=1; b=2; a=3; a=4; b=5; c=6');
+    is(scalar(%$repeated), 3, 'repeated names are counted once');
+    is(scalar(%$repeated), scalar(keys %$repeated), 'scalar agrees with keys');
+
+    my $many = crush_cookie_lazy(join('; ', map { "n" . ($_ % 50) . "=$_" } 1..300));
+    is(scalar(%$many), 50, 'repeated names are counted once in a long cookie');
+    is_deeply([ sort keys %$many ], [ sort map { "n$_" } 0..49 ],
+              'repeated names are listed once in a long cookie');
+    is($many->{n7}, 7, 'first value kept in a long cookie');
+
+    $cookie = 'changed=1';
+    is($lazy->{csrf}, '1234', 'values survive changes to original string');
+}
+
+sub test_lazy_read_only {
+    my $lazy = crush_cookie_lazy('foo=bar');
+
+    ok(!eval { $lazy->{foo} = 'baz'; 1 }, 'cannot store a value');
+    ok(!eval { delete $lazy->{foo}; 1 }, 'cannot delete a value');
+    ok(!eval { %$lazy = (); 1 }, 'cannot clear the hash');
+    is($lazy->{foo}, 'bar', 'value is unchanged');
+}
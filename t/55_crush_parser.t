@@ -0,0 +1,94 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie];
+
+exit main();
+
+sub main {
+    test_parser();
+    test_parser_split_escape();
+    test_parser_random();
+
+    done_testing();
+    return 0;
+}
+
+sub feed_chunks {
+    my ($parser, @chunks) = @_;
+    my @pairs;
+    push @pairs, $parser->feed($_) for @chunks;
+    push @pairs, $parser->finish();
+    return \@pairs;
+}
+
+sub test_parser {
+    my $parser = HTTP::XSCookies::Parser->new();
+    isa_ok($parser, 'HTTP::XSCookies::Parser');
+
+    is_deeply([ $parser->feed('foo=bar; se') ], [ foo => 'bar' ], 'got first pair');
+    is_deeply([ $parser->feed('ssion=abc%20') ], [], 'no pair yet');
+    is_deeply([ $parser->feed('def; list=a&b; foo=baz') ], [ session => 'abc def', list => [qw/a b/] ],
+              'got next pairs');
+    is_deeply([ $parser->finish() ], [], 'repeated name not returned');
+    is_deeply($parser->crushed(), { foo => 'bar', session => 'abc def', list => [qw/a b/] },
+              'crushed all pairs');
+    is_deeply([ $parser->feed('more=1') ], [], 'nothing after finish');
+
+    $parser->reset();
+    is_deeply(feed_chunks($parser, 'flag; x=', '1'), [ x => 1 ], 'reused after reset');
+    is_deeply($parser->crushed(), { x => 1 }, 'crushed after reset');
+
+    my $lists = HTTP::XSCookies::Parser->new();
+    my %pairs = $lists->feed('list=a&b;');
+    push @{ $pairs{list} }, 'c';
+    is_deeply($lists->crushed(), { list => [qw/a b/] }, 'returned pairs have their own arrays');
+
+    my $allow = HTTP::XSCookies::Parser->new(1);
+    is_deeply(feed_chunks($allow, 'flag; x', '=1'), [ flag => undef, x => 1 ], 'allowing no value');
+
+    my $str = 'a=1; b=2';
+    my $chunked = HTTP::XSCookies::Parser->new();
+    is_deeply(feed_chunks($chunked, substr($str, 0, 5), substr($str, 5)), [ a => 1, b => 2 ],
+              'fed substr chunks');
+
+    my $empty = HTTP::XSCookies::Parser->new();
+    is_deeply(feed_chunks($empty, '', undef, ''), [], 'empty chunks');
+    is_deeply($empty->crushed(), {}, 'crushed empty cookie');
+}
+
+sub test_parser_split_escape {
+    my $cookie = 'n%41me=%2%4x%41%%4142 ; m=%4';
+    my $expected = crush_cookie($cookie);
+    for my $pos (0..length($cookie)) {
+        for my $len (1..3) {
+            next if $pos + $len > length($cookie);
+            my $parser = HTTP::XSCookies::Parser->new();
+            my @chunks = (substr($cookie, 0, $pos), substr($cookie, $pos, $len), substr($cookie, $pos + $len));
+            feed_chunks($parser, @chunks);
+            is_deeply($parser->crushed(), $expected, "escapes split at $pos, length $len");
+        }
+    }
+}
+
+sub test_parser_random {
+    my @chars = ('a'..'c', '%', '%4', '%41', '=', ';', '; ', ' ', "\t", '&', "\x{e9}", 'plain' x 4);
+    srand(20160130);
+    for my $iter (1..300) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(100)));
+        my @chunks;
+        for (my $pos = 0; $pos < length($str); ) {
+            my $len = 1 + int(rand(8));
+            push @chunks, substr($str, $pos, $len);
+            $pos += $len;
+        }
+        for my $allow (0, 1) {
+            my $parser = HTTP::XSCookies::Parser->new($allow);
+            my %pairs = @{ feed_chunks($parser, @chunks) };
+            my $expected = crush_cookie($str, $allow);
+            is_deeply($parser->crushed(), $expected, "parsed random cookie $iter in chunks, allow is $allow");
+            is_deeply(\%pairs, $expected, "returned pairs for random cookie $iter, allow is $allow");
+        }
+    }
+}
@@ -0,0 +1,52 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie crush_cookies];
+
+exit main();
+
+sub main {
+    test_crush_cookies();
+    test_crush_cookies_random();
+
+    done_testing();
+    return 0;
+}
+
+sub test_crush_cookies {
+    my @cookies = (
+        'foo=bar; path=/',
+        '',
+        undef,
+        'flag; session=abc%20def; list=a&b',
+        'whv=MtW_XszVxqHnN6rHsX0d; expires=Wed, 07 Jan 2026 11:10:40 GMT; domain=.wikihow.com; path=',
+    );
+    for my $allow (0, 1) {
+        is_deeply(crush_cookies(\@cookies, $allow),
+                  [ map { crush_cookie($_, $allow) } @cookies ],
+                  "crushed several cookies, allow is $allow");
+    }
+
+    my $set = HTTP::XSCookies::NameSet->new(qw/foo session/);
+    is_deeply(crush_cookies(\@cookies, 0, $set),
+              [ map { crush_cookie($_, 0, $set) } @cookies ],
+              'crushed several cookies with a filter');
+
+    is_deeply(crush_cookies([]), [], 'crushed no cookies');
+    is_deeply(crush_cookies([ 'a=1', 'a=2' ]), [ { a => 1 }, { a => 2 } ], 'results are independent');
+
+    ok(!eval { crush_cookies('foo=bar'); 1 }, 'cookies must be an arrayref');
+    like($@, qr/must be an arrayref/, 'got the right error');
+}
+
+sub test_crush_cookies_random {
+    my @chars = ('a'..'c', '%41', '%3b', '=', ';', '; ', ' ', '&', 'plain' x 20);
+    srand(20160129);
+    my @cookies = map { join('', map { $chars[int(rand(@chars))] } 1..int(rand(200))) } 1..300;
+    for my $allow (0, 1) {
+        is_deeply(crush_cookies(\@cookies, $allow),
+                  [ map { crush_cookie($_, $allow) } @cookies ],
+                  "crushed random cookies, allow is $allow");
+    }
+}
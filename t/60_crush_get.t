@@ -0,0 +1,49 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie crush_cookie_get];
+
+exit main();
+
+sub main {
+    test_get();
+    test_get_same_as_crush();
+
+    done_testing();
+    return 0;
+}
+
+sub test_get {
+    my $cookie = 'flag; session=abc%20def; csrf=1234; list=a&b; csrf=5678; flag=1';
+
+    my @tests = (
+        [ 't00', 'session', 'abc def' ],
+        [ 't01', 'csrf', '1234' ],
+        [ 't02', 'list', [qw/a b/] ],
+        [ 't03', 'flag', '1' ],
+        [ 't04', 'missing', undef ],
+        [ 't05', 'sess', undef ],
+        [ 't06', '', undef ],
+        [ 't07', undef, undef ],
+    );
+    for my $test (@tests) {
+        is_deeply(crush_cookie_get($cookie, $test->[1]), $test->[2], $test->[0]);
+    }
+
+    is(crush_cookie_get('', 'foo'), undef, 'empty cookie');
+    is(crush_cookie_get(undef, 'foo'), undef, 'undef cookie');
+}
+
+sub test_get_same_as_crush {
+    my @chars = ('a'..'c', '%41', '%3b', '=', ';', '; ', ' ', '&', 'plain');
+    srand(20160126);
+    for my $iter (1..200) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(100)));
+        my $crushed = crush_cookie($str);
+        for my $name (sort keys %$crushed) {
+            is_deeply(crush_cookie_get($str, $name), $crushed->{$name},
+                      "got same value as crush for random cookie $iter, name '$name'");
+        }
+    }
+}
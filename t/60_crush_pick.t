@@ -0,0 +1,52 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie crush_cookie_pick];
+
+exit main();
+
+sub main {
+    test_pick();
+    test_pick_same_as_crush();
+
+    done_testing();
+    return 0;
+}
+
+sub test_pick {
+    my $cookie = 'flag; session=abc%20def; csrf=1234; list=a&b; csrf=5678; flag=1';
+
+    my @tests = (
+        [ 't00', [qw/session csrf/], [ 'abc def', '1234' ] ],
+        [ 't01', [qw/csrf session/], [ '1234', 'abc def' ] ],
+        [ 't02', [qw/list flag missing/], [ [qw/a b/], '1', undef ] ],
+        [ 't03', [qw/csrf csrf/], [ '1234', '1234' ] ],
+        [ 't04', [ undef, '', 'csrf' ], [ undef, undef, '1234' ] ],
+        [ 't05', [], [] ],
+        [ 't06', [ (map { "n$_" } 1..40), 'csrf' ], [ (undef) x 40, '1234' ] ],
+    );
+    for my $test (@tests) {
+        is_deeply([ crush_cookie_pick($cookie, @{ $test->[1] }) ], $test->[2], $test->[0]);
+    }
+
+    is_deeply([ crush_cookie_pick('', qw/a b/) ], [ undef, undef ], 'empty cookie');
+    is_deeply([ crush_cookie_pick(undef, qw/a b/) ], [ undef, undef ], 'undef cookie');
+
+    my ($first, $second) = crush_cookie_pick('a=1&2', 'a', 'a');
+    is_deeply([ $first, $second ], [ [1, 2], [1, 2] ], 'repeated name with several values');
+    push @$first, 3;
+    is_deeply($second, [1, 2], 'repeated name gets its own array');
+}
+
+sub test_pick_same_as_crush {
+    my @chars = ('a'..'c', '%41', '%3b', '=', ';', '; ', ' ', '&', 'plain');
+    srand(20160127);
+    for my $iter (1..200) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(100)));
+        my $crushed = crush_cookie($str);
+        my @names = ((sort keys %$crushed), 'missing');
+        is_deeply([ crush_cookie_pick($str, reverse @names) ], [ @$crushed{reverse @names} ],
+                  "picked same values as crush for random cookie $iter");
+    }
+}
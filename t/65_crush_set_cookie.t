@@ -0,0 +1,163 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[bake_cookie crush_set_cookie];
+
+exit main();
+
+sub main {
+    test_crush_set_cookie();
+    test_crush_max_age();
+    test_crush_dates();
+    test_crush_round_trip();
+
+    done_testing();
+    return 0;
+}
+
+sub test_crush_set_cookie {
+    my @tests = (
+        [ undef, undef ],
+        [ '', undef ],
+        [ 'Secure', undef ],
+        [ '=value; Path=/', undef ],
+        [ 'foo=bar', { name => 'foo', value => 'bar' } ],
+        [ 'foo=', { name => 'foo', value => '' } ],
+        [ 'foo=b%20r&baz', { name => 'foo', value => [ 'b r', 'baz' ] } ],
+        [ 'foo=bar; Domain=.example.com; Path=/some/path; Max-Age=3600; ' .
+          'Expires=Sun, 06 Nov 1994 08:49:37 GMT; Secure; HttpOnly; SameSite=Lax',
+          { name => 'foo', value => 'bar', Domain => '.example.com',
+            Path => '/some/path', 'Max-Age' => 3600, Expires => 784111777,
+            Secure => 1, HttpOnly => 1, SameSite => 'Lax' } ],
+        [ 'foo=bar; domain=.example.com; PATH=/; max-age=10; secure; httponly; samesite=Strict',
+          { name => 'foo', value => 'bar', Domain => '.example.com',
+            Path => '/', 'Max-Age' => 10, Secure => 1, HttpOnly => 1,
+            SameSite => 'Strict' } ],
+        [ 'foo=bar; Secure=yes; HttpOnly=0',
+          { name => 'foo', value => 'bar', Secure => 1, HttpOnly => 1 } ],
+        [ 'foo=bar; Max-Age=-1', { name => 'foo', value => 'bar', 'Max-Age' => -1 } ],
+        [ 'foo=bar; Max-Age=10s', { name => 'foo', value => 'bar' } ],
+        [ 'foo=bar; Max-Age=', { name => 'foo', value => 'bar' } ],
+        [ 'foo=bar; Max-Age', { name => 'foo', value => 'bar' } ],
+        [ 'foo=bar; Expires=tomorrow', { name => 'foo', value => 'bar' } ],
+        [ 'foo=bar; Path=/a; Path=/b', { name => 'foo', value => 'bar', Path => '/b' } ],
+        [ 'foo=bar; Comment=yummy; Partitioned', { name => 'foo', value => 'bar' } ],
+        [ 'foo=bar;Path=/ ;  Domain=x.com  ',
+          { name => 'foo', value => 'bar', Path => '/', Domain => 'x.com' } ],
+        # attributes are taken literally, only the value is URL-decoded
+        [ 'foo=b%21r; %53ecure; Http%4Fnly; Path=/x%2Fy',
+          { name => 'foo', value => 'b!r', Path => '/x%2Fy' } ],
+        [ 'foo=bar; Domain=ex%61mple.com; SameSite=L%61x; Max-Age=1%30',
+          { name => 'foo', value => 'bar', Domain => 'ex%61mple.com', SameSite => 'L%61x' } ],
+        [ 'foo=bar; Path=/a=b c;;; Secure',
+          { name => 'foo', value => 'bar', Path => '/a=b c', Secure => 1 } ],
+        [ "foo=bar;\tPath\t=\t/\t", { name => 'foo', value => 'bar', Path => '/' } ],
+    );
+
+    for my $test (@tests) {
+        my $label = defined($test->[0]) ? $test->[0] : 'undef';
+        is_deeply(crush_set_cookie($test->[0]), $test->[1],
+                  "crushed Set-Cookie [$label]");
+    }
+}
+
+# Max-Age values too large for an integer are clamped.
+sub test_crush_max_age {
+    my $max = ~0 >> 1;
+    my @tests = (
+        [ "$max", $max ],
+        [ "-$max", -$max ],
+        [ '0' x 30 . '42', 42 ],
+        [ '99999999999999999999999', $max ],
+        [ '-99999999999999999999999', -$max ],
+    );
+    # one below, at and one above the largest integer, and ten times it
+    (my $below = $max) =~ s/7$/6/;
+    (my $above = $max) =~ s/7$/8/;
+    push @tests, [ $below, $below ], [ $above, $max ], [ $max . '0', $max ];
+
+    for my $test (@tests) {
+        my ($age, $expected) = @$test;
+        is(crush_set_cookie("foo=bar; Max-Age=$age")->{'Max-Age'}, $expected,
+           "Max-Age [$age]");
+    }
+}
+
+sub test_crush_dates {
+    my @tests = (
+        [ 'Sun, 06 Nov 1994 08:49:37 GMT', 784111777 ],
+        [ 'Sunday, 06-Nov-94 08:49:37 GMT', 784111777 ],
+        [ 'Sun Nov  6 08:49:37 1994', 784111777 ],
+        [ 'Sun, 06-Nov-1994 08:49:37 GMT', 784111777 ],
+        [ 'sun, 06 NOV 1994 08:49:37 UTC', 784111777 ],
+        [ 'Thu, 01 Jan 1970 00:00:00 GMT', 0 ],
+        [ 'Wed, 31 Dec 1969 23:59:59 GMT', -1 ],
+        [ 'Thursday, 01-Jan-70 00:00:00 GMT', 0 ],
+        [ 'Tuesday, 19-Jan-38 03:14:08 GMT', 2147483648 ],
+        [ 'Thu, 29 Feb 2024 12:00:00 GMT', 1709208000 ],
+        [ 'Fri, 31 Dec 9999 23:59:59 GMT', 253402300799 ],
+        [ 'Tue, 29 Feb 2100 12:00:00 GMT', undef ],
+        [ 'Sun, 31 Apr 1994 08:49:37 GMT', undef ],
+        [ 'Sun, 06 Nov 1994 24:00:00 GMT', undef ],
+        [ 'Sun, 06 Nov 1994 08:60:00 GMT', undef ],
+        [ 'Sun, 06 Nov 1994 8:49:37 GMT', undef ],
+        [ 'Sun, 06 Nox 1994 08:49:37 GMT', undef ],
+        [ 'Sun, 06 Nov 994 08:49:37 GMT', undef ],
+        [ 'Sun, 06-Nov 1994 08:49:37 GMT', undef ],
+        [ 'Sun, 06 Nov 1994 08:49:37 GMT junk', undef ],
+        [ 'Sun Nov  6 08:49:37 94', undef ],
+        [ '784111777', undef ],
+    );
+
+    for my $test (@tests) {
+        my $crushed = crush_set_cookie("foo=bar; Expires=$test->[0]");
+        is($crushed->{Expires}, $test->[1], "parsed Expires date [$test->[0]]");
+    }
+
+    # compare with gmtime() for random dates in all three formats
+    my @days = qw/Sun Mon Tue Wed Thu Fri Sat/;
+    my @months = qw/Jan Feb Mar Apr May Jun Jul Aug Sep Oct Nov Dec/;
+    srand(20261017);
+    for my $iter (1..200) {
+        my $epoch = int(rand(2**31));
+        my ($s, $m, $h, $md, $mo, $y, $wd) = gmtime($epoch);
+        my @dates = (
+            sprintf('%s, %02d %s %04d %02d:%02d:%02d GMT',
+                    $days[$wd], $md, $months[$mo], $y + 1900, $h, $m, $s),
+            sprintf('%sday, %02d-%s-%02d %02d:%02d:%02d GMT',
+                    $days[$wd], $md, $months[$mo], $y % 100, $h, $m, $s),
+            sprintf('%s %s %2d %02d:%02d:%02d %04d',
+                    $days[$wd], $months[$mo], $md, $h, $m, $s, $y + 1900),
+        );
+        for my $date (@dates) {
+            my $crushed = crush_set_cookie("foo=bar; Expires=$date");
+            is($crushed->{Expires}, $epoch, "parsed Expires date [$date]");
+        }
+    }
+}
+
+sub test_crush_round_trip {
+    my $attributes = {
+        value      => 'some value',
+        domain     => '.example.com',
+        path       => '/',
+        expires    => 1452449969,
+        'max-age'  => 300,
+        secure     => 1,
+        httponly   => 1,
+        samesite   => 'None',
+    };
+    my $baked = bake_cookie('round trip', $attributes);
+    is_deeply(crush_set_cookie($baked), {
+        name       => 'round trip',
+        value      => 'some value',
+        Domain     => '.example.com',
+        Path       => '/',
+        Expires    => 1452449969,
+        'Max-Age'  => 300,
+        Secure     => 1,
+        HttpOnly   => 1,
+        SameSite   => 'None',
+    }, "crushed baked cookie [$baked]");
+}
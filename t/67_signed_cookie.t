@@ -0,0 +1,152 @@
+use strict;
+use warnings;
+
+use Test::More;
+use MIME::Base64 qw[decode_base64];
+use Digest::SHA qw[hmac_sha256];
+use HTTP::XSCookies qw[
+    bake_signed_cookie
+    verify_signed_cookie
+    crush_cookie
+];
+
+exit main();
+
+sub main {
+    test_rfc4231();
+    test_digest_sha();
+    test_verify();
+    test_bake_spec();
+
+    done_testing();
+    return 0;
+}
+
+# Get the HMAC, as raw bytes, from the value in a signed cookie.
+sub get_mac {
+    my ($cookie) = @_;
+    my $value = crush_cookie($cookie)->{n};
+    $value = join('&', @$value) if ref($value);
+    my ($sig) = $value =~ m/\.([A-Za-z0-9_-]+)\z/;
+    return undef unless defined($sig);
+    $sig =~ tr{-_}{+/};
+    return decode_base64($sig . '=');
+}
+
+# The keys and data from the RFC 4231 test cases.  The signature is the
+# HMAC of the name, a zero byte and the value, so the HMACs in the RFC do
+# not apply; check against Digest::SHA instead.
+sub test_rfc4231 {
+    my @tests = (
+        [ 1, "\x0b" x 20, 'Hi There' ],
+        [ 2, 'Jefe', 'what do ya want for nothing?' ],
+        [ 3, "\xaa" x 20, "\xdd" x 50 ],
+        [ 4, pack('H*', '0102030405060708090a0b0c0d0e0f10111213141516171819'), "\xcd" x 50 ],
+        [ 5, "\x0c" x 20, 'Test With Truncation' ],
+        [ 6, "\xaa" x 131, 'Test Using Larger Than Block-Size Key - Hash Key First' ],
+        [ 7, "\xaa" x 131,
+          'This is a test using a larger than block-size key and a larger ' .
+          'than block-size data. The key needs to be hashed before being ' .
+          'used by the HMAC algorithm.' ],
+    );
+    foreach my $test (@tests) {
+        my ($case, $key, $data) = @$test;
+        my $cookie = bake_signed_cookie('n', $data, $key);
+        is(get_mac($cookie), hmac_sha256("n\x00$data", $key), "RFC 4231 test case $case");
+        isnt(get_mac($cookie), hmac_sha256($data, $key), "RFC 4231 test case $case signs the name");
+        is(verify_signed_cookie('n', crush_cookie($cookie)->{n}, $key), $data,
+           "RFC 4231 test case $case verifies");
+    }
+}
+
+# Data and keys of all lengths around the SHA-256 block size.
+sub test_digest_sha {
+    my @failed;
+    foreach my $dlen (0..200) {
+        my $data = join('', map { chr(($_ * 7 + $dlen) % 256) } 1..$dlen);
+        foreach my $klen (1, 31, 32, 63, 64, 65, 100) {
+            my $key = substr('k' x 50 . "\x00\xff" x 50, 0, $klen);
+            my $cookie = bake_signed_cookie('n', $data, $key);
+            push @failed, "$dlen/$klen"
+                if get_mac($cookie) ne hmac_sha256("n\x00$data", $key);
+        }
+    }
+    is_deeply(\@failed, [], 'same HMAC as Digest::SHA for all lengths');
+}
+
+sub test_verify {
+    my $key = 'secret';
+    my $value = crush_cookie(bake_signed_cookie('n', 'user=42.admin', $key))->{n};
+    is(verify_signed_cookie('n', $value, $key), 'user=42.admin', 'value with dots verifies');
+    is(verify_signed_cookie('n', $value, 'secreT'), undef, 'wrong key');
+    is(verify_signed_cookie('m', $value, $key), undef, 'wrong name');
+    is(verify_signed_cookie('n ', $value, $key), undef, 'longer name');
+    is(verify_signed_cookie(undef, $value, $key), undef, 'undef name');
+
+    # a value signed for one cookie cannot be replayed as another one
+    my $admin = crush_cookie(bake_signed_cookie('is_admin', '1', $key))->{is_admin};
+    my $count = crush_cookie(bake_signed_cookie('cart_count', '1', $key))->{cart_count};
+    isnt($admin, $count, 'same value signed differently for each name');
+    is(verify_signed_cookie('is_admin', $admin, $key), '1', 'value verifies for its name');
+    is(verify_signed_cookie('is_admin', $count, $key), undef, 'value for another name does not verify');
+
+    my $changed = $value;
+    substr($changed, 5, 1) = '9';
+    is(verify_signed_cookie('n', $changed, $key), undef, 'changed value');
+
+    foreach my $pos (-1, -43, -44) {
+        my $broken = $value;
+        my $char = substr($broken, $pos, 1);
+        substr($broken, $pos, 1) = $char eq 'A' ? 'B' : 'A';
+        is(verify_signed_cookie('n', $broken, $key), undef, "changed signature at $pos");
+    }
+
+    is(verify_signed_cookie('n', 'user=42.admin', $key), undef, 'no signature');
+    is(verify_signed_cookie('n', substr($value, 1), $key), undef, 'truncated value');
+    is(verify_signed_cookie('n', $value . 'x', $key), undef, 'longer signature');
+    is(verify_signed_cookie('n', '', $key), undef, 'empty string');
+    is(verify_signed_cookie('n', undef, $key), undef, 'undef');
+    is(verify_signed_cookie('n', {}, $key), undef, 'hashref');
+
+    # the last key is kept prepared, make sure switching keys works
+    my %signed = map { $_ => crush_cookie(bake_signed_cookie('n', 'v', $_))->{n} }
+                 ('key1', 'key2', 'x' x 100);
+    foreach my $k ('key1', 'x' x 100, 'key2', 'key1', 'key2') {
+        my $other = $k eq 'key1' ? 'key2' : 'key1';
+        is(verify_signed_cookie('n', $signed{$k}, $k), 'v', 'verifies after switching keys');
+        is(verify_signed_cookie('n', $signed{$k}, $other), undef, 'other key does not verify');
+    }
+
+    my $empty = crush_cookie(bake_signed_cookie('n', '', $key))->{n};
+    is(verify_signed_cookie('n', $empty, $key), '', 'empty value verifies');
+
+    foreach my $bad (undef, '') {
+        ok(!eval { bake_signed_cookie('n', 'v', $bad); 1 }, 'bake with no key dies');
+        like($@, qr/Key for bake_signed_cookie/, 'got error for bake with no key');
+        ok(!eval { verify_signed_cookie('n', $value, $bad); 1 }, 'verify with no key dies');
+        like($@, qr/Key for verify_signed_cookie/, 'got error for verify with no key');
+    }
+}
+
+sub test_bake_spec {
+    my $key = 'secret';
+    my $cookie = bake_signed_cookie('session', {
+        value    => 'id 42',
+        path     => '/',
+        httponly => 1,
+    }, $key);
+    like($cookie, qr/^session=id%2042\.[A-Za-z0-9_-]{43}; /, 'value is encoded and signed');
+    like($cookie, qr/; Path=\//, 'got path');
+    like($cookie, qr/; HttpOnly/, 'got HttpOnly');
+    is(verify_signed_cookie('session', crush_cookie($cookie)->{session}, $key), 'id 42',
+       'hashref spec verifies');
+
+    my $multi = bake_signed_cookie('n', { value => [ 'a', 'b c' ] }, $key);
+    my $crushed = crush_cookie($multi)->{n};
+    is(ref($crushed), 'ARRAY', 'multiple values are crushed into an array');
+    is_deeply(verify_signed_cookie('n', $crushed, $key), [ 'a', 'b c' ],
+              'multiple values verify');
+    is(scalar(@$crushed), 2, 'array is not changed when verifying');
+
+    is(bake_signed_cookie('n', undef, $key), '', 'undef value bakes nothing');
+}
@@ -0,0 +1,248 @@
+use strict;
+use warnings;
+
+use Test::More;
+use MIME::Base64 qw[decode_base64];
+use HTTP::XSCookies qw[
+    bake_sealed_cookie
+    open_sealed_cookie
+    crush_cookie
+];
+
+# plain text used in RFC 8439
+my $sunscreen =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only " .
+    "one tip for the future, sunscreen would be it.";
+
+exit main();
+
+sub main {
+    test_rfc8439_chacha20();
+    test_rfc8439_poly1305();
+    test_rfc8439_aead();
+    test_round_trip();
+    test_open();
+    test_nonces();
+    test_bake_spec();
+
+    done_testing();
+    return 0;
+}
+
+# Turn hex, which can have spaces, into bytes.
+sub bytes {
+    my ($hex) = @_;
+    $hex =~ s/\s+//g;
+    return pack('H*', $hex);
+}
+
+# Get the raw bytes from the value in a sealed cookie.
+sub get_raw {
+    my ($cookie) = @_;
+    my $value = crush_cookie($cookie)->{n};
+    $value =~ tr{-_}{+/};
+    return decode_base64($value . '=' x (-length($value) % 4));
+}
+
+sub test_rfc8439_chacha20 {
+    # section 2.4.2
+    my $key = bytes(join('', map { sprintf('%02x', $_) } 0..31));
+    my $nonce = bytes('000000000000004a00000000');
+    my $expected = bytes(
+        '6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b' .
+        'f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8' .
+        '07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736' .
+        '5af90bbf74a35be6b40b8eedf2785e42874d');
+    my $encrypted = HTTP::XSCookies::_chacha20($key, 1, $nonce, $sunscreen);
+    is(unpack('H*', $encrypted), unpack('H*', $expected), 'RFC 8439 2.4.2 encryption');
+    is(HTTP::XSCookies::_chacha20($key, 1, $nonce, $encrypted), $sunscreen,
+       'RFC 8439 2.4.2 decryption');
+
+    # appendix A.1, test vectors 1 and 2 (key stream for zero key and nonce)
+    my $zero = "\x00" x 32;
+    my $znonce = "\x00" x 12;
+    is(unpack('H*', HTTP::XSCookies::_chacha20($zero, 0, $znonce, "\x00" x 64)),
+       '76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7' .
+       'da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586',
+       'RFC 8439 A.1 test vector 1');
+    is(unpack('H*', HTTP::XSCookies::_chacha20($zero, 1, $znonce, "\x00" x 64)),
+       '9f07e7be5551387a98ba977c732d080dcb0f29a048e3656912c6533e32ee7aed' .
+       '29b721769ce64e43d57133b074d839d531ed1f28510afb45ace10a1f4b794d6f',
+       'RFC 8439 A.1 test vector 2');
+}
+
+sub test_rfc8439_poly1305 {
+    my $r1 = '01' . '00' x 15;
+    my $r2 = '02' . '00' x 15;
+    my $s0 = '00' x 16;
+    my @tests = (
+        # section 2.5.2
+        [ '2.5.2',
+          '85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b',
+          unpack('H*', 'Cryptographic Forum Research Group'),
+          'a8061dc1305136c6c22b8baf0c0127a9' ],
+        # appendix A.3, test vectors that exercise the final reduction
+        [ 'A.3 #1', '00' x 32, '00' x 64, '00' x 16 ],
+        [ 'A.3 #5', $r2 . $s0, 'ff' x 16, '03' . '00' x 15 ],
+        [ 'A.3 #6', $r2 . 'ff' x 16, '02' . '00' x 15, '03' . '00' x 15 ],
+        [ 'A.3 #7', $r1 . $s0,
+          'ff' x 16 . 'f0' . 'ff' x 15 . '11' . '00' x 15,
+          '05' . '00' x 15 ],
+        [ 'A.3 #8', $r1 . $s0,
+          'ff' x 16 . 'fb' . 'fe' x 15 . '01' x 16,
+          '00' x 16 ],
+        [ 'A.3 #9', $r2 . $s0, 'fd' . 'ff' x 15, 'fa' . 'ff' x 15 ],
+    );
+    foreach my $test (@tests) {
+        my ($name, $key, $msg, $expected) = @$test;
+        my $tag = HTTP::XSCookies::_poly1305(bytes($key), bytes($msg));
+        is(unpack('H*', $tag), $expected, "RFC 8439 $name Poly1305");
+    }
+}
+
+sub test_rfc8439_aead {
+    # section 2.8.2
+    my $key = bytes(join('', map { sprintf('%02x', $_) } 0x80..0x9f));
+    my $nonce = bytes('070000004041424344454647');
+    my $aad = bytes('50515253c0c1c2c3c4c5c6c7');
+    my $expected = bytes(
+        'd31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6' .
+        '3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36' .
+        '92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc' .
+        '3ff4def08e4b7a9de576d26586cec64b6116' .
+        '1ae10b594f09e26a7e902ecbd0600691');
+    my $sealed = HTTP::XSCookies::_aead_seal($key, $nonce, $aad, $sunscreen);
+    is(unpack('H*', $sealed), unpack('H*', $expected), 'RFC 8439 2.8.2 seal');
+    is(HTTP::XSCookies::_aead_open($key, $nonce, $aad, $sealed), $sunscreen,
+       'RFC 8439 2.8.2 open');
+
+    my @failed;
+    foreach my $pos (0, 57, length($sealed) - 17, length($sealed) - 1) {
+        my $broken = $sealed;
+        substr($broken, $pos, 1) ^= "\x01";
+        push @failed, $pos
+            if defined(HTTP::XSCookies::_aead_open($key, $nonce, $aad, $broken));
+    }
+    is_deeply(\@failed, [], 'RFC 8439 2.8.2 does not open when changed');
+    is(HTTP::XSCookies::_aead_open($key, $nonce, 'x' . $aad, $sealed), undef,
+       'RFC 8439 2.8.2 does not open with other data');
+    is(HTTP::XSCookies::_aead_open($key, $nonce, $aad, 'short'), undef,
+       'RFC 8439 2.8.2 does not open shorter than a tag');
+}
+
+# Values of all lengths around the ChaCha20 and Poly1305 block sizes.
+sub test_round_trip {
+    my $key = join('', map { chr($_ * 3) } 1..32);
+    my @failed;
+    foreach my $len (0..200) {
+        my $value = join('', map { chr(33 + ($_ * 7 + $len) % 90) } 1..$len);
+        $value =~ tr/&/x/;
+        my $cookie = bake_sealed_cookie('n', $value, $key);
+        my $raw = get_raw($cookie);
+        my ($nonce, $sealed) = (substr($raw, 0, 12), substr($raw, 12));
+        push @failed, "$len/length" if length($sealed) != $len + 16;
+        push @failed, "$len/aead"
+            if (HTTP::XSCookies::_aead_open($key, $nonce, 'n', $sealed) // '') ne $value;
+        push @failed, "$len/open"
+            if (open_sealed_cookie('n', crush_cookie($cookie)->{n}, $key) // '') ne $value;
+    }
+    is_deeply(\@failed, [], 'values of all lengths open');
+}
+
+sub test_open {
+    my $key = 'k' x 32;
+    my $value = crush_cookie(bake_sealed_cookie('n', 'user=42; admin', $key))->{n};
+    like($value, qr/^[A-Za-z0-9_-]+\z/, 'sealed value is base64url');
+    unlike($value, qr/user/, 'sealed value is not readable');
+    is(open_sealed_cookie('n', $value, $key), 'user=42; admin', 'value opens');
+    is(open_sealed_cookie('n', $value, 'K' . 'k' x 31), undef, 'wrong key');
+    is(open_sealed_cookie('m', $value, $key), undef, 'wrong name');
+    is(open_sealed_cookie('n ', $value, $key), undef, 'longer name');
+    is(open_sealed_cookie(undef, $value, $key), undef, 'undef name');
+
+    # a value sealed for one cookie cannot be replayed as another one
+    my $admin = crush_cookie(bake_sealed_cookie('is_admin', '1', $key))->{is_admin};
+    is(open_sealed_cookie('is_admin', $admin, $key), '1', 'value opens for its name');
+    is(open_sealed_cookie('cart_count', $admin, $key), undef, 'value does not open for another name');
+
+    my @failed;
+    foreach my $pos (0..length($value) - 1) {
+        my $broken = $value;
+        my $char = substr($broken, $pos, 1);
+        substr($broken, $pos, 1) = $char eq 'A' ? 'B' : 'A';
+        push @failed, $pos if defined(open_sealed_cookie('n', $broken, $key));
+    }
+    is_deeply(\@failed, [], 'changing any character does not open');
+
+    is(open_sealed_cookie('n', substr($value, 1), $key), undef, 'truncated value');
+    is(open_sealed_cookie('n', substr($value, 0, -1), $key), undef, 'truncated tag');
+    is(open_sealed_cookie('n', $value . 'A', $key), undef, 'longer value');
+    is(open_sealed_cookie('n', '!' . substr($value, 1), $key), undef, 'not base64url');
+    is(open_sealed_cookie('n', 'A' x 37, $key), undef, 'shorter than nonce and tag');
+    is(open_sealed_cookie('n', '', $key), undef, 'empty string');
+    is(open_sealed_cookie('n', undef, $key), undef, 'undef');
+    is(open_sealed_cookie('n', {}, $key), undef, 'hashref');
+
+    my $empty = crush_cookie(bake_sealed_cookie('n', '', $key))->{n};
+    is(open_sealed_cookie('n', $empty, $key), '', 'empty value opens');
+
+    foreach my $bad (undef, '', 'short', 'k' x 33) {
+        ok(!eval { bake_sealed_cookie('n', 'v', $bad); 1 }, 'bake with bad key dies');
+        like($@, qr/Key for bake_sealed_cookie must be a string of 32 bytes/,
+             'got error for bake with bad key');
+        ok(!eval { open_sealed_cookie('n', $value, $bad); 1 }, 'open with bad key dies');
+        like($@, qr/Key for open_sealed_cookie must be a string of 32 bytes/,
+             'got error for open with bad key');
+    }
+}
+
+sub test_nonces {
+    my $key = 'k' x 32;
+    my %seen;
+    my $count = 1000;
+    foreach (1..$count) {
+        my $raw = get_raw(bake_sealed_cookie('n', 'same', $key));
+        ++$seen{substr($raw, 0, 12)};
+    }
+    is(scalar(keys %seen), $count, 'every value gets its own nonce');
+
+  SKIP: {
+        skip 'no fork on this platform', 1 if $^O eq 'MSWin32';
+        pipe(my $reader, my $writer) or die "Cannot create pipe: $!";
+        my $pid = fork();
+        die "Cannot fork: $!" unless defined($pid);
+        if (!$pid) {
+            close($reader);
+            print $writer unpack('H*', substr(get_raw(bake_sealed_cookie('n', 'same', $key)), 0, 12));
+            close($writer);
+            exit(0);
+        }
+        close($writer);
+        my $child = <$reader>;
+        waitpid($pid, 0);
+        my $parent = unpack('H*', substr(get_raw(bake_sealed_cookie('n', 'same', $key)), 0, 12));
+        isnt($child, $parent, 'forked process gets its own nonces');
+    }
+}
+
+sub test_bake_spec {
+    my $key = 'k' x 32;
+    my $cookie = bake_sealed_cookie('session', {
+        value    => 'id 42',
+        path     => '/',
+        httponly => 1,
+    }, $key);
+    like($cookie, qr/^session=[A-Za-z0-9_-]+; /, 'value is sealed');
+    like($cookie, qr/; Path=\//, 'got path');
+    like($cookie, qr/; HttpOnly/, 'got HttpOnly');
+    is(open_sealed_cookie('session', crush_cookie($cookie)->{session}, $key), 'id 42',
+       'hashref spec opens');
+
+    my $multi = bake_sealed_cookie('n', { value => [ 'a', 'b c' ] }, $key);
+    my $crushed = crush_cookie($multi)->{n};
+    is(ref($crushed), '', 'multiple values are sealed together');
+    is_deeply(open_sealed_cookie('n', $crushed, $key), [ 'a', 'b c' ],
+              'multiple values open');
+
+    is(bake_sealed_cookie('n', undef, $key), '', 'undef value bakes nothing');
+}
@@ -0,0 +1,253 @@
+use strict;
+use warnings;
+
+use Test::More;
+use MIME::Base64 qw[decode_base64 encode_base64url];
+use HTTP::XSCookies qw[
+    bake_cookie
+    bake_cookies
+    bake_signed_cookie
+    verify_signed_cookie
+    bake_sealed_cookie
+    open_sealed_cookie
+    crush_cookie
+    crush_cookies
+    unpack_cookie_value
+    decompress_cookie_value
+    uri_encode
+];
+
+exit main();
+
+sub main {
+    test_round_trip();
+    test_format();
+    test_when();
+    test_crush();
+    test_guarded();
+    test_invalid();
+
+    done_testing();
+    return 0;
+}
+
+# Some values that look like what we put in cookies.
+sub get_values {
+    my @chars = ('A'..'Z', 'a'..'z', '0'..'9');
+    my $random = join('', map { $chars[rand(@chars)] } 1..300);
+    return (
+        [ 'ids',      join(',', map { 1000 + $_ * 7 } 1..200) ],
+        [ 'pairs',    join('&', map { "item_$_=product-" . ($_ % 7) } 1..60) ],
+        [ 'json',     '{"prefs":[' . join(',', map { qq({"id":$_,"on":true,"name":"opt$_"}) } 1..30) . ']}' ],
+        [ 'run',      'a' x 5000 ],
+        [ 'pattern',  'abc' x 1000 ],
+        [ 'binary',   join('', map { chr($_ % 256) } 1..2000) ],
+        [ 'random',   $random ],
+        [ 'short',    'x' x 127 ],
+        [ 'limit',    'y' x 128 ],
+        [ 'utf8',     "caf\x{e9} \x{263a} " x 50 ],
+    );
+}
+
+sub test_round_trip {
+    foreach my $test (get_values()) {
+        my ($name, $value) = @$test;
+        my $bytes = $value;
+        utf8::encode($bytes) if utf8::is_utf8($bytes);
+        my $cookie = bake_cookie('n', { value => $value, compress => 1 });
+        my $crushed = crush_cookie($cookie, 0, undef, 1)->{n};
+        $crushed = join('&', @$crushed) if ref($crushed);
+        is($crushed, $bytes, "round trip $name");
+    }
+
+    my @failed;
+    foreach my $len (120..300) {
+        my $value = join('', map { ('a'..'e')[($_ * $_ + $len) % 5] } 1..$len);
+        my $cookie = bake_cookie('n', { value => $value, compress => 1 });
+        my $crushed = crush_cookie($cookie, 0, undef, 1)->{n};
+        push @failed, $len if $crushed ne $value;
+    }
+    is_deeply(\@failed, [], 'values of all lengths round trip');
+}
+
+# Decompress an LZ4 block in plain Perl, to check what we produce is valid
+# LZ4, not just something we can read back ourselves.
+sub lz4_decompress {
+    my ($src) = @_;
+    my $out = '';
+    my $pos = 0;
+    my $get_length = sub {
+        my ($len) = @_;
+        my $byte;
+        do {
+            $byte = ord(substr($src, $pos++, 1));
+            $len += $byte;
+        } while ($byte == 255);
+        return $len;
+    };
+    while (1) {
+        my $token = ord(substr($src, $pos++, 1));
+        my $lit = $token >> 4;
+        $lit = $get_length->($lit) if $lit == 15;
+        $out .= substr($src, $pos, $lit);
+        $pos += $lit;
+        last if $pos >= length($src);
+        my $offset = unpack('v', substr($src, $pos, 2));
+        $pos += 2;
+        my $mlen = $token & 15;
+        $mlen = $get_length->($mlen) if $mlen == 15;
+        $mlen += 4;
+        die "bad offset" if !$offset || $offset > length($out);
+        $out .= substr($out, -$offset, 1) for 1..$mlen;
+    }
+    return $out;
+}
+
+sub test_format {
+    foreach my $test (get_values()) {
+        my ($name, $value) = @$test;
+        my $bytes = $value;
+        utf8::encode($bytes) if utf8::is_utf8($bytes);
+        my $crushed = crush_cookie(bake_cookie('n', { value => $value, compress => 1 }))->{n};
+        next if ref($crushed) || $crushed !~ s/^!//;
+
+        $crushed =~ tr{-_}{+/};
+        my $raw = decode_base64($crushed . '=' x (-length($crushed) % 4));
+        my ($len, $shift, $byte) = (0, 0, 0);
+        do {
+            $byte = ord(substr($raw, 0, 1, ''));
+            $len |= ($byte & 0x7f) << $shift;
+            $shift += 7;
+        } while ($byte & 0x80);
+        is($len, length($bytes), "original length for $name");
+        is(lz4_decompress($raw), $bytes, "valid LZ4 block for $name");
+    }
+}
+
+sub test_when {
+    my %values = map { $_->[0] => $_->[1] } get_values();
+
+    foreach my $name (qw[ids pairs json run pattern]) {
+        my $cookie = bake_cookie('n', { value => $values{$name}, compress => 1 });
+        my $plain  = bake_cookie('n', { value => $values{$name} });
+        like($cookie, qr/^n=![A-Za-z0-9_-]+\z/, "$name is compressed");
+        cmp_ok(length($cookie), '<', length($plain), "$name gets shorter");
+    }
+
+    my $random = bake_cookie('n', { value => $values{random}, compress => 1 });
+    is($random, bake_cookie('n', { value => $values{random} }),
+       'value that does not get shorter is not compressed');
+    like(bake_cookie('n', { value => $values{binary}, compress => 1 }), qr/^n=!/,
+         'value that gets shorter than URL-encoded is compressed');
+    is(bake_cookie('n', { value => $values{short}, compress => 1 }), 'n=' . $values{short},
+       'value below the threshold is not compressed');
+    like(bake_cookie('n', { value => $values{limit}, compress => 1 }), qr/^n=!/,
+         'value at the threshold is compressed');
+    is(bake_cookie('n', { value => $values{run}, compress => 0 }), 'n=' . $values{run},
+       'value is not compressed with a false flag');
+
+    my $cookie = bake_cookie('n', { value => [ ('same') x 100 ], compress => 1, path => '/' });
+    like($cookie, qr/^n=![A-Za-z0-9_-]+; Path=\/\z/, 'attributes are kept, flag is not one');
+}
+
+sub test_crush {
+    my $value = join('&', map { "item_$_" } 1..50);
+    my $compressed = bake_cookie('big', { value => $value, compress => 1 });
+    my $header = "$compressed; small=a%20b; other=!raw";
+
+    my $plain = crush_cookie($header);
+    like($plain->{big}, qr/^!/, 'not decompressed by default');
+
+    my $crushed = crush_cookie($header, 0, undef, 1);
+    is_deeply($crushed->{big}, [ map { "item_$_" } 1..50 ], 'decompressed into an array');
+    is($crushed->{small}, 'a b', 'other values are still decoded');
+    is($crushed->{other}, '!raw', 'marked value that is not compressed is left alone');
+
+    my $set = HTTP::XSCookies::NameSet->new('big');
+    is_deeply(crush_cookie($header, 0, $set, 1), { big => [ map { "item_$_" } 1..50 ] },
+              'decompressed when filtering');
+
+    my $all = crush_cookies([ $header, $header ], 0, undef, 1);
+    is_deeply($all, [ $crushed, $crushed ], 'crush_cookies decompresses');
+
+    # the same bytes, but with the marker URL-encoded: not ours
+    (my $encoded = $compressed) =~ s/=!/=%21/;
+    is(crush_cookie($encoded, 0, undef, 1)->{big}, '!' . substr($compressed, 5),
+       'value with an encoded marker is not decompressed');
+
+    my $value_only = crush_cookie($compressed)->{big};
+    is_deeply(decompress_cookie_value($value_only), [ map { "item_$_" } 1..50 ],
+              'decompress_cookie_value decompresses');
+    is(decompress_cookie_value('plain'), 'plain', 'plain value is returned as it was');
+    is(decompress_cookie_value('!plain'), '!plain', 'invalid value is returned as it was');
+    is(decompress_cookie_value(undef), undef, 'undef is returned as it was');
+}
+
+sub test_guarded {
+    my $value = 'x' x 100 . 'y' x 100 . 'x' x 100;
+
+    my $key = 'secret';
+    my $signed = bake_signed_cookie('n', { value => $value, compress => 1 }, $key);
+    like($signed, qr/^n=![A-Za-z0-9_-]+\.[A-Za-z0-9_-]{43}\z/, 'signed value is compressed');
+    my $verified = verify_signed_cookie('n', crush_cookie($signed)->{n}, $key);
+    is(decompress_cookie_value($verified), $value, 'signed compressed value round trips');
+
+    my $skey = 's' x 32;
+    ok(!eval { bake_sealed_cookie('n', { value => $value, compress => 1 }, $skey); 1 },
+       'compressing a sealed value dies');
+    like($@, qr/Cannot compress a value that will be sealed/, 'got error for sealed value');
+    my $sealed = bake_sealed_cookie('n', { value => $value, compress => 0 }, $skey);
+    is(open_sealed_cookie('n', crush_cookie($sealed)->{n}, $skey), $value,
+       'sealed value without compression still works');
+
+    my $prefs = { map { ("option_$_" => 'enabled') } 1..40 };
+    my $packed = bake_cookie('n', { value => $prefs, packed => 1, compress => 1 });
+    like($packed, qr/^n=!/, 'packed value is compressed');
+    is_deeply(unpack_cookie_value(crush_cookie($packed, 0, undef, 1)->{n}), $prefs,
+              'packed compressed value round trips');
+}
+
+sub test_invalid {
+    my $value = join(',', map { "value_$_" } 1..100);
+    my $cookie = bake_cookie('n', { value => $value, compress => 1 });
+    my $compressed = substr($cookie, 2);
+
+    # every prefix is left alone (or, if we are unlucky, decompresses to
+    # something else), and never crashes
+    my @broken;
+    foreach my $len (1..length($compressed) - 1) {
+        my $got = decompress_cookie_value(substr($compressed, 0, $len));
+        push @broken, $len if $got eq $value;
+    }
+    is_deeply(\@broken, [], 'no prefix decompresses to the value');
+
+    my @flipped;
+    foreach my $pos (1..length($compressed) - 1) {
+        my $bad = $compressed;
+        substr($bad, $pos, 1) = substr($bad, $pos, 1) eq 'A' ? 'B' : 'A';
+        my $got = decompress_cookie_value($bad);
+        push @flipped, $pos if !defined($got);
+    }
+    is_deeply(\@flipped, [], 'changed values never crash');
+
+    my @tests = (
+        [ 'empty', '!' ],
+        [ 'not base64url', '!a=b' ],
+        [ 'no length', '!' . encode_base64url("\x80") ],
+        [ 'too long', '!' . encode_base64url("\x81\x80\x80\x01\x10abcd") ],
+        [ 'length too big', '!' . encode_base64url("\x80\x80\xc0\x00\x1fa\x01\x00") ],
+        [ 'wrong length', '!' . encode_base64url("\x05\x40abcd") ],
+        [ 'bad offset', '!' . encode_base64url("\x09\x10a\x02\x00") ],
+        [ 'zero offset', '!' . encode_base64url("\x09\x10a\x00\x00") ],
+        [ 'truncated offset', '!' . encode_base64url("\x09\x10a\x01") ],
+        [ 'truncated literals', '!' . encode_base64url("\x09\x50abc") ],
+        [ 'truncated length', '!' . encode_base64url("\x20\xf0\xff") ],
+    );
+    foreach my $test (@tests) {
+        my ($name, $bad) = @$test;
+        is(decompress_cookie_value($bad), $bad, "invalid value: $name");
+    }
+
+    is(decompress_cookie_value('!' . encode_base64url("\x09\x14a\x01\x00\x00")), 'a' x 9,
+       'match overlapping its output');
+}
@@ -0,0 +1,228 @@
+use strict;
+use warnings;
+
+use Test::More;
+use MIME::Base64 qw[encode_base64url];
+use HTTP::XSCookies qw[
+    bake_cookie
+    bake_cookies
+    bake_signed_cookie
+    verify_signed_cookie
+    bake_sealed_cookie
+    open_sealed_cookie
+    crush_cookie
+    unpack_cookie_value
+];
+
+exit main();
+
+sub main {
+    test_round_trip();
+    test_numbers();
+    test_strings();
+    test_size();
+    test_bake();
+    test_guarded();
+    test_invalid();
+
+    done_testing();
+    return 0;
+}
+
+# Bake a packed value and get it back.
+sub round_trip {
+    my ($value) = @_;
+    my $cookie = bake_cookie('n', { value => $value, packed => 1 });
+    my $crushed = crush_cookie($cookie)->{n};
+    return unpack_cookie_value($crushed);
+}
+
+# Pack some raw bytes the way a cookie would carry them.
+sub raw {
+    return encode_base64url(join('', @_));
+}
+
+sub test_round_trip {
+    my @tests = (
+        [ 'string', 'hello world' ],
+        [ 'empty string', '' ],
+        [ 'hash', { theme => 'dark', lang => 'en', n => 3 } ],
+        [ 'array', [ 'a', 'b c', 'd&e', 42 ] ],
+        [ 'empty hash', {} ],
+        [ 'empty array', [] ],
+        [ 'undef elements', [ undef, 'x', undef ] ],
+        [ 'undef values', { a => undef, b => '' } ],
+        [ 'special chars', { '{"k"}' => '=; ,%&' } ],
+        [ 'binary', { bin => join('', map { chr } 0..255) } ],
+        [ 'many keys', { map { ("key_$_" => "value_$_") } 1..100 } ],
+    );
+    foreach my $test (@tests) {
+        my ($name, $value) = @$test;
+        is_deeply(round_trip($value), $value, "round trip $name");
+    }
+
+    my $array = [ 1, 2, 3 ];
+    bake_cookie('n', { value => $array, packed => 1 });
+    is_deeply($array, [ 1, 2, 3 ], 'array is not changed when packing');
+}
+
+sub test_numbers {
+    my @numbers = (
+        0, 1, 63, 64, 127, 128, 16383, 16384, 2**31, 2**32,
+        -1, -2, -63, -64, -65, -128, -(2**31), -(2**32),
+        '999999999999999999', '-999999999999999999',
+    );
+    my @failed;
+    foreach my $number (@numbers) {
+        my $got = round_trip([ $number, "$number" ]);
+        push @failed, $number
+            if $got->[0] ne $number || $got->[1] ne "$number";
+    }
+    is_deeply(\@failed, [], 'numbers round trip');
+
+    # not canonical, or too long: kept as strings
+    my @strings = (
+        '007', '-0', '-', '+1', '1.5', '1e3', ' 1', '1 ', '0x10',
+        '1000000000000000000', '-1000000000000000000', '18446744073709551616',
+    );
+    is_deeply(round_trip(\@strings), \@strings, 'strings that look like numbers round trip');
+
+    # sizes: small numbers fit in the tag
+    is(length(raw_value([ 0 ])), 3, 'number 0 takes one byte');
+    is(length(raw_value([ 63 ])), 3, 'number 63 takes one byte');
+    is(length(raw_value([ 64 ])), 4, 'number 64 takes two bytes');
+    is(length(raw_value([ -1 ])), 4, 'number -1 takes two bytes');
+}
+
+# The packed bytes for a value.
+sub raw_value {
+    my ($value) = @_;
+    my $cookie = bake_cookie('n', { value => $value, packed => 1 });
+    my $packed = crush_cookie($cookie)->{n};
+    $packed =~ tr{-_}{+/};
+    return MIME::Base64::decode_base64($packed . '=' x (-length($packed) % 4));
+}
+
+sub test_strings {
+    my @lengths = (0, 1, 62, 63, 64, 65, 127, 128, 300);
+    my @failed;
+    foreach my $len (@lengths) {
+        my $bytes = join('', map { chr(($_ * 11) % 256) } 1..$len);
+        my $chars = join('', map { chr(0x100 + $_) } 1..$len);
+        my $got = round_trip({ $chars => $bytes, bytes => $bytes, chars => $chars });
+        push @failed, "bytes $len" if $got->{bytes} ne $bytes;
+        push @failed, "chars $len" if $got->{chars} ne $chars;
+        push @failed, "key $len" if !defined($got->{$chars}) || $got->{$chars} ne $bytes;
+        push @failed, "utf8 $len" if $len && !utf8::is_utf8($got->{chars});
+        push @failed, "latin1 $len" if utf8::is_utf8($got->{bytes});
+    }
+    is_deeply(\@failed, [], 'byte and character strings of all lengths round trip');
+}
+
+sub test_size {
+    # what we would have had to do before: JSON, then URL-encoding
+    my $json = '{"theme":"dark","lang":"en","n":3,"beta":true}';
+    my $encoded = HTTP::XSCookies::uri_encode($json);
+    my $packed = crush_cookie(bake_cookie('n', {
+        value => { theme => 'dark', lang => 'en', n => 3, beta => 1 },
+        packed => 1,
+    }))->{n};
+    like($packed, qr/^[A-Za-z0-9_-]+\z/, 'packed value is base64url');
+    cmp_ok(length($packed), '<', length($encoded) / 2,
+           'packed value is less than half the size of URL-encoded JSON');
+}
+
+sub test_bake {
+    my $cookie = bake_cookie('prefs', {
+        value    => { theme => 'dark' },
+        packed   => 1,
+        path     => '/',
+        httponly => 1,
+    });
+    like($cookie, qr/^prefs=[A-Za-z0-9_-]+; /, 'value is packed');
+    like($cookie, qr/; Path=\//, 'got path');
+    like($cookie, qr/; HttpOnly/, 'got HttpOnly');
+    unlike($cookie, qr/packed/i, 'packed flag is not an attribute');
+
+    is(bake_cookie('n', { value => 'a b', packed => 0 }), 'n=a%20b',
+       'value is not packed with a false flag');
+
+    my $baked = bake_cookies([
+        a => { value => [ 1, 2 ], packed => 1 },
+        b => 'plain',
+    ]);
+    is_deeply(unpack_cookie_value(crush_cookie($baked->[0])->{a}), [ 1, 2 ],
+              'bake_cookies packs values');
+    is($baked->[1], 'b=plain', 'bake_cookies does not pack other values');
+
+    foreach my $bad ([ [ 1 ] ], { a => {} }, \'x') {
+        ok(!eval { bake_cookie('n', { value => $bad, packed => 1 }); 1 },
+           'packing a nested value dies');
+        like($@, qr/Packed cookie values can only have strings and numbers/,
+             'got error for nested value');
+    }
+}
+
+sub test_guarded {
+    my $value = { cart => 1234, items => 3 };
+
+    my $key = 'secret';
+    my $signed = bake_signed_cookie('n', { value => $value, packed => 1 }, $key);
+    like($signed, qr/^n=[A-Za-z0-9_-]+\.[A-Za-z0-9_-]{43}\z/,
+         'signed packed value needs no encoding');
+    my $verified = verify_signed_cookie('n', crush_cookie($signed)->{n}, $key);
+    is_deeply(unpack_cookie_value($verified), $value, 'signed packed value round trips');
+
+    my $skey = 's' x 32;
+    my $sealed = bake_sealed_cookie('n', { value => $value, packed => 1 }, $skey);
+    my $opened = open_sealed_cookie('n', crush_cookie($sealed)->{n}, $skey);
+    is_deeply(unpack_cookie_value($opened), $value, 'sealed packed value round trips');
+}
+
+sub test_invalid {
+    my @tests = (
+        [ 'undef', undef ],
+        [ 'empty string', '' ],
+        [ 'arrayref', [ 'a' ] ],
+        [ 'not base64url', 'a=b' ],
+        [ 'bad base64url length', 'abcde' ],
+        [ 'unknown tag', raw("\xc7") ],
+        [ 'string too short', raw("\x05abcd") ],
+        [ 'long string too short', raw("\xc1\x40", 'x' x 63) ],
+        [ 'unfinished length', raw("\xc1\x80") ],
+        [ 'length too long', raw("\xc3", "\xff" x 10, "\x01") ],
+        [ 'number too big', raw("\xc3", "\xff" x 9, "\x02") ],
+        [ 'negative number too big', raw("\xc4", "\xff" x 9, "\x01") ],
+        [ 'trailing bytes', raw("\x01a\x01b") ],
+        [ 'array too short', raw("\xc5\x03\x01a\x01b") ],
+        [ 'huge array', raw("\xc5\xff\xff\xff\xff\x0f\x01a") ],
+        [ 'hash missing value', raw("\xc6\x01\x01a") ],
+        [ 'huge hash', raw("\xc6\xff\xff\xff\xff\x0f\x01a\x01b") ],
+        [ 'number key', raw("\xc6\x01\x81\x01a") ],
+        [ 'nested array', raw("\xc5\x01\xc5\x00") ],
+        [ 'nested hash', raw("\xc6\x01\x01a\xc6\x00") ],
+        [ 'bad UTF-8', raw("\x42\xc3\x28") ],
+        [ 'bad UTF-8 key', raw("\xc6\x01\x42\xc3\x28\x01a") ],
+    );
+    foreach my $test (@tests) {
+        my ($name, $value) = @$test;
+        is(unpack_cookie_value($value), undef, "invalid value: $name");
+    }
+
+    is(unpack_cookie_value(raw("\xc4", "\xfe", "\xff" x 8, "\x01")), -(2**64 - 1),
+       'most negative number');
+    is(unpack_cookie_value(raw("\xc3", "\xff" x 9, "\x01")), '18446744073709551615',
+       'largest number');
+
+    # every prefix of a valid value is invalid, and never crashes
+    my $packed = crush_cookie(bake_cookie('n', {
+        value  => { a => 'x' x 70, b => 1, c => "\x{263a}" },
+        packed => 1,
+    }))->{n};
+    my @opened;
+    foreach my $len (0..length($packed) - 1) {
+        my $value = unpack_cookie_value(substr($packed, 0, $len));
+        push @opened, $len if defined($value) && ref($value);
+    }
+    is_deeply(\@opened, [], 'no prefix of a packed hash unpacks into a hash');
+}
@@ -0,0 +1,91 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[bake_cookie];
+
+exit main();
+
+sub main {
+    test_template();
+    test_template_same_as_bake();
+    test_template_expires();
+
+    done_testing();
+    return 0;
+}
+
+# Attributes can come out in any order, so compare them as a set
+sub split_cookie {
+    my ($cookie) = @_;
+    my ($pair, @attributes) = split /; /, $cookie;
+    return [ $pair, sort @attributes ];
+}
+
+sub test_template {
+    my $empty = HTTP::XSCookies::Template->new();
+    isa_ok($empty, 'HTTP::XSCookies::Template');
+    is($empty->bake('foo', 'bar'), 'foo=bar', 'baked with empty template');
+    is($empty->bake('Bilbo&Frodo', 'Foo Bar'), 'Bilbo%26Frodo=Foo%20Bar', 'baked with encoding');
+    is($empty->bake('foo', ''), 'foo=', 'baked empty value');
+    is($empty->bake(undef, 'bar'), '', 'baked undef name');
+    is($empty->bake('foo', undef), '', 'baked undef value');
+
+    # same validation as bake_cookie
+    foreach my $bad ([ 'foo', 42 ], [ 'foo', [ 'bar' ] ], [ 'foo', \'bar' ],
+                     [ 42, 'bar' ], [ [ 'foo' ], 'bar' ]) {
+        my $label = join(' / ', map { ref($_) || $_ } @$bad);
+        is($empty->bake(@$bad), bake_cookie(@$bad), "baked same as bake_cookie for $label");
+        is($empty->bake(@$bad), '', "baked nothing for $label");
+    }
+    is($empty->bake('foo', '42'), 'foo=42', 'baked number in a string');
+    is($empty->bake('foo', { value => 'bar' }), '', 'attributes come only from the template');
+
+    my $tmpl = HTTP::XSCookies::Template->new({
+        value    => 'ignored',
+        Path     => '/',
+        domain   => '.example.com',
+        SECURE   => 1,
+        httponly => 0,
+        samesite => 'Strict',
+        unknown  => 'whatever',
+    });
+    for my $iter (1..3) {
+        is_deeply(split_cookie($tmpl->bake('id', "x y $iter")),
+                  [ "id=x%20y%20$iter", 'Domain=.example.com', 'Path=/', 'SameSite=Strict', 'Secure' ],
+                  "baked with template, iteration $iter");
+    }
+
+    ok(!eval { HTTP::XSCookies::Template->new([ path => '/' ]); 1 }, 'attributes must be a hashref');
+    like($@, qr/must be a hashref/, 'got the right error');
+}
+
+sub test_template_same_as_bake {
+    my @attributes = (
+        { path => '/tmp', domain => 'foo.com' },
+        { 'Max-Age' => 3600, HttpOnly => 1 },
+        { expires => '1452449969', secure => 1 },
+        { expires => 'Sun, 10-Jan-2016 18:19:29 GMT' },
+    );
+    for my $attr (@attributes) {
+        my $tmpl = HTTP::XSCookies::Template->new({ %$attr });
+        for my $value ('bar', 'a&b', "caf\x{e9}", '') {
+            is_deeply(split_cookie($tmpl->bake('foo', $value)),
+                      split_cookie(bake_cookie('foo', { %$attr, value => $value })),
+                      "template bakes same as bake_cookie for '$value'");
+        }
+    }
+}
+
+sub test_template_expires {
+    my $tmpl = HTTP::XSCookies::Template->new({ Path => '/', expires => '+1h' });
+    my $before = bake_cookie('foo', { value => 'bar', expires => '+1h' });
+    my $baked = $tmpl->bake('foo', 'bar');
+    my $after = bake_cookie('foo', { value => 'bar', expires => '+1h' });
+
+    my ($expires) = $baked =~ m/; Expires=([^;]+)$/;
+    ok($expires, 'relative expires rendered when baking');
+    my @possible = map { (m/Expires=([^;]+)/)[0] } ($before, $after);
+    ok((grep { $_ eq $expires } @possible), 'relative expires computed for current time');
+    like($baked, qr/^foo=bar; Path=\/; Expires=/, 'relative expires comes last');
+}
@@ -0,0 +1,81 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[crush_cookie crush_cookie_pick];
+
+exit main();
+
+sub main {
+    test_nameset();
+    test_nameset_large();
+    test_crush_filter();
+    test_pick_nameset();
+
+    done_testing();
+    return 0;
+}
+
+sub test_nameset {
+    my $set = HTTP::XSCookies::NameSet->new(qw/session csrf/, undef, 'csrf', '', 'a b');
+    isa_ok($set, 'HTTP::XSCookies::NameSet');
+    is_deeply([ $set->names ], [ 'session', 'csrf', '', 'a b' ], 'repeated names dropped');
+    ok($set->contains($_), "set contains '$_'") for ('session', 'csrf', '', 'a b');
+    ok(!$set->contains($_), "set does not contain '$_'") for ('Session', 'csr', 'csrff', 'a  b');
+
+    my $empty = HTTP::XSCookies::NameSet->new();
+    is_deeply([ $empty->names ], [], 'empty set');
+    ok(!$empty->contains('a'), 'empty set contains nothing');
+}
+
+# Enough names to need several hash buckets, and some long names
+sub test_nameset_large {
+    my @names = ((map { "name_$_" } 1..1000), (map { 'x' x $_ } 60..70));
+    my $set = HTTP::XSCookies::NameSet->new(@names);
+    is(scalar(() = $set->names), scalar(@names), 'large set has all names');
+    my $missing = grep { !$set->contains($_) } @names;
+    is($missing, 0, 'large set contains all its names');
+    my $extra = grep { $set->contains($_) } ((map { "name_$_" } 1001..2000), 'x' x 71, 'x' x 59);
+    is($extra, 0, 'large set contains no other names');
+}
+
+sub test_crush_filter {
+    my $cookie = 'flag; session=abc%20def; csrf=1234; list=a&b; csrf=5678; flag=1; other=x';
+    my $set = HTTP::XSCookies::NameSet->new(qw/session csrf list flag missing/);
+
+    is_deeply(crush_cookie($cookie, 0, $set),
+              { session => 'abc def', csrf => '1234', list => [qw/a b/], flag => '1' },
+              'crushed cookie with filter');
+    is_deeply(crush_cookie($cookie, 1, $set),
+              { session => 'abc def', csrf => '1234', list => [qw/a b/], flag => undef },
+              'crushed cookie with filter, allowing no value');
+    is_deeply(crush_cookie($cookie, 0, undef), crush_cookie($cookie), 'undef filter is no filter');
+    is_deeply(crush_cookie('', 0, $set), {}, 'crushed empty cookie with filter');
+
+    ok(!eval { crush_cookie($cookie, 0, [qw/session/]); 1 }, 'filter must be a name set');
+    like($@, qr/must be an HTTP::XSCookies::NameSet/, 'got the right error');
+
+    my @chars = ('a'..'c', '%41', '%3b', '=', ';', '; ', ' ', '&', 'plain');
+    srand(20160128);
+    for my $iter (1..200) {
+        my $str = join('', map { $chars[int(rand(@chars))] } 1..int(rand(100)));
+        for my $allow (0, 1) {
+            my $crushed = crush_cookie($str, $allow);
+            my @names = grep { rand() < 0.5 } sort keys %$crushed;
+            my $filter = HTTP::XSCookies::NameSet->new(@names, 'missing');
+            my %expected = map { $_ => $crushed->{$_} } @names;
+            is_deeply(crush_cookie($str, $allow, $filter), \%expected,
+                      "filtered same values as crush for random cookie $iter, allow is $allow");
+        }
+    }
+}
+
+sub test_pick_nameset {
+    my $cookie = 'flag; session=abc%20def; csrf=1234; list=a&b; csrf=5678; flag=1';
+    my $set = HTTP::XSCookies::NameSet->new(qw/csrf missing session/);
+
+    is_deeply([ crush_cookie_pick($cookie, $set) ], [ '1234', undef, 'abc def' ],
+              'picked values with a name set');
+    is_deeply([ crush_cookie_pick($cookie, $set) ], [ crush_cookie_pick($cookie, $set->names) ],
+              'picking with a name set is the same as picking with a list');
+}
@@ -0,0 +1,389 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies;
+
+my $now = 1_500_000_000;
+
+exit main();
+
+sub main {
+    test_basic();
+    test_urls();
+    test_domains();
+    test_paths();
+    test_secure();
+    test_prefixes();
+    test_same_site();
+    test_parsing();
+    test_expiry();
+    test_replace();
+    test_random();
+
+    done_testing();
+    return 0;
+}
+
+sub header {
+    my ($jar, $url, $site) = @_;
+    return $jar->cookie_header($url, $site, $now);
+}
+
+sub test_basic {
+    my $jar = HTTP::XSCookies::Jar->new();
+    isa_ok($jar, 'HTTP::XSCookies::Jar');
+    is($jar->count($now), 0, 'new jar is empty');
+    is(header($jar, 'http://example.com/'), '', 'empty jar sends nothing');
+
+    is($jar->add('http://example.com/', 'foo=bar', $now), 1, 'stored one cookie');
+    is($jar->add('http://example.com/', [ 'a=1', undef, 'b=2' ], $now), 2, 'stored two cookies');
+    is($jar->count($now), 3, 'jar has three cookies');
+    is(header($jar, 'http://example.com/'), 'foo=bar; a=1; b=2', 'sent in creation order');
+    is(header($jar, 'http://other.com/'), '', 'nothing for another host');
+
+    is_deeply([ sort { $a->{name} cmp $b->{name} } $jar->cookies($now) ], [
+        { name => 'a',   value => '1',   Domain => 'example.com', Path => '/', host_only => 1 },
+        { name => 'b',   value => '2',   Domain => 'example.com', Path => '/', host_only => 1 },
+        { name => 'foo', value => 'bar', Domain => 'example.com', Path => '/', host_only => 1 },
+    ], 'got all cookies');
+
+    $jar->clear();
+    is($jar->count($now), 0, 'cleared jar is empty');
+    is(header($jar, 'http://example.com/'), '', 'cleared jar sends nothing');
+    is($jar->add('http://example.com/', 'foo=baz', $now), 1, 'can store after clear');
+    is(header($jar, 'http://example.com/'), 'foo=baz', 'sent after clear');
+}
+
+sub test_urls {
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add('HTTP://user:pw@WWW.Example.COM:8080/a/b?x=/c#d', 'foo=bar', $now);
+    is_deeply([ map { [ @$_{qw/Domain Path/} ] } $jar->cookies($now) ],
+              [ [ 'www.example.com', '/a' ] ], 'host and path taken from URL');
+    is(header($jar, 'http://www.example.com/a?q=1'), 'foo=bar', 'query is not part of path');
+    is(header($jar, 'http://www.example.com/a#frag'), 'foo=bar', 'fragment is not part of path');
+    is(header($jar, 'http://www.example.com:9090/a/'), 'foo=bar', 'port does not matter');
+
+    $jar->add('http://[::1]:8080/', 'v6=1', $now);
+    is(header($jar, 'http://[::1]/'), 'v6=1', 'IPv6 host');
+
+    for my $url (undef, '', 'example.com/', 'http:/example.com/', 'http://', 'http://:80/',
+                 'ht tp://example.com/', 'http://[::1/', 'http://exa mple.com/',
+                 'http://' . ('a' x 256) . '/') {
+        my $show = defined $url ? "'$url'" : 'undef';
+        ok(!eval { $jar->add($url, 'foo=bar', $now); 1 }, "URL $show is invalid");
+        like($@, qr/Invalid URL/, "got the right error for $show");
+    }
+}
+
+sub test_domains {
+    my $jar = HTTP::XSCookies::Jar->new();
+    is($jar->add('http://www.example.com/', 'host=1', $now), 1, 'host-only cookie');
+    is($jar->add('http://www.example.com/', 'dom=1; Domain=example.com', $now), 1, 'domain cookie');
+    is($jar->add('http://www.example.com/', 'dot=1; Domain=.EXAMPLE.com', $now), 1,
+       'domain cookie with leading dot');
+    is($jar->add('http://www.example.com/', 'self=1; Domain=www.example.com', $now), 1,
+       'domain cookie for the host');
+    is($jar->add('http://www.example.com/', 'sub=1; Domain=a.www.example.com', $now), 0,
+       'domain cookie for a subdomain rejected');
+    is($jar->add('http://www.example.com/', 'other=1; Domain=other.com', $now), 0,
+       'domain cookie for another domain rejected');
+    is($jar->add('http://www.example.com/', 'part=1; Domain=ample.com', $now), 0,
+       'domain cookie for a partial label rejected');
+    is($jar->add('http://www.example.com/', 'tld=1; Domain=com', $now), 0,
+       'domain cookie for a top level domain rejected');
+    is($jar->add('http://www.example.com/', 'empty=1; Domain=', $now), 1,
+       'empty domain is ignored');
+
+    is(header($jar, 'http://www.example.com/'), 'host=1; dom=1; dot=1; self=1; empty=1',
+       'all cookies sent to the host');
+    is(header($jar, 'http://example.com/'), 'dom=1; dot=1', 'domain cookies sent to the domain');
+    is(header($jar, 'http://a.b.www.example.com/'), 'dom=1; dot=1; self=1',
+       'domain cookies sent to subdomains');
+    is(header($jar, 'http://wwwexample.com/'), '', 'nothing sent to a similar host');
+    is(header($jar, 'http://com/'), '', 'nothing sent to the top level domain');
+
+    is($jar->add('http://localhost/', 'local=1; Domain=localhost', $now), 1,
+       'domain cookie for a single label host');
+    is_deeply([ map { $_->{host_only} } grep { $_->{name} eq 'local' } $jar->cookies($now) ],
+              [ 1 ], 'it is host-only');
+    is(header($jar, 'http://localhost/'), 'local=1', 'sent to the host');
+
+    is($jar->add('http://10.0.0.1/', 'ip=1', $now), 1, 'cookie for an IP address');
+    is($jar->add('http://10.0.0.1/', 'ipdom=1; Domain=0.0.1', $now), 0,
+       'domain cookie for part of an IP address rejected');
+    is(header($jar, 'http://10.0.0.1/'), 'ip=1', 'sent to the IP address');
+    is(header($jar, 'http://1.10.0.0.1/'), '', 'not sent to a longer address');
+}
+
+sub test_paths {
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add('http://example.com/',          'root=1', $now);
+    $jar->add('http://example.com/docs/page', 'default=1', $now);
+    $jar->add('http://example.com/docs',      'top=1', $now);
+    $jar->add('http://example.com/',          'docs=1; Path=/docs', $now);
+    $jar->add('http://example.com/',          'slash=1; Path=/docs/', $now);
+    $jar->add('http://example.com/',          'deep=1; Path=/docs/a/b', $now);
+    $jar->add('http://example.com/docs/x/y',  'rel=1; Path=docs', $now);
+
+    is_deeply({ map { $_->{name} => $_->{Path} } $jar->cookies($now) }, {
+        root => '/', default => '/docs', top => '/', docs => '/docs',
+        slash => '/docs/', deep => '/docs/a/b', rel => '/docs/x',
+    }, 'got all paths');
+
+    is(header($jar, 'http://example.com/'), 'root=1; top=1', 'root path');
+    is(header($jar, 'http://example.com/docs'), 'default=1; docs=1; root=1; top=1', 'exact path');
+    is(header($jar, 'http://example.com/docs/'), 'slash=1; default=1; docs=1; root=1; top=1',
+       'path with slash');
+    is(header($jar, 'http://example.com/docs/a/b/c'),
+       'deep=1; slash=1; default=1; docs=1; root=1; top=1', 'longer paths first');
+    is(header($jar, 'http://example.com/docsx'), 'root=1; top=1', 'path must end at a slash');
+    is(header($jar, 'http://example.com/docs/x/y'), 'rel=1; slash=1; default=1; docs=1; root=1; top=1',
+       'invalid path means default path');
+    is(header($jar, 'http://example.com/DOCS'), 'root=1; top=1', 'paths are case sensitive');
+}
+
+sub test_secure {
+    my $jar = HTTP::XSCookies::Jar->new();
+    is($jar->add('http://example.com/', 'a=1; Secure', $now), 0, 'secure cookie from http rejected');
+    is($jar->add('https://example.com/', 'a=1; Secure', $now), 1, 'secure cookie from https');
+    is($jar->add('wss://example.com/', 'b=1; secure', $now), 1, 'secure cookie from wss');
+    is($jar->add('http://example.com/', 'c=1; HttpOnly', $now), 1, 'http-only cookie');
+    is(header($jar, 'https://example.com/'), 'a=1; b=1; c=1', 'all sent over https');
+    is(header($jar, 'http://example.com/'), 'c=1', 'only non-secure sent over http');
+    is_deeply({ map { $_->{name} => [ $_->{Secure}, $_->{HttpOnly} ] } $jar->cookies($now) },
+              { a => [ 1, undef ], b => [ 1, undef ], c => [ undef, 1 ] }, 'got the flags');
+
+    # plain HTTP cannot shadow a Secure cookie
+    $jar = HTTP::XSCookies::Jar->new();
+    my $url = 'https://www.example.com/a/';
+    is($jar->add($url, 's=good; Secure; Path=/a', $now), 1, 'secure cookie');
+    is($jar->add('http://www.example.com/a/', 's=evil; Path=/a', $now), 0,
+       'same name, domain and path from http rejected');
+    is($jar->add('http://www.example.com/a/', 's=evil; Path=/a/b', $now), 0,
+       'longer path from http rejected');
+    is($jar->add('http://www.example.com/a/', 's=evil; Domain=example.com; Path=/a', $now), 0,
+       'parent domain from http rejected');
+    is($jar->add('http://x.www.example.com/a/', 's=evil; Path=/a', $now), 0,
+       'subdomain from http rejected');
+    is($jar->add('http://www.example.com/a/', 's=fine; Path=/', $now), 1,
+       'shorter path from http allowed');
+    is($jar->add('http://www.example.com/ab/', 's=fine; Path=/ab', $now), 1,
+       'path that does not match from http allowed');
+    is($jar->add('http://other.example.com/a/', 's=fine; Path=/a', $now), 1,
+       'sibling domain from http allowed');
+    is($jar->add('http://www.example.com/a/', 't=fine; Path=/a', $now), 1,
+       'other name from http allowed');
+    is($jar->add('https://www.example.com/a/', 's=new; Path=/a', $now), 1,
+       'non-secure cookie from https allowed');
+    is(header($jar, 'https://www.example.com/a/'), 's=new; t=fine; s=fine',
+       'secure cookie replaced over https only');
+    is($jar->add('http://www.example.com/a/', 's=now; Path=/a', $now), 1,
+       'no longer shadows once the secure cookie is replaced');
+
+    # Secure cookies in deeper subdomains, and in other sites
+    $jar = HTTP::XSCookies::Jar->new();
+    is($jar->add("https://a$_.b.example.co.uk/", "s$_=good; Secure", $now), 1,
+       "secure cookie $_ in a subdomain") for 1 .. 40;
+    is($jar->add('http://example.co.uk/', 's7=evil; Domain=example.co.uk', $now), 0,
+       'domain with a secure cookie in a subdomain rejected');
+    is($jar->add('http://b.example.co.uk/', 's39=evil', $now), 0,
+       'host with a secure cookie in a subdomain rejected');
+    is($jar->add('http://a7.b.example.co.uk/', 's8=fine', $now), 1,
+       'secure cookie in a sibling does not count');
+    is($jar->add('http://other.co.uk/', 's7=fine; Domain=other.co.uk', $now), 1,
+       'secure cookie in another site does not count');
+    is($jar->add('https://a7.b.example.co.uk/', 's7=gone; Secure; Max-Age=0', $now), 0,
+       'secure cookie removed');
+    is($jar->add('http://example.co.uk/', 's7=fine; Domain=example.co.uk', $now), 1,
+       'no longer shadows once the secure cookie is removed');
+    $jar->clear();
+    is($jar->add('http://example.co.uk/', 's8=fine; Domain=example.co.uk', $now), 1,
+       'no longer shadows once the jar is cleared');
+}
+
+sub test_prefixes {
+    my $jar = HTTP::XSCookies::Jar->new();
+    my $url = 'https://www.example.com/a/b';
+    is($jar->add($url, '__Secure-a=1', $now), 0, '__Secure- needs Secure');
+    is($jar->add($url, '__Secure-a=1; Secure; Domain=example.com', $now), 1, '__Secure- with Secure');
+    is($jar->add($url, '__secure-b=1', $now), 0, 'prefixes are not case sensitive');
+    is($jar->add($url, '__Host-a=1; Secure', $now), 0, '__Host- needs Path=/');
+    is($jar->add($url, '__Host-a=1; Path=/', $now), 0, '__Host- needs Secure');
+    is($jar->add($url, '__Host-a=1; Secure; Path=/; Domain=www.example.com', $now), 0,
+       '__Host- cannot have a Domain');
+    is($jar->add($url, '__Host-a=1; Secure; Path=/', $now), 1, '__Host- with all restrictions');
+    is($jar->add($url, '__Hostile=1', $now), 1, 'not a prefix');
+    is(header($jar, 'https://www.example.com/a/'), '__Secure-a=1; __Hostile=1; __Host-a=1',
+       'got the cookies');
+}
+
+sub test_same_site {
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add('http://example.com/', $_, $now)
+        for ('unset=1', 'none=1; SameSite=None', 'lax=1; SameSite=lax',
+             'strict=1; SameSite=STRICT', 'bogus=1; SameSite=bogus');
+
+    is_deeply({ map { $_->{name} => $_->{SameSite} } $jar->cookies($now) },
+              { unset => undef, none => 'None', lax => 'Lax', strict => 'Strict', bogus => undef },
+              'got SameSite values');
+    is(header($jar, 'http://example.com/'), 'unset=1; none=1; lax=1; strict=1; bogus=1',
+       'all sent by default');
+    is(header($jar, 'http://example.com/', 'same-site'), 'unset=1; none=1; lax=1; strict=1; bogus=1',
+       'all sent for same-site requests');
+    is(header($jar, 'http://example.com/', 'navigation'), 'unset=1; none=1; lax=1; bogus=1',
+       'Strict not sent for cross-site navigation');
+    is(header($jar, 'http://example.com/', 'cross-site'), 'unset=1; none=1; bogus=1',
+       'Strict and Lax not sent for cross-site requests');
+
+    ok(!eval { header($jar, 'http://example.com/', 'Cross-Site'); 1 }, 'invalid site');
+    like($@, qr/Invalid site/, 'got the right error');
+}
+
+sub test_parsing {
+    my $jar = HTTP::XSCookies::Jar->new();
+    my $url = 'http://example.com/';
+    is($jar->add($url, '  sp ace =  a b  ; Path = / ', $now), 1, 'whitespace trimmed');
+    is($jar->add($url, 'eq=a=b==', $now), 1, 'value with equal signs');
+    is($jar->add($url, 'empty=', $now), 1, 'empty value');
+    is($jar->add($url, 'raw=%20"q";junk; Secure=no', $now), 0, 'Secure with a value is still Secure');
+    is($jar->add($url, 'raw=%20"q"', $now), 1, 'value kept verbatim');
+    is($jar->add($url, 'novalue', $now), 0, 'no equal sign rejected');
+    is($jar->add($url, '=value', $now), 0, 'empty name rejected');
+    is($jar->add($url, '', $now), 0, 'empty header rejected');
+    is($jar->add($url, "ctl=a\nb", $now), 0, 'control characters rejected');
+    is($jar->add($url, "tab=a\tb", $now), 1, 'tabs allowed');
+    is($jar->add($url, 'big=' . ('x' x 4093), $now), 1, 'big cookie');
+    is($jar->add($url, 'huge=' . ('x' x 4093), $now), 0, 'huge cookie rejected');
+    is(header($jar, $url), join('; ', 'sp ace=a b', 'eq=a=b==', 'empty=', 'raw=%20"q"',
+                                "tab=a\tb", 'big=' . ('x' x 4093)), 'got the cookies');
+}
+
+sub test_expiry {
+    my $jar = HTTP::XSCookies::Jar->new();
+    my $url = 'http://example.com/';
+    is($jar->add($url, 'session=1', $now), 1, 'session cookie');
+    is($jar->add($url, 'age=1; Max-Age=100', $now), 1, 'cookie with Max-Age');
+    is($jar->add($url, 'date=1; Expires=Fri, 14 Jul 2017 02:41:40 GMT', $now), 1,
+       'cookie with Expires');
+    is($jar->add($url, 'both=1; Max-Age=50; Expires=Fri, 14 Jul 2017 02:40:50 GMT', $now), 1,
+       'Max-Age wins over Expires');
+    is($jar->add($url, 'badage=1; Max-Age=1x', $now), 1, 'invalid Max-Age ignored');
+    is($jar->add($url, 'baddate=1; Expires=someday', $now), 1, 'invalid Expires ignored');
+    is($jar->add($url, 'old=1; Expires=Sun, 06 Nov 1994 08:49:37 GMT', $now), 0,
+       'expired cookie not stored');
+    is($jar->add($url, 'zero=1; Max-Age=0', $now), 0, 'zero Max-Age not stored');
+    is($jar->add($url, 'negative=1; Max-Age=-1', $now), 0, 'negative Max-Age not stored');
+
+    is_deeply({ map { $_->{name} => $_->{Expires} } $jar->cookies($now) }, {
+        session => undef, age => $now + 100, date => 1500000100, both => $now + 50,
+        badage => undef, baddate => undef,
+    }, 'got the expiration dates');
+
+    is($jar->count($now + 49), 6, 'nothing expired yet');
+    is($jar->cookie_header($url, undef, $now + 50), 'session=1; age=1; date=1; badage=1; baddate=1',
+       'expired cookie not sent');
+    is($jar->count($now + 50), 5, 'expired cookie removed');
+    is($jar->purge($now + 100), 2, 'purged two cookies');
+    is($jar->purge($now + 1000), 0, 'nothing else to purge');
+    is($jar->count($now), 3, 'session cookies stay');
+
+    is($jar->add($url, 'session=1; Max-Age=0', $now), 0, 'deleting a cookie');
+    is(header($jar, $url), 'badage=1; baddate=1', 'cookie deleted');
+
+    my $count = 1000;
+    $jar->clear();
+    $jar->add("http://host$_.example.com/", "c$_=1; Domain=example.com; Max-Age=" . ($_ * 10), $now)
+        for 1..$count;
+    is($jar->count($now), $count, 'got many cookies');
+    for my $step (1..10) {
+        is($jar->purge($now + $step * $count), $count / 10, "purged cookies, step $step");
+    }
+    is($jar->count($now), 0, 'purged all cookies');
+}
+
+sub test_replace {
+    my $jar = HTTP::XSCookies::Jar->new();
+    my $url = 'http://www.example.com/';
+    $jar->add($url, 'a=1', $now);
+    $jar->add($url, 'b=1', $now);
+    $jar->add($url, 'a=2; Max-Age=100', $now);
+    is(header($jar, $url), 'a=2; b=1', 'replaced cookie keeps its place');
+    is($jar->count($now), 2, 'still two cookies');
+
+    $jar->add($url, 'a=3; Path=/x', $now);
+    $jar->add($url, 'b=2; Domain=example.com', $now);
+    is($jar->count($now), 4, 'different path or domain is a different cookie');
+
+    # many replacements of persistent cookies leave stale expiration entries,
+    # which must not expire the new cookies
+    for my $age (1..1000) {
+        $jar->add($url, "a=$age; Max-Age=$age", $now);
+    }
+    is($jar->count($now + 999), 4, 'replaced cookie did not expire');
+    is(header($jar, $url), 'a=1000; b=1; b=2', 'got last value');
+    is($jar->count($now + 1000), 3, 'replaced cookie expired');
+
+    $jar->add($url, 'b=3; Max-Age=100', $now);
+    $jar->add($url, 'b=4', $now);
+    is($jar->count($now + 200), 3, 'session cookie replacing a persistent one stays');
+}
+
+# Compare against a simple implementation of the same rules
+sub test_random {
+    my @hosts = qw/example.com www.example.com a.www.example.com other.com www.other.com/;
+    my @paths = qw{/ /a /a/ /a/b /b /ab};
+    my $jar = HTTP::XSCookies::Jar->new();
+    my %model;
+    my $seq = 0;
+
+    srand(20171017);
+    for my $iter (1..2000) {
+        my $host = $hosts[rand @hosts];
+        my $time = $now + $iter;
+        if (rand() < 0.6) {
+            my $name = ('a'..'e')[rand 5];
+            my $value = int(rand 1000);
+            my $path = $paths[rand @paths];
+            my $age = int(rand(100)) - 10;
+            my @parts = ("$name=$value", "Path=$path");
+            my $domain = $host;
+            my $host_only = 1;
+            if (rand() < 0.5) {
+                ($domain) = $host =~ /(\w+\.com)$/;
+                push @parts, "Domain=$domain";
+                $host_only = 0;
+            }
+            push @parts, "Max-Age=$age" if rand() < 0.5;
+            $jar->add("http://$host/", join('; ', @parts), $time);
+
+            my $key = join("\0", $name, $domain, $path);
+            if (@parts > 2 && $parts[-1] =~ /Max-Age/ && $age <= 0) {
+                delete $model{$key};
+                next;
+            }
+            my $expires = $parts[-1] =~ /Max-Age/ ? $time + $age : undef;
+            my $old = $model{$key};
+            my $created = $old && (!defined $old->{expires} || $old->{expires} > $time)
+                        ? $old->{created} : $seq++;
+            $model{$key} = { name => $name, value => $value, domain => $domain, path => $path,
+                             host_only => $host_only, expires => $expires, created => $created };
+        } else {
+            my $path = $paths[rand @paths];
+            my @match = sort { length($b->{path}) <=> length($a->{path}) || $a->{created} <=> $b->{created} }
+                        grep { !defined $_->{expires} || $_->{expires} > $time }
+                        grep { $_->{host_only} ? $host eq $_->{domain}
+                                               : $host =~ /(^|\.)\Q$_->{domain}\E$/ }
+                        grep { $path eq $_->{path} || index($path, $_->{path}) == 0 &&
+                               ($_->{path} =~ m{/$} || substr($path, length $_->{path}, 1) eq '/') }
+                        values %model;
+            my $expected = join('; ', map { "$_->{name}=$_->{value}" } @match);
+            my $got = $jar->cookie_header("http://$host$path", undef, $time);
+            if ($got ne $expected) {
+                is($got, $expected, "iteration $iter, header for $host$path");
+                return;
+            }
+        }
+    }
+    ok(1, 'random cookies match the model');
+}
@@ -0,0 +1,177 @@
+use strict;
+use warnings;
+use utf8;
+
+use Test::More;
+use HTTP::XSCookies qw[public_suffix];
+
+exit main();
+
+sub main {
+    test_registrable();
+    test_public_suffix();
+    test_jar();
+
+    done_testing();
+    return 0;
+}
+
+# The registrable domain: the public suffix plus one more label
+sub registrable {
+    my ($host) = @_;
+    my $suffix = public_suffix($host);
+    return undef if !defined $suffix;
+    my ($domain) = lc($host) =~ /([^.]+\.\Q$suffix\E)$/;
+    return $domain;
+}
+
+# Cases from the test file that comes with the Public Suffix List
+sub test_registrable {
+    my @cases = (
+        # mixed case
+        [ 'COM', undef ],
+        [ 'example.COM', 'example.com' ],
+        [ 'WwW.example.COM', 'example.com' ],
+        # leading dot
+        [ '.com', undef ],
+        [ '.example', undef ],
+        [ '.example.com', undef ],
+        [ '.example.example', undef ],
+        # unlisted TLD
+        [ 'example', undef ],
+        [ 'example.example', 'example.example' ],
+        [ 'b.example.example', 'example.example' ],
+        [ 'a.b.example.example', 'example.example' ],
+        # TLD with only one rule
+        [ 'biz', undef ],
+        [ 'domain.biz', 'domain.biz' ],
+        [ 'b.domain.biz', 'domain.biz' ],
+        [ 'a.b.domain.biz', 'domain.biz' ],
+        # TLD with some two-level rules
+        [ 'com', undef ],
+        [ 'example.com', 'example.com' ],
+        [ 'b.example.com', 'example.com' ],
+        [ 'a.b.example.com', 'example.com' ],
+        [ 'uk.com', undef ],
+        [ 'example.uk.com', 'example.uk.com' ],
+        [ 'b.example.uk.com', 'example.uk.com' ],
+        [ 'a.b.example.uk.com', 'example.uk.com' ],
+        [ 'test.ac', 'test.ac' ],
+        # TLD with only one wildcard rule
+        [ 'mm', undef ],
+        [ 'c.mm', undef ],
+        [ 'b.c.mm', 'b.c.mm' ],
+        [ 'a.b.c.mm', 'b.c.mm' ],
+        # more complex TLD
+        [ 'jp', undef ],
+        [ 'test.jp', 'test.jp' ],
+        [ 'www.test.jp', 'test.jp' ],
+        [ 'ac.jp', undef ],
+        [ 'test.ac.jp', 'test.ac.jp' ],
+        [ 'www.test.ac.jp', 'test.ac.jp' ],
+        [ 'kyoto.jp', undef ],
+        [ 'test.kyoto.jp', 'test.kyoto.jp' ],
+        [ 'ide.kyoto.jp', undef ],
+        [ 'b.ide.kyoto.jp', 'b.ide.kyoto.jp' ],
+        [ 'a.b.ide.kyoto.jp', 'b.ide.kyoto.jp' ],
+        [ 'c.kobe.jp', undef ],
+        [ 'b.c.kobe.jp', 'b.c.kobe.jp' ],
+        [ 'a.b.c.kobe.jp', 'b.c.kobe.jp' ],
+        [ 'city.kobe.jp', 'city.kobe.jp' ],
+        [ 'www.city.kobe.jp', 'city.kobe.jp' ],
+        # TLD with a wildcard rule and exceptions
+        [ 'ck', undef ],
+        [ 'test.ck', undef ],
+        [ 'b.test.ck', 'b.test.ck' ],
+        [ 'a.b.test.ck', 'b.test.ck' ],
+        [ 'www.ck', 'www.ck' ],
+        [ 'www.www.ck', 'www.ck' ],
+        # US K12
+        [ 'us', undef ],
+        [ 'test.us', 'test.us' ],
+        [ 'www.test.us', 'test.us' ],
+        [ 'ak.us', undef ],
+        [ 'test.ak.us', 'test.ak.us' ],
+        [ 'www.test.ak.us', 'test.ak.us' ],
+        [ 'k12.ak.us', undef ],
+        [ 'test.k12.ak.us', 'test.k12.ak.us' ],
+        [ 'www.test.k12.ak.us', 'test.k12.ak.us' ],
+        # IDN labels, in UTF-8
+        [ '食狮.com.cn', '食狮.com.cn' ],
+        [ '食狮.公司.cn', '食狮.公司.cn' ],
+        [ 'www.食狮.公司.cn', '食狮.公司.cn' ],
+        [ 'shishi.公司.cn', 'shishi.公司.cn' ],
+        [ '公司.cn', undef ],
+        [ '食狮.中国', '食狮.中国' ],
+        [ 'www.食狮.中国', '食狮.中国' ],
+        [ 'shishi.中国', 'shishi.中国' ],
+        [ '中国', undef ],
+        # same, in their ASCII form
+        [ 'xn--85x722f.com.cn', 'xn--85x722f.com.cn' ],
+        [ 'xn--85x722f.xn--55qx5d.cn', 'xn--85x722f.xn--55qx5d.cn' ],
+        [ 'www.xn--85x722f.xn--55qx5d.cn', 'xn--85x722f.xn--55qx5d.cn' ],
+        [ 'shishi.xn--55qx5d.cn', 'shishi.xn--55qx5d.cn' ],
+        [ 'xn--55qx5d.cn', undef ],
+        [ 'xn--85x722f.xn--fiqs8s', 'xn--85x722f.xn--fiqs8s' ],
+        [ 'www.xn--85x722f.xn--fiqs8s', 'xn--85x722f.xn--fiqs8s' ],
+        [ 'shishi.xn--fiqs8s', 'shishi.xn--fiqs8s' ],
+        [ 'xn--fiqs8s', undef ],
+    );
+
+    for my $case (@cases) {
+        my ($host, $expected) = @$case;
+        my $name = $host;
+        utf8::encode($name);
+        is(registrable($host), $expected, "registrable domain for '$name'");
+    }
+}
+
+sub test_public_suffix {
+    is(public_suffix(undef), undef, 'undef host');
+    is(public_suffix(''), undef, 'empty host');
+    is(public_suffix('example.com.'), undef, 'trailing dot');
+    is(public_suffix('a..example.com'), undef, 'empty label');
+    is(public_suffix('x' x 256), undef, 'host too long');
+    is(public_suffix('WWW.EXAMPLE.CO.UK'), 'co.uk', 'lowercased');
+    is(public_suffix('user.github.io'), 'github.io', 'private domain');
+    is(public_suffix('10.0.0.1'), '1', 'numbers are labels too');
+
+    my $suffix = public_suffix('www.食狮.中国');
+    ok(utf8::is_utf8($suffix), 'suffix is a character string');
+    is($suffix, '中国', 'suffix in UTF-8');
+    my $bytes = 'www.食狮.中国';
+    utf8::encode($bytes);
+    $suffix = public_suffix($bytes);
+    ok(!utf8::is_utf8($suffix), 'suffix is a byte string');
+    is($suffix, "\xe4\xb8\xad\xe5\x9b\xbd", 'suffix in UTF-8 bytes');
+}
+
+sub test_jar {
+    my $now = 1_500_000_000;
+    my $jar = HTTP::XSCookies::Jar->new();
+
+    my $url = 'https://www.example.co.uk/';
+    is($jar->add($url, 'a=1; Domain=co.uk', $now), 0, 'cookie for a public suffix rejected');
+    is($jar->add($url, 'b=1; Domain=.CO.UK', $now), 0, 'same, with a leading dot and uppercase');
+    is($jar->add($url, 'c=1; Domain=example.co.uk', $now), 1, 'cookie for the registrable domain');
+    is($jar->add($url, 'd=1; Domain=example.co.uk.', $now), 0, 'cookie for a domain with empty labels');
+    is($jar->cookie_header('https://other.co.uk/', undef, $now), '', 'nothing sent to another site');
+    is($jar->cookie_header('https://a.example.co.uk/', undef, $now), 'c=1', 'sent to subdomains');
+
+    $url = 'https://alice.github.io/';
+    is($jar->add($url, 'e=1; Domain=github.io', $now), 0, 'cookie for a private public suffix rejected');
+    is($jar->add($url, 'f=1', $now), 1, 'host-only cookie for a site under it');
+    is($jar->cookie_header('https://bob.github.io/', undef, $now), '', 'not sent to other sites');
+
+    $url = 'https://github.io/';
+    is($jar->add($url, 'g=1; Domain=github.io', $now), 1, 'cookie for a public suffix from itself');
+    is_deeply([ map { $_->{host_only} } grep { $_->{name} eq 'g' } $jar->cookies($now) ],
+              [ 1 ], 'it is host-only');
+    is($jar->cookie_header($url, undef, $now), 'g=1', 'sent to the public suffix itself');
+    is($jar->cookie_header('https://alice.github.io/', undef, $now), 'f=1', 'not sent to sites under it');
+
+    $url = 'http://b.test.ck/';
+    is($jar->add($url, 'h=1; Domain=test.ck', $now), 0, 'cookie for a wildcard suffix rejected');
+    is($jar->add('http://a.www.ck/', 'i=1; Domain=www.ck', $now), 1, 'cookie for an exception');
+    is($jar->cookie_header('http://www.ck/', undef, $now), 'i=1', 'sent to the exception');
+}
@@ -13,4 +13,86 @@ Test::MemoryGrowth::no_growth(sub {
     HTTP::XSCookies::crush_cookie($cookie);
 });
 
+Test::MemoryGrowth::no_growth(sub {
+    my $values = HTTP::XSCookies::crush_cookie_lazy($cookie);
+    my $foo = $values->{foo};
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $names = HTTP::XSCookies::NameSet->new(qw/foo path bar/);
+    my $values = HTTP::XSCookies::crush_cookie($cookie, 0, $names);
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $template = HTTP::XSCookies::Template->new({ path => '/', expires => '+1d' });
+    my $baked = $template->bake(foo => 'bar');
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $parser = HTTP::XSCookies::Parser->new();
+    my @pairs = ($parser->feed('foo=b'), $parser->feed('ar; path=/'), $parser->finish());
+    my $values = $parser->crushed();
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $values = HTTP::XSCookies::crush_set_cookie(
+        'foo=bar; Path=/; Expires=Sun, 06 Nov 1994 08:49:37 GMT; Secure');
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $str = HTTP::XSCookies::uri_decode('q=caf%C3%A9&page=2');
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $str = HTTP::XSCookies::uri_encode("caf\x{e9} au lait");
+    HTTP::XSCookies::uri_decode_inplace($str);
+    HTTP::XSCookies::uri_encode_inplace($str);
+    my $query = 'q=';
+    HTTP::XSCookies::uri_encode_append($query, $str);
+    HTTP::XSCookies::uri_decode_append($query, $str);
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $cookie = HTTP::XSCookies::bake_signed_cookie('foo', { value => 'bar', path => '/' }, 'key');
+    my $value = HTTP::XSCookies::verify_signed_cookie(
+        'foo', HTTP::XSCookies::crush_cookie($cookie)->{foo}, 'key');
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $key = 'k' x 32;
+    my $cookie = HTTP::XSCookies::bake_sealed_cookie('foo', { value => 'bar', path => '/' }, $key);
+    my $value = HTTP::XSCookies::open_sealed_cookie(
+        'foo', HTTP::XSCookies::crush_cookie($cookie)->{foo}, $key);
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $cookie = HTTP::XSCookies::bake_cookie('foo', { value => { a => 1, b => 'x' }, packed => 1 });
+    my $value = HTTP::XSCookies::unpack_cookie_value(
+        HTTP::XSCookies::crush_cookie($cookie)->{foo});
+    HTTP::XSCookies::unpack_cookie_value(substr($cookie, 4, 5));
+    eval { HTTP::XSCookies::bake_cookie('foo', { value => [ [] ], packed => 1 }) };
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $cookie = HTTP::XSCookies::bake_cookie('foo', { value => 'bar' x 100, compress => 1 });
+    my $values = HTTP::XSCookies::crush_cookie($cookie, 0, undef, 1);
+    my $value = HTTP::XSCookies::decompress_cookie_value(
+        HTTP::XSCookies::crush_cookie($cookie)->{foo});
+    HTTP::XSCookies::decompress_cookie_value('!bogus');
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add('https://www.example.com/a', [ 'foo=bar; Domain=example.com; Max-Age=1', 'baz=1' ], 100);
+    $jar->add('https://www.example.com/a', 'foo=baz; Max-Age=2', 100);
+    my $header = $jar->cookie_header('https://www.example.com/a/b', undef, 100);
+    my @cookies = $jar->cookies(101);
+    eval { $jar->add('bogus', 'foo=bar') };
+});
+
+Test::MemoryGrowth::no_growth(sub {
+    my $suffix = HTTP::XSCookies::public_suffix('www.example.co.uk');
+    $suffix = HTTP::XSCookies::public_suffix('a..b');
+});
+
 done_testing;
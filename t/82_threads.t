@@ -0,0 +1,58 @@
+use strict;
+use warnings;
+
+use Config;
+use Test::More;
+
+BEGIN {
+    $Config{useithreads}
+      or plan skip_all => 'This perl does not support threads';
+    eval { require threads; threads->import(); 1; }
+      or plan skip_all => 'threads is needed for this test';
+}
+
+use HTTP::XSCookies;
+
+# Objects backed by C data are not cloned into new threads; the parent
+# must still be able to use them after a thread is created and joined.
+sub spawn {
+    my $thread = threads->create(sub { return 1 });
+    return $thread->join();
+}
+
+{
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add('https://www.example.com/', 'foo=bar', 100);
+    ok(spawn(), 'thread created with a jar around');
+    is($jar->cookie_header('https://www.example.com/', undef, 100), 'foo=bar',
+       'jar still works in the parent');
+}
+
+{
+    my $set = HTTP::XSCookies::NameSet->new('foo', 'bar');
+    ok(spawn(), 'thread created with a name set around');
+    ok($set->contains('bar'), 'name set still works in the parent');
+}
+
+{
+    my $parser = HTTP::XSCookies::Parser->new();
+    $parser->feed('foo=b');
+    ok(spawn(), 'thread created with a parser around');
+    $parser->feed('ar');
+    $parser->finish();
+    is_deeply($parser->crushed(), { foo => 'bar' }, 'parser still works in the parent');
+}
+
+{
+    my $values = HTTP::XSCookies::crush_cookie_lazy('foo=bar%21; baz=1');
+    ok(spawn(), 'thread created with a lazy hash around');
+    is($values->{foo}, 'bar!', 'lazy hash still works in the parent');
+}
+
+{
+    my $template = HTTP::XSCookies::Template->new({ path => '/' });
+    ok(spawn(), 'thread created with a template around');
+    is($template->bake('foo', 'bar'), 'foo=bar; Path=/', 'template still works in the parent');
+}
+
+done_testing;
@@ -0,0 +1,139 @@
+use strict;
+use warnings;
+
+use Test::More;
+use HTTP::XSCookies qw[
+    bake_cookie bake_cookies
+    crush_cookie crush_cookies crush_cookie_lazy crush_cookie_get
+    crush_cookie_pick crush_set_cookie
+];
+
+exit main();
+
+sub main {
+    test_no_allocations();
+    test_lazy_allocations();
+    test_buffers_given_back();
+
+    done_testing();
+    return 0;
+}
+
+sub scratch_allocs {
+    my ($allocs) = HTTP::XSCookies::_scratch_stats();
+    return $allocs;
+}
+
+sub scratch_used {
+    my (undef, $used) = HTTP::XSCookies::_scratch_stats();
+    return $used;
+}
+
+# Memory allocated by our C code; undef unless built with GMEM_CHECK.
+sub gmem_allocs {
+    return HTTP::XSCookies::_gmem_allocs();
+}
+
+sub long_cookie {
+    return join('; ', map { "name_$_=" . ('0123456789abcdef%20' x 10) } 1..20);
+}
+
+# Once the scratch buffers have grown enough, processing more cookies of
+# the same sizes must not allocate any memory for them, or (when we can
+# count it) any other memory in our C code, other than the Perl values
+# returned.
+sub test_no_allocations {
+    my $long = long_cookie();
+    my @many = map { "name_$_" } 1..20;
+    my $set_cookie = 'session=' . ('x' x 500) .
+                     '; Path=/; Expires=Sun, 06 Nov 1994 08:49:37 GMT; Secure';
+    my $names = HTTP::XSCookies::NameSet->new(qw/name_3 name_7/);
+    my $template = HTTP::XSCookies::Template->new({ path => '/', expires => '+1d' });
+    my $value = 'some value with spaces & ampersands' x 20;
+
+    my $work = sub {
+        bake_cookie('foo', $value);
+        bake_cookie('foo', { value => [ $value, $value ], path => '/', expires => '+1h' });
+        bake_cookies([ foo => $value, bar => { value => $value, domain => '.x.com' } ]);
+        $template->bake('foo', $value);
+        crush_cookie($long);
+        crush_cookie($long, 0, $names);
+        crush_cookies([ $long, $long ]);
+        crush_cookie_get($long, 'name_20');
+        crush_cookie_pick($long, $names);
+        crush_cookie_pick($long, @many);
+        crush_set_cookie($set_cookie);
+    };
+
+    $work->() for 1..3;
+    my $before = scratch_allocs();
+    my $gmem = gmem_allocs();
+    ok($before > 0, 'scratch buffers were allocated while warming up');
+
+    $work->() for 1..100;
+    is(scratch_allocs(), $before, 'no allocations for scratch buffers after warming up');
+    is(scratch_used(), 0, 'all scratch buffers were given back');
+    SKIP: {
+        skip 'memory is only counted when built with GMEM_CHECK', 1 unless defined $gmem;
+        is(gmem_allocs(), $gmem, 'no other allocations after warming up');
+    }
+}
+
+# A lazy hash is an object that outlives the call: it keeps a copy of the
+# cookie and an index of its pairs.  The index allocates room for the
+# names once, unless they are short enough to fit in the index itself, and
+# room for the pairs once, when there are more than fit in the index.
+# Fetching values uses only scratch buffers.
+sub test_lazy_allocations {
+    my $long = long_cookie();
+    my $short = join('; ', map { "name_$_=value%20$_" } 1..10);
+    my $tiny = 'a=1; b=2';
+    my $work = sub {
+        my ($cookie) = @_;
+        my $lazy = crush_cookie_lazy($cookie);
+        my $fetched = $lazy->{name_5};
+        my $count = scalar(%$lazy);
+    };
+
+    $work->($_) for ($long, $short, $tiny) x 3;
+    my $before = scratch_allocs();
+    for my $case ([ $long, 2, '20 pairs' ], [ $short, 1, '10 pairs' ], [ $tiny, 0, '2 short pairs' ]) {
+        my ($cookie, $expected, $what) = @$case;
+        my $gmem = gmem_allocs();
+        $work->($cookie) for 1..100;
+        SKIP: {
+            skip 'memory is only counted when built with GMEM_CHECK', 1 unless defined $gmem;
+            is(gmem_allocs() - $gmem, 100 * $expected,
+               "allocations for each lazy hash with $what");
+        }
+    }
+    is(scratch_allocs(), $before, 'no allocations for scratch buffers in lazy hashes');
+    is(scratch_used(), 0, 'all scratch buffers were given back by lazy hashes');
+}
+
+# Buffers are given back even when we die while holding them.
+sub test_buffers_given_back {
+    tie my @values, 'DiesShifting';
+    @values = ('a', 'b');
+    ok(!eval { bake_cookie('foo', { value => \@values, path => '/' }); 1 },
+       'died while baking');
+    is(scratch_used(), 0, 'scratch buffers given back after dying while baking');
+
+    ok(!eval { bake_cookies([ foo => 'bar', baz => { value => \@values } ]); 1 },
+       'died while baking several cookies');
+    is(scratch_used(), 0, 'scratch buffers given back after dying while baking several cookies');
+
+    my $name = DiesStringifying->new();
+    ok(!eval { crush_cookie_pick('a=1', map({ "name_$_" } 1..20), $name); 1 },
+       'died while getting the names to pick');
+    is(scratch_used(), 0, 'scratch buffers given back after dying while getting the names');
+}
+
+package DiesStringifying;
+use overload '""' => sub { die "cannot stringify\n" };
+sub new { return bless {}, shift }
+
+package DiesShifting;
+use Tie::Array;
+use parent -norequire, 'Tie::StdArray';
+sub SHIFT { die "cannot shift\n" }
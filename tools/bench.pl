@@ -16,6 +16,7 @@ sub main {
         long    => 'DV=; expires=Mon, 01-Jan-1990 00:00:00 GMT; path=/webhp; domain=www.google.com',
         longer  => 'whv=MtW_XszVxqHnN6rHsX0d; expires=Wed, 07 Jan 2026 11:10:40 GMT; domain=.wikihow.com; path=',
         encoded => '%2bBilbo%26Frodo%2b=%23Foo%20Bar%23; path=%2bMERRY%2b;',
+        huge    => join('; ', map { "ab_test_$_=" . ('0123456789abcdef' x 4) } 1..50),
     );
 
     if ($#ARGV < 0) {
@@ -30,6 +31,13 @@ sub main {
             run_benchmark($name, $cookies{$name});
         }
     }
+    run_batch_benchmark(\%cookies);
+    run_bake_benchmark();
+    run_date_benchmark();
+    run_uri_benchmark();
+    run_seal_benchmark();
+    run_compress_benchmark();
+    run_jar_benchmark();
 
     return 0;
 }
@@ -74,6 +82,434 @@ sub run_benchmark {
 
     $bench->run;
     $bench->report;
+
+    run_get_benchmark($name, $cookie);
+}
+
+# Compare getting a single value by crushing the whole cookie and by
+# looking just for that name; we look for the last name in the cookie,
+# which is the worst case for crush_cookie_get().
+sub run_get_benchmark {
+    my ($name, $cookie) = @_;
+
+    my $iterations = 1e5;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my @names = map { (split /=/, $_)[0] } split /;\s*/, $cookie;
+    my $wanted = $names[-1];
+    my $filter = HTTP::XSCookies::NameSet->new($wanted);
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies crush', $name),
+            code => sub {
+                for(1..$iterations){
+                    my $value = HTTP::XSCookies::crush_cookie($cookie)->{$wanted};
+                }
+            },
+        ),
+
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies get', $name),
+            code => sub {
+                for(1..$iterations){
+                    my $value = HTTP::XSCookies::crush_cookie_get($cookie, $wanted);
+                }
+            },
+        ),
+
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies filter', $name),
+            code => sub {
+                for(1..$iterations){
+                    my $value = HTTP::XSCookies::crush_cookie($cookie, 0, $filter)->{$wanted};
+                }
+            },
+        ),
+    );
+
+    $bench->run;
+    $bench->report;
+}
+
+# Compare crushing many cookies with a Perl loop over crush_cookie() and
+# with a single call to crush_cookies().
+sub run_batch_benchmark {
+    my ($cookies) = @_;
+
+    my $iterations = 1e3;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my @headers = map { values %$cookies } 1..25;
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies loop', 'batch'),
+            code => sub {
+                for(1..$iterations){
+                    my $crushed = [ map { HTTP::XSCookies::crush_cookie($_) } @headers ];
+                }
+            },
+        ),
+
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies batch', 'batch'),
+            code => sub {
+                for(1..$iterations){
+                    my $crushed = HTTP::XSCookies::crush_cookies(\@headers);
+                }
+            },
+        ),
+    );
+
+    $bench->run;
+    $bench->report;
+}
+
+# Compare baking cookies with the same attributes using bake_cookie()
+# and using a template.
+sub run_bake_benchmark {
+    my $iterations = 1e5;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my %attributes = (
+        Domain   => '.example.com',
+        Path     => '/',
+        Secure   => 1,
+        HttpOnly => 1,
+        SameSite => 'Lax',
+    );
+    my $template = HTTP::XSCookies::Template->new(\%attributes);
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies bake', 'template'),
+            code => sub {
+                for(1..$iterations){
+                    HTTP::XSCookies::bake_cookie('session', { %attributes, value => 'abc def' });
+                }
+            },
+        ),
+
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies template', 'template'),
+            code => sub {
+                for(1..$iterations){
+                    $template->bake('session', 'abc def');
+                }
+            },
+        ),
+    );
+
+    $bench->run;
+    $bench->report;
+}
+
+# Date::Parse and HTTP::Date are only used if they are installed.
+sub run_date_benchmark {
+    my $iterations = 1e5;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my @dates = (
+        'Sun, 06 Nov 1994 08:49:37 GMT',
+        'Sunday, 06-Nov-94 08:49:37 GMT',
+        'Sun Nov  6 08:49:37 1994',
+    );
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'date'),
+            code => sub {
+                for(1..$iterations){
+                    HTTP::XSCookies::parse_http_date($_) for @dates;
+                }
+            },
+        ),
+    );
+    if (eval { require Date::Parse; 1 }) {
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('Date::Parse', 'date'),
+                code => sub {
+                    for(1..$iterations){
+                        Date::Parse::str2time($_) for @dates;
+                    }
+                },
+            ),
+        );
+    }
+    if (eval { require HTTP::Date; 1 }) {
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('HTTP::Date', 'date'),
+                code => sub {
+                    for(1..$iterations){
+                        HTTP::Date::str2time($_) for @dates;
+                    }
+                },
+            ),
+        );
+    }
+
+    $bench->run;
+    $bench->report;
+}
+
+# URI::Escape and URI::Escape::XS are only used if they are installed.
+sub run_uri_benchmark {
+    my $iterations = 1e5;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my $plain = 'q=' . join('&', map { "field_$_=value_$_" } 1..10);
+    my $encoded = HTTP::XSCookies::uri_encode("caf\x{e9} & cr\x{e8}me br\x{fb}l\x{e9}e / " x 5);
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'uri'),
+            code => sub {
+                for(1..$iterations){
+                    HTTP::XSCookies::uri_encode($plain);
+                    HTTP::XSCookies::uri_decode($encoded);
+                }
+            },
+        ),
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'uri_inplace'),
+            code => sub {
+                for(1..$iterations){
+                    my $str = $plain;
+                    HTTP::XSCookies::uri_encode_inplace($str);
+                    $str = $encoded;
+                    HTTP::XSCookies::uri_decode_inplace($str);
+                }
+            },
+        ),
+    );
+    if (eval { require URI::Escape; 1 }) {
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('URI::Escape', 'uri'),
+                code => sub {
+                    for(1..$iterations){
+                        URI::Escape::uri_escape($plain);
+                        URI::Escape::uri_unescape($encoded);
+                    }
+                },
+            ),
+        );
+    }
+    if (eval { require URI::Escape::XS; 1 }) {
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('URI::Escape::XS', 'uri'),
+                code => sub {
+                    for(1..$iterations){
+                        URI::Escape::XS::uri_escape($plain);
+                        URI::Escape::XS::uri_unescape($encoded);
+                    }
+                },
+            ),
+        );
+    }
+
+    $bench->run;
+    $bench->report;
+}
+
+sub run_seal_benchmark {
+    my $iterations = 1e4;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my $key = join('', map { chr($_ * 7 % 256) } 1..32);
+    my $value = 'prefs=' . join(',', map { "opt_$_" } 1..20);
+    my $spec = { value => $value, path => '/', httponly => 1 };
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'sealed'),
+            code => sub {
+                for(1..$iterations){
+                    my $cookie = HTTP::XSCookies::bake_sealed_cookie('prefs', $spec, $key);
+                    my $values = HTTP::XSCookies::crush_cookie($cookie);
+                    HTTP::XSCookies::open_sealed_cookie('prefs', $values->{prefs}, $key);
+                }
+            },
+        ),
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'signed'),
+            code => sub {
+                for(1..$iterations){
+                    my $cookie = HTTP::XSCookies::bake_signed_cookie('prefs', $spec, $key);
+                    my $values = HTTP::XSCookies::crush_cookie($cookie);
+                    HTTP::XSCookies::verify_signed_cookie('prefs', $values->{prefs}, $key);
+                }
+            },
+        ),
+    );
+    if (eval { require Crypt::AuthEnc::GCM; require MIME::Base64; 1 }) {
+        # what we used to do: AES-GCM and base64 in Perl around bake / crush
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('Crypt::AuthEnc::GCM', 'sealed'),
+                code => sub {
+                    for(1..$iterations){
+                        my $nonce = join('', map { chr(rand(256)) } 1..12);
+                        my ($ct, $tag) = Crypt::AuthEnc::GCM::gcm_encrypt_authenticate(
+                            'AES', $key, $nonce, '', $value);
+                        my $sealed = MIME::Base64::encode_base64url($nonce . $ct . $tag);
+                        my $cookie = HTTP::XSCookies::bake_cookie('prefs', {
+                            %$spec, value => $sealed });
+                        my $values = HTTP::XSCookies::crush_cookie($cookie);
+                        my $raw = MIME::Base64::decode_base64url($values->{prefs});
+                        Crypt::AuthEnc::GCM::gcm_decrypt_verify(
+                            'AES', $key, substr($raw, 0, 12), '',
+                            substr($raw, 12, -16), substr($raw, -16));
+                    }
+                },
+            ),
+        );
+    }
+
+    $bench->run;
+    $bench->report;
+}
+
+sub run_compress_benchmark {
+    my $iterations = 1e4;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    my %payloads = (
+        cart    => join('&', map { "sku-$_:" . ($_ % 3 + 1) } 1000..1080),
+        prefs   => HTTP::XSCookies::uri_decode(join('&', map { "pref_$_=" . ($_ % 2 ? 'on' : 'off') } 1..60)),
+        history => join(',', map { "/products/category-" . ($_ % 9) . "/item-$_" } 1..40),
+        json    => '[' . join(',', map { qq({"id":$_,"seen":true,"tag":"campaign-) . ($_ % 4) . '"}' } 1..30) . ']',
+    );
+
+    foreach my $name (sort keys %payloads) {
+        my $value = $payloads{$name};
+        my $plain = HTTP::XSCookies::bake_cookie($name, { value => $value });
+        my $compressed = HTTP::XSCookies::bake_cookie($name, { value => $value, compress => 1 });
+        printf("%-10s %5d bytes raw, %5d bytes in cookie, %5d compressed (%.0f%%)\n",
+               $name, length($value), length($plain), length($compressed),
+               100 * length($compressed) / length($plain));
+
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('XSCookies', "$name plain"),
+                code => sub {
+                    for(1..$iterations){
+                        my $cookie = HTTP::XSCookies::bake_cookie($name, { value => $value });
+                        HTTP::XSCookies::crush_cookie($cookie);
+                    }
+                },
+            ),
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('XSCookies', "$name compressed"),
+                code => sub {
+                    for(1..$iterations){
+                        my $cookie = HTTP::XSCookies::bake_cookie($name, { value => $value, compress => 1 });
+                        HTTP::XSCookies::crush_cookie($cookie, 0, undef, 1);
+                    }
+                },
+            ),
+        );
+    }
+
+    $bench->run;
+    $bench->report;
+}
+
+sub run_jar_benchmark {
+    my $iterations = 1e3;
+    my $bench = Dumbbench->new(
+        target_rel_precision => 0.005,
+        initial_runs         => 20,
+    );
+
+    # a crawler's view: many sites, a few cookies each, one request per URL
+    my @sites = map { "site$_.example" . ($_ % 7) . '.com' } 1..500;
+    my @responses = map {
+        my $site = $_;
+        [ "https://www.$site/shop/cart", [
+            "session=s-$site; Domain=$site; Path=/; Secure; HttpOnly",
+            'cart=a1b2c3; Path=/shop; Max-Age=3600',
+            "prefs=lang-en; Domain=$site; Max-Age=86400; SameSite=Lax",
+        ] ];
+    } @sites;
+    my @requests = map { ("https://www.$_/shop/item/42", "https://static.$_/img/logo.png") } @sites;
+
+    my $jar = HTTP::XSCookies::Jar->new();
+    $jar->add(@$_) for @responses;
+
+    $bench->add_instances(
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'jar add'),
+            code => sub {
+                my $fresh = HTTP::XSCookies::Jar->new();
+                $fresh->add(@$_) for @responses;
+            },
+        ),
+        Dumbbench::Instance::PerlSub->new(
+            name => get_name('XSCookies', 'jar header'),
+            code => sub {
+                for(1..$iterations / 100){
+                    $jar->cookie_header($_) for @requests;
+                }
+            },
+        ),
+    );
+    if (eval { require HTTP::Cookies; require HTTP::Request; require HTTP::Response; 1 }) {
+        my $cookies = HTTP::Cookies->new();
+        my @messages = map {
+            my $response = HTTP::Response->new(200);
+            $response->request(HTTP::Request->new(GET => $_->[0]));
+            $response->push_header('Set-Cookie' => $_) for @{ $_->[1] };
+            $response;
+        } @responses;
+        $cookies->extract_cookies($_) for @messages;
+
+        $bench->add_instances(
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('HTTP::Cookies', 'jar add'),
+                code => sub {
+                    my $fresh = HTTP::Cookies->new();
+                    $fresh->extract_cookies($_) for @messages;
+                },
+            ),
+            Dumbbench::Instance::PerlSub->new(
+                name => get_name('HTTP::Cookies', 'jar header'),
+                code => sub {
+                    for(1..$iterations / 100){
+                        $cookies->add_cookie_header(HTTP::Request->new(GET => $_)) for @requests;
+                    }
+                },
+            ),
+        );
+    }
+
+    $bench->run;
+    $bench->report;
 }
 
 sub get_name {
@@ -0,0 +1,116 @@
+/*
+ * Count how many times memory is allocated (and how long it takes) when
+ * crushing and baking long cookies, using new buffers every time, as the
+ * XS code did before it had a pool of scratch buffers.  This must be built
+ * with GMEM_CHECK defined, so that gmem counts the allocations.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "buffer.h"
+#include "cookie.h"
+#include "scan.h"
+
+#define ITERATIONS 20000L
+#define PAIRS      20
+#define VALUE_LEN  2000
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* what, double elapsed, long allocs)
+{
+    printf("%-30s %8.3f s  %8.1f ns/cookie  %6.2f allocs/cookie\n",
+           what, elapsed, elapsed * 1e9 / ITERATIONS,
+           (double) allocs / ITERATIONS);
+}
+
+static void bench_crush(const char* what, const char* str, int len)
+{
+    double start = 0;
+    long allocs = gmem_allocs;
+    long j = 0;
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        Buffer cookie;
+        Buffer name;
+        Buffer value;
+        buffer_wrap(&cookie, str, len);
+        buffer_init(&name, 0);
+        buffer_init(&value, 0);
+        while (1) {
+            buffer_reset(&name);
+            buffer_reset(&value);
+            cookie_get_pair(&cookie, &name, &value);
+            if (name.wpos == 0) {
+                break;
+            }
+        }
+        buffer_fini(&value);
+        buffer_fini(&name);
+    }
+    report(what, now() - start, gmem_allocs - allocs);
+}
+
+static void bench_bake(const char* what, const char* str, int len)
+{
+    double start = 0;
+    long allocs = gmem_allocs;
+    long j = 0;
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        Buffer cookie;
+        buffer_init(&cookie, 0);
+        cookie_put_string(&cookie, "session", 7, str, len, 1, 1);
+        cookie_put_string(&cookie, "Path", 4, "/", 1, 0, 0);
+        buffer_fini(&cookie);
+    }
+    report(what, now() - start, gmem_allocs - allocs);
+}
+
+int main(void)
+{
+    static char plain[PAIRS * (VALUE_LEN + 16) + 1];
+    static char escaped[PAIRS * (VALUE_LEN + 16) + 1];
+    static char hex[PAIRS * (3 * VALUE_LEN / 4 + 16) + 1];
+    static char value[VALUE_LEN + 1];
+    int plen = 0;
+    int elen = 0;
+    int hlen = 0;
+    int j = 0;
+    int k = 0;
+
+    scan_init();
+
+    for (j = 0; j < VALUE_LEN; ++j) {
+        value[j] = 'a' + j % 26;
+    }
+    for (j = 0; j < PAIRS; ++j) {
+        plen += sprintf(plain + plen, "%sname_%02d=%s",
+                        j ? "; " : "", j, value);
+        /* one escaped character forces copying the value */
+        elen += sprintf(escaped + elen, "%sname_%02d=%%20%s",
+                        j ? "; " : "", j, value + 3);
+        /* every character escaped, the worst case for decoding */
+        hlen += sprintf(hex + hlen, "%sname_%02d=", j ? "; " : "", j);
+        for (k = 0; k < VALUE_LEN / 4; ++k) {
+            hlen += sprintf(hex + hlen, "%%%02X", (unsigned char) value[k]);
+        }
+    }
+    for (j = 0; j < VALUE_LEN; j += 10) {
+        value[j] = ' ';
+    }
+
+    bench_crush("crush, plain values", plain, plen);
+    bench_crush("crush, escaped values", escaped, elen);
+    bench_crush("crush, all escaped values", hex, hlen);
+    bench_bake("bake, value with spaces", value, VALUE_LEN);
+
+    return 0;
+}
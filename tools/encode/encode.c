@@ -8,6 +8,9 @@ static void preamble(void);
 static void decode_table(const char* name);
 static void encode_table(const char* name);
 static void state_table(const char* name);
+static void plain_table(const char* name);
+static void open_guard(const char* which);
+static void close_guard(void);
 static void coda(void);
 
 int main(int argc, char* argv[])
@@ -16,6 +19,7 @@ int main(int argc, char* argv[])
     decode_table("uri_decode_tbl");
     encode_table("uri_encode_tbl");
     state_table("uri_state_tbl");
+    plain_table("uri_plain_tbl");
 
     coda();
 
@@ -33,7 +37,28 @@ static void preamble(void)
     printf("\n");
     printf("#define NIBBLE_BITS 4\n");
     printf("#define MAKE_BYTE(nh, nl) (((nh) << NIBBLE_BITS) | (nl))\n");
+    printf("#define NIBBLE_NONE %d\n", NIBBLE);
     printf("\n");
+    printf("/*\n");
+    printf(" * All the tables are defined by default.  To get only some of them, and\n");
+    printf(" * no warnings about the others not being used, define URI_TABLES_SOME\n");
+    printf(" * and then any of URI_TABLE_DECODE, URI_TABLE_ENCODE, URI_TABLE_STATE\n");
+    printf(" * and URI_TABLE_PLAIN before including this file.\n");
+    printf(" */\n");
+    printf("\n");
+}
+
+/*
+ * Only define a table when it was asked for, or when no table was.
+ */
+static void open_guard(const char* which)
+{
+    printf("#if !defined(URI_TABLES_SOME) || defined(URI_TABLE_%s)\n", which);
+}
+
+static void close_guard(void)
+{
+    printf("#endif\n\n");
 }
 
 static void coda(void)
@@ -49,10 +74,13 @@ static void coda(void)
 static void decode_table(const char* name)
 {
     printf("/*\n");
-    printf(" * Table has a 0 if that character cannot be a hex digit;\n");
-    printf(" * otherwise it has the decimal value for that hex digit.\n");
+    printf(" * Table has NIBBLE_NONE if that character cannot be a hex digit;\n");
+    printf(" * otherwise it has the decimal value for that hex digit.  This way,\n");
+    printf(" * two characters are both hex digits if OR-ing their values gives\n");
+    printf(" * something below NIBBLE_NONE.\n");
     printf(" */\n");
-    printf("static char %s[%d] =\n", name, NIBBLE*NIBBLE);
+    open_guard("DECODE");
+    printf("static unsigned char %s[%d] =\n", name, NIBBLE*NIBBLE);
     printf("/*");
     for (unsigned char r = 0; r < NIBBLE; ++r) {
         printf("%5x", r);
@@ -68,7 +96,7 @@ static void decode_table(const char* name)
 
             /*
              * If the character is a valid hexadecimal digit, the table will
-             * contain its value; otherwise it will have a zero.
+             * contain its value; otherwise it will have NIBBLE_NONE.
              */
             if (x >= '0' && x <= '9') {
                 hex = 1;
@@ -82,11 +110,12 @@ static void decode_table(const char* name)
                 hex = 1;
                 dig = x - 'A' + 10;
             }
-            printf(" %3d,", hex ? dig : 0);
+            printf(" %3d,", hex ? dig : NIBBLE);
         }
         printf("  /* %1x: %3d ~ %3d */\n", r, m, m + NIBBLE - 1);
     }
-    printf("};\n\n");
+    printf("};\n");
+    close_guard();
 }
 
 /*
@@ -98,6 +127,7 @@ static void encode_table(const char* name)
     printf(" * Table has a 0 if that character doesn't need to be encoded;\n");
     printf(" * otherwise it has a string with the character encoded in hex digits.\n");
     printf(" */\n");
+    open_guard("ENCODE");
     printf("static char* %s[%d] =\n", name, NIBBLE*NIBBLE);
     printf("/");
     for (unsigned char r = 0; r < NIBBLE; ++r) {
@@ -122,7 +152,8 @@ static void encode_table(const char* name)
         }
         printf("  /* %1x: %3d ~ %3d */\n", r, m, m + NIBBLE - 1);
     }
-    printf("};\n\n");
+    printf("};\n");
+    close_guard();
 }
 
 #define URI_STATE_START  0
@@ -157,6 +188,7 @@ static void state_table(const char* name)
     printf("#define %-20.20s %s\n", "URI_STATE_TERMINATE", "URI_STATE_END");
     printf("\n");
 
+    open_guard("STATE");
     printf("static char %s[%d][%d] =\n", name, NIBBLE*NIBBLE, size+1);
     printf("/* ");
     for (int state = 0; state < size; ++state) {
@@ -215,5 +247,42 @@ static void state_table(const char* name)
         }
         printf("},  /* %2x -- %3d -- %c */\n", x, x, isprint(c) ? c : '.');
     }
-    printf("};\n\n");
+    printf("};\n");
+    close_guard();
+}
+
+/*
+ * Generate a table which identifies characters that can be copied verbatim
+ * while parsing the name or value in a cookie; the parser can skip over whole
+ * runs of these characters without going through the state machine.
+ */
+static void plain_table(const char* name)
+{
+    printf("/*\n");
+    printf(" * Table has a 1 if that character can be copied verbatim while parsing;\n");
+    printf(" * otherwise (separators, '%%' and whitespace) it has a 0.\n");
+    printf(" */\n");
+    open_guard("PLAIN");
+    printf("static char %s[%d] =\n", name, NIBBLE*NIBBLE);
+    printf("/*");
+    for (unsigned char r = 0; r < NIBBLE; ++r) {
+        printf("%3x", r);
+    }
+    printf(" */\n{\n");
+    for (unsigned char r = 0; r < NIBBLE; ++r) {
+        unsigned char m = r << NIBBLE_BITS;
+        printf("   ");
+        for (unsigned char c = 0; c < NIBBLE; ++c) {
+            unsigned char x = m | c;
+            int plain = !(x == '\0' ||
+                          x == ';' ||
+                          x == '=' ||
+                          x == '%' ||
+                          isspace(x));
+            printf(" %d,", plain);
+        }
+        printf("  /* %1x: %3d ~ %3d */\n", r, m, m + NIBBLE - 1);
+    }
+    printf("};\n");
+    close_guard();
 }
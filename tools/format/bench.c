@@ -0,0 +1,77 @@
+/*
+ * Compare the speed of the fast formatting functions with the speed of
+ * sprintf() and gmtime_r().
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "format.h"
+
+#define ITERATIONS 10000000L
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* what, double elapsed, double base)
+{
+    printf("%-30s %8.3f s  %6.1f ns/call  %5.2fx\n",
+           what, elapsed, elapsed * 1e9 / ITERATIONS, base / elapsed);
+}
+
+int main(void)
+{
+    static const char* Mon[] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec",
+    };
+    static const char* Day[] = {
+        "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat",
+    };
+    char buf[64];
+    unsigned long sum = 0;
+    double start = 0;
+    double base = 0;
+    long j = 0;
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        sprintf(buf, "%ld", j * 7919L);
+        sum += strlen(buf);
+    }
+    base = now() - start;
+    report("sprintf(\"%ld\")", base, base);
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        sum += format_long(buf, j * 7919L);
+    }
+    report("format_long()", now() - start, base);
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        time_t t = (time_t) (j * 409L);
+        struct tm gmt;
+        gmtime_r(&t, &gmt);
+        sprintf(buf, "%3s, %02d-%3s-%04d %02d:%02d:%02d GMT",
+                Day[gmt.tm_wday], gmt.tm_mday, Mon[gmt.tm_mon],
+                gmt.tm_year + 1900, gmt.tm_hour, gmt.tm_min, gmt.tm_sec);
+        sum += buf[5];
+    }
+    base = now() - start;
+    report("gmtime_r() + sprintf()", base, base);
+
+    start = now();
+    for (j = 0; j < ITERATIONS; ++j) {
+        format_date(buf, (time_t) (j * 409L), FORMAT_DATE_NETSCAPE);
+        sum += buf[5];
+    }
+    report("format_date()", now() - start, base);
+
+    /* make sure the compiler does not optimize the loops away */
+    printf("(checksum %lu)\n", sum);
+    return 0;
+}
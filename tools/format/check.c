@@ -0,0 +1,90 @@
+/*
+ * Check the fast formatting functions against sprintf() and gmtime_r(),
+ * for every second between 1970 and 2100 and for lots of integers.
+ *
+ * Pass a number of seconds as argument to check only one out of that many
+ * seconds; checking every second takes a few minutes.
+ */
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "format.h"
+
+#define FIRST_SECOND 0L             /* 1970-01-01 00:00:00 */
+#define LAST_SECOND  4133980799L    /* 2100-12-31 23:59:59 */
+
+static int check_long(long value)
+{
+    char expected[50];
+    char got[FORMAT_LONG_LEN];
+    unsigned int len = 0;
+
+    sprintf(expected, "%ld", value);
+    len = format_long(got, value);
+    if (len != strlen(expected) || memcmp(got, expected, len) != 0) {
+        printf("FAIL: format_long(%ld) => [%.*s]\n", value, (int) len, got);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_date(time_t t)
+{
+    static const char* Mon[] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec",
+    };
+    static const char* Day[] = {
+        "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat",
+    };
+    char expected[50];
+    char got[FORMAT_DATE_LEN];
+    struct tm gmt;
+
+    gmtime_r(&t, &gmt);
+    sprintf(expected, "%3s, %02d-%3s-%04d %02d:%02d:%02d GMT",
+            Day[gmt.tm_wday], gmt.tm_mday, Mon[gmt.tm_mon],
+            gmt.tm_year + 1900, gmt.tm_hour, gmt.tm_min, gmt.tm_sec);
+    format_date(got, t, FORMAT_DATE_NETSCAPE);
+    if (memcmp(got, expected, FORMAT_DATE_LEN) != 0) {
+        printf("FAIL: format_date(%ld) => [%.*s], expected [%s]\n",
+               (long) t, FORMAT_DATE_LEN, got, expected);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    long step = argc > 1 ? atol(argv[1]) : 1;
+    long errors = 0;
+    long checked = 0;
+    long value = 0;
+    long t = 0;
+    int j = 0;
+
+    for (value = -100000; value <= 100000; ++value) {
+        errors += check_long(value);
+        ++checked;
+    }
+    for (j = 0; j < 63; ++j) {
+        long power = 1L << j;
+        errors += check_long(power) + check_long(power - 1) + check_long(power + 1);
+        errors += check_long(-power) + check_long(-power - 1) + check_long(-power + 1);
+        checked += 6;
+    }
+    errors += check_long(LONG_MAX) + check_long(LONG_MIN);
+    checked += 2;
+    printf("checked %ld integers, %ld errors\n", checked, errors);
+
+    checked = 0;
+    for (t = FIRST_SECOND; t <= LAST_SECOND; t += step < 1 ? 1 : step) {
+        errors += check_date((time_t) t);
+        ++checked;
+    }
+    printf("checked %ld dates, %ld errors\n", checked, errors);
+
+    return errors > 0;
+}
@@ -0,0 +1,492 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Compile the Public Suffix List (https://publicsuffix.org/list/) into a
+ * reversed-label trie, printed as static tables for psl.c:
+ *
+ *   ./trie public_suffix_list.dat > psl_tables.h
+ *
+ * Each rule is split into labels, which are inserted from the last one
+ * ("com" before "co" in "co.com"); a wildcard rule ("*.ck") marks its
+ * parent node, an exception rule ("!www.ck") marks its own node.  Rules
+ * with non-ASCII labels are added twice: as UTF-8, and in their ASCII
+ * form ("xn--" plus Punycode), which is what hosts normally have.
+ *
+ * Nodes are laid out breadth first, so the children of every node are
+ * contiguous, and sorted by length and then bytes, so they can be found
+ * with a binary search.  Each distinct label is stored only once.
+ */
+
+/* must match psl.h */
+#define PSL_RULE      0x01
+#define PSL_WILDCARD  0x02
+#define PSL_EXCEPTION 0x04
+
+#define LABEL_MAX     63
+#define RULE_MAX      1024
+#define LINE_WIDTH    72
+
+typedef struct Node {
+    char* label;
+    unsigned int len;
+    unsigned int flags;
+    struct Node** children;
+    unsigned int count;
+    unsigned int size;
+    unsigned int pos;           /* position in the node table */
+    unsigned int offset;        /* offset of its label in the label table */
+} Node;
+
+static Node root;
+static unsigned int rules;
+
+static void* allocate(void* ptr, size_t size)
+{
+    ptr = realloc(ptr, size);
+    if (!ptr) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+static int compare_labels(const char* la, unsigned int na, const char* lb, unsigned int nb)
+{
+    if (na != nb) {
+        return na < nb ? -1 : 1;
+    }
+    return memcmp(la, lb, na);
+}
+
+static int compare_nodes(const void* a, const void* b)
+{
+    const Node* na = *(const Node* const*) a;
+    const Node* nb = *(const Node* const*) b;
+    return compare_labels(na->label, na->len, nb->label, nb->len);
+}
+
+static Node* get_child(Node* node, const char* label, unsigned int len)
+{
+    Node* child = 0;
+    unsigned int j = 0;
+
+    for (j = 0; j < node->count; ++j) {
+        if (compare_labels(node->children[j]->label, node->children[j]->len, label, len) == 0) {
+            return node->children[j];
+        }
+    }
+
+    if (node->count >= node->size) {
+        node->size = node->size ? 2 * node->size : 4;
+        node->children = allocate(node->children, node->size * sizeof(Node*));
+    }
+    child = allocate(0, sizeof(Node));
+    memset(child, 0, sizeof(Node));
+    child->label = allocate(0, len);
+    memcpy(child->label, label, len);
+    child->len = len;
+    node->children[node->count++] = child;
+    return child;
+}
+
+/*
+ * Decode one UTF-8 character; return its length, or 0 if it is invalid.
+ */
+static unsigned int utf8_decode(const unsigned char* s, unsigned int len, unsigned long* cp)
+{
+    unsigned int need = 0;
+    unsigned int j = 0;
+
+    if (s[0] < 0x80) {
+        *cp = s[0];
+        return 1;
+    } else if ((s[0] & 0xe0) == 0xc0) {
+        *cp = s[0] & 0x1f;
+        need = 2;
+    } else if ((s[0] & 0xf0) == 0xe0) {
+        *cp = s[0] & 0x0f;
+        need = 3;
+    } else if ((s[0] & 0xf8) == 0xf0) {
+        *cp = s[0] & 0x07;
+        need = 4;
+    } else {
+        return 0;
+    }
+    if (need > len) {
+        return 0;
+    }
+    for (j = 1; j < need; ++j) {
+        if ((s[j] & 0xc0) != 0x80) {
+            return 0;
+        }
+        *cp = (*cp << 6) | (s[j] & 0x3f);
+    }
+    return need;
+}
+
+static char punycode_digit(unsigned long d)
+{
+    return (char) (d < 26 ? 'a' + d : '0' + d - 26);
+}
+
+static unsigned long punycode_adapt(unsigned long delta, unsigned long points, int first)
+{
+    unsigned long k = 0;
+
+    delta = first ? delta / 700 : delta / 2;
+    delta += delta / points;
+    while (delta > ((36 - 1) * 26) / 2) {
+        delta /= 36 - 1;
+        k += 36;
+    }
+    return k + (36 * delta) / (delta + 38);
+}
+
+/*
+ * Convert a UTF-8 label to its ASCII form, "xn--" plus Punycode (RFC
+ * 3492); return its length, or 0 if it cannot be converted.
+ */
+static unsigned int punycode(const char* label, unsigned int len, char* out)
+{
+    unsigned long cps[LABEL_MAX * 4];
+    unsigned int ncp = 0;
+    unsigned int olen = 0;
+    unsigned int basic = 0;
+    unsigned int handled = 0;
+    unsigned long n = 128;
+    unsigned long delta = 0;
+    unsigned long bias = 72;
+    unsigned int j = 0;
+
+    for (j = 0; j < len; ) {
+        unsigned int used = utf8_decode((const unsigned char*) label + j, len - j, &cps[ncp]);
+        if (!used) {
+            return 0;
+        }
+        j += used;
+        ++ncp;
+    }
+
+    memcpy(out, "xn--", 4);
+    olen = 4;
+    for (j = 0; j < ncp; ++j) {
+        if (cps[j] < 0x80) {
+            out[olen++] = (char) cps[j];
+        }
+    }
+    handled = basic = olen - 4;
+    if (basic > 0) {
+        out[olen++] = '-';
+    }
+
+    while (handled < ncp) {
+        unsigned long m = (unsigned long) -1;
+        for (j = 0; j < ncp; ++j) {
+            if (cps[j] >= n && cps[j] < m) {
+                m = cps[j];
+            }
+        }
+        delta += (m - n) * (handled + 1);
+        n = m;
+        for (j = 0; j < ncp; ++j) {
+            if (cps[j] < n) {
+                ++delta;
+            }
+            if (cps[j] == n) {
+                unsigned long q = delta;
+                unsigned long k = 0;
+                for (k = 36; ; k += 36) {
+                    unsigned long t = k <= bias ? 1 : k >= bias + 26 ? 26 : k - bias;
+                    if (q < t) {
+                        break;
+                    }
+                    out[olen++] = punycode_digit(t + (q - t) % (36 - t));
+                    q = (q - t) / (36 - t);
+                }
+                out[olen++] = punycode_digit(q);
+                bias = punycode_adapt(delta, handled + 1, handled == basic);
+                delta = 0;
+                ++handled;
+            }
+        }
+        ++delta;
+        ++n;
+    }
+
+    return olen <= LABEL_MAX ? olen : 0;
+}
+
+/*
+ * Add a rule, given as its labels; ascii asks to convert non-ASCII labels.
+ */
+static void add_rule(const char* rule, unsigned int len, unsigned int flags, int ascii)
+{
+    Node* node = &root;
+    unsigned int end = len;
+
+    while (end > 0) {
+        char converted[LABEL_MAX + 1];
+        const char* label = 0;
+        unsigned int llen = 0;
+        unsigned int beg = end;
+        unsigned int j = 0;
+        int plain = 1;
+
+        while (beg > 0 && rule[beg - 1] != '.') {
+            --beg;
+        }
+        label = rule + beg;
+        llen = end - beg;
+        for (j = 0; j < llen; ++j) {
+            if ((unsigned char) label[j] >= 0x80) {
+                plain = 0;
+            }
+        }
+        if (!plain && ascii) {
+            llen = punycode(label, llen, converted);
+            label = converted;
+        }
+        if (llen == 0 || llen > LABEL_MAX) {
+            fprintf(stderr, "Invalid rule %.*s\n", (int) len, rule);
+            exit(1);
+        }
+
+        node = get_child(node, label, llen);
+        end = beg > 0 ? beg - 1 : 0;
+    }
+    node->flags |= flags;
+}
+
+static void read_rules(FILE* fp)
+{
+    char line[RULE_MAX];
+
+    while (fgets(line, sizeof(line), fp)) {
+        char* rule = line;
+        unsigned int len = 0;
+        unsigned int flags = PSL_RULE;
+        unsigned int j = 0;
+        int ascii = 1;
+
+        /* a rule is the first word in a line; skip comments */
+        while (rule[len] && rule[len] != ' ' && rule[len] != '\t' &&
+               rule[len] != '\r' && rule[len] != '\n') {
+            ++len;
+        }
+        if (len == 0 || (len >= 2 && rule[0] == '/' && rule[1] == '/')) {
+            continue;
+        }
+
+        if (rule[0] == '!') {
+            flags = PSL_EXCEPTION;
+            ++rule;
+            --len;
+        } else if (len > 2 && rule[0] == '*' && rule[1] == '.') {
+            flags = PSL_WILDCARD;
+            rule += 2;
+            len -= 2;
+        }
+
+        for (j = 0; j < len; ++j) {
+            if (rule[j] >= 'A' && rule[j] <= 'Z') {
+                rule[j] = rule[j] - 'A' + 'a';
+            }
+            if ((unsigned char) rule[j] >= 0x80) {
+                ascii = 0;
+            }
+        }
+
+        add_rule(rule, len, flags, 1);
+        if (!ascii) {
+            add_rule(rule, len, flags, 0);
+        }
+        ++rules;
+    }
+}
+
+/*
+ * Longer labels first; for the same length, in byte order.
+ */
+static int compare_longest(const void* a, const void* b)
+{
+    const Node* na = *(const Node* const*) a;
+    const Node* nb = *(const Node* const*) b;
+    if (na->len != nb->len) {
+        return na->len > nb->len ? -1 : 1;
+    }
+    return memcmp(na->label, nb->label, na->len);
+}
+
+/*
+ * Return the offset of a label anywhere in the labels stored so far, or
+ * -1 if it is not there.
+ */
+static int find_label(const char* labels, unsigned int lused, const char* label, unsigned int len)
+{
+    unsigned int j = 0;
+
+    for (j = 0; j + len <= lused; ++j) {
+        if (labels[j] == label[0] && memcmp(labels + j, label, len) == 0) {
+            return (int) j;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Lay out the nodes breadth first, and intern their labels.
+ */
+static Node** layout(unsigned int* total, char** labels, unsigned int* lsize)
+{
+    Node** order = 0;
+    unsigned int count = 1;
+    unsigned int size = 1024;
+    unsigned int j = 0;
+    unsigned int lused = 0;
+    Node** byname = 0;
+
+    order = allocate(0, size * sizeof(Node*));
+    order[0] = &root;
+    *labels = 0;
+    *lsize = 0;
+
+    for (j = 0; j < count; ++j) {
+        Node* node = order[j];
+        unsigned int k = 0;
+
+        qsort(node->children, node->count, sizeof(Node*), compare_nodes);
+        for (k = 0; k < node->count; ++k) {
+            if (count >= size) {
+                size *= 2;
+                order = allocate(order, size * sizeof(Node*));
+            }
+            node->children[k]->pos = count;
+            order[count++] = node->children[k];
+        }
+    }
+
+    /* intern labels, longest first, so that a label that is part of a
+     * label already stored (such as "co" in "com") takes no room */
+    byname = allocate(0, count * sizeof(Node*));
+    memcpy(byname, order, count * sizeof(Node*));
+    qsort(byname + 1, count - 1, sizeof(Node*), compare_longest);
+    for (j = 1; j < count; ++j) {
+        Node* node = byname[j];
+        int found = find_label(*labels, lused, node->label, node->len);
+        if (found >= 0) {
+            node->offset = (unsigned int) found;
+            continue;
+        }
+        if (lused + node->len > *lsize) {
+            *lsize = *lsize ? 2 * *lsize : 4096;
+            *labels = allocate(*labels, *lsize);
+        }
+        node->offset = lused;
+        memcpy(*labels + lused, node->label, node->len);
+        lused += node->len;
+    }
+    free(byname);
+
+    *lsize = lused;
+    *total = count;
+    return order;
+}
+
+/*
+ * Print the labels as a string, in lines of about LINE_WIDTH characters;
+ * bytes that are not printable ASCII are escaped in octal.
+ */
+static void print_labels(const char* labels, unsigned int len)
+{
+    unsigned int column = 0;
+    unsigned int j = 0;
+
+    printf("static const char psl_labels[] =\n");
+    for (j = 0; j < len; ++j) {
+        unsigned char c = (unsigned char) labels[j];
+        if (column == 0) {
+            printf("    \"");
+            column = 5;
+        }
+        if (c >= 0x20 && c < 0x7f && c != '"' && c != '\\' && c != '?') {
+            putchar(c);
+            column += 1;
+        } else {
+            printf("\\%03o", (unsigned int) c);
+            column += 4;
+        }
+        if (column >= LINE_WIDTH || j + 1 == len) {
+            printf("\"\n");
+            column = 0;
+        }
+    }
+    printf("%s;\n\n", len ? "" : "    \"\"");
+}
+
+static void print_nodes(Node** order, unsigned int count)
+{
+    unsigned int j = 0;
+
+    printf("/*\n");
+    printf(" * The trie: first child, label offset, number of children, label\n");
+    printf(" * length and flags.  The root is the first node; its children are\n");
+    printf(" * the top level domains.\n");
+    printf(" */\n");
+    printf("static const PslNode psl_nodes[%u] = {\n", count);
+    for (j = 0; j < count; ++j) {
+        const Node* node = order[j];
+        unsigned int first = node->count ? node->children[0]->pos : 0;
+        printf("%s{%u,%u,%u,%u,%u},", j % 4 ? " " : "    ",
+               first, node->offset, node->count, node->len, node->flags);
+        if (j % 4 == 3 || j + 1 == count) {
+            printf("\n");
+        }
+    }
+    printf("};\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    FILE* fp = 0;
+    Node** order = 0;
+    unsigned int count = 0;
+    char* labels = 0;
+    unsigned int lsize = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s public_suffix_list.dat\n", argv[0]);
+        return 1;
+    }
+    fp = fopen(argv[1], "r");
+    if (!fp) {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+    read_rules(fp);
+    fclose(fp);
+
+    order = layout(&count, &labels, &lsize);
+
+    printf("/*\n");
+    printf(" *  THIS FILE WAS GENERATED AUTOMATICALLY\n");
+    printf(" *\n");
+    printf(" *  DON'T EDIT IT BY HAND!\n");
+    printf(" *  (unless you know what you are doing)\n");
+    printf(" *\n");
+    printf(" *  Built by tools/psl/trie from the Public Suffix List, which is\n");
+    printf(" *  subject to the terms of the Mozilla Public License, v. 2.0;\n");
+    printf(" *  see https://publicsuffix.org/list/\n");
+    printf(" *\n");
+    printf(" *  %u rules, %u nodes, %u bytes of labels.\n", rules, count, lsize);
+    printf(" */\n");
+    printf("\n");
+    print_labels(labels, lsize);
+    print_nodes(order, count);
+    printf("/*\n");
+    printf(" *  END OF FILE\n");
+    printf(" */\n");
+
+    return 0;
+}
@@ -1,10 +1,13 @@
-#include <ctype.h>
 #include <string.h>
 #include "uri.h"
+#include "scan.h"
 
 /*
  * This file is generated automatically with program "encode".
  */
+#define URI_TABLES_SOME
+#define URI_TABLE_DECODE
+#define URI_TABLE_ENCODE
 #include "uri_tables.h"
 
 /*
@@ -15,63 +18,124 @@
  */
 #define CAST_INDEX(x) (((unsigned char) (x)) & 0xff)
 
-Buffer* url_decode(Buffer* src, Buffer* tgt)
+unsigned int url_decode_str(const char* src, unsigned int len, char* tgt)
 {
-    unsigned int s = src->rpos;
-    unsigned int t = tgt->wpos;
+    unsigned int s = 0;
+    unsigned int t = 0;
 
-    /* check and maybe increase space in target */
-    buffer_ensure_unused(tgt, buffer_used(src));
+    while (s < len) {
+        /* find the next '%' (memchr is vectorized) and copy the whole
+         * run before it in one go; this is the only pass we make when
+         * there is nothing to decode; escapes often come one after the
+         * other, so check for that before calling memchr */
+        const char* pct = src[s] == '%' ? src + s
+                                        : (const char*) memchr(src + s, '%', len - s);
+        unsigned int run = pct ? (unsigned int) (pct - src) - s : len - s;
+        if (run && tgt + t != src + s) {
+            memmove(tgt + t, src + s, run);
+        }
+        s += run;
+        t += run;
+        if (!pct) {
+            break;
+        }
 
-    while (s < src->wpos) {
-        if (src->data[s] == '%' &&
-            isxdigit(src->data[s+1]) &&
-            isxdigit(src->data[s+2])) {
-            /* put a byte together from the next two hex digits */
-            tgt->data[t++] = MAKE_BYTE(uri_decode_tbl[CAST_INDEX(src->data[s+1])],
-                                       uri_decode_tbl[CAST_INDEX(src->data[s+2])]);
-            /* we used up 3 characters (%XY) from source */
-            s += 3;
-        } else {
-            tgt->data[t++] = src->data[s++];
+        if (s + 2 < len) {
+            unsigned char nh = uri_decode_tbl[CAST_INDEX(src[s+1])];
+            unsigned char nl = uri_decode_tbl[CAST_INDEX(src[s+2])];
+            if ((nh | nl) < NIBBLE_NONE) {
+                /* put a byte together from the next two hex digits;
+                 * we used up 3 characters (%XY) from source */
+                tgt[t++] = MAKE_BYTE(nh, nl);
+                s += 3;
+                continue;
+            }
         }
+
+        /* not followed by two hex digits, copy the '%' as is */
+        tgt[t++] = src[s++];
     }
 
-    /* null-terminate target and return src as was left */
-    src->rpos = s;
-    tgt->wpos = t;
+    return t;
+}
+
+Buffer* url_decode(Buffer* src, Buffer* tgt)
+{
+    /* check and maybe increase space in target */
+    buffer_ensure_unused(tgt, buffer_used(src));
+
+    tgt->wpos += url_decode_str(src->data + src->rpos, buffer_used(src),
+                                tgt->data + tgt->wpos);
+
+    /* return src as was left */
+    src->rpos = src->wpos;
     return src;
 }
 
-Buffer* url_encode(Buffer* src, Buffer* tgt)
+unsigned int url_encode_str(const char* src, unsigned int len, char* tgt)
 {
-    unsigned int s = src->rpos;
-    unsigned int t = tgt->wpos;
+    unsigned int s = 0;
+    unsigned int t = 0;
 
-    /* check and maybe increase space in target */
-    buffer_ensure_unused(tgt, 3 * buffer_used(src));
+    while (s < len) {
+        /* copy the whole run of characters that don't need to be
+         * encoded in one go */
+        unsigned int run = scan_unreserved(src + s, len - s);
+        if (run && tgt + t != src + s) {
+            memmove(tgt + t, src + s, run);
+        }
+        s += run;
+        t += run;
 
-    while (s < src->wpos) {
-        char* v = uri_encode_tbl[CAST_INDEX(src->data[s])];
+        /* encode characters using our table, until we find one that
+         * doesn't need it */
+        while (s < len) {
+            char* v = uri_encode_tbl[CAST_INDEX(src[s])];
+            if (!v) {
+                break;
+            }
 
-        /* if current source character doesn't need to be encoded,
-           just copy it to target*/
-        if (!v) {
-            tgt->data[t++] = src->data[s++];
-            continue;
+            /* copy encoded character from our table */
+            memcpy(tgt + t, v, 3);
+
+            /* we used up 3 characters (%XY) in target
+             * and 1 character from source */
+            t += 3;
+            ++s;
         }
+    }
 
-        /* copy encoded character from our table */
-        memcpy(tgt->data + t, v, 3);
+    return t;
+}
+
+unsigned int url_encoded_len(const char* src, unsigned int len)
+{
+    unsigned int s = 0;
+    unsigned int t = 0;
 
-        /* we used up 3 characters (%XY) in target
-         * and 1 character from source */
-        t += 3;
-        ++s;
+    while (s < len) {
+        unsigned int run = scan_unreserved(src + s, len - s);
+        s += run;
+        t += run;
+        if (s < len) {
+            /* the character after a run always needs encoding */
+            t += 3;
+            ++s;
+        }
     }
 
-    /* null-terminate target and return src as was left */
-    src->rpos = s;
-    tgt->wpos = t;
+    return t;
+}
+
+Buffer* url_encode(Buffer* src, Buffer* tgt)
+{
+    /* check and maybe increase space in target */
+    buffer_ensure_unused(tgt, 3 * buffer_used(src));
+
+    tgt->wpos += url_encode_str(src->data + src->rpos, buffer_used(src),
+                                tgt->data + tgt->wpos);
+
+    /* return src as was left */
+    src->rpos = src->wpos;
     return src;
 }
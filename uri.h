@@ -3,6 +3,11 @@
 
 /*
  * Routines to URI encode and decode a string efficiently.
+ *
+ * When encoding, runs of characters that need no encoding are found with
+ * scan_unreserved() (so scan_init() must have been called) and copied in
+ * one go.  When decoding, the runs between '%' characters are copied in one
+ * go, and a string without any '%' is copied with a single memcpy.
  */
 
 #include "buffer.h"
@@ -10,4 +15,27 @@
 Buffer* url_decode(Buffer* src, Buffer* tgt);
 Buffer* url_encode(Buffer* src, Buffer* tgt);
 
+/*
+ * URL-decode len characters from src into tgt, returning the number of
+ * characters written.  Decoding never makes a string longer, so tgt must
+ * have room for len characters; tgt may also be the same as src, to decode
+ * a string in place.  A '%' not followed by two hex digits is left alone.
+ */
+unsigned int url_decode_str(const char* src, unsigned int len, char* tgt);
+
+/*
+ * URL-encode len characters from src into tgt, returning the number of
+ * characters written.  Encoding at most triples the length of a string, so
+ * tgt must have room for 3 * len characters.  To encode a string in place,
+ * move it to the last len characters of such a buffer and use the start of
+ * the buffer as tgt: we never write past the character we are reading.
+ */
+unsigned int url_encode_str(const char* src, unsigned int len, char* tgt);
+
+/*
+ * Number of characters that URL-encoding len characters from src would
+ * produce.
+ */
+unsigned int url_encoded_len(const char* src, unsigned int len);
+
 #endif
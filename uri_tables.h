@@ -7,36 +7,49 @@
 
 #define NIBBLE_BITS 4
 #define MAKE_BYTE(nh, nl) (((nh) << NIBBLE_BITS) | (nl))
+#define NIBBLE_NONE 16
 
 /*
- * Table has a 0 if that character cannot be a hex digit;
- * otherwise it has the decimal value for that hex digit.
+ * All the tables are defined by default.  To get only some of them, and
+ * no warnings about the others not being used, define URI_TABLES_SOME
+ * and then any of URI_TABLE_DECODE, URI_TABLE_ENCODE, URI_TABLE_STATE
+ * and URI_TABLE_PLAIN before including this file.
  */
-static char uri_decode_tbl[256] =
+
+/*
+ * Table has NIBBLE_NONE if that character cannot be a hex digit;
+ * otherwise it has the decimal value for that hex digit.  This way,
+ * two characters are both hex digits if OR-ing their values gives
+ * something below NIBBLE_NONE.
+ */
+#if !defined(URI_TABLES_SOME) || defined(URI_TABLE_DECODE)
+static unsigned char uri_decode_tbl[256] =
 /*    0    1    2    3    4    5    6    7    8    9    a    b    c    d    e    f */
 {
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 0:   0 ~  15 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 1:  16 ~  31 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 2:  32 ~  47 */
-      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   0,   0,   0,   0,   0,   0,  /* 3:  48 ~  63 */
-      0,  10,  11,  12,  13,  14,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 4:  64 ~  79 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 5:  80 ~  95 */
-      0,  10,  11,  12,  13,  14,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 6:  96 ~ 111 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 7: 112 ~ 127 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 8: 128 ~ 143 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* 9: 144 ~ 159 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* a: 160 ~ 175 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* b: 176 ~ 191 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* c: 192 ~ 207 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* d: 208 ~ 223 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* e: 224 ~ 239 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  /* f: 240 ~ 255 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 0:   0 ~  15 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 1:  16 ~  31 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 2:  32 ~  47 */
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  16,  16,  16,  16,  16,  16,  /* 3:  48 ~  63 */
+     16,  10,  11,  12,  13,  14,  15,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 4:  64 ~  79 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 5:  80 ~  95 */
+     16,  10,  11,  12,  13,  14,  15,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 6:  96 ~ 111 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 7: 112 ~ 127 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 8: 128 ~ 143 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* 9: 144 ~ 159 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* a: 160 ~ 175 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* b: 176 ~ 191 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* c: 192 ~ 207 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* d: 208 ~ 223 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* e: 224 ~ 239 */
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  /* f: 240 ~ 255 */
 };
+#endif
 
 /*
  * Table has a 0 if that character doesn't need to be encoded;
  * otherwise it has a string with the character encoded in hex digits.
  */
+#if !defined(URI_TABLES_SOME) || defined(URI_TABLE_ENCODE)
 static char* uri_encode_tbl[256] =
 /*    0     1     2     3     4     5     6     7     8     9     a     b     c     d     e     f */
 {
@@ -57,6 +70,7 @@ static char* uri_encode_tbl[256] =
    "%e0","%e1","%e2","%e3","%e4","%e5","%e6","%e7","%e8","%e9","%ea","%eb","%ec","%ed","%ee","%ef",  /* e: 224 ~ 239 */
    "%f0","%f1","%f2","%f3","%f4","%f5","%f6","%f7","%f8","%f9","%fa","%fb","%fc","%fd","%fe","%ff",  /* f: 240 ~ 255 */
 };
+#endif
 
 /*
  * Table has the next state given last read character and current state.
@@ -72,6 +86,7 @@ static char* uri_encode_tbl[256] =
 /* Minimum state that indicates we must terminate processing */
 #define URI_STATE_TERMINATE  URI_STATE_END
 
+#if !defined(URI_TABLES_SOME) || defined(URI_TABLE_STATE)
 static char uri_state_tbl[256][7] =
 /*     0    1    2    3    4    5*/
 {
@@ -332,6 +347,34 @@ static char uri_state_tbl[256][7] =
     {  1,   1,   3,   3,   4,   5, },  /* fe -- 254 -- . */
     {  1,   1,   3,   3,   4,   5, },  /* ff -- 255 -- . */
 };
+#endif
+
+/*
+ * Table has a 1 if that character can be copied verbatim while parsing;
+ * otherwise (separators, '%' and whitespace) it has a 0.
+ */
+#if !defined(URI_TABLES_SOME) || defined(URI_TABLE_PLAIN)
+static char uri_plain_tbl[256] =
+/*  0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f */
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1,  /* 0:   0 ~  15 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 1:  16 ~  31 */
+    0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 2:  32 ~  47 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1,  /* 3:  48 ~  63 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 4:  64 ~  79 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 5:  80 ~  95 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 6:  96 ~ 111 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 7: 112 ~ 127 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 8: 128 ~ 143 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 9: 144 ~ 159 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* a: 160 ~ 175 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* b: 176 ~ 191 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* c: 192 ~ 207 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* d: 208 ~ 223 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* e: 224 ~ 239 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* f: 240 ~ 255 */
+};
+#endif
 
 /*
  *  END OF FILE